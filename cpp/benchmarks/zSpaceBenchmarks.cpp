@@ -0,0 +1,875 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+// Benchmark suite of the zSpace libraries, with a command line and JSON output in the format of Google Benchmark,
+// so the results can be compared with its tools.
+//
+//	zSpace_Benchmarks [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>] [--benchmark_repetitions=<n>]
+//	                  [--benchmark_format=<console|json>] [--benchmark_out=<file>] [--benchmark_sizes=<n,n,..>]
+//
+// Each benchmark runs on synthetic inputs of each size, which is the grid resolution of the input mesh or field.
+// The largest size of the spectral benchmarks, 316, gives a triangle mesh of about 100k vertices. The largest field size, 4096,
+// gives about 16.8M field values and needs more than 8 GB of memory, so it can be skipped with --benchmark_sizes.
+
+#include<headers/zInterface/functionsets/zFnMesh.h>
+#include<headers/zInterface/functionsets/zFnMeshField.h>
+#include<headers/zToolsets/pathNetworks/zTsShortestPath.h>
+#include<headers/zToolsets/statics/zTsVault.h>
+#include<headers/zToolsets/geometry/zTsSpectral.h>
+
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+#ifdef _WIN32
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define fdopen _fdopen
+#define ZSPACE_NULL_DEVICE "NUL"
+#else
+#include <unistd.h>
+#define ZSPACE_NULL_DEVICE "/dev/null"
+#endif
+
+using namespace zSpace;
+
+namespace zBenchmarks
+{
+	//--------------------------
+	//---- HARNESS
+	//--------------------------
+
+	/*! \class zBenchmarkState
+	*	\brief The state of a benchmark run. Only the iterations of the keepRunning loop are timed, so the setup before it is not measured.
+	*/
+	class zBenchmarkState
+	{
+	public:
+		/*!	\brief size of the synthetic inputs.	*/
+		int size;
+
+		/*!	\brief number of iterations to run.	*/
+		long long maxIterations;
+
+		/*!	\brief number of iterations done.	*/
+		long long iterations;
+
+		/*!	\brief measured wall and processor time in seconds.	*/
+		double realTime, cpuTime;
+
+		/*!	\brief number of items processed per iteration, reported as a rate if set.	*/
+		long long itemsPerIteration;
+
+		/*!	\brief error message, empty if the run succeeded.	*/
+		string error;
+
+		zBenchmarkState(int _size, long long _maxIterations)
+		{
+			size = _size;
+			maxIterations = _maxIterations;
+			iterations = 0;
+			realTime = cpuTime = 0;
+			itemsPerIteration = 0;
+			running = false;
+		}
+
+		bool keepRunning()
+		{
+			if (!running)
+			{
+				running = true;
+				resumeTiming();
+			}
+			else iterations++;
+
+			if (iterations < maxIterations) return true;
+
+			pauseTiming();
+			running = false;
+			return false;
+		}
+
+		void pauseTiming()
+		{
+			realTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+			cpuTime += double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+		}
+
+		void resumeTiming()
+		{
+			realStart = std::chrono::steady_clock::now();
+			cpuStart = std::clock();
+		}
+
+	protected:
+		bool running;
+		std::chrono::steady_clock::time_point realStart;
+		std::clock_t cpuStart;
+	};
+
+	/*! \struct zBenchmark
+	*	\brief A registered benchmark, run once per size.
+	*/
+	struct zBenchmark
+	{
+		string name;
+		std::function<void(zBenchmarkState&)> function;
+		zIntArray sizes;
+	};
+
+	/*! \struct zBenchmarkResult
+	*	\brief The result of a benchmark run.
+	*/
+	struct zBenchmarkResult
+	{
+		string name;
+		long long iterations;
+		double realTime, cpuTime, itemsPerSecond;
+		string error;
+	};
+
+	vector<zBenchmark>& registry()
+	{
+		static vector<zBenchmark> benchmarks;
+		return benchmarks;
+	}
+
+	void registerBenchmark(string name, std::function<void(zBenchmarkState&)> function, zIntArray sizes)
+	{
+		registry().push_back({ name, function, sizes });
+	}
+
+	zBenchmarkResult runBenchmark(zBenchmark &b, int size, double minTime)
+	{
+		zBenchmarkResult result;
+		result.name = b.name + "/" + to_string(size);
+		result.itemsPerSecond = 0;
+
+		// grow the iteration count until the run takes the minimum time, as Google Benchmark does
+		long long n = 1;
+		while (true)
+		{
+			zBenchmarkState state(size, n);
+
+			try
+			{
+				b.function(state);
+			}
+			catch (std::exception &e)
+			{
+				state.error = e.what();
+			}
+
+			if (!state.error.empty() || state.realTime >= minTime || n >= 1000000000LL)
+			{
+				result.iterations = state.iterations;
+				result.realTime = (state.iterations > 0) ? state.realTime / state.iterations : 0;
+				result.cpuTime = (state.iterations > 0) ? state.cpuTime / state.iterations : 0;
+				if (state.itemsPerIteration > 0 && state.realTime > 0) result.itemsPerSecond = state.itemsPerIteration * state.iterations / state.realTime;
+				result.error = state.error;
+				return result;
+			}
+
+			double multiplier = (state.realTime > 0) ? 1.4 * minTime / state.realTime : 10.0;
+			multiplier = std::min(10.0, std::max(2.0, multiplier));
+			n = (long long)(n * multiplier);
+		}
+	}
+
+	string jsonEscape(const string &s)
+	{
+		string out;
+		for (char c : s)
+		{
+			if (c == '"' || c == '\\') out += '\\';
+			if (c == '\n') { out += "\\n"; continue; }
+			out += c;
+		}
+		return out;
+	}
+
+	void writeJSON(std::ostream &out, vector<zBenchmarkResult> &results)
+	{
+		std::time_t now = std::time(nullptr);
+		char date[64];
+		std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+		out << "{\n";
+		out << "  \"context\": {\n";
+		out << "    \"date\": \"" << date << "\",\n";
+		out << "    \"executable\": \"zSpace_Benchmarks\",\n";
+		out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+		out << "    \"num_threads\": " << zThreadPool::getGlobal().numThreads() << ",\n";
+#ifdef NDEBUG
+		out << "    \"library_build_type\": \"release\"\n";
+#else
+		out << "    \"library_build_type\": \"debug\"\n";
+#endif
+		out << "  },\n";
+		out << "  \"benchmarks\": [";
+
+		for (int i = 0; i < results.size(); i++)
+		{
+			zBenchmarkResult &r = results[i];
+
+			out << ((i == 0) ? "\n" : ",\n") << "    {\n";
+			out << "      \"name\": \"" << jsonEscape(r.name) << "\",\n";
+			out << "      \"run_name\": \"" << jsonEscape(r.name) << "\",\n";
+			out << "      \"run_type\": \"iteration\",\n";
+			if (!r.error.empty())
+			{
+				out << "      \"error_occurred\": true,\n";
+				out << "      \"error_message\": \"" << jsonEscape(r.error) << "\",\n";
+			}
+			if (r.itemsPerSecond > 0) out << "      \"items_per_second\": " << r.itemsPerSecond << ",\n";
+			out << "      \"iterations\": " << r.iterations << ",\n";
+			out << "      \"real_time\": " << r.realTime * 1e9 << ",\n";
+			out << "      \"cpu_time\": " << r.cpuTime * 1e9 << ",\n";
+			out << "      \"time_unit\": \"ns\"\n";
+			out << "    }";
+		}
+
+		out << "\n  ]\n}\n";
+	}
+
+	void writeConsole(FILE *report, zBenchmarkResult &r)
+	{
+		if (!r.error.empty())
+		{
+			fprintf(report, "%-48s ERROR: %s\n", r.name.c_str(), r.error.c_str());
+			return;
+		}
+
+		fprintf(report, "%-48s %14.0f ns %14.0f ns %10lld", r.name.c_str(), r.realTime * 1e9, r.cpuTime * 1e9, r.iterations);
+		if (r.itemsPerSecond > 0) fprintf(report, "  items/s=%.4g", r.itemsPerSecond);
+		fprintf(report, "\n");
+		fflush(report);
+	}
+
+	/*! \brief This method redirects the standard output to the null device, so the messages the library prints don't mix with the report. It returns the stream of the original standard output. */
+	FILE* redirectLibraryOutput()
+	{
+		fflush(stdout);
+
+		int reportFd = dup(1);
+		FILE *report = (reportFd >= 0) ? fdopen(reportFd, "w") : nullptr;
+		if (!report) return stdout;
+
+		FILE *nullDevice = fopen(ZSPACE_NULL_DEVICE, "w");
+		if (nullDevice)
+		{
+			dup2(fileno(nullDevice), 1);
+			fclose(nullDevice);
+		}
+
+		return report;
+	}
+
+	//--------------------------
+	//---- SYNTHETIC INPUTS
+	//--------------------------
+
+	/*! \brief This method creates a quad grid mesh of n x n faces, with a height variation so the faces are not planar. */
+	void makeGridMesh(int n, zPointArray &positions, zIntArray &polyCounts, zIntArray &polyConnects)
+	{
+		positions.clear();
+		polyCounts.clear();
+		polyConnects.clear();
+
+		for (int j = 0; j <= n; j++)
+		{
+			for (int i = 0; i <= n; i++)
+			{
+				float x = (float)i / n;
+				float y = (float)j / n;
+				positions.push_back(zPoint(x * 10, y * 10, 0.5 * sin(x * 6.0) * cos(y * 4.0)));
+			}
+		}
+
+		for (int j = 0; j < n; j++)
+		{
+			for (int i = 0; i < n; i++)
+			{
+				int v = j * (n + 1) + i;
+				polyConnects.push_back(v);
+				polyConnects.push_back(v + 1);
+				polyConnects.push_back(v + n + 2);
+				polyConnects.push_back(v + n + 1);
+				polyCounts.push_back(4);
+			}
+		}
+	}
+
+	void makeGridMesh(int n, zObjMesh &meshObj)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+		makeGridMesh(n, positions, polyCounts, polyConnects);
+
+		zFnMesh fnMesh(meshObj);
+		fnMesh.create(positions, polyCounts, polyConnects);
+	}
+
+	/*! \brief This method creates the grid mesh of n x n faces with each quad split into two triangles. */
+	void makeTriangleGridMesh(int n, zObjMesh &meshObj)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+		makeGridMesh(n, positions, polyCounts, polyConnects);
+
+		zIntArray triCounts, triConnects;
+		for (int i = 0; i < polyCounts.size(); i++)
+		{
+			int *quad = &polyConnects[i * 4];
+
+			triCounts.push_back(3);
+			triConnects.insert(triConnects.end(), { quad[0], quad[1], quad[2] });
+
+			triCounts.push_back(3);
+			triConnects.insert(triConnects.end(), { quad[0], quad[2], quad[3] });
+		}
+
+		zFnMesh fnMesh(meshObj);
+		fnMesh.create(positions, triCounts, triConnects);
+	}
+
+	/*! \brief This method creates a scalar field of n x n cells over the domain of the grid mesh. */
+	void makeField(int n, zObjMeshScalarField &fieldObj)
+	{
+		zFnMeshScalarField fnField(fieldObj);
+		fnField.create(zPoint(-1, -1, 0), zPoint(11, 11, 0), n, n, 1, true, false);
+	}
+
+	/*! \brief This method creates points on a circle, the sources of the field benchmarks. */
+	void makeSources(int numPoints, zPointArray &points)
+	{
+		points.clear();
+		for (int i = 0; i < numPoints; i++)
+		{
+			double a = TWO_PI * i / numPoints;
+			points.push_back(zPoint(5 + 4 * cos(a), 5 + 4 * sin(a), 0));
+		}
+	}
+
+	/*! \brief This method creates a closed polyline graph on the circle of the sources, the source of the edge distance benchmark. */
+	void makeSourceGraph(int numPoints, zObjGraph &graphObj)
+	{
+		zPointArray points;
+		makeSources(numPoints, points);
+
+		zIntArray edgeConnects;
+		for (int i = 0; i < numPoints; i++)
+		{
+			edgeConnects.push_back(i);
+			edgeConnects.push_back((i + 1) % numPoints);
+		}
+
+		zFnGraph fnGraph(graphObj);
+		fnGraph.create(points, edgeConnects);
+	}
+
+	string tempPath(string fileName)
+	{
+		return (std::filesystem::temp_directory_path() / fileName).string();
+	}
+
+	//--------------------------
+	//---- BENCHMARKS
+	//--------------------------
+
+	void BM_MeshCreate(zBenchmarkState &state)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+		makeGridMesh(state.size, positions, polyCounts, polyConnects);
+
+		while (state.keepRunning())
+		{
+			zObjMesh meshObj;
+			zFnMesh fnMesh(meshObj);
+			fnMesh.create(positions, polyCounts, polyConnects);
+		}
+
+		state.itemsPerIteration = polyCounts.size();
+	}
+
+	void BM_MeshCreateStringHashMap(zBenchmarkState &state)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+		makeGridMesh(state.size, positions, polyCounts, polyConnects);
+
+		// the string keyed maps used before zIntegerHashMap, for comparison with BM_MeshCreate
+		while (state.keepRunning())
+		{
+			zObjMesh meshObj;
+			meshObj.mesh.setHashMapType(zStringHashMap);
+
+			zFnMesh fnMesh(meshObj);
+			fnMesh.create(positions, polyCounts, polyConnects);
+		}
+
+		state.itemsPerIteration = polyCounts.size();
+	}
+
+	void BM_MeshDual(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+		zFnMesh fnMesh(meshObj);
+
+		while (state.keepRunning())
+		{
+			zObjMesh dualObj;
+			zIntArray inEdge_dualEdge, dualEdge_inEdge;
+			fnMesh.getDualMesh(dualObj, inEdge_dualEdge, dualEdge_inEdge, true);
+		}
+
+		state.itemsPerIteration = fnMesh.numPolygons();
+	}
+
+	void BM_MeshTriangulate(zBenchmarkState &state)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+		makeGridMesh(state.size, positions, polyCounts, polyConnects);
+
+		while (state.keepRunning())
+		{
+			state.pauseTiming();
+			zObjMesh meshObj;
+			zFnMesh fnMesh(meshObj);
+			fnMesh.create(positions, polyCounts, polyConnects);
+			state.resumeTiming();
+
+			fnMesh.triangulate();
+		}
+
+		state.itemsPerIteration = polyCounts.size();
+	}
+
+	void BM_FieldIsoContour(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zPointArray sources;
+		makeSources(16, sources);
+
+		zScalarArray scalars;
+		fnField.getScalarsAsVertexDistance(scalars, sources, 0.5, true);
+		fnField.setFieldValues(scalars);
+
+		while (state.keepRunning())
+		{
+			zObjMesh contourObj;
+			fnField.getIsolineMesh(contourObj, 0.5);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_MeshIsoContour(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+		zFnMesh fnMesh(meshObj);
+
+		// signed distance to a circle in the middle of the grid
+		zScalarArray vertexScalars;
+		zPoint centre(5, 5, 0);
+		zPoint *positions = fnMesh.getRawVertexPositions();
+
+		for (int i = 0; i < fnMesh.numVertices(); i++)
+		{
+			zPoint p(positions[i].x, positions[i].y, 0);
+			vertexScalars.push_back(p.distanceTo(centre) - 3.0);
+		}
+
+		while (state.keepRunning())
+		{
+			zPointArray contourPositions;
+			zIntArray edgeConnects;
+			zColorArray contourColors;
+			fnMesh.getIsoContour(vertexScalars, 0.0, contourPositions, edgeConnects, contourColors);
+		}
+
+		state.itemsPerIteration = fnMesh.numPolygons();
+	}
+
+	void BM_FieldIDW(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zPointArray sources;
+		makeSources(64, sources);
+
+		while (state.keepRunning())
+		{
+			zScalarArray fieldValues;
+			fnField.getFieldValuesAsVertexDistance_IDW(fieldValues, sources, 1.0f, 1.0, 2.0, true);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_FieldIDWRadius(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zPointArray sources;
+		makeSources(64, sources);
+
+		// only the sources within the radius contribute, so most field values see a few of them
+		while (state.keepRunning())
+		{
+			zScalarArray fieldValues;
+			fnField.getFieldValuesAsVertexDistance_IDW(fieldValues, sources, 1.0f, 1.0, 2.0, true, 1.5);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_FieldVertexDistance(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zPointArray sources;
+		makeSources(16, sources);
+
+		while (state.keepRunning())
+		{
+			zScalarArray scalars;
+			fnField.getScalarsAsVertexDistance(scalars, sources, 0.5, true);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_FieldEdgeDistance(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zObjGraph graphObj;
+		makeSourceGraph(16, graphObj);
+
+		while (state.keepRunning())
+		{
+			zScalarArray scalars;
+			fnField.getScalarsAsEdgeDistance(scalars, graphObj, 0.5, true);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_FieldSmooth(zBenchmarkState &state)
+	{
+		zObjMeshScalarField fieldObj;
+		makeField(state.size, fieldObj);
+		zFnMeshScalarField fnField(fieldObj);
+
+		zPointArray sources;
+		makeSources(16, sources);
+
+		zScalarArray scalars;
+		fnField.getScalarsAsVertexDistance(scalars, sources, 0.5, true);
+
+		while (state.keepRunning())
+		{
+			zScalarArray smoothed = scalars;
+			fnField.smoothField(smoothed, 10);
+		}
+
+		state.itemsPerIteration = fnField.numFieldValues();
+	}
+
+	void BM_ShortestDistance(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+
+		zTsMeshShortestPath shortestPath(meshObj);
+
+		while (state.keepRunning())
+		{
+			zFloatArray dist;
+			zIntArray parent;
+			shortestPath.shortestDistance(0, dist, parent);
+		}
+
+		state.itemsPerIteration = zFnMesh(meshObj).numVertices();
+	}
+
+	void BM_VaultFDM(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+
+		zTsMeshVault vault(meshObj);
+		vault.setConstraints(zResultDiagram);
+		vault.setForceDensity(1.0);
+		vault.setVertexMass(1.0);
+		vault.setVertexThickness(0.1);
+		vault.setVertexWeights(zResultDiagram);
+
+		while (state.keepRunning())
+		{
+			if (!vault.forceDensityMethod()) throw std::runtime_error("forceDensityMethod failed.");
+		}
+
+		state.itemsPerIteration = zFnMesh(meshObj).numVertices();
+	}
+
+	void BM_SpectralEigen(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeTriangleGridMesh(state.size, meshObj);
+
+		while (state.keepRunning())
+		{
+			zTsSpectral spectral(meshObj);
+			if (!spectral.computeEigenPairs(16)) throw std::runtime_error("computeEigenPairs failed.");
+		}
+
+		state.itemsPerIteration = zFnMesh(meshObj).numVertices();
+	}
+
+	void BM_SpectralEigenFunction(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeTriangleGridMesh(state.size, meshObj);
+
+		zTsSpectral spectral(meshObj);
+		spectral.setNumEigens(16);
+
+		double frequency = 0;
+		bool computeEigenVectors = true;
+		spectral.computeEigenFunction(frequency, computeEigenVectors);
+
+		// frequency animation and varying number of eigens on the cached eigen pairs
+		while (state.keepRunning())
+		{
+			frequency += 1;
+			spectral.setNumEigens(8 + (int)frequency % 9);
+
+			computeEigenVectors = true;
+			spectral.computeEigenFunction(frequency, computeEigenVectors);
+		}
+
+		state.itemsPerIteration = zFnMesh(meshObj).numVertices();
+	}
+
+	void BM_MeshWriteOBJ(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+		zFnMesh fnMesh(meshObj);
+
+		string path = tempPath("zSpace_benchmark.obj");
+
+		while (state.keepRunning()) fnMesh.to(path, zOBJ);
+
+		std::remove(path.c_str());
+		state.itemsPerIteration = fnMesh.numPolygons();
+	}
+
+	void BM_MeshReadOBJ(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+
+		string path = tempPath("zSpace_benchmark_read.obj");
+		zFnMesh(meshObj).to(path, zOBJ);
+
+		while (state.keepRunning())
+		{
+			zObjMesh readObj;
+			zFnMesh fnRead(readObj);
+			fnRead.from(path, zOBJ);
+		}
+
+		std::remove(path.c_str());
+		state.itemsPerIteration = zFnMesh(meshObj).numPolygons();
+	}
+
+	void BM_MeshWriteJSON(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+		zFnMesh fnMesh(meshObj);
+
+		string path = tempPath("zSpace_benchmark.json");
+
+		while (state.keepRunning()) fnMesh.to(path, zJSON);
+
+		std::remove(path.c_str());
+		state.itemsPerIteration = fnMesh.numPolygons();
+	}
+
+	void BM_MeshReadJSON(zBenchmarkState &state)
+	{
+		zObjMesh meshObj;
+		makeGridMesh(state.size, meshObj);
+
+		string path = tempPath("zSpace_benchmark_read.json");
+		zFnMesh(meshObj).to(path, zJSON);
+
+		while (state.keepRunning())
+		{
+			zObjMesh readObj;
+			zFnMesh fnRead(readObj);
+			fnRead.from(path, zJSON);
+		}
+
+		std::remove(path.c_str());
+		state.itemsPerIteration = zFnMesh(meshObj).numPolygons();
+	}
+
+	void registerAll()
+	{
+		zIntArray meshSizes = { 32, 128, 256 };
+		zIntArray fieldSizes = { 64, 256, 512, 1024, 4096 };
+		zIntArray solverSizes = { 16, 64, 128 };
+		zIntArray triangulateSizes = { 8, 16, 32 };
+		zIntArray spectralSizes = { 32, 128, 316 };
+
+		registerBenchmark("BM_MeshCreate", BM_MeshCreate, meshSizes);
+		registerBenchmark("BM_MeshCreateStringHashMap", BM_MeshCreateStringHashMap, meshSizes);
+		registerBenchmark("BM_MeshDual", BM_MeshDual, meshSizes);
+		registerBenchmark("BM_MeshTriangulate", BM_MeshTriangulate, triangulateSizes);
+		registerBenchmark("BM_MeshIsoContour", BM_MeshIsoContour, meshSizes);
+		registerBenchmark("BM_FieldIsoContour", BM_FieldIsoContour, fieldSizes);
+		registerBenchmark("BM_FieldIDW", BM_FieldIDW, fieldSizes);
+		registerBenchmark("BM_FieldIDWRadius", BM_FieldIDWRadius, fieldSizes);
+		registerBenchmark("BM_FieldVertexDistance", BM_FieldVertexDistance, fieldSizes);
+		registerBenchmark("BM_FieldEdgeDistance", BM_FieldEdgeDistance, fieldSizes);
+		registerBenchmark("BM_FieldSmooth", BM_FieldSmooth, fieldSizes);
+		registerBenchmark("BM_ShortestDistance", BM_ShortestDistance, meshSizes);
+		registerBenchmark("BM_VaultFDM", BM_VaultFDM, solverSizes);
+		registerBenchmark("BM_SpectralEigen", BM_SpectralEigen, spectralSizes);
+		registerBenchmark("BM_SpectralEigenFunction", BM_SpectralEigenFunction, spectralSizes);
+		registerBenchmark("BM_MeshWriteOBJ", BM_MeshWriteOBJ, meshSizes);
+		registerBenchmark("BM_MeshReadOBJ", BM_MeshReadOBJ, meshSizes);
+		registerBenchmark("BM_MeshWriteJSON", BM_MeshWriteJSON, meshSizes);
+		registerBenchmark("BM_MeshReadJSON", BM_MeshReadJSON, meshSizes);
+	}
+}
+
+using namespace zBenchmarks;
+
+int main(int argc, char** argv)
+{
+	string filter = ".*";
+	string format = "console";
+	string outPath;
+	double minTime = 0.5;
+	int repetitions = 1;
+	zIntArray sizes;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		auto value = [&arg](string flag) { return arg.substr(flag.size()); };
+
+		if (arg.rfind("--benchmark_filter=", 0) == 0) filter = value("--benchmark_filter=");
+		else if (arg.rfind("--benchmark_format=", 0) == 0) format = value("--benchmark_format=");
+		else if (arg.rfind("--benchmark_out=", 0) == 0) outPath = value("--benchmark_out=");
+		else if (arg.rfind("--benchmark_min_time=", 0) == 0) minTime = atof(value("--benchmark_min_time=").c_str());
+		else if (arg.rfind("--benchmark_repetitions=", 0) == 0) repetitions = std::max(1, atoi(value("--benchmark_repetitions=").c_str()));
+		else if (arg.rfind("--benchmark_sizes=", 0) == 0)
+		{
+			std::stringstream ss(value("--benchmark_sizes="));
+			string token;
+			while (getline(ss, token, ',')) if (atoi(token.c_str()) > 0) sizes.push_back(atoi(token.c_str()));
+		}
+		else if (arg.rfind("--benchmark_out_format=", 0) == 0) {}
+		else
+		{
+			printf("usage: %s [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>] [--benchmark_repetitions=<n>] [--benchmark_format=<console|json>] [--benchmark_out=<file>] [--benchmark_sizes=<n,n,..>]\n", argv[0]);
+			return (arg == "--help") ? 0 : 1;
+		}
+	}
+
+	if (format != "console" && format != "json")
+	{
+		printf("error: unknown benchmark format %s\n", format.c_str());
+		return 1;
+	}
+
+	registerAll();
+
+	std::regex pattern(filter);
+	bool console = (format == "console");
+
+	FILE *report = redirectLibraryOutput();
+
+	if (console) fprintf(report, "%-48s %17s %17s %10s\n", "Benchmark", "Time", "CPU", "Iterations");
+
+	vector<zBenchmarkResult> results;
+	for (auto &b : registry())
+	{
+		zIntArray &bSizes = (sizes.size() > 0) ? sizes : b.sizes;
+
+		for (int size : bSizes)
+		{
+			string name = b.name + "/" + to_string(size);
+			if (!std::regex_search(name, pattern)) continue;
+
+			for (int r = 0; r < repetitions; r++)
+			{
+				results.push_back(runBenchmark(b, size, minTime));
+				if (console) writeConsole(report, results.back());
+			}
+		}
+	}
+
+	if (!console)
+	{
+		std::stringstream json;
+		writeJSON(json, results);
+		fputs(json.str().c_str(), report);
+	}
+
+	fflush(report);
+
+	if (outPath.size() > 0)
+	{
+		std::ofstream out(outPath);
+		if (out.fail())
+		{
+			fprintf(stderr, "error: unable to open %s\n", outPath.c_str());
+			return 1;
+		}
+
+		writeJSON(out, results);
+	}
+
+	bool failed = false;
+	for (auto &r : results) if (!r.error.empty()) failed = true;
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,315 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms,
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE
+//
+// This Source Code Form is subject to the terms of the MIT License
+// If a copy of the MIT License was not distributed with this file, You can
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+// Round trip check of the JSON and zBIN formats of meshes and graphs.
+//
+//	zSpace_BinaryRoundTrip [--mesh=<file.json>] [--graph=<file.json>] [--size=<n>]
+//
+// Each input is read from JSON, written to zBIN and read back, then written to JSON from the zBIN copy and read back again.
+// The connectivity and the attributes of both copies are compared with the original. Without inputs a synthetic grid mesh
+// and graph of n x n cells are used. The exit code is the number of failed checks.
+
+#include<headers/zInterface/functionsets/zFnMesh.h>
+#include<headers/zInterface/functionsets/zFnGraph.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+using namespace zSpace;
+
+namespace zRoundTrip
+{
+	/*!	\brief tolerance of the attribute comparisons, as JSON stores the values as text.	*/
+	const double tolerance = 1e-5;
+
+	string tempPath(string fileName)
+	{
+		return (std::filesystem::temp_directory_path() / fileName).string();
+	}
+
+	bool equal(float a, float b) { return fabs(a - b) <= tolerance; }
+	bool equal(double a, double b) { return fabs(a - b) <= tolerance; }
+	bool equal(zVector &a, zVector &b) { return equal(a.x, b.x) && equal(a.y, b.y) && equal(a.z, b.z); }
+	bool equal(zColor &a, zColor &b) { return equal(a.r, b.r) && equal(a.g, b.g) && equal(a.b, b.b) && equal(a.a, b.a); }
+
+	/*! \brief This method compares two attribute containers and prints the first mismatch. */
+	template<typename T>
+	bool compareArray(vector<T> &a, vector<T> &b, string name)
+	{
+		if (a.size() != b.size())
+		{
+			printf("\n   %s : size %zu != %zu", name.c_str(), a.size(), b.size());
+			return false;
+		}
+
+		for (size_t i = 0; i < a.size(); i++)
+		{
+			if (!equal(a[i], b[i]))
+			{
+				printf("\n   %s : mismatch at %zu", name.c_str(), i);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int id(zHalfEdge *he) { return (he) ? he->getId() : -1; }
+	int id(zVertex *v) { return (v) ? v->getId() : -1; }
+	int id(zFace *f) { return (f) ? f->getId() : -1; }
+
+	/*! \brief This method compares the half edge connectivity and the attributes shared by graphs and meshes. */
+	bool compareGraph(zGraph &a, zGraph &b, bool faces)
+	{
+		if (a.vertices.size() != b.vertices.size() || a.halfEdges.size() != b.halfEdges.size() || a.edges.size() != b.edges.size())
+		{
+			printf("\n   element counts differ");
+			return false;
+		}
+
+		for (size_t i = 0; i < a.halfEdges.size(); i++)
+		{
+			zHalfEdge &heA = a.halfEdges[i];
+			zHalfEdge &heB = b.halfEdges[i];
+
+			bool same = id(heA.getNext()) == id(heB.getNext()) && id(heA.getPrev()) == id(heB.getPrev()) && id(heA.getSym()) == id(heB.getSym()) && id(heA.getVertex()) == id(heB.getVertex());
+			if (faces) same = same && id(heA.getFace()) == id(heB.getFace());
+
+			if (!same)
+			{
+				printf("\n   half edge connectivity mismatch at %zu", i);
+				return false;
+			}
+		}
+
+		for (size_t i = 0; i < a.vertices.size(); i++)
+		{
+			if (id(a.vertices[i].getHalfEdge()) != id(b.vertices[i].getHalfEdge()))
+			{
+				printf("\n   vertex connectivity mismatch at %zu", i);
+				return false;
+			}
+		}
+
+		bool out = true;
+		out = compareArray(a.vertexPositions, b.vertexPositions, "vertex positions") && out;
+		out = compareArray(a.vertexColors, b.vertexColors, "vertex colors") && out;
+		out = compareArray(a.vertexWeights, b.vertexWeights, "vertex weights") && out;
+		out = compareArray(a.edgeColors, b.edgeColors, "edge colors") && out;
+		out = compareArray(a.edgeWeights, b.edgeWeights, "edge weights") && out;
+		return out;
+	}
+
+	bool compareMesh(zObjMesh &a, zObjMesh &b)
+	{
+		if (a.mesh.faces.size() != b.mesh.faces.size())
+		{
+			printf("\n   face counts differ");
+			return false;
+		}
+
+		bool out = compareGraph(a.mesh, b.mesh, true);
+
+		for (size_t i = 0; i < a.mesh.faces.size(); i++)
+		{
+			if (id(a.mesh.faces[i].getHalfEdge()) != id(b.mesh.faces[i].getHalfEdge()))
+			{
+				printf("\n   face connectivity mismatch at %zu", i);
+				return false;
+			}
+		}
+
+		out = compareArray(a.mesh.vertexNormals, b.mesh.vertexNormals, "vertex normals") && out;
+		out = compareArray(a.mesh.faceNormals, b.mesh.faceNormals, "face normals") && out;
+		out = compareArray(a.mesh.faceColors, b.mesh.faceColors, "face colors") && out;
+		return out;
+	}
+
+	/*! \brief This method creates a grid mesh of n x n quads, with a wave so the normals vary. */
+	void makeGridMesh(int n, zObjMesh &meshObj)
+	{
+		zPointArray positions;
+		zIntArray polyCounts, polyConnects;
+
+		for (int j = 0; j <= n; j++)
+		{
+			for (int i = 0; i <= n; i++)
+			{
+				float x = (float)i / n;
+				float y = (float)j / n;
+				positions.push_back(zPoint(x * 10, y * 10, 0.5 * sin(x * 6.0) * cos(y * 4.0)));
+			}
+		}
+
+		for (int j = 0; j < n; j++)
+		{
+			for (int i = 0; i < n; i++)
+			{
+				int v0 = j * (n + 1) + i;
+				polyConnects.push_back(v0);
+				polyConnects.push_back(v0 + 1);
+				polyConnects.push_back(v0 + n + 2);
+				polyConnects.push_back(v0 + n + 1);
+				polyCounts.push_back(4);
+			}
+		}
+
+		zFnMesh fnMesh(meshObj);
+		fnMesh.create(positions, polyCounts, polyConnects);
+	}
+
+	/*! \brief This method creates a grid graph of n x n cells. */
+	void makeGridGraph(int n, zObjGraph &graphObj)
+	{
+		zPointArray positions;
+		zIntArray edgeConnects;
+
+		for (int j = 0; j <= n; j++)
+		{
+			for (int i = 0; i <= n; i++)
+			{
+				positions.push_back(zPoint(i, j, 0));
+
+				int v0 = j * (n + 1) + i;
+				if (i < n) { edgeConnects.push_back(v0); edgeConnects.push_back(v0 + 1); }
+				if (j < n) { edgeConnects.push_back(v0); edgeConnects.push_back(v0 + n + 1); }
+			}
+		}
+
+		zFnGraph fnGraph(graphObj);
+		fnGraph.create(positions, edgeConnects);
+	}
+
+	/*! \brief This method runs the JSON -> zBIN -> JSON round trip of a mesh and returns the number of failed checks. */
+	int roundTripMesh(string jsonPath)
+	{
+		int failed = 0;
+		string binPath = tempPath("zSpace_roundtrip_mesh.zbin");
+		string outPath = tempPath("zSpace_roundtrip_mesh.json");
+
+		zObjMesh original, fromBin, fromJson;
+		zFnMesh fnOriginal(original);
+		fnOriginal.from(jsonPath, zJSON);
+
+		fnOriginal.to(binPath, zBIN);
+		zFnMesh fnBin(fromBin);
+		fnBin.from(binPath, zBIN);
+
+		printf("\n mesh JSON -> zBIN : %d vertices, %d faces", fnBin.numVertices(), fnBin.numPolygons());
+		if (!compareMesh(original, fromBin)) { printf("\n   FAILED"); failed++; }
+		else printf("\n   OK");
+
+		fnBin.to(outPath, zJSON);
+		zFnMesh fnJson(fromJson);
+		fnJson.from(outPath, zJSON);
+
+		printf("\n mesh zBIN -> JSON : %d vertices, %d faces", fnJson.numVertices(), fnJson.numPolygons());
+		if (!compareMesh(original, fromJson)) { printf("\n   FAILED"); failed++; }
+		else printf("\n   OK");
+
+		std::remove(binPath.c_str());
+		std::remove(outPath.c_str());
+		return failed;
+	}
+
+	/*! \brief This method runs the JSON -> zBIN -> JSON round trip of a graph and returns the number of failed checks. */
+	int roundTripGraph(string jsonPath)
+	{
+		int failed = 0;
+		string binPath = tempPath("zSpace_roundtrip_graph.zbin");
+		string outPath = tempPath("zSpace_roundtrip_graph.json");
+
+		zObjGraph original, fromBin, fromJson;
+		zFnGraph fnOriginal(original);
+		fnOriginal.from(jsonPath, zJSON);
+
+		fnOriginal.to(binPath, zBIN);
+		zFnGraph fnBin(fromBin);
+		fnBin.from(binPath, zBIN);
+
+		printf("\n graph JSON -> zBIN : %d vertices, %d edges", fnBin.numVertices(), fnBin.numEdges());
+		if (!compareGraph(original.graph, fromBin.graph, false)) { printf("\n   FAILED"); failed++; }
+		else printf("\n   OK");
+
+		fnBin.to(outPath, zJSON);
+		zFnGraph fnJson(fromJson);
+		fnJson.from(outPath, zJSON);
+
+		printf("\n graph zBIN -> JSON : %d vertices, %d edges", fnJson.numVertices(), fnJson.numEdges());
+		if (!compareGraph(original.graph, fromJson.graph, false)) { printf("\n   FAILED"); failed++; }
+		else printf("\n   OK");
+
+		std::remove(binPath.c_str());
+		std::remove(outPath.c_str());
+		return failed;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace zRoundTrip;
+
+	string meshPath, graphPath;
+	int size = 64;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+
+		if (arg.rfind("--mesh=", 0) == 0) meshPath = arg.substr(7);
+		else if (arg.rfind("--graph=", 0) == 0) graphPath = arg.substr(8);
+		else if (arg.rfind("--size=", 0) == 0) size = atoi(arg.substr(7).c_str());
+		else
+		{
+			printf("\n usage: zSpace_BinaryRoundTrip [--mesh=<file.json>] [--graph=<file.json>] [--size=<n>] \n");
+			return -1;
+		}
+	}
+
+	bool synthetic = meshPath.empty() && graphPath.empty();
+	if (synthetic)
+	{
+		meshPath = tempPath("zSpace_roundtrip_input_mesh.json");
+		graphPath = tempPath("zSpace_roundtrip_input_graph.json");
+
+		zObjMesh meshObj;
+		makeGridMesh(size, meshObj);
+		zFnMesh(meshObj).to(meshPath, zJSON);
+
+		zObjGraph graphObj;
+		makeGridGraph(size, graphObj);
+		zFnGraph(graphObj).to(graphPath, zJSON);
+	}
+
+	int failed = 0;
+
+	try
+	{
+		if (!meshPath.empty()) failed += roundTripMesh(meshPath);
+		if (!graphPath.empty()) failed += roundTripGraph(graphPath);
+	}
+	catch (const std::exception &e)
+	{
+		printf("\n %s", e.what());
+		failed++;
+	}
+
+	if (synthetic)
+	{
+		std::remove(meshPath.c_str());
+		std::remove(graphPath.c_str());
+	}
+
+	printf("\n\n %s \n", (failed == 0) ? "round trip passed" : "round trip FAILED");
+	return failed;
+}
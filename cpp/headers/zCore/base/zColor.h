@@ -16,6 +16,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <cmath>
 
 #include<headers/zCore/base/zInline.h>
 #include<headers/zCore/base/zEnumerators.h>
@@ -17,6 +17,7 @@
 #include <stdexcept>
 #include <vector>
 #include <ostream>
+#include <cmath>
 #include <time.h> 
 using namespace std;
 
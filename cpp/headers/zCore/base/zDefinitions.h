@@ -177,6 +177,19 @@ namespace zSpace
 	#define GLIntSize sizeof(GLint)
 	#endif
 
+	//--------------------------
+	//---- SIMD DEFINITIONS
+	//--------------------------
+
+	/*!
+	*	\brief Defined if SSE2 intrinsics are available on the target.
+	*/
+	#if !defined(__CUDACC__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#ifndef ZSPACE_SSE2
+	#define ZSPACE_SSE2
+	#endif
+	#endif
+
 	/*! \typedef double3
 	*	\brief An array of int of size 2.
 	*
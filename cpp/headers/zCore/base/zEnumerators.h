@@ -110,10 +110,10 @@ namespace zSpace
 	enum zWalkType { zEdgePath = 120, zEdgeVisited};
 
 	/*! \enum	zFieldValueType
-	*	\brief	field value sampling types.
+	*	\brief	field value sampling types. zFieldNearest and zFieldLinear (bilinear in 2D, trilinear in 3D) are closed-form grid samplers.
 	*	\since	version 0.0.1
 	*/
-	enum zFieldValueType { zFieldIndex = 130, zFieldNeighbourWeighted, zFieldAdjacentWeighted, zFieldContainedWeighted};
+	enum zFieldValueType { zFieldIndex = 130, zFieldNeighbourWeighted, zFieldAdjacentWeighted, zFieldContainedWeighted, zFieldNearest, zFieldLinear};
 
 	/*! \enum	zFieldStreamType
 	*	\brief	field stream sampling types.
@@ -125,7 +125,7 @@ namespace zSpace
 	*	\brief	input and ouput file types.
 	*	\since	version 0.0.2
 	*/
-	enum zFileTpye { zJSON = 150, zOBJ, zTXT,zMAYATXT, zCSV, zBMP, zPNG, zJPEG, zMESH , zGRAPH};
+	enum zFileTpye { zJSON = 150, zOBJ, zTXT,zMAYATXT, zCSV, zBMP, zPNG, zJPEG, zMESH , zGRAPH, zBIN};
 
 	/*! \enum	zFnType
 	*	\brief	functionset types.
@@ -175,6 +175,24 @@ namespace zSpace
 	*/
   enum zConnectivityType { zVertexVertex = 250, zVertexEdge, zFaceVertex, zFaceEdge };
 
+	/*! \enum	zHashMapType
+	*	\brief	hash map types for vertex position and half edge lookups.
+	*	\since	version 0.0.4
+	*/
+	enum zHashMapType { zStringHashMap = 260, zIntegerHashMap };
+
+	/*! \enum	zMeshCacheType
+	*	\brief	cached mesh attribute types, as bit flags.
+	*	\since	version 0.0.4
+	*/
+	enum zMeshCacheType { zCacheNormals = 1, zCacheFaceAreas = 2, zCacheVertexAreas = 4, zCacheCurvatures = 8 };
+
+	/*! \enum	zKMeansInitType
+	*	\brief	initialisation types of the K-Means means.
+	*	\since	version 0.0.4
+	*/
+	enum zKMeansInitType { zKMeansRandom = 270, zKMeansPlusPlus };
+
 
 	/** @}*/
 
@@ -0,0 +1,251 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_ZHASHMAP_H
+#define ZSPACE_ZHASHMAP_H
+
+#pragma once
+
+#include<headers/zCore/base/zDefinitions.h>
+#include<headers/zCore/base/zVector.h>
+
+#include <vector>
+#include <cmath>
+using namespace std;
+
+namespace  zSpace
+{
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBase
+	*	\brief  The base classes, enumerators ,defintions of the library.
+	*  @{
+	*/
+
+	/*! \struct zPositionKey
+	*	\brief A struct to hold the quantized integer coordinates of a position, used as a hash key.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	struct ZSPACE_CORE zPositionKey
+	{
+		/*!	\brief stores the quantized coordinates. */
+		long long x, y, z;
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zPositionKey();
+
+		/*! \brief Overloaded constructor. The coordinates are rounded to the input precision factor, matching the rounding of the string hash keys.
+		*
+		*	\param		[in]	pos				- input position.
+		*	\param		[in]	precisionfactor	- input precision factor.
+		*	\since version 0.0.4
+		*/
+		zPositionKey(zVector &pos, int precisionfactor);
+
+		/*! \brief This operator checks for equality of two keys.
+		*
+		*	\param		[in]	other	- key to compare.
+		*	\return				bool	- true if all the coordinates are equal.
+		*	\since version 0.0.4
+		*/
+		bool operator==(const zPositionKey &other) const;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBase
+	*	\brief  The base classes, enumerators ,defintions of the library.
+	*  @{
+	*/
+
+	/*! \class zHashMap
+	*	\brief A open addressing hash map with linear probing, mapping integer keys to integer values.
+	*	\details Keys and values are stored in flat containers to avoid the per element allocations of the node based std::unordered_map.
+	*	\tparam				T			- Type to work with zPositionKey or unsigned long long.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	template <typename T>
+	class ZSPACE_CORE zHashMap
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of keys.	*/
+		vector<T> keys;
+
+		/*!	\brief container of values.	*/
+		vector<int> values;
+
+		/*!	\brief container of slot states - 0 empty, 1 occupied, 2 erased.	*/
+		vector<unsigned char> states;
+
+		/*!	\brief number of occupied slots.	*/
+		int n_active;
+
+		/*!	\brief number of occupied and erased slots.	*/
+		int n_used;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zHashMap();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*	\since version 0.0.4
+		*/
+		~zHashMap();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method reserves the map to hold the input number of elements without rehashing.
+		*
+		*	\param		[in]	numElements	- number of elements.
+		*	\since version 0.0.4
+		*/
+		void reserve(int numElements);
+
+		/*! \brief This method clears the map.
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		/*! \brief This method returns the number of elements in the map.
+		*
+		*	\return				int		- number of elements.
+		*	\since version 0.0.4
+		*/
+		int size();
+
+		/*! \brief This method adds the key value pair to the map. If the key exists its value is replaced.
+		*
+		*	\param		[in]	key		- input key.
+		*	\param		[in]	value	- input value.
+		*	\since version 0.0.4
+		*/
+		void insert(const T &key, int value);
+
+		/*! \brief This method removes the key from the map.
+		*
+		*	\param		[in]	key		- input key.
+		*	\since version 0.0.4
+		*/
+		void erase(const T &key);
+
+		/*! \brief This method detemines if the key exists in the map.
+		*
+		*	\param		[in]	key			- input key.
+		*	\param		[out]	outValue	- stores value if the key exists else it is -1.
+		*	\return				bool		- true if key exists else false.
+		*	\since version 0.0.4
+		*/
+		bool find(const T &key, int &outValue);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method computes the hash of the input key.
+		*
+		*	\param		[in]	key		- input key.
+		*	\return				size_t	- hash value.
+		*	\since version 0.0.4
+		*/
+		size_t hashKey(const T &key);
+
+		/*! \brief This method returns the slot holding the input key.
+		*
+		*	\param		[in]	key		- input key.
+		*	\return				int		- slot index if the key exists else -1.
+		*	\since version 0.0.4
+		*/
+		int findSlot(const T &key);
+
+		/*! \brief This method resizes the slot containers to the input capacity and reinserts the occupied slots.
+		*
+		*	\param		[in]	newCapacity	- new capacity, a power of 2.
+		*	\since version 0.0.4
+		*/
+		void rehash(int newCapacity);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBase
+	*	\brief  The base classes, enumerators ,defintions of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zHashMapTypedef
+	*	\brief  The hash map typedef of the library.
+	*  @{
+	*/
+
+	/*! \typedef zPositionHashMap
+	*	\brief A hash map of quantized positions to vertex indices.
+	*
+	*	\since version 0.0.4
+	*/
+	typedef zHashMap<zPositionKey> zPositionHashMap;
+
+	/*! \typedef zHalfEdgeHashMap
+	*	\brief A hash map of packed (v1,v2) vertex index pairs to half edge indices.
+	*
+	*	\since version 0.0.4
+	*/
+	typedef zHashMap<unsigned long long> zHalfEdgeHashMap;
+
+	/** @}*/
+	/** @}*/
+	/** @}*/
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/base/zHashMap.cpp>
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_ZTHREADPOOL_H
+#define ZSPACE_ZTHREADPOOL_H
+
+#pragma once
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zDefinitions.h>
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+using namespace std;
+
+namespace  zSpace
+{
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBase
+	*	\brief  The base classes, enumerators ,defintions of the library.
+	*  @{
+	*/
+
+	/*! \struct zTaskQueue
+	*	\brief A struct to hold the index range tasks of a worker of the thread pool.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	struct ZSPACE_CORE zTaskQueue
+	{
+		/*!	\brief mutex guarding the tasks.	*/
+		std::mutex lock;
+
+		/*!	\brief container of start and end(exclusive) index ranges.	*/
+		std::deque<std::pair<int, int>> tasks;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBase
+	*	\brief  The base classes, enumerators ,defintions of the library.
+	*  @{
+	*/
+
+	/*! \class zThreadPool
+	*	\brief A work stealing thread pool for data parallel loops over index ranges.
+	*	\details The range of a parallel loop is split in tasks, which are dealt in contiguous blocks to the worker queues. A worker takes tasks from the front of its queue and steals from the back of the other queues when it runs out.
+	*	The calling thread works as the first worker. Nested loops run serially on the calling worker. Kernels need to write to disjoint indicies, so the output doesn't depend on the schedule.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	class ZSPACE_CORE zThreadPool
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief number of threads including the calling thread.	*/
+		int nThreads;
+
+		/*!	\brief container of worker threads.	*/
+		vector<std::thread> workers;
+
+		/*!	\brief container of task queues, one per thread.	*/
+		vector<unique_ptr<zTaskQueue>> queues;
+
+		/*!	\brief pointer to the kernel of the current loop, nullptr if there is no loop running.	*/
+		std::function<void(int, int)> *job;
+
+		/*!	\brief id of the current loop.	*/
+		unsigned long long jobId;
+
+		/*!	\brief number of tasks of the current loop not yet completed.	*/
+		std::atomic<int> pendingTasks;
+
+		/*!	\brief number of workers working on the current loop.	*/
+		int activeWorkers;
+
+		/*!	\brief first exception thrown by a kernel of the current loop.	*/
+		std::exception_ptr jobException;
+
+		/*!	\brief boolean indicating if the workers need to exit.	*/
+		bool stop;
+
+		/*!	\brief mutex guarding the job attributes.	*/
+		std::mutex jobLock;
+
+		/*!	\brief mutex serializing loops started from different threads.	*/
+		std::mutex runLock;
+
+		/*!	\brief condition to wake the workers for a new loop.	*/
+		std::condition_variable jobStart;
+
+		/*!	\brief condition to signal the calling thread that the workers are done.	*/
+		std::condition_variable jobDone;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\param		[in]	_numThreads		- number of threads, hardware concurrency if 0.
+		*	\since version 0.0.4
+		*/
+		zThreadPool(int _numThreads = 0);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*	\since version 0.0.4
+		*/
+		~zThreadPool();
+
+		//--------------------------
+		//---- STATIC METHODS
+		//--------------------------
+
+		/*! \brief This method returns the global thread pool used by the library. The global thread count is set with setNumThreads on it.
+		*
+		*	\return				zThreadPool		- global thread pool.
+		*	\since version 0.0.4
+		*/
+		static zThreadPool& getGlobal();
+
+		//--------------------------
+		//---- GET SET METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of threads including the calling thread.
+		*
+		*	\return				int		- number of threads.
+		*	\since version 0.0.4
+		*/
+		int numThreads();
+
+		/*! \brief This method sets the number of threads including the calling thread, and restarts the workers.
+		*
+		*	\param		[in]	_numThreads		- number of threads, hardware concurrency if 0.
+		*	\since version 0.0.4
+		*/
+		void setNumThreads(int _numThreads);
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method evaluates the input kernel over the input index range in parallel.
+		*
+		*	\param		[in]	start		- start of the range.
+		*	\param		[in]	end			- end of the range(exclusive).
+		*	\param		[in]	kernel		- kernel evaluated for each task, with the start and end(exclusive) index of the task.
+		*	\param		[in]	grainSize	- number of indicies per task, computed from the range and number of threads if 0.
+		*	\since version 0.0.4
+		*/
+		void parallel_for(int start, int end, std::function<void(int, int)> kernel, int grainSize = 0);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method starts the worker threads.
+		*	\since version 0.0.4
+		*/
+		void startWorkers();
+
+		/*! \brief This method stops and joins the worker threads.
+		*	\since version 0.0.4
+		*/
+		void stopWorkers();
+
+		/*! \brief This method is the loop of a worker thread.
+		*
+		*	\param		[in]	workerId	- index of the worker queue.
+		*	\since version 0.0.4
+		*/
+		void workerLoop(int workerId);
+
+		/*! \brief This method runs the tasks of the input queue, and then steals from the other queues until all the queues are empty.
+		*
+		*	\param		[in]	queueId		- index of the worker queue.
+		*	\param		[in]	kernel		- kernel of the current loop.
+		*	\since version 0.0.4
+		*/
+		void runTasks(int queueId, std::function<void(int, int)> &kernel);
+
+		/*! \brief This method returns the flag indicating if the current thread is running a task.
+		*
+		*	\return				bool	- reference to the thread local flag.
+		*	\since version 0.0.4
+		*/
+		static bool& insideTask();
+	};
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/base/zThreadPool.cpp>
+#endif
+
+#endif
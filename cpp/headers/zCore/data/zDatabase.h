@@ -17,6 +17,10 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <functional>
+#include <memory>
 #include <algorithm>    // std::sort
 using namespace std;
 
@@ -39,6 +43,231 @@ namespace  zSpace
 	*  @{
 	*/		
 
+	/*! \struct zDatabaseCachedStatement
+	*	\brief A prepared statement of the zDatabase statement cache, shared with the cursor stepping it.
+	*	\since version 0.0.4
+	*/
+
+	/*! \class zDatabaseCursor
+	*	\brief A cursor class for stepping through the rows of a prepared SQL statement, with typed column accessors.
+	*	\details The cursor is obtained from zDatabase::query. Parameters are bound with 1 based indicies and columns are read with 0 based indicies.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zDatabaseCachedStatement
+	{
+		/*!	\brief prepared statement  */
+		sqlite3_stmt *stmt = nullptr;
+
+		/*!	\brief true while a cursor steps the statement  */
+		bool inUse = false;
+
+		/*!	\brief true while the statement is owned by the cache, else the cursor stepping it finalizes it  */
+		bool cached = true;
+	};
+
+	class ZSPACE_CORE zDatabaseCursor
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief prepared statement  */
+		sqlite3_stmt *stmt;
+
+		/*!	\brief entry of the statement in the statement cache, nullptr if the statement is owned by the cursor  */
+		std::shared_ptr<zDatabaseCachedStatement> cacheEntry;
+
+		/*!	\brief result code of the last step  */
+		int RC;
+
+	public:
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor();
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_stmt			- prepared statement.
+		*	\param		[in]	_cacheEntry		- statement cache entry, nullptr if the cursor owns the statement.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor(sqlite3_stmt *_stmt, std::shared_ptr<zDatabaseCachedStatement> _cacheEntry);
+
+		/*! \brief Move constructor.
+		*
+		*	\param		[in]	other			- cursor to move from.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor(zDatabaseCursor &&other);
+
+		zDatabaseCursor(const zDatabaseCursor &other) = delete;
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. A cached statement is reset and handed back to the cache, an owned statement or a statement removed from the cache is finalized.
+		*
+		*	\since version 0.0.4
+		*/
+		~zDatabaseCursor();
+
+		//--------------------------
+		//---- OPERATORS
+		//--------------------------
+
+		/*! \brief Move assignment operator.
+		*
+		*	\param		[in]	other			- cursor to move from.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor& operator=(zDatabaseCursor &&other);
+
+		zDatabaseCursor& operator=(const zDatabaseCursor &other) = delete;
+
+	private:
+
+		/*! \brief This method hands the statement back to the cache or finalizes it.
+		*
+		*	\since version 0.0.4
+		*/
+		void release();
+
+	public:
+
+		//--------------------------
+		//---- STEP METHODS
+		//--------------------------
+
+		/*! \brief This method steps to the next row of the result.
+		*
+		*	\return			bool			- true if a row is available, false if the statement is done or failed.
+		*	\since version 0.0.4
+		*/
+		bool step();
+
+		/*! \brief This method runs the statement to completion and resets it, keeping it ready for the next bound parameters.
+		*
+		*	\return			bool			- true if the statement ran successfully.
+		*	\since version 0.0.4
+		*/
+		bool execute();
+
+		/*! \brief This method resets the statement and clears the bound parameters.
+		*
+		*	\since version 0.0.4
+		*/
+		void reset();
+
+		/*! \brief This method returns the result code of the last step.
+		*
+		*	\return			int				- SQLite result code.
+		*	\since version 0.0.4
+		*/
+		int getResultCode();
+
+		//--------------------------
+		//---- BIND METHODS
+		//--------------------------
+
+		/*! \brief This method binds an integer value to the parameter at the input index.
+		*
+		*	\param		[in]	index			- 1 based parameter index.
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void bindInt64(int index, long long value);
+
+		/*! \brief This method binds a double value to the parameter at the input index.
+		*
+		*	\param		[in]	index			- 1 based parameter index.
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void bindDouble(int index, double value);
+
+		/*! \brief This method binds a text value to the parameter at the input index. The text is copied.
+		*
+		*	\param		[in]	index			- 1 based parameter index.
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void bindText(int index, std::string_view value);
+
+		/*! \brief This method binds NULL to the parameter at the input index.
+		*
+		*	\param		[in]	index			- 1 based parameter index.
+		*	\since version 0.0.4
+		*/
+		void bindNull(int index);
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of columns in the current row.
+		*
+		*	\return			int				- number of columns.
+		*	\since version 0.0.4
+		*/
+		int numColumns();
+
+		/*! \brief This method returns if the column value of the current row is NULL.
+		*
+		*	\param		[in]	column			- 0 based column index.
+		*	\return			bool			- true if the value is NULL.
+		*	\since version 0.0.4
+		*/
+		bool isNull(int column);
+
+		/*! \brief This method returns the column value of the current row as an integer.
+		*
+		*	\param		[in]	column			- 0 based column index.
+		*	\return			long long		- column value.
+		*	\since version 0.0.4
+		*/
+		long long getInt64(int column);
+
+		/*! \brief This method returns the column value of the current row as a double.
+		*
+		*	\param		[in]	column			- 0 based column index.
+		*	\return			double			- column value.
+		*	\since version 0.0.4
+		*/
+		double getDouble(int column);
+
+		/*! \brief This method returns the column value of the current row as text, without copying it.
+		*
+		*	\param		[in]	column			- 0 based column index.
+		*	\return			string_view		- column value, valid until the next step or reset of the cursor.
+		*	\since version 0.0.4
+		*/
+		std::string_view getText(int column);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zData
+	*	\brief The data classes and structs of the library.
+	*  @{
+	*/
+
 	/*! \class zDatabase
 	*	\brief A database class for accessing a SQL database using SQLite library.
 	*	\since version 0.0.1
@@ -58,6 +287,9 @@ namespace  zSpace
 		/*!	\brief SQL database  */
 		sqlite3 * database;
 
+		/*!	\brief cache of prepared statements, keyed by their SQL text  */
+		unordered_map<string, std::shared_ptr<zDatabaseCachedStatement>> statementCache;
+
 	public:
 
 		//--------------------------
@@ -77,6 +309,12 @@ namespace  zSpace
 		*/		
 		zDatabase(char* filename);
 
+		/*! \brief Deleted copy constructor, as a copy would share the connection and the cached statements of this database.
+		*
+		*	\since version 0.0.4
+		*/
+		zDatabase(const zDatabase &other) = delete;
+
 		//--------------------------
 		//---- DESTRUCTOR
 		//--------------------------
@@ -87,6 +325,12 @@ namespace  zSpace
 		*/	
 		~zDatabase();
 
+		//--------------------------
+		//---- OPERATORS
+		//--------------------------
+
+		zDatabase& operator=(const zDatabase &other) = delete;
+
 		//--------------------------
 		//---- DATABASE METHODS
 		//--------------------------
@@ -137,6 +381,65 @@ namespace  zSpace
 		*	\since version 0.0.1
 		*/		
 		void tableInsert(zStringArray &sqlStatment, string &tableName, zStringArray& columnNames, zStringArray &values);
+
+		/*! \brief This method inserts rows into an existing table in the database, inside a single transaction, using a cached prepared statement.
+		*
+		*	\param		[in]	tableName			- name of the table.
+		*	\param		[in]	columnNames			- column names of the table.
+		*	\param		[in]	numRows				- number of rows to be inserted.
+		*	\param		[in]	bindRow				- method binding the values of the input row index to the cursor parameters, one per column.
+		*	\return				bool				- true if all the rows are inserted. The transaction is rolled back otherwise.
+		*	\since version 0.0.4
+		*/
+		bool tableInsert(string &tableName, zStringArray &columnNames, int numRows, std::function<void(zDatabaseCursor&, int)> bindRow);
+
+		//--------------------------
+		//---- STATEMENT METHODS
+		//--------------------------
+
+		/*! \brief This method returns a cursor on the prepared statement of the input SQL. Statements are prepared once and cached, so it is cheap to query the same SQL with different bound parameters.
+		*	\details The cursors need to be destroyed before the database is closed.
+		*
+		*	\param		[in]	sql					- SQL statement, with ? for the parameters.
+		*	\return				zDatabaseCursor		- cursor on the statement.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor query(const string &sql);
+
+		/*! \brief This method finalizes all the cached prepared statements. Statements stepped by a cursor are removed from the cache and finalized by the cursor.
+		*
+		*	\since version 0.0.4
+		*/
+		void clearStatementCache();
+
+		/*! \brief This method checks if a table or view exists in the database.
+		*
+		*	\param		[in]	tableName			- name of the table.
+		*	\return				bool				- true if the table exists.
+		*	\since version 0.0.4
+		*/
+		bool tableExists(const string &tableName);
+
+		/*! \brief This method begins an explicit transaction.
+		*
+		*	\return				bool				- true if successful.
+		*	\since version 0.0.4
+		*/
+		bool beginTransaction();
+
+		/*! \brief This method commits the current transaction.
+		*
+		*	\return				bool				- true if successful.
+		*	\since version 0.0.4
+		*/
+		bool commitTransaction();
+
+		/*! \brief This method rolls back the current transaction.
+		*
+		*	\return				bool				- true if successful.
+		*	\since version 0.0.4
+		*/
+		bool rollbackTransaction();
 		
 	
 	};
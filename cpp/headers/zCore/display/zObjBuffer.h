@@ -18,11 +18,14 @@
 #define GL_GLEXT_PROTOTYPES
 
 
+// the buffer methods are loaded with GLEW on Windows, other platforms export them from the GL library
+#ifdef _WIN32
 #include <depends/openGL/glew.h>
 #include <depends/openGL/glext.h>
+#endif
 
-#include <GL/GL.h>			// Header File For The OpenGL32 Library
-#include <gl/glu.h>			// Header File For The GLu32 Library
+#include <GL/gl.h>			// Header File For The OpenGL32 Library
+#include <GL/glu.h>			// Header File For The GLu32 Library
 
 
 
@@ -91,6 +94,21 @@ namespace zSpace
 		/*!	\brief stores number of edge vertex connectivity indicies in the buffer  */
 		GLint nFaces;
 
+		/*!	\brief true if the buffer is stored in host memory instead of VBOs, for drawing with zUtilsRaster without an OPENGL context  */
+		bool headless;
+
+		/*!	\brief host copy of the vertex positions and normals, used if the buffer is headless  */
+		zFloatArray hostVertices;
+
+		/*!	\brief host copy of the vertex colors, used if the buffer is headless  */
+		zFloatArray hostColors;
+
+		/*!	\brief host copy of the edge vertex connectivity indicies, used if the buffer is headless  */
+		zIntArray hostEdgeIndices;
+
+		/*!	\brief host copy of the face vertex connectivity indicies, used if the buffer is headless  */
+		zIntArray hostFaceIndices;
+
 		
 
 		//--------------------------
@@ -106,9 +124,10 @@ namespace zSpace
 		/*! \brief Overloaded constructor.
 		*
 		*	\param		[in]	_Max_Num_Verts		- size of the buffer to be initialised.
+		*	\param		[in]	_headless			- true if the buffer is stored in host memory, which needs no OPENGL context.
 		*	\since version 0.0.1
 		*/
-		zObjBuffer(GLint _Max_Num_Verts);
+		zObjBuffer(GLint _Max_Num_Verts, bool _headless = false);
 
 		//--------------------------
 		//----  DESTRUCTOR
@@ -102,7 +102,7 @@ namespace zSpace
 			zParticleDerivative out;
 
 			out.dP = this->dP * val;
-			out.dP = this->dV * val;
+			out.dV = this->dV * val;
 
 			return out;
 
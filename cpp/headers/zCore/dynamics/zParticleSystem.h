@@ -0,0 +1,312 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_PARTICLE_SYSTEM_H
+#define ZSPACE_PARTICLE_SYSTEM_H
+
+#pragma once
+
+#include <headers/zCore/base/zInline.h>
+#include <headers/zCore/base/zTypeDef.h>
+#include <headers/zCore/base/zThreadPool.h>
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zDynamics
+	*	\brief The physics and dynamics classes of the library.
+	*  @{
+	*/
+
+	/*! \class zParticleSystem
+	*	\brief A particle system storing the particle attributes as contiguous arrays per component.
+	*	\details The positions are the ones of the bound container, for example the vertex positions of a mesh, so they are updated in place. Velocity, force, mass, derivatives and the free mask are stored per component, so the force and integration kernels run over contiguous arrays and are evaluated in parallel with the global zThreadPool.
+	*	The edge and face forces gather over compressed adjacency containers per particle, so each particle sums its own force and no locking is needed. The integration is the same as zFnParticle.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zParticleSystem
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief number of particles.	*/
+		int n;
+
+		/*!	\brief pointer to the bound container of positions.	*/
+		zPoint *positions;
+
+		/*!	\brief containers of the velocity components.	*/
+		zFloatArray vx, vy, vz;
+
+		/*!	\brief containers of the force components.	*/
+		zFloatArray fx, fy, fz;
+
+		/*!	\brief containers of the position derivative components.	*/
+		zFloatArray dPx, dPy, dPz;
+
+		/*!	\brief containers of the velocity derivative components.	*/
+		zFloatArray dVx, dVy, dVz;
+
+		/*!	\brief container of inverse masses.	*/
+		zFloatArray invMass;
+
+		/*!	\brief container of free masks - 1 if the particle is free, 0 if it is fixed.	*/
+		zFloatArray freeMask;
+
+		/*!	\brief container of offsets into the neighbour container, numParticles + 1.	*/
+		zIntArray neighbourOffsets;
+
+		/*!	\brief container of neighbour particle indicies per particle.	*/
+		zIntArray neighbours;
+
+		/*!	\brief container of offsets into the particle face container, numParticles + 1.	*/
+		zIntArray faceOffsets;
+
+		/*!	\brief container of face indicies per particle.	*/
+		zIntArray particleFaces;
+
+		/*!	\brief number of particles per task of the parallel loops.	*/
+		int grainSize;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zParticleSystem();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zParticleSystem();
+
+		//--------------------------
+		//---- CREATE METHODS
+		//--------------------------
+
+		/*! \brief This method creates the particles from the input positions, with unit mass and zero velocity and force.
+		*
+		*	\param		[in]	_positions		- input pointer to the positions, which are updated in place.
+		*	\param		[in]	numParticles	- number of positions.
+		*	\since version 0.0.4
+		*/
+		void create(zPoint *_positions, int numParticles);
+
+		/*! \brief This method sets the neighbours of each particle used by the edge force.
+		*
+		*	\param		[in]	_neighbourOffsets	- input container of offsets into the neighbour container, numParticles + 1.
+		*	\param		[in]	_neighbours			- input container of neighbour particle indicies.
+		*	\since version 0.0.4
+		*/
+		void setNeighbours(const zIntArray &_neighbourOffsets, const zIntArray &_neighbours);
+
+		/*! \brief This method sets the faces of each particle used by the planarity force.
+		*
+		*	\param		[in]	_faceOffsets		- input container of offsets into the face container, numParticles + 1.
+		*	\param		[in]	_particleFaces		- input container of face indicies.
+		*	\since version 0.0.4
+		*/
+		void setFaces(const zIntArray &_faceOffsets, const zIntArray &_particleFaces);
+
+		/*! \brief This method clears the particles.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- GET SET METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of particles.
+		*
+		*	\return				int		- number of particles.
+		*	\since version 0.0.4
+		*/
+		int numParticles();
+
+		/*! \brief This method sets the fixed state of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\param		[in]	fixed		- true if the particle is fixed.
+		*	\since version 0.0.4
+		*/
+		void setFixed(int index, bool fixed);
+
+		/*! \brief This method returns the fixed state of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\return				bool		- true if the particle is fixed.
+		*	\since version 0.0.4
+		*/
+		bool getFixed(int index);
+
+		/*! \brief This method sets the mass of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\param		[in]	mass		- input mass, which needs to be positive.
+		*	\since version 0.0.4
+		*/
+		void setMass(int index, double mass);
+
+		/*! \brief This method returns the mass of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\return				double		- mass.
+		*	\since version 0.0.4
+		*/
+		double getMass(int index);
+
+		/*! \brief This method sets the velocity of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\param		[in]	velocity	- input velocity.
+		*	\since version 0.0.4
+		*/
+		void setVelocity(int index, zVector &velocity);
+
+		/*! \brief This method returns the velocity of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\return				zVector		- velocity.
+		*	\since version 0.0.4
+		*/
+		zVector getVelocity(int index);
+
+		/*! \brief This method returns the force of the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\return				zVector		- force.
+		*	\since version 0.0.4
+		*/
+		zVector getForce(int index);
+
+		//--------------------------
+		//---- FORCE METHODS
+		//--------------------------
+
+		/*! \brief This method adds the input force to all the particles.
+		*
+		*	\param		[in]	force		- input force.
+		*	\since version 0.0.4
+		*/
+		void addForce(zVector force);
+
+		/*! \brief This method adds the input force to the input particle.
+		*
+		*	\param		[in]	index		- input particle index.
+		*	\param		[in]	force		- input force.
+		*	\since version 0.0.4
+		*/
+		void addForce(int index, zVector &force);
+
+		/*! \brief This method adds the edge force of the neighbours to the free particles. The force of each neighbour is the vector from the particle to the neighbour, scaled by the weight of the particle.
+		*
+		*	\param		[in]	weights		- input container of weights per particle, unit weights if empty.
+		*	\since version 0.0.4
+		*/
+		void addEdgeForce(const zDoubleArray &weights = zDoubleArray());
+
+		/*! \brief This method adds the planarity force of the faces to the free particles. The force of each face is the projection of the particle to the face plane.
+		*
+		*	\param		[in]	fNormals	- input container of face normals.
+		*	\param		[in]	fCenters	- input container of face centers.
+		*	\param		[in]	fVolumes	- input container of face volumes.
+		*	\param		[in]	tolerance	- faces with a volume smaller or equal to the tolerance are left out.
+		*	\since version 0.0.4
+		*/
+		void addPlanarityForce(zVectorArray &fNormals, zPointArray &fCenters, zDoubleArray &fVolumes, double tolerance = EPS);
+
+		/*! \brief This method clears the force of all the particles.
+		*
+		*	\since version 0.0.4
+		*/
+		void clearForces();
+
+		//--------------------------
+		//---- UPDATE METHODS
+		//--------------------------
+
+		/*! \brief This method integrates the forces and updates the position and velocity of all the free particles.
+		*
+		*	\param		[in]	dT					- timestep.
+		*	\param		[in]	type				- integration type - zEuler or zRK4.
+		*	\param		[in]	clearForce			- clears the force if true.
+		*	\param		[in]	clearVelocity		- clears the velocity if true.
+		*	\param		[in]	clearDerivatives	- clears the derivatives if true.
+		*	\since version 0.0.4
+		*/
+		void update(double dT, zIntergrationType type = zEuler, bool clearForce = true, bool clearVelocity = false, bool clearDerivatives = false);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method integrates the forces of the input range of particles with semi-implicit euler.
+		*
+		*	\param		[in]	start		- start of the range.
+		*	\param		[in]	end			- end of the range(exclusive).
+		*	\param		[in]	dT			- timestep.
+		*	\since version 0.0.4
+		*/
+		void integrateEuler(int start, int end, float dT);
+
+		/*! \brief This method integrates the forces of the input range of particles with runge kutta 4.
+		*
+		*	\param		[in]	start		- start of the range.
+		*	\param		[in]	end			- end of the range(exclusive).
+		*	\param		[in]	dT			- timestep.
+		*	\since version 0.0.4
+		*/
+		void integrateRK4(int start, int end, float dT);
+
+		/*! \brief This method applies the derivatives to the positions and velocities of the input range of particles.
+		*
+		*	\param		[in]	start				- start of the range.
+		*	\param		[in]	end					- end of the range(exclusive).
+		*	\param		[in]	clearForce			- clears the force if true.
+		*	\param		[in]	clearVelocity		- clears the velocity if true.
+		*	\param		[in]	clearDerivatives	- clears the derivatives if true.
+		*	\since version 0.0.4
+		*/
+		void applyDerivatives(int start, int end, bool clearForce, bool clearVelocity, bool clearDerivatives);
+	};
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/dynamics/zParticleSystem.cpp>
+#endif
+
+#endif
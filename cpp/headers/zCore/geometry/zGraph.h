@@ -20,6 +20,7 @@
 #include <headers/zCore/base/zMatrix.h>
 #include <headers/zCore/base/zColor.h>
 #include <headers/zCore/base/zTypeDef.h>
+#include <headers/zCore/base/zHashMap.h>
 
 #include <headers/zCore/utilities/zUtilsCore.h>
 
@@ -92,6 +93,15 @@ namespace zSpace
 		/*!	\brief position to vertexId map. Used to check if vertex exists with the haskey being the vertex position.	 */
 		unordered_map <string, int> positionVertex;	
 
+		/*!	\brief hash map type used for the vertex and half edge lookups. Default its zIntegerHashMap.	 */
+		zHashMapType hashMapType = zIntegerHashMap;
+
+		/*!	\brief vertices to edgeId map with the haskey being the packed vertex sequence. Used when hashMapType is zIntegerHashMap.	 */
+		zHalfEdgeHashMap halfEdgeHashMap;
+
+		/*!	\brief position to vertexId map with the haskey being the quantized vertex position. Used when hashMapType is zIntegerHashMap.	 */
+		zPositionHashMap positionHashMap;
+
 		/*!	\brief container which stores vertex colors.	*/
 		zColorArray vertexColors;
 
@@ -252,6 +262,14 @@ namespace zSpace
 		*/
 		bool halfEdgeExists(int v1, int v2, int &outEdgeId);
 
+		/*! \brief This method sets the hash map type used for the vertex and half edge lookups, and rebuilds the maps of the new type.
+		*
+		*	\param		[in]	type			- zStringHashMap or zIntegerHashMap.
+		*	\param		[in]	precisionfactor	- input precision factor for the vertex positions.
+		*	\since version 0.0.4
+		*/
+		void setHashMapType(zHashMapType type, int precisionfactor = 6);
+
 
 		//--------------------------
 		//---- EDGE METHODS
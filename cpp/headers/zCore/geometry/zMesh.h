@@ -16,6 +16,7 @@
 #pragma once
 
 #include <headers/zCore/geometry/zGraph.h>
+#include <headers/zCore/base/zThreadPool.h>
 #include <set>
 
 namespace zSpace
@@ -65,6 +66,21 @@ namespace zSpace
 		/*!	\brief container which stores face colors. 	*/
 		zColorArray faceColors;
 
+		/*!	\brief container which stores the cached planar face areas. 	*/
+		zDoubleArray faceAreas;
+
+		/*!	\brief container which stores the cached vertex areas. 	*/
+		zFloatArray vertexAreas;
+
+		/*!	\brief container which stores the cached vertex principal curvatures. 	*/
+		zCurvatureArray vertexCurvatures;
+
+		/*!	\brief container which stores the vertex positions the cached attributes were last updated for. Used to find the moved vertices. 	*/
+		zPointArray cachePositions;
+
+		/*!	\brief stores the zMeshCacheType flags of the cached attributes which are up to date with cachePositions.  */
+		int cachedAttributes;
+
 		/*!	\brief storesface handles. Used for container resizing only  */
 		vector<zFaceHandle> fHandles;
 
@@ -107,6 +123,18 @@ namespace zSpace
 		*/
 		void create(zPointArray(&_positions), zIntArray(&polyCounts), zIntArray(&polyConnects));
 
+		/*! \brief This method creates a mesh from the input containers in bulk, with the same element ordering and connectivity as the per polygon construction of the create method.
+		*	\details The edges are found by bucketing the face half edges by their smaller vertex index and sorting each bucket, and the element containers are sized once and linked per face in parallel.
+		*	The method returns false and leaves the mesh empty if an edge is shared by more than two faces, two faces use an edge in the same direction or a face repeats a vertex consecutively, which the per polygon construction resolves.
+		*
+		*	\param		[in]	_positions		- container of type zVector containing position information of vertices.
+		*	\param		[in]	polyCounts		- container of type integer with number of vertices per polygon.
+		*	\param		[in]	polyConnects	- polygon connection list with vertex ids for each face.
+		*	\return				bool			- true if the mesh is created.
+		*	\since version 0.0.4
+		*/
+		bool createBulk(zPointArray(&_positions), zIntArray(&polyCounts), zIntArray(&polyConnects));
+
 		/*! \brief This methods clears all the mesh containers.
 		*
 		*	\since version 0.0.2
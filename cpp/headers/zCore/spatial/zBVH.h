@@ -0,0 +1,307 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_ZBVH_H
+#define ZSPACE_ZBVH_H
+
+#pragma once
+
+#include<headers/zCore/spatial/zKdTree.h>
+#include<headers/zCore/utilities/zUtilsCore.h>
+#include<headers/zCore/geometry/zMesh.h>
+
+namespace  zSpace
+{
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zSpatial
+	*	\brief  The spatial acceleration structures of the library.
+	*  @{
+	*/
+
+	/*! \class zBVH
+	*	\brief A bounding volume hierarchy of edges or triangles for closest primitive, radius and ray queries.
+	*	\details The hierarchy is split with the surface area heuristic over binned primitive centroids. The edge distance is computed with zUtilsCore::minDist_Edge_Point and the triangle distance with zUtilsCore::minDist_Triangle_Point, so query results are the same as a linear scan over the primitives, where ties are resolved to the lowest index.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	class ZSPACE_CORE zBVH
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief core utilities Object  */
+		zUtilsCore coreUtils;
+
+		/*!	\brief container of positions.	*/
+		zPointArray positions;
+
+		/*!	\brief container of primitive vertex indicies, primitiveSize per primitive. Primitives with a negative vertex index are not part of the hierarchy.	*/
+		zIntArray primitiveVertices;
+
+		/*!	\brief number of vertices per primitive - 2 (edges) / 3 (triangles).	*/
+		int primitiveSize;
+
+		/*!	\brief container of face indicies of each triangle, if the hierarchy is built from a mesh.	*/
+		zIntArray triangleFaces;
+
+		/*!	\brief container of primitive indicies, sorted by the hierarchy nodes.	*/
+		zIntArray indices;
+
+		/*!	\brief container of hierarchy nodes. The first node is the root.	*/
+		vector<zKdNode> nodes;
+
+		/*!	\brief maximum number of primitives in a leaf node.	*/
+		int leafSize;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zBVH();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*	\since version 0.0.4
+		*/
+		~zBVH();
+
+		//--------------------------
+		//---- CREATE METHODS
+		//--------------------------
+
+		/*! \brief This method builds the hierarchy from the input edges.
+		*
+		*	\param		[in]	inPositions		- input pointer to the vertex positions.
+		*	\param		[in]	numPositions	- number of vertex positions.
+		*	\param		[in]	_edgeVertices	- input container of edge vertex indicies, 2 per edge.
+		*	\param		[in]	_leafSize		- maximum number of edges in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void buildEdges(zPoint *inPositions, int numPositions, zIntArray &_edgeVertices, int _leafSize = 4);
+
+		/*! \brief This method builds the hierarchy from the edges of the input graph. The primitive indicies are the edge indicies of the graph, and inactive edges are left out.
+		*
+		*	\param		[in]	inGraph			- input graph, for example zObjGraph::graph.
+		*	\param		[in]	_leafSize		- maximum number of edges in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void buildEdges(zGraph &inGraph, int _leafSize = 4);
+
+		/*! \brief This method builds the hierarchy from the input triangles.
+		*
+		*	\param		[in]	inPositions			- input pointer to the vertex positions.
+		*	\param		[in]	numPositions		- number of vertex positions.
+		*	\param		[in]	_triangleVertices	- input container of triangle vertex indicies, 3 per triangle.
+		*	\param		[in]	_leafSize			- maximum number of triangles in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void buildTriangles(zPoint *inPositions, int numPositions, zIntArray &_triangleVertices, int _leafSize = 4);
+
+		/*! \brief This method builds the hierarchy from the faces of the input mesh. The faces are fan triangulated, which is exact for convex faces. Concave faces need to be triangulated with zFnMesh::getMeshTriangles and built with the triangle container method.
+		*
+		*	\param		[in]	inMesh			- input mesh, for example zObjMesh::mesh.
+		*	\param		[in]	_leafSize		- maximum number of triangles in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void buildTriangles(zMesh &inMesh, int _leafSize = 4);
+
+		/*! \brief This method updates the vertex positions of the hierarchy and refits the node bounding boxes, keeping the hierarchy structure. Queries stay exact, but get slower as the positions drift from the ones the hierarchy was built with.
+		*
+		*	\param		[in]	inPositions		- input pointer to the vertex positions.
+		*	\param		[in]	numPositions	- number of vertex positions, which needs to be equal to the number of positions in the hierarchy.
+		*	\since version 0.0.4
+		*/
+		void refit(zPoint *inPositions, int numPositions);
+
+		/*! \brief This method clears the hierarchy.
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of primitives of the hierarchy, including the ones left out.
+		*
+		*	\return				int		- number of primitives.
+		*	\since version 0.0.4
+		*/
+		int numPrimitives();
+
+		/*! \brief This method returns the face index of the input triangle, if the hierarchy is built from a mesh.
+		*
+		*	\param		[in]	triangleId		- input triangle index.
+		*	\return				int				- face index, -1 if the hierarchy is not built from a mesh.
+		*	\since version 0.0.4
+		*/
+		int getTriangleFace(int triangleId);
+
+		/*! \brief This method returns the index of the primitive closest to the input position.
+		*
+		*	\param		[in]	pos				- input position.
+		*	\param		[out]	outDistance		- distance to the closest primitive.
+		*	\param		[out]	outClosestPt	- closest point on the closest primitive.
+		*	\return				int				- index of the closest primitive, -1 if the hierarchy is empty.
+		*	\since version 0.0.4
+		*/
+		int getNearest(zPoint &pos, double &outDistance, zPoint &outClosestPt);
+
+		/*! \brief This method gets the indicies of the primitives within the input radius of the input position.
+		*
+		*	\param		[in]	pos			- input position.
+		*	\param		[in]	radius		- input search radius.
+		*	\param		[out]	outIndices	- container of primitive indicies, sorted in ascending order.
+		*	\since version 0.0.4
+		*/
+		void getWithinRadius(zPoint &pos, double radius, zIntArray &outIndices);
+
+		/*! \brief This method returns the index of the first triangle hit by the input ray.
+		*
+		*	\details The triangle hit is computed with zUtilsCore::ray_triangleIntersection.
+		*	\param		[in]	origin			- input ray origin.
+		*	\param		[in]	direction		- input ray direction.
+		*	\param		[out]	outDistance		- ray parameter of the hit point, in multiples of the direction length.
+		*	\param		[out]	outHitPt		- hit point.
+		*	\return				int				- index of the hit triangle, -1 if there is no hit.
+		*	\since version 0.0.4
+		*/
+		int getRayIntersection(zPoint &origin, zVector &direction, double &outDistance, zPoint &outHitPt);
+
+		/*! \brief This method returns if the input ray hits any triangle. The search stops at the first hit found, which makes it faster than getRayIntersection for occlusion queries.
+		*
+		*	\param		[in]	origin			- input ray origin.
+		*	\param		[in]	direction		- input ray direction.
+		*	\return				bool			- true if the ray hits a triangle.
+		*	\since version 0.0.4
+		*/
+		bool hasRayIntersection(zPoint &origin, zVector &direction);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method builds the hierarchy from the input primitives.
+		*
+		*	\param		[in]	inPositions				- input pointer to the vertex positions.
+		*	\param		[in]	numPositions			- number of vertex positions.
+		*	\param		[in]	_primitiveVertices		- input container of primitive vertex indicies.
+		*	\param		[in]	_primitiveSize			- number of vertices per primitive.
+		*	\param		[in]	_leafSize				- maximum number of primitives in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void buildPrimitives(zPoint *inPositions, int numPositions, zIntArray &_primitiveVertices, int _primitiveSize, int _leafSize);
+
+		/*! \brief This method recursively builds the hierarchy nodes for the input range of the index container.
+		*
+		*	\param		[in]	start		- start of the range.
+		*	\param		[in]	end			- end of the range(exclusive).
+		*	\return				int			- index of the node.
+		*	\since version 0.0.4
+		*/
+		int buildNode(int start, int end);
+
+		/*! \brief This method computes the bounding box of the input node from its primitives.
+		*
+		*	\param		[in]	node		- input node.
+		*	\since version 0.0.4
+		*/
+		void computeLeafBounds(zKdNode &node);
+
+		/*! \brief This method returns the centroid of the input primitive.
+		*
+		*	\param		[in]	primitiveId		- input primitive index.
+		*	\return				zPoint			- centroid.
+		*	\since version 0.0.4
+		*/
+		zPoint getCentroid(int primitiveId);
+
+		/*! \brief This method returns the distance of the input position to the input primitive.
+		*
+		*	\param		[in]	primitiveId		- input primitive index.
+		*	\param		[in]	pos				- input position.
+		*	\param		[out]	closestPt		- closest point on the primitive.
+		*	\return				double			- distance.
+		*	\since version 0.0.4
+		*/
+		double getDistance(int primitiveId, zPoint &pos, zPoint &closestPt);
+
+		/*! \brief This method recursively searches the input node for the closest primitive.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\param		[in]	pos				- input position.
+		*	\param		[out]	bestId			- index of the closest primitive found so far.
+		*	\param		[out]	bestDistance	- distance to the closest primitive found so far.
+		*	\param		[out]	bestPt			- closest point found so far.
+		*	\since version 0.0.4
+		*/
+		void nearestNode(int nodeId, zPoint &pos, int &bestId, double &bestDistance, zPoint &bestPt);
+
+		/*! \brief This method recursively searches the input node for the primitives within the input radius.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\param		[in]	pos				- input position.
+		*	\param		[in]	radius			- input search radius.
+		*	\param		[out]	outIndices		- container of primitive indicies.
+		*	\since version 0.0.4
+		*/
+		void radiusNode(int nodeId, zPoint &pos, double radius, zIntArray &outIndices);
+
+		/*! \brief This method recursively searches the input node for the first triangle hit by the input ray.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\param		[in]	origin			- input ray origin.
+		*	\param		[in]	direction		- input ray direction.
+		*	\param		[out]	bestId			- index of the first hit triangle found so far.
+		*	\param		[out]	bestDistance	- ray parameter of the first hit found so far.
+		*	\param		[out]	bestPt			- first hit point found so far.
+		*	\since version 0.0.4
+		*/
+		void rayNode(int nodeId, zPoint &origin, zVector &direction, int &bestId, double &bestDistance, zPoint &bestPt);
+
+		/*! \brief This method recursively searches the input node for any triangle hit by the input ray.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\param		[in]	origin			- input ray origin.
+		*	\param		[in]	direction		- input ray direction.
+		*	\return				bool			- true if the ray hits a triangle of the node.
+		*	\since version 0.0.4
+		*/
+		bool rayAnyNode(int nodeId, zPoint &origin, zVector &direction);
+	};
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/spatial/zBVH.cpp>
+#endif
+
+#endif
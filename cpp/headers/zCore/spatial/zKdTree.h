@@ -0,0 +1,275 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_ZKDTREE_H
+#define ZSPACE_ZKDTREE_H
+
+#pragma once
+
+#include<headers/zCore/base/zDefinitions.h>
+#include<headers/zCore/base/zTypeDef.h>
+#include<headers/zCore/base/zVector.h>
+#include<headers/zCore/geometry/zPointCloud.h>
+
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+using namespace std;
+
+namespace  zSpace
+{
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zSpatial
+	*	\brief  The spatial acceleration structures of the library.
+	*  @{
+	*/
+
+	/*! \struct zKdNode
+	*	\brief A struct to hold a node of a k-d tree or a bounding volume hierarchy.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	struct ZSPACE_CORE zKdNode
+	{
+		/*!	\brief stores the minimum and maximum of the bounding box of the node.	*/
+		zVector bbMin, bbMax;
+
+		/*!	\brief stores the start and end(exclusive) of the node in the primitive index container.	*/
+		int start, end;
+
+		/*!	\brief stores the indicies of the child nodes, -1 if the node is a leaf.	*/
+		int left, right;
+
+		/*! \brief This method returns the square distance of the input position to the bounding box of the node.
+		*
+		*	\param		[in]	pos		- input position.
+		*	\return				float	- square distance, 0 if the position is inside the bounding box.
+		*	\since version 0.0.4
+		*/
+		float squareDistanceTo(zVector &pos);
+
+		/*! \brief This method expands the bounding box of the node to include the input position.
+		*
+		*	\param		[in]	pos		- input position.
+		*	\since version 0.0.4
+		*/
+		void expand(zVector &pos);
+
+		/*! \brief This method returns the ray parameter where the input ray enters the bounding box of the node.
+		*
+		*	\param		[in]	origin		- input ray origin.
+		*	\param		[in]	direction	- input ray direction.
+		*	\return				float		- ray parameter of the entry point, 0 if the origin is inside the bounding box, FLT_MAX if the ray misses it.
+		*	\since version 0.0.4
+		*/
+		float rayEntry(zPoint &origin, zVector &direction);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zSpatial
+	*	\brief  The spatial acceleration structures of the library.
+	*  @{
+	*/
+
+	/*! \class zKdTree
+	*	\brief A static k-d tree of positions for nearest, k-nearest and radius queries.
+	*	\details The tree is split at the median of the longest bounding box axis. Query results are the same as a linear scan over the positions, where ties are resolved to the lowest index.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	class ZSPACE_CORE zKdTree
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of positions.	*/
+		zPointArray positions;
+
+		/*!	\brief container of position indicies, sorted by the tree nodes.	*/
+		zIntArray indices;
+
+		/*!	\brief container of tree nodes. The first node is the root.	*/
+		vector<zKdNode> nodes;
+
+		/*!	\brief maximum number of positions in a leaf node.	*/
+		int leafSize;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zKdTree();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*	\since version 0.0.4
+		*/
+		~zKdTree();
+
+		//--------------------------
+		//---- CREATE METHODS
+		//--------------------------
+
+		/*! \brief This method builds the tree from the input positions.
+		*
+		*	\param		[in]	inPositions		- input container of positions.
+		*	\param		[in]	_leafSize		- maximum number of positions in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void build(zPointArray &inPositions, int _leafSize = 8);
+
+		/*! \brief This method builds the tree from the input positions.
+		*
+		*	\param		[in]	inPositions		- input pointer to the positions.
+		*	\param		[in]	numPositions	- number of positions.
+		*	\param		[in]	_leafSize		- maximum number of positions in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void build(zPoint *inPositions, int numPositions, int _leafSize = 8);
+
+		/*! \brief This method builds the tree from the input point cloud.
+		*
+		*	\param		[in]	inPointCloud	- input point cloud, for example zObjPointCloud::pCloud.
+		*	\param		[in]	_leafSize		- maximum number of positions in a leaf node.
+		*	\since version 0.0.4
+		*/
+		void build(zPointCloud &inPointCloud, int _leafSize = 8);
+
+		/*! \brief This method updates the positions of the tree and refits the node bounding boxes, keeping the tree structure. Queries stay exact, but get slower as the positions drift from the ones the tree was built with.
+		*
+		*	\param		[in]	inPositions		- input pointer to the positions.
+		*	\param		[in]	numPositions	- number of positions, which needs to be equal to the number of positions in the tree.
+		*	\since version 0.0.4
+		*/
+		void refit(zPoint *inPositions, int numPositions);
+
+		/*! \brief This method clears the tree.
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of positions in the tree.
+		*
+		*	\return				int		- number of positions.
+		*	\since version 0.0.4
+		*/
+		int numPositions();
+
+		/*! \brief This method returns the index of the position nearest to the input position.
+		*
+		*	\param		[in]	pos					- input position.
+		*	\param		[out]	outDistanceSquared	- square distance to the nearest position.
+		*	\return				int					- index of the nearest position, -1 if the tree is empty.
+		*	\since version 0.0.4
+		*/
+		int getNearest(zPoint &pos, float &outDistanceSquared);
+
+		/*! \brief This method gets the indicies of the positions within the input radius of the input position.
+		*
+		*	\param		[in]	pos			- input position.
+		*	\param		[in]	radius		- input search radius.
+		*	\param		[out]	outIndices	- container of position indicies, sorted in ascending order.
+		*	\since version 0.0.4
+		*/
+		void getWithinRadius(zPoint &pos, float radius, zIntArray &outIndices);
+
+		/*! \brief This method gets the indicies of the k positions nearest to the input position.
+		*
+		*	\param		[in]	pos						- input position.
+		*	\param		[in]	k						- number of positions.
+		*	\param		[out]	outIndices				- container of position indicies, sorted by distance and then index.
+		*	\param		[out]	outDistancesSquared		- container of square distances to the positions.
+		*	\since version 0.0.4
+		*/
+		void getKNearest(zPoint &pos, int k, zIntArray &outIndices, zFloatArray &outDistancesSquared);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method recursively builds the tree nodes for the input range of the index container.
+		*
+		*	\param		[in]	start		- start of the range.
+		*	\param		[in]	end			- end of the range(exclusive).
+		*	\return				int			- index of the node.
+		*	\since version 0.0.4
+		*/
+		int buildNode(int start, int end);
+
+		/*! \brief This method recursively searches the input node for the nearest position.
+		*
+		*	\param		[in]	nodeId				- input node index.
+		*	\param		[in]	pos					- input position.
+		*	\param		[out]	bestId				- index of the nearest position found so far.
+		*	\param		[out]	bestDistanceSquared	- square distance to the nearest position found so far.
+		*	\since version 0.0.4
+		*/
+		void nearestNode(int nodeId, zPoint &pos, int &bestId, float &bestDistanceSquared);
+
+		/*! \brief This method recursively searches the input node for the positions within the input square radius.
+		*
+		*	\param		[in]	nodeId				- input node index.
+		*	\param		[in]	pos					- input position.
+		*	\param		[in]	radiusSquared		- input square radius.
+		*	\param		[out]	outIndices			- container of position indicies.
+		*	\since version 0.0.4
+		*/
+		void radiusNode(int nodeId, zPoint &pos, float radiusSquared, zIntArray &outIndices);
+
+		/*! \brief This method recursively searches the input node for the k nearest positions.
+		*
+		*	\param		[in]	nodeId				- input node index.
+		*	\param		[in]	pos					- input position.
+		*	\param		[in]	k					- number of positions.
+		*	\param		[out]	heap				- max heap of square distance and index pairs of the nearest positions found so far.
+		*	\since version 0.0.4
+		*/
+		void kNearestNode(int nodeId, zPoint &pos, int k, vector<pair<float, int>> &heap);
+	};
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/spatial/zKdTree.cpp>
+#endif
+
+#endif
@@ -0,0 +1,358 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_BINARY_H
+#define ZSPACE_UTILS_BINARY_H
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <iostream>
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zVector.h>
+#include<headers/zCore/base/zColor.h>
+#include<headers/zCore/base/zTypeDef.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zBinary
+	*	\brief The zBIN binary file utility structs and classes of the library.
+	*  @{
+	*/
+
+	/*! \enum	zBinaryBlockType
+	*	\brief	data block types of a zBIN file.
+	*	\since	version 0.0.4
+	*/
+	enum zBinaryBlockType { zBinVertexHalfEdges = 1, zBinHalfEdges, zBinFaceHalfEdges, zBinVertexPositions, zBinVertexNormals, zBinVertexColors, zBinVertexWeights, zBinEdgeColors, zBinEdgeWeights, zBinFaceNormals, zBinFaceColors, zBinFieldGrid, zBinFieldValues };
+
+	/*! \struct zUtilsBinaryHeader
+	*
+	*	\brief The header at the start of a zBIN file.
+	*	\details The header is followed by numBlocks block table entries and the 16 byte aligned data blocks. All values are little-endian.
+	*	\since version 0.0.4
+	*/
+
+	/*! \struct zUtilsBinaryBlock
+	*
+	*	\brief A block table entry of a zBIN file, giving the type, element size, element count and file offset of a data block.
+	*	\since version 0.0.4
+	*/
+
+	/*! \class zUtilsBinaryWriter
+	*	\brief A writer class collecting the data blocks of a zBIN file.
+	*	\since version 0.0.4
+	*/
+
+	/*! \class zUtilsBinaryReader
+	*	\brief A reader class mapping a zBIN file to memory and giving direct access to its data blocks.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsBinaryHeader
+	{
+		/*!	\brief file signature, always "ZBIN".  */
+		char magic[4];
+
+		/*!	\brief format version.  */
+		uint32_t version;
+
+		/*!	\brief zFnType of the stored object.  */
+		uint32_t objectType;
+
+		/*!	\brief number of data blocks.  */
+		uint32_t numBlocks;
+
+		/*!	\brief reserved for later versions.  */
+		uint64_t reserved[2];
+	};
+
+	struct ZSPACE_CORE zUtilsBinaryBlock
+	{
+		/*!	\brief zBinaryBlockType of the block.  */
+		uint32_t blockType;
+
+		/*!	\brief size of a block element in bytes.  */
+		uint32_t elementSize;
+
+		/*!	\brief number of elements in the block.  */
+		uint64_t count;
+
+		/*!	\brief offset of the block from the start of the file.  */
+		uint64_t offset;
+	};
+
+	class ZSPACE_CORE zUtilsBinaryWriter
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of block table entries.  */
+		vector<zUtilsBinaryBlock> blocks;
+
+		/*!	\brief container of block data.  */
+		vector<vector<char>> blockData;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default Constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsBinaryWriter();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsBinaryWriter();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method adds a copy of the input data as a block. Blocks with a count of 0 are skipped.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input pointer to the block data.
+		*	\param		[in]	elementSize		- size of a block element in bytes.
+		*	\param		[in]	count			- number of elements.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, const void *data, uint32_t elementSize, uint64_t count);
+
+		/*! \brief This method adds the input integers as a block of int32 elements of the input stride.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input container of integers.
+		*	\param		[in]	stride			- number of integers per element.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, zIntArray &data, int stride = 1);
+
+		/*! \brief This method adds the input doubles as a block of float64 elements.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input container of doubles.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, zDoubleArray &data);
+
+		/*! \brief This method adds the input floats as a block of float32 elements.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input container of floats.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, zFloatArray &data);
+
+		/*! \brief This method adds the input vectors as a block of float32 x, y, z elements.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input container of vectors.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, zPointArray &data);
+
+		/*! \brief This method adds the input colors as a block of float32 r, g, b, a elements.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	data			- input container of colors.
+		*	\since version 0.0.4
+		*/
+		void addBlock(zBinaryBlockType blockType, zColorArray &data);
+
+		/*! \brief This method writes the header, block table and blocks to the input file.
+		*
+		*	\param		[in]	outfilename		- output file name including the directory path and extension.
+		*	\param		[in]	objectType		- zFnType of the stored object.
+		*	\return				bool			- true if the file is written, else false.
+		*	\since version 0.0.4
+		*/
+		bool write(string outfilename, int objectType);
+	};
+
+	class ZSPACE_CORE zUtilsBinaryReader
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief pointer to the start of the mapped file.  */
+		const char *mappedData;
+
+		/*!	\brief size of the mapped file in bytes.  */
+		size_t mappedSize;
+
+#ifdef _WIN32
+		/*!	\brief file handle.  */
+		void *fileHandle;
+
+		/*!	\brief file mapping handle.  */
+		void *mappingHandle;
+#else
+		/*!	\brief file descriptor.  */
+		int fileDescriptor;
+#endif
+
+		/*!	\brief zFnType of the stored object.  */
+		int objectType;
+
+		/*!	\brief container of block table entries.  */
+		vector<zUtilsBinaryBlock> blocks;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default Constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsBinaryReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Unmaps the file if it is open.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsBinaryReader();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file to memory and reads the header and block table.
+		*
+		*	\param		[in]	infilename		- input file name including the directory path and extension.
+		*	\return				bool			- true if the file is mapped, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string infilename);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns the zFnType of the stored object.
+		*
+		*	\return				int				- zFnType of the stored object.
+		*	\since version 0.0.4
+		*/
+		int getObjectType();
+
+		/*! \brief This method returns a pointer to the mapped data of the input block type.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[in]	elementSize		- expected size of a block element in bytes.
+		*	\param		[out]	count			- number of elements in the block, 0 if the block is not in the file.
+		*	\return				const void*		- pointer to the block data, nullptr if the block is not in the file.
+		*	\since version 0.0.4
+		*/
+		const void* getBlock(zBinaryBlockType blockType, uint32_t elementSize, uint64_t &count);
+
+		/*! \brief This method copies the int32 block of the input type and stride to the container.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[out]	data			- container of integers.
+		*	\param		[in]	stride			- number of integers per element.
+		*	\return				bool			- true if the block is in the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool getBlock(zBinaryBlockType blockType, zIntArray &data, int stride = 1);
+
+		/*! \brief This method copies the float64 block of the input type to the container.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[out]	data			- container of doubles.
+		*	\return				bool			- true if the block is in the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool getBlock(zBinaryBlockType blockType, zDoubleArray &data);
+
+		/*! \brief This method copies the float32 block of the input type to the container.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[out]	data			- container of floats.
+		*	\return				bool			- true if the block is in the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool getBlock(zBinaryBlockType blockType, zFloatArray &data);
+
+		/*! \brief This method copies the vector block of the input type to the container.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[out]	data			- container of vectors.
+		*	\return				bool			- true if the block is in the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool getBlock(zBinaryBlockType blockType, zPointArray &data);
+
+		/*! \brief This method copies the color block of the input type to the container.
+		*
+		*	\param		[in]	blockType		- zBinaryBlockType of the block.
+		*	\param		[out]	data			- container of colors.
+		*	\return				bool			- true if the block is in the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool getBlock(zBinaryBlockType blockType, zColorArray &data);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsBinary.cpp>
+#endif
+
+#endif
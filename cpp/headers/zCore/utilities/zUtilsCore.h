@@ -26,6 +26,7 @@
 #include <headers/zCore/base/zDomain.h>
 #include <headers/zCore/base/zTypeDef.h>
 #include <headers/zCore/base/zExtern.h>
+#include <headers/zCore/base/zHashMap.h>
 
 #include <string.h>
 #include <vector>
@@ -37,7 +38,13 @@
 #include <cstdio>
 #include <vector>
 #include <stdio.h>
+#ifdef _WIN32
 #include <direct.h>
+#else
+#include <sys/stat.h>
+inline int _mkdir(const char *path) { return mkdir(path, 0755); }
+inline int mkdir(const char *path) { return mkdir(path, 0755); }
+#endif
 #include <time.h> 
 #include <ctype.h>
 #include <numeric>
@@ -355,6 +362,35 @@ namespace zSpace
 		*	\since version 0.0.1
 		*/
 		ZSPACE_CUDA_CALLABLE_HOST void addToPositionMap(unordered_map<string, int>& positionVertex, zVector &pos, int index, int precisionFac);
+
+		/*! \brief This method checks if the input position exists in the integer keyed map.
+		*
+		*	\param		[in]	positionVertex	- input position vertex map.
+		*	\param		[in]	pos				- input position.
+		*	\param		[in]	precisionFac	- precision factor of the points to check.
+		*	\param		[out]	outVertexId		- index of the position in the map if it exists.
+		*	\return				bool			- true if the position exists in the map.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST bool vertexExists(zPositionHashMap& positionVertex, zVector & pos, int precisionFac, int & outVertexId);
+
+		/*! \brief This method adds the position given by input vector to the integer keyed positionVertex Map.
+		*	\param		[in]	positionVertex		- input position vertex map.
+		*	\param		[in]		pos				- input position.
+		*	\param		[in]		index			- input vertex index in the vertex position container.
+		*	\param		[in]	precisionFac		- precision factor of the points to check.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST void addToPositionMap(zPositionHashMap& positionVertex, zVector &pos, int index, int precisionFac);
+
+		/*! \brief This method packs the input integer pair into a 64 bit hash key.
+		*
+		*	\param		[in]	v1			- input first integer.
+		*	\param		[in]	v2			- input second integer.
+		*	\return				unsigned long long	- packed key with v1 in the high and v2 in the low 32 bits.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE unsigned long long packIntPair(int v1, int v2);
 			   
 		//--------------------------
 		//---- VECTOR METHODS 
@@ -447,7 +483,7 @@ namespace zSpace
 		*	\param		[in]	inPositions		- input container of positions.
 		*	\since version 0.0.2
 		*/
-		ZSPACE_CUDA_CALLABLE_HOST int getClosest_PointCloud(zVector &pos, vector<zVector> inPositions);
+		ZSPACE_CUDA_CALLABLE_HOST int getClosest_PointCloud(zVector &pos, vector<zVector> &inPositions);
 
 		/*! \brief This method returns the bounds of the input list points.
 		*
@@ -646,6 +682,19 @@ namespace zSpace
 		*/
 		ZSPACE_CUDA_CALLABLE double minDist_Edge_Point(zVector & pt, zVector & e0, zVector & e1, zVector & closest_Pt);
 
+		/*! \brief This method computes the minimum distance between a point and triangle and the closest Point on the triangle.
+		*
+		*	\details based on Real-Time Collision Detection, Christer Ericson, section 5.1.5.
+		*	\param	[in]	pt			- point
+		*	\param	[in]	t0			- first point of triangle.
+		*	\param	[in]	t1			- second point of triangle.
+		*	\param	[in]	t2			- third point of triangle.
+		*	\param	[out]	closest_Pt	- closest point on triangle to the input point.
+		*	\return			minDist		- distance to closest point.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE double minDist_Triangle_Point(zVector & pt, zVector & t0, zVector & t1, zVector & t2, zVector & closest_Pt);
+
 		/*! \brief This method computes the minimum distance between a point and a plane.
 		*
 		*	\details based on http://paulbourke.net/geometry/pointlineplane/
@@ -0,0 +1,350 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_RASTER_H
+#define ZSPACE_UTILS_RASTER_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <iostream>
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zThreadPool.h>
+#include<headers/zCore/display/zObjBuffer.h>
+
+#include <depends/lodePNG/lodepng.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsRaster
+	*	\brief A headless CPU rasteriser class for drawing points, lines, triangles and quads with vertex colors to an in-memory framebuffer, without an OPENGL context.
+	*	\details The framebuffer is split into tiles which are rasterised in parallel on the global thread pool, using SSE edge functions where available. 
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsRaster
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief framebuffer width in pixels.  */
+		int width;
+
+		/*!	\brief framebuffer height in pixels.  */
+		int height;
+
+		/*!	\brief RGBA color buffer, 4 bytes per pixel stored row by row from the top of the image.  */
+		vector<unsigned char> colorBuffer;
+
+		/*!	\brief depth buffer, 1 float per pixel in the range 0 to 1.  */
+		zFloatArray depthBuffer;
+
+		/*!	\brief view matrix.  */
+		zTransform viewMatrix;
+
+		/*!	\brief projection matrix.  */
+		zTransform projectionMatrix;
+
+		/*!	\brief color used when no vertex colors are drawn.  */
+		zColor drawColor;
+
+		/*!	\brief point size in pixels.  */
+		int pointSize;
+
+		/*!	\brief line width in pixels.  */
+		int lineWidth;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsRaster();
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_width			- framebuffer width in pixels.
+		*	\param		[in]	_height			- framebuffer height in pixels.
+		*	\since version 0.0.4
+		*/
+		zUtilsRaster(int _width, int _height);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsRaster();
+
+		//--------------------------
+		//---- SET METHODS
+		//--------------------------
+
+		/*! \brief This method resizes the framebuffer and clears it to black.
+		*
+		*	\param		[in]	_width			- framebuffer width in pixels.
+		*	\param		[in]	_height			- framebuffer height in pixels.
+		*	\since version 0.0.4
+		*/
+		void setSize(int _width, int _height);
+
+		/*! \brief This method sets the view matrix from the input camera position, target and up vector, similar to gluLookAt.
+		*
+		*	\param		[in]	eye				- camera position.
+		*	\param		[in]	target			- camera target.
+		*	\param		[in]	up				- camera up vector.
+		*	\since version 0.0.4
+		*/
+		void setCamera(zPoint &eye, zPoint &target, zVector &up);
+
+		/*! \brief This method sets a perspective projection matrix, similar to gluPerspective. The aspect ratio is taken from the framebuffer size.
+		*
+		*	\param		[in]	fovY			- vertical field of view in degrees.
+		*	\param		[in]	zNear			- distance to the near clipping plane.
+		*	\param		[in]	zFar			- distance to the far clipping plane.
+		*	\since version 0.0.4
+		*/
+		void setPerspective(float fovY, float zNear, float zFar);
+
+		/*! \brief This method sets an orthographic projection matrix, similar to glOrtho. The aspect ratio is taken from the framebuffer size.
+		*
+		*	\param		[in]	halfHeight		- half of the visible height at the camera target.
+		*	\param		[in]	zNear			- distance to the near clipping plane.
+		*	\param		[in]	zFar			- distance to the far clipping plane.
+		*	\since version 0.0.4
+		*/
+		void setOrthographic(float halfHeight, float zNear, float zFar);
+
+		/*! \brief This method sets the color used when no vertex colors are drawn.
+		*
+		*	\param		[in]	_drawColor		- input color.
+		*	\since version 0.0.4
+		*/
+		void setDrawColor(zColor &_drawColor);
+
+		/*! \brief This method sets the point size.
+		*
+		*	\param		[in]	_pointSize		- point size in pixels.
+		*	\since version 0.0.4
+		*/
+		void setPointSize(int _pointSize);
+
+		/*! \brief This method sets the line width.
+		*
+		*	\param		[in]	_lineWidth		- line width in pixels.
+		*	\since version 0.0.4
+		*/
+		void setLineWidth(int _lineWidth);
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method returns the framebuffer width.
+		*
+		*	\return				int				- framebuffer width in pixels.
+		*	\since version 0.0.4
+		*/
+		int getWidth();
+
+		/*! \brief This method returns the framebuffer height.
+		*
+		*	\return				int				- framebuffer height in pixels.
+		*	\since version 0.0.4
+		*/
+		int getHeight();
+
+		/*! \brief This method returns the RGBA color buffer.
+		*
+		*	\return				vector<unsigned char>&	- RGBA color buffer, 4 bytes per pixel stored row by row from the top of the image.
+		*	\since version 0.0.4
+		*/
+		vector<unsigned char>& getColorBuffer();
+
+		/*! \brief This method returns the depth buffer.
+		*
+		*	\return				zFloatArray&	- depth buffer, 1 float per pixel in the range 0 to 1.
+		*	\since version 0.0.4
+		*/
+		zFloatArray& getDepthBuffer();
+
+		//--------------------------
+		//---- DRAW METHODS
+		//--------------------------
+
+		/*! \brief This method clears the color buffer to the input color and the depth buffer to 1.
+		*
+		*	\param		[in]	backgroundColor	- input background color.
+		*	\since version 0.0.4
+		*/
+		void clear(zColor &backgroundColor);
+
+		/*! \brief This method draws the input points.
+		*
+		*	\param		[in]	positions		- container of point positions.
+		*	\param		[in]	colors			- container of point colors. The draw color is used if it is empty.
+		*	\since version 0.0.4
+		*/
+		void drawPoints(zPointArray &positions, zColorArray &colors);
+
+		/*! \brief This method draws lines between the input positions.
+		*
+		*	\param		[in]	positions		- container of positions.
+		*	\param		[in]	colors			- container of vertex colors. The draw color is used if it is empty.
+		*	\param		[in]	edgeIndices		- container of edge vertex indices, 2 per line.
+		*	\since version 0.0.4
+		*/
+		void drawLines(zPointArray &positions, zColorArray &colors, zIntArray &edgeIndices);
+
+		/*! \brief This method draws triangles between the input positions.
+		*
+		*	\param		[in]	positions		- container of positions.
+		*	\param		[in]	colors			- container of vertex colors. The draw color is used if it is empty.
+		*	\param		[in]	triIndices		- container of triangle vertex indices, 3 per triangle.
+		*	\since version 0.0.4
+		*/
+		void drawTriangles(zPointArray &positions, zColorArray &colors, zIntArray &triIndices);
+
+		/*! \brief This method draws quads between the input positions.
+		*
+		*	\param		[in]	positions		- container of positions.
+		*	\param		[in]	colors			- container of vertex colors. The draw color is used if it is empty.
+		*	\param		[in]	quadIndices		- container of quad vertex indices, 4 per quad.
+		*	\since version 0.0.4
+		*/
+		void drawQuads(zPointArray &positions, zColorArray &colors, zIntArray &quadIndices);
+
+		/*! \brief This method draws the vertices of the input headless buffer as points.
+		*
+		*	\param		[in]	bufferObj		- input headless buffer.
+		*	\param		[in]	colors			- true if the buffer vertex colors are drawn, else the draw color is used.
+		*	\since version 0.0.4
+		*/
+		void drawPointsFromBuffer(zObjBuffer &bufferObj, bool colors = true);
+
+		/*! \brief This method draws the edge indices of the input headless buffer as lines.
+		*
+		*	\param		[in]	bufferObj		- input headless buffer.
+		*	\param		[in]	colors			- true if the buffer vertex colors are drawn, else the draw color is used.
+		*	\since version 0.0.4
+		*/
+		void drawLinesFromBuffer(zObjBuffer &bufferObj, bool colors = true);
+
+		/*! \brief This method draws the face indices of the input headless buffer as triangles.
+		*
+		*	\param		[in]	bufferObj		- input headless buffer.
+		*	\param		[in]	colors			- true if the buffer vertex colors are drawn, else the draw color is used.
+		*	\since version 0.0.4
+		*/
+		void drawTrianglesFromBuffer(zObjBuffer &bufferObj, bool colors = true);
+
+		/*! \brief This method draws the face indices of the input headless buffer as quads.
+		*
+		*	\param		[in]	bufferObj		- input headless buffer.
+		*	\param		[in]	colors			- true if the buffer vertex colors are drawn, else the draw color is used.
+		*	\since version 0.0.4
+		*/
+		void drawQuadsFromBuffer(zObjBuffer &bufferObj, bool colors = true);
+
+		//--------------------------
+		//---- EXPORT METHODS
+		//--------------------------
+
+		/*! \brief This method writes the color buffer to a PNG file.
+		*
+		*	\param		[in]	outfilename		- output file name including the directory path and extension.
+		*	\return				bool			- true if the file is written, else false.
+		*	\since version 0.0.4
+		*/
+		bool toPNG(string outfilename);
+
+	private:
+		//--------------------------
+		//---- PRIVATE METHODS
+		//--------------------------
+
+		/*! \brief This method rasterises points.
+		*
+		*	\param		[in]	positions		- pointer to the x, y, z positions.
+		*	\param		[in]	positionStride	- number of floats between consecutive positions.
+		*	\param		[in]	colors			- pointer to the r, g, b, a colors, nullptr if the draw color is used.
+		*	\param		[in]	numColors		- number of colors. Vertices without a color use the draw color.
+		*	\param		[in]	numVertices		- number of vertices.
+		*	\since version 0.0.4
+		*/
+		void rasterPoints(const float *positions, int positionStride, const float *colors, int numColors, int numVertices);
+
+		/*! \brief This method rasterises lines.
+		*
+		*	\param		[in]	positions		- pointer to the x, y, z positions.
+		*	\param		[in]	positionStride	- number of floats between consecutive positions.
+		*	\param		[in]	colors			- pointer to the r, g, b, a colors, nullptr if the draw color is used.
+		*	\param		[in]	numColors		- number of colors. Vertices without a color use the draw color.
+		*	\param		[in]	numVertices		- number of vertices.
+		*	\param		[in]	indices			- pointer to the line vertex indices, 2 per line.
+		*	\param		[in]	numIndices		- number of indices.
+		*	\since version 0.0.4
+		*/
+		void rasterLines(const float *positions, int positionStride, const float *colors, int numColors, int numVertices, const int *indices, int numIndices);
+
+		/*! \brief This method rasterises polygons of a fixed vertex count as triangle fans.
+		*
+		*	\param		[in]	positions		- pointer to the x, y, z positions.
+		*	\param		[in]	positionStride	- number of floats between consecutive positions.
+		*	\param		[in]	colors			- pointer to the r, g, b, a colors, nullptr if the draw color is used.
+		*	\param		[in]	numColors		- number of colors. Vertices without a color use the draw color.
+		*	\param		[in]	numVertices		- number of vertices.
+		*	\param		[in]	indices			- pointer to the polygon vertex indices.
+		*	\param		[in]	numIndices		- number of indices.
+		*	\param		[in]	polygonSize		- number of vertices per polygon, 3 for triangles and 4 for quads.
+		*	\since version 0.0.4
+		*/
+		void rasterPolygons(const float *positions, int positionStride, const float *colors, int numColors, int numVertices, const int *indices, int numIndices, int polygonSize);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsRaster.cpp>
+#endif
+
+#endif
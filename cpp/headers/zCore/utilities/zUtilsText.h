@@ -0,0 +1,221 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_TEXT_H
+#define ZSPACE_UTILS_TEXT_H
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zThreadPool.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zText
+	*	\brief The text file utility structs and classes of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsTextToken
+	*
+	*	\brief A token of a text file, given by its first and one past last character in the file buffer.
+	*	\since version 0.0.4
+	*/
+
+	/*! \class zUtilsTextReader
+	*	\brief A reader class for text files such as OBJ, CSV and EPW.
+	*	\details The file is read in large blocks into one buffer and the lines are indexed in parallel. Lines are split into tokens without allocating strings and numbers are parsed with std::from_chars, so importers can parse blocks of lines in parallel into preallocated containers.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsTextToken
+	{
+		/*!	\brief pointer to the first character of the token.  */
+		const char *begin;
+
+		/*!	\brief pointer to one past the last character of the token.  */
+		const char *end;
+	};
+
+	class ZSPACE_CORE zUtilsTextReader
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief file buffer.  */
+		vector<char> buffer;
+
+		/*!	\brief container of line start offsets in the buffer, with a trailing entry one past the end of the last line.  */
+		vector<size_t> lineStarts;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default Constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsTextReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsTextReader();
+
+		//--------------------------
+		//---- READ METHODS
+		//--------------------------
+
+		/*! \brief This method reads the input file in blocks and indexes its lines in parallel.
+		*
+		*	\param		[in]	infilename		- input file name including the directory path and extension.
+		*	\param		[in]	blockSize		- size of the read blocks in bytes.
+		*	\return				bool			- true if the file is read, else false.
+		*	\since version 0.0.4
+		*/
+		bool read(string infilename, size_t blockSize = 1 << 24);
+
+		//--------------------------
+		//---- LINE METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of lines.
+		*
+		*	\return				int				- number of lines.
+		*	\since version 0.0.4
+		*/
+		int numLines();
+
+		/*! \brief This method returns the number of line blocks used to parse the lines in parallel.
+		*
+		*	\return				int				- number of line blocks.
+		*	\since version 0.0.4
+		*/
+		int numLineBlocks();
+
+		/*! \brief This method gets the range of lines of the input line block.
+		*
+		*	\param		[in]	blockId			- input line block index.
+		*	\param		[out]	start			- first line of the block.
+		*	\param		[out]	end				- one past the last line of the block.
+		*	\since version 0.0.4
+		*/
+		void getLineBlock(int blockId, int &start, int &end);
+
+		/*! \brief This method gets the input line without the line break.
+		*
+		*	\param		[in]	lineId			- input line index.
+		*	\return				zUtilsTextToken	- line token.
+		*	\since version 0.0.4
+		*/
+		zUtilsTextToken getLine(int lineId);
+
+		/*! \brief This method splits the input line into tokens, skipping empty tokens like zUtilsCore::splitString.
+		*
+		*	\param		[in]	lineId			- input line index.
+		*	\param		[in]	delimiters		- input delimiter characters.
+		*	\param		[out]	tokens			- container of tokens.
+		*	\return				int				- number of tokens.
+		*	\since version 0.0.4
+		*/
+		int getTokens(int lineId, const char *delimiters, vector<zUtilsTextToken> &tokens);
+
+		/*! \brief This method splits the input token into tokens, skipping empty tokens like zUtilsCore::splitString.
+		*
+		*	\param		[in]	token			- input token.
+		*	\param		[in]	delimiters		- input delimiter characters.
+		*	\param		[out]	tokens			- container of tokens.
+		*	\return				int				- number of tokens.
+		*	\since version 0.0.4
+		*/
+		int getTokens(const zUtilsTextToken &token, const char *delimiters, vector<zUtilsTextToken> &tokens);
+
+		//--------------------------
+		//---- TOKEN METHODS
+		//--------------------------
+
+		/*! \brief This method checks if the input token is equal to the input string.
+		*
+		*	\param		[in]	token			- input token.
+		*	\param		[in]	str				- input string.
+		*	\return				bool			- true if equal, else false.
+		*	\since version 0.0.4
+		*/
+		bool equals(const zUtilsTextToken &token, const char *str);
+
+		/*! \brief This method converts the input token to a string.
+		*
+		*	\param		[in]	token			- input token.
+		*	\return				string			- token string.
+		*	\since version 0.0.4
+		*/
+		string toString(const zUtilsTextToken &token);
+
+		/*! \brief This method parses the input token as a double. Like atof, leading whitespace is skipped and 0 is returned if no number is found.
+		*
+		*	\param		[in]	token			- input token.
+		*	\return				double			- parsed value.
+		*	\since version 0.0.4
+		*/
+		double toDouble(const zUtilsTextToken &token);
+
+		/*! \brief This method parses the input token as an integer. Like atoi, leading whitespace is skipped and 0 is returned if no number is found.
+		*
+		*	\param		[in]	token			- input token.
+		*	\return				int				- parsed value.
+		*	\since version 0.0.4
+		*/
+		int toInt(const zUtilsTextToken &token);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsText.cpp>
+#endif
+
+#endif
@@ -27,11 +27,16 @@
 #define RAD_MIN 300.0
 #define RAD_MAX 1000.0
 
+#define SUNVECS_LANES 8
+
 
 #include<headers/zCudaToolsets/base/zCudaDefinitions.h>
 #include<headers/zCore/base/zInline.h>
 #include<headers/zCore/base/zDomain.h>
 #include<headers/zCore/utilities/zUtilsCore.h>
+#include<headers/zCore/utilities/zUtilsText.h>
+#include<headers/zCore/base/zThreadPool.h>
+#include<headers/zCore/spatial/zBVH.h>
 
 namespace zSpace
 {
@@ -54,6 +59,7 @@ namespace zSpace
 
 	/*! \class zTsSolarAnalysis
 	*	\brief A tool set to do solar analysis.
+	*	\details The cummulative radiation is computed on the GPU with cdpCummulativeRadiation, or on the CPU with computeCummulativeRadiation_CPU, which also takes the occlusion of a context mesh into account.
 	*	\since version 0.0.4
 	*/
 
@@ -109,6 +115,21 @@ namespace zSpace
 		/*!	\brief size of container for normals, cummulative raditation, colors*/
 		int memSize;
 
+		/*!	\brief container of face centers, 3 floats per normal. Used as ray origins of the occlusion test.	*/
+		zFloatArray centers;
+
+		/*!	\brief bounding volume hierarchy of the context mesh triangles.	*/
+		zBVH contextBVH;
+
+		/*!	\brief containers of the x, y, z components of the sun vectors above the horizon, padded to a multiple of SUNVECS_LANES.	*/
+		zFloatArray sunVecs_x, sunVecs_y, sunVecs_z;
+
+		/*!	\brief container of the EPW radiation of each packed sun vector.	*/
+		zFloatArray sunVecs_radiation;
+
+		/*!	\brief container of the weight of each packed sun vector - 1 for sun vectors, 0 for padding.	*/
+		zFloatArray sunVecs_mask;
+
 
 	public:
 
@@ -148,6 +169,21 @@ namespace zSpace
 
 		ZSPACE_CUDA_CALLABLE_HOST void setLocation(zLocation &_location);
 
+		/*! \brief This method sets the face centers of the normals, which are the ray origins of the occlusion test.
+		*
+		*	\param		[in]	_centers		- input pointer to the face centers, 3 floats per center.
+		*	\param		[in]	_numCenters		- number of floats in the container, which needs to be equal to the number of floats of the normals.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST void setFaceCenters(const float *_centers, int _numCenters);
+
+		/*! \brief This method sets the context mesh, which occludes the sun vectors in computeCummulativeRadiation_CPU. To include self shadowing, the analysed mesh needs to be part of the context mesh.
+		*
+		*	\param		[in]	contextMesh		- input context mesh, for example zObjMesh::mesh. An empty mesh disables the occlusion test.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST void setContextMesh(zMesh &contextMesh);
+
 		//--------------------------
 		//---- GET METHODS
 		//--------------------------	
@@ -194,6 +230,16 @@ namespace zSpace
 
 		ZSPACE_CUDA_CALLABLE void computeCummulativeRadiation();
 
+		/*! \brief This method computes the cummulative radiation on the CPU, with the same outputs as cdpCummulativeRadiation.
+		*	\details The normals are computed in parallel. Per normal, the loops over the sun vectors run over contiguous component containers in SUNVECS_LANES independent lanes, so they are vectorised by the compiler and the result doesn't depend on the number of threads.
+		*	If a context mesh is set, a sun vector only contributes if the ray from the face center towards the sun doesn't hit the context mesh.
+		*
+		*	\param		[in]	EPWRead			- true if the EPW data is read. The average radiation is written to the cummulative radiation container and mapped to the colors, else the average angle is mapped to the colors.
+		*	\param		[in]	rayOffset		- offset of the ray origin from the face center along the normal, to avoid the face occluding itself.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST void computeCummulativeRadiation_CPU(bool EPWRead, float rayOffset = 0.001);
+
 
 		//--------------------------
 		//---- DISPLAY METHODS
@@ -210,6 +256,13 @@ namespace zSpace
 
 		ZSPACE_CUDA_CALLABLE_HOST void computeSunVectors_Day();
 
+		/*! \brief This method packs the sun vectors above the horizon and their EPW radiation in the component containers.
+		*
+		*	\param		[in]	EPWRead			- true if the EPW data is read.
+		*	\since version 0.0.4
+		*/
+		ZSPACE_CUDA_CALLABLE_HOST void computeSunVectors_Packed(bool EPWRead);
+
 	};
 }
 
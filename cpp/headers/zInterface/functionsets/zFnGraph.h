@@ -497,6 +497,14 @@ namespace zSpace
 		*/
 		bool fromJSON(string infilename);
 
+		/*! \brief This method imports zGraph from a zBIN binary file. The file is memory mapped and the containers are copied directly from its blocks.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool			- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromBIN(string infilename);
+
 
 		/*! \brief This method exports zGraph to a TXT file format.
 		*
@@ -515,6 +523,13 @@ namespace zSpace
 		*/
 		void toJSON(string outfilename);
 
+		/*! \brief This method exports zGraph to a zBIN binary file, storing the half edge connectivity and the attributes as contiguous little-endian blocks.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toBIN(string outfilename);
+
 	private:
 
 		//--------------------------
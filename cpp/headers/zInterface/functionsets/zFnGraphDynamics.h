@@ -16,6 +16,7 @@
 #pragma once
 
 #include <headers/zInterface/functionsets/zFnParticle.h>
+#include <headers/zCore/dynamics/zParticleSystem.h>
 #include <headers/zInterface/functionsets/zFnGraph.h>
 
 namespace zSpace
@@ -46,11 +47,8 @@ namespace zSpace
 		//---- PROTECTED ATTRIBUTES
 		//--------------------------
 
-		/*!	\brief container of particle function set  */
-		vector<zFnParticle> fnParticles;
-
-		/*!	\brief container of  particle objects  */
-		vector<zObjParticle> particlesObj;
+		/*!	\brief particle system of the graph vertices  */
+		zParticleSystem particles;
 
 	public:
 
@@ -37,6 +37,97 @@ namespace zSpace
 	*  @{
 	*/
 
+	/*! \struct zIsoContourBuffer
+	*	\brief A struct to hold the contour vertices and polygons computed from a range of mesh faces.
+	*	\details The contour vertices are welded by a key of the mesh element they lie on - the mesh vertex for positions on a vertex, else the intersected mesh edge. The buffers of consecutive face ranges are computed in parallel and merged in order, giving the same vertex order as a serial walk over the faces.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_API zIsoContourBuffer
+	{
+		/*!	\brief stores the positions of the contour vertices.	*/
+		zPointArray positions;
+
+		/*!	\brief stores the colors of the contour vertices.	*/
+		zColorArray colors;
+
+		/*!	\brief stores the weld keys of the contour vertices - 2 * vertex index for positions on a mesh vertex, 4 * edge index + 2 * band level + 1 for crossings of a mesh edge.	*/
+		vector<unsigned long long> keys;
+
+		/*!	\brief stores the contour vertex indicies of the polygons or edges.	*/
+		zIntArray connects;
+
+		/*!	\brief stores the number of vertices of the polygons, empty for edges.	*/
+		zIntArray counts;
+
+		/*!	\brief stores the map of weld keys to contour vertex indicies.	*/
+		zHashMap<unsigned long long> keyVertex;
+
+		/*!	\brief stores the pointer to the vertex scalars of an isoband, used to tell the low and high threshold crossings of an edge apart. nullptr for isolines.	*/
+		zScalarArray *bandScalars;
+
+		/*!	\brief stores the low and high thresholds of an isoband.	*/
+		float bandLow, bandHigh;
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zIsoContourBuffer();
+
+		/*! \brief This method adds the input position of the input face to the buffer, if a vertex with the same weld key does not exist.
+		*
+		*	\param		[in]	f				- input face iterator.
+		*	\param		[in]	pos				- input position, on the boundary of the face.
+		*	\param		[in]	precisionFac	- precision factor used to check if the position is on a face vertex.
+		*	\param		[in]	col				- input color of the vertex.
+		*	\return				int				- index of the contour vertex in the buffer.
+		*	\since version 0.0.4
+		*/
+		int addVertex(zItMeshFace &f, zPoint &pos, int precisionFac, zColor col = zColor());
+
+		/*! \brief This method removes the repeated consecutive vertices of the polygons, and the polygons or edges collapsing to less than 3 or 2 vertices.
+		*	\since version 0.0.4
+		*/
+		void removeRepeatedVertices();
+
+		/*! \brief This method computes the contour buffers of the faces of the input mesh, in parallel over consecutive face ranges.
+		*
+		*	\param		[in]	meshObj			- input mesh object.
+		*	\param		[out]	buffers			- container of buffers, one per face range.
+		*	\param		[in]	faceContour		- input method computing the contour of a face into a buffer.
+		*	\param		[in]	_bandScalars	- input pointer to the vertex scalars of an isoband, nullptr for isolines.
+		*	\param		[in]	_bandLow		- input low threshold of an isoband.
+		*	\param		[in]	_bandHigh		- input high threshold of an isoband.
+		*	\since version 0.0.4
+		*/
+		static void compute(zObjMesh &meshObj, vector<zIsoContourBuffer> &buffers, std::function<void(zItMeshFace&, zIsoContourBuffer&)> faceContour, zScalarArray *_bandScalars = nullptr, float _bandLow = 0, float _bandHigh = 0);
+
+		/*! \brief This method merges the input buffers in order, welding the vertices with the same key.
+		*
+		*	\param		[in]	buffers			- input container of buffers, in face order.
+		*	\param		[out]	outPositions	- container of contour vertex positions.
+		*	\param		[out]	outConnects		- container of contour polygon or edge connectivity.
+		*	\param		[out]	outCounts		- container of number of vertices per polygon.
+		*	\param		[out]	outColors		- container of contour vertex colors.
+		*	\since version 0.0.4
+		*/
+		static void merge(vector<zIsoContourBuffer> &buffers, zPointArray &outPositions, zIntArray &outConnects, zIntArray &outCounts, zColorArray &outColors);
+	};
+
+	/** \addtogroup zInterface
+	*	\brief The Application Program Interface of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zFuntionSets
+	*	\brief The function set classes of the library.
+	*  @{
+	*/
+
 	/*! \class zFnMesh
 	*	\brief A mesh function set.
 	*	\since version 0.0.2
@@ -301,6 +392,19 @@ namespace zSpace
 		*	\since version 0.0.2
 		*/
 		void computeMeshNormals();
+
+		/*! \brief This method updates the normals of the faces around the vertices moved since the last update, and of the vertices of those faces.
+		*
+		*	\details The moved vertices are found by comparing against the positions of the last update, so writes through setVertexPositions, iterators and raw position pointers are all picked up. All the normals are computed on the first update, when the element counts change, after topology edits and when most of the vertices moved.
+		*	\since version 0.0.4
+		*/
+		void updateMeshNormals();
+
+		/*! \brief This method clears the cached mesh attributes, so the next update computes them for the whole mesh. It needs to be called after topology edits which keep the element counts, if they are not done through the function set.
+		*
+		*	\since version 0.0.4
+		*/
+		void clearAttributeCaches();
 		
 		/*! \brief This method averages the positions of vertex except for the ones on the boundary.
 		*
@@ -676,6 +780,29 @@ namespace zSpace
 		*/
 		double getPlanarFaceAreas(zDoubleArray &faceAreas);		
 
+		/*! \brief This method updates the cached planar face areas for the vertices moved since the last update, as in updateMeshNormals, and copies them to the output container.
+		*
+		*	\param		[out]	faceAreas		- vector of face areas.
+		*	\return				double			- total area of the mesh.
+		*	\since version 0.0.4
+		*/
+		double updatePlanarFaceAreas(zDoubleArray &faceAreas);
+
+		/*! \brief This method updates the cached vertex areas for the vertices moved since the last update, as in updateMeshNormals, and copies them to the output container. The areas are the ones of getVertexAreas with the face and half edge centers of the mesh.
+		*
+		*	\param		[out]	vertexAreas		- vector of vertex areas.
+		*	\return				double			- total area of the mesh.
+		*	\since version 0.0.4
+		*/
+		double updateVertexAreas(zFloatArray &vertexAreas);
+
+		/*! \brief This method updates the cached principal curvatures for the vertices moved since the last update, as in updateMeshNormals, and copies them to the output container.
+		*
+		*	\param		[out]	vertexCurvatures	- container of vertex curvature.
+		*	\since version 0.0.4
+		*/
+		void updatePrincipalCurvatures(zCurvatureArray &vertexCurvatures);
+
 		/*! \brief This method stores mesh face connectivity information in the input containers
 		*
 		*	\param		[out]	polyConnects	- stores list of polygon connection with vertex ids for each face.
@@ -975,6 +1102,13 @@ namespace zSpace
 		*/
 		void toJSON(string outfilename);
 
+		/*! \brief This method exports zMesh to a zBIN binary file, storing the half edge connectivity and the attributes as contiguous little-endian blocks.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toBIN(string outfilename);
+
 		/*! \brief This method imports zMesh from an OBJ file.
 		*
 		*	\param	[in]		infilename			- input file name including the directory path and extension.
@@ -991,6 +1125,14 @@ namespace zSpace
 		*/
 		bool fromJSON(string infilename);
 
+		/*! \brief This method imports zMesh from a zBIN binary file. The file is memory mapped and the containers are copied directly from its blocks.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool			- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromBIN(string infilename);
+
 		//--------------------------
 		//---- PROTECTED CONTOUR METHODS
 		//--------------------------
@@ -1038,57 +1180,46 @@ namespace zSpace
 		*
 		*	\param	[in]	vertexScalars	- input vertex scalar values.
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	edgeConnects	- container of edge connectivity of the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed edges.
 		*	\param	[in]	threshold		- field threshold.
 		*	\since version 0.0.2
 		*/
-		void getIsoline(zScalarArray& vertexScalars, zItMeshFace& f, zPointArray& positions, zIntArray& edgeConnects, zColorArray& cVertexColor, unordered_map <string, int>& positionVertex, float& threshold);
+		void getIsoline(zScalarArray& vertexScalars, zItMeshFace& f, zIsoContourBuffer& contour, float& threshold);
 
 
 		/*! \brief This method gets the isoline polygon for the input mesh at the given input face index.
 		*
 		*	\param	[in]	vertexScalars	- input vertex scalar values.
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	polyConnects	- container of polygon connectivity of the computed polygon.
-		*	\param	[in]	polyCounts		- container of number of vertices in the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed polygons.
 		*	\param	[in]	threshold		- field threshold.
 		*	\param	[in]	invertMesh	- true if inverted mesh is required.
 		*	\since version 0.0.2
 		*/
-		void getIsolinePoly_mixed(zScalarArray& vertexScalars, zItMeshFace& f, zPointArray& positions, zIntArray& polyConnects, zIntArray& polyCounts, unordered_map <string, int>& positionVertex, float& threshold, bool invertMesh);
+		void getIsolinePoly_mixed(zScalarArray& vertexScalars, zItMeshFace& f, zIsoContourBuffer& contour, float& threshold, bool invertMesh);
 
 
 		/*! \brief This method gets the isoline polygon for the input mesh at the given input face index.
 		*
 		*	\param	[in]	vertexScalars	- input vertex scalar values.
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	polyConnects	- container of polygon connectivity of the computed polygon.
-		*	\param	[in]	polyCounts		- container of number of vertices in the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed polygons.
 		*	\param	[in]	threshold		- field threshold.
 		*	\param	[in]	invertMesh	- true if inverted mesh is required.
 		*	\since version 0.0.2
 		*/
-		void getIsolinePoly(zScalarArray& vertexScalars, zItMeshFace& f, zPointArray& positions, zIntArray& polyConnects, zIntArray& polyCounts, unordered_map <string, int>& positionVertex, float& threshold, bool invertMesh);
+		void getIsolinePoly(zScalarArray& vertexScalars, zItMeshFace& f, zIsoContourBuffer& contour, float& threshold, bool invertMesh);
 
 
 		/*! \brief This method gets the isoline polygon for the input mesh at the given input face index.
 		*
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	polyConnects	- container of polygon connectivity of the computed polygon.
-		*	\param	[in]	polyCounts		- container of number of vertices in the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed polygons.
 		*	\param	[in]	thresholdLow	- field threshold domain minimum.
 		*	\param	[in]	thresholdHigh	- field threshold domain maximum.
 		*	\since version 0.0.2
 		*/
-		void getIsobandPoly(zItMeshFace& f, zPointArray &positions, zIntArray &polyConnects, zIntArray &polyCounts, unordered_map <string, int> &positionVertex, float&thresholdLow, float&thresholdHigh);
+		void getIsobandPoly(zItMeshFace& f, zIsoContourBuffer& contour, float&thresholdLow, float&thresholdHigh);
 
 
 	private:
@@ -1103,6 +1234,43 @@ namespace zSpace
 		*/
 		void setStaticContainers();
 
+		//--------------------------
+		//---- ATTRIBUTE CACHE METHODS
+		//--------------------------
+
+		/*! \brief This method computes the normal of the input face from its vertex positions.
+		*
+		*	\param		[in]	f				- face iterator.
+		*	\return				zVector			- face normal.
+		*	\since version 0.0.4
+		*/
+		zVector computeFaceNormal(zItMeshFace &f);
+
+		/*! \brief This method computes the normal of the input vertex from the normals of its connected faces.
+		*
+		*	\param		[in]	v				- vertex iterator.
+		*	\return				zVector			- vertex normal.
+		*	\since version 0.0.4
+		*/
+		zVector computeVertexNormal(zItMeshVertex &v);
+
+		/*! \brief This method computes the area around the input vertex based on face centers. The centers are computed from the mesh if the input containers are null.
+		*
+		*	\param		[in]	v				- vertex iterator.
+		*	\param		[in]	faceCenters		- pointer to container of face centers, or null.
+		*	\param		[in]	edgeCenters		- pointer to container of half edge centers, or null.
+		*	\return				double			- vertex area.
+		*	\since version 0.0.4
+		*/
+		double computeVertexArea(zItMeshVertex &v, zPointArray *faceCenters, zPointArray *edgeCenters);
+
+		/*! \brief This method brings the cached attributes of the input types up to date with the vertex positions, recomputing only the faces and vertices around the moved vertices when the cache allows it.
+		*
+		*	\param		[in]	attributes		- zMeshCacheType flags of the attributes to update.
+		*	\since version 0.0.4
+		*/
+		void updateAttributeCaches(int attributes);
+
 		//--------------------------
 		//---- DEACTIVATE AND REMOVE METHODS
 		//--------------------------
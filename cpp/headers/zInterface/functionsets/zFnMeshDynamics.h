@@ -17,6 +17,7 @@
 
 #include <headers/zInterface/functionsets/zFnMesh.h>
 #include <headers/zInterface/functionsets/zFnParticle.h>
+#include <headers/zCore/dynamics/zParticleSystem.h>
 
 
 namespace zSpace
@@ -47,11 +48,8 @@ namespace zSpace
 		//--------------------------
 		//---- PROTECTED ATTRIBUTES
 		//--------------------------
-		/*!	\brief container of particle function set  */
-		vector<zFnParticle> fnParticles;	
-
-		/*!	\brief container of  particle objects  */
-		vector<zObjParticle> particlesObj;
+		/*!	\brief particle system of the mesh vertices  */
+		zParticleSystem particles;
 		
 	public:	
 
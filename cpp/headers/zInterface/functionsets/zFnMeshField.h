@@ -27,6 +27,9 @@
 #include<headers/zInterface/iterators/zItMeshField.h>
 
 #include<headers/zCore/utilities/zUtilsBMP.h>
+#include<headers/zCore/spatial/zKdTree.h>
+#include<headers/zCore/spatial/zBVH.h>
+#include<headers/zCore/base/zThreadPool.h>
 
 namespace zSpace
 {
@@ -86,6 +89,12 @@ namespace zSpace
 		/*!	\brief field color domain.  */
 		zDomainColor fieldColorDomain = zDomainColor(zColor(), zColor(1, 1, 1, 1));
 
+		/*!	\brief number of rings of the ring neighbourhood.  */
+		int numNeighbourRings = 1;
+
+		/*!	\brief scratch buffer of the diffusion stencil, reused between calls.  */
+		vector<float> diffusionBuffer;
+
 	public:
 
 		//--------------------------
@@ -155,7 +164,7 @@ namespace zSpace
 		/*! \brief This method imports the field to the given file type.
 		*
 		*	\param [in]		path			- input file name including the directory path and extension.
-		*	\param [in]		type			- type of file to be exported - zBMP
+		*	\param [in]		type			- type of file to be exported - zBMP, zOBJ, zJSON or zBIN
 		*	\since version 0.0.2
 		*/
 		void to(string path, zFileTpye type);
@@ -325,6 +334,48 @@ namespace zSpace
 		*/
 		zVectorArray getGradients(float epsilon = EPS);
 
+		//--------------------------
+		//---- SAMPLE METHODS
+		//--------------------------
+
+		/*! \brief This method samples the field at the input position with grid arithmetic on the field values, without neighbour queries or heap allocation. Positions outside the field are clamped to its bounds.
+		*
+		*	\param		[in]	samplePos	- sample position.
+		*	\param		[in]	type		- type of sampling. zFieldIndex / zFieldNearest / zFieldLinear (bilinear)
+		*	\param		[out]	fieldValue	- output field value.
+		*	\return				bool		- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		bool sampleFieldValue(zPoint &samplePos, zFieldValueType type, T &fieldValue);
+
+		/*! \brief This method samples the field at the input positions in parallel. Scalar fields use SIMD for zFieldLinear where available.
+		*
+		*	\param		[in]	samplePositions	- container of sample positions.
+		*	\param		[in]	type			- type of sampling. zFieldIndex / zFieldNearest / zFieldLinear (bilinear)
+		*	\param		[out]	fieldValues		- container of field values, one per sample position.
+		*	\since version 0.0.4
+		*/
+		void sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, vector<T> &fieldValues);
+
+		/*! \brief This method computes the gradient of the bilinear interpolation of the field at the input position.
+		*
+		*	\param		[in]	samplePos	- sample position.
+		*	\param		[out]	gradient	- output gradient vector.
+		*	\return				bool		- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		bool sampleGradient(zPoint &samplePos, zVector &gradient);
+
+		/*! \brief This method computes the gradients of the bilinear interpolation of the field at the input positions in parallel.
+		*
+		*	\param		[in]	samplePositions	- container of sample positions.
+		*	\param		[out]	gradients		- container of gradient vectors, one per sample position.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		void sampleGradients(zPointArray &samplePositions, zVectorArray &gradients);
+
 		/*! \brief This method gets the boolean indicating if the field values aligns with mesh vertices or faces.
 		*
 		*	\return				bool		- if true field values aligns with mesh vertices else aligns with mesh faces.
@@ -377,9 +428,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values as inverse weighted distance from the input graph vertex positions.
 		*
@@ -389,9 +441,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 	
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -401,9 +454,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -413,9 +467,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -425,9 +480,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
@@ -438,9 +494,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		//--------------------------
 		//----  2D SCALAR FIELD METHODS
@@ -732,9 +789,10 @@ namespace zSpace
 		*	\param		[in]	numSmooth			- number of times to smooth.
 		*	\param		[in]	diffuseDamp			- damping value of the averaging.
 		*	\param		[in]	type				- smooth type - zlaplacian / zAverage.
+		*	\param		[in]	numRings			- number of rings of the stencil - 1 (3x3) / 2 (5x5).
 		*	\since version 0.0.2
 		*/
-		void smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage);
+		void smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage, int numRings = 1);
 
 		/*! \brief This method computes the field index of each input position and stores them in a container per field index.
 		*
@@ -897,12 +955,85 @@ namespace zSpace
 		*/
 		void fromBMP(string infilename);
 
+		/*! \brief This method exports the field to a zBIN binary file, storing the grid parameters and the field values as contiguous little-endian blocks.
+		*
+		*	\param [in]		outfilename		- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toBIN(string outfilename);
+
+		/*! \brief This method imports the field from a zBIN binary file and creates the corresponding field and field mesh. The file is memory mapped and the field values are copied directly from its blocks.
+		*
+		*	\param		[in]		infilename		- input file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void fromBIN(string infilename);
+
 		/*! \brief This method creates the mesh from the field parameters.
 		*
 		*	\since version 0.0.2
 		*/
 		void createFieldMesh();
 
+		//--------------------------
+		//---- PROTECTED DISTANCE METHODS
+		//--------------------------
+
+		/*! \brief This method computes the field values as inverse weighted distance from all the input positions, or the ones within the influence radius using a k-d tree.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	values				- value to be propagated for each input position.
+		*	\param	[in]	influences			- influence value of each input position.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
+		*	\since version 0.0.4
+		*/
+		void computeIDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, vector<T> &values, zDoubleArray &influences, double power, double influenceRadius);
+
+		/*! \brief This method computes the field values as inverse weighted distance from the input positions which are closer than all the positions before them. Blocks of consecutive positions farther than the closest position so far are skipped.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	value				- value to be propagated.
+		*	\param	[in]	influence			- influence value.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
+		*	\since version 0.0.4
+		*/
+		void computeIDW_Nearest(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T value, double influence, double power, double influenceRadius);
+
+		/*! \brief This method computes the scalars as the offset distance to the nearest input position, using a k-d tree.
+		*
+		*	\param	[out]	scalars				- container for storing scalar values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	offset				- input distance variable.
+		*	\since version 0.0.4
+		*/
+		void computeVertexDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, float offset);
+
+		//--------------------------
+		//---- PROTECTED DIFFUSION METHODS
+		//--------------------------
+
+		/*! \brief This method computes one diffusion step of the input grid values with a square stencil of the input number of rings, clipped at the field boundary.
+		*
+		*	\details The stencil sums the neighbours in the same order as the ring neighbourhood of zItMeshScalarField::getNeighbour_Ring. Laplacian diffusion weights the centre with -((2R + 1)^2 - 1), which balances the neighbours of R rings, unless a centre weight is given, and adds the damped sum to the centre value. Average diffusion divides the sum by the number of cells in the clipped stencil.
+		*	Interior cells are evaluated a row at a time with branch free loops over contiguous memory, so the inner loops vectorize.
+		*	\param		[in]	inValues		- input pointer to the grid values, of size n_X * n_Y.
+		*	\param		[out]	outValues		- output pointer to the diffused values, of size n_X * n_Y. It must not overlap the input.
+		*	\param		[in]	numRings		- number of rings of the stencil.
+		*	\param		[in]	diffuseDamp		- damping value of the laplacian.
+		*	\param		[in]	type			- diffusion type - zlaplacian / zAverage.
+		*	\param		[in]	scale			- scale applied to the diffused values.
+		*	\param		[in]	centreWeight	- laplacian weight of the centre cell. The balanced weight is used if it is 0.
+		*	\since version 0.0.4
+		*/
+		void computeDiffusion(float *inValues, float *outValues, int numRings, double diffuseDamp, zDiffusionType type, double scale = 1.0, double centreWeight = 0.0);
+
 		//--------------------------
 		//---- PROTECTED METHODS
 		//--------------------------
@@ -918,6 +1049,27 @@ namespace zSpace
 		*/
 		float getScalar_Polygon(zObjGraph& inGraphObj, zPoint& p);
 
+		/*! \brief This method gets the grid coordinates of the input position, clamped to the field bounds.
+		*
+		*	\param	[in]	samplePos		- sample position.
+		*	\param	[out]	fX				- grid coordinate in X.
+		*	\param	[out]	fY				- grid coordinate in Y.
+		*	\return			bool			- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		bool getSampleCoordinates(zPoint &samplePos, float &fX, float &fY);
+
+		/*! \brief This method computes the bilinear field values and / or gradients of a range of sample positions, 4 at a time with SIMD where available.
+		*
+		*	\param	[in]	samplePositions	- input pointer to the sample positions.
+		*	\param	[in]	numSamples		- number of sample positions.
+		*	\param	[out]	fieldValues		- output pointer to the field values, nullptr if not required.
+		*	\param	[out]	gradients		- output pointer to the gradients, nullptr if not required.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		void sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients);
+
 		/*! \brief This method gets the scalar for the input point.
 		*
 		*	\detail based on https://iquilezles.org/www/articles/distfunctions2d/distfunctions2d.htm.
@@ -1019,31 +1171,285 @@ namespace zSpace
 		/*! \brief This method gets the isoline polygon for the input mesh at the given input face index.
 		*
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	polyConnects	- container of polygon connectivity of the computed polygon.
-		*	\param	[in]	polyCounts		- container of number of vertices in the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed polygons.
 		*	\param	[in]	threshold		- field threshold.
 		*	\param	[in]	invertMesh	- true if inverted mesh is required.
 		*	\since version 0.0.2
 		*/
-		void getIsolinePoly(zItMeshFace& f , zPointArray &positions, zIntArray &polyConnects, zIntArray &polyCounts, unordered_map <string, int> &positionVertex, float &threshold, bool invertMesh);
+		void getIsolinePoly(zItMeshFace& f , zIsoContourBuffer &contour, float &threshold, bool invertMesh);
 
 		/*! \brief This method gets the isoline polygon for the input mesh at the given input face index.
 		*
 		*	\param	[in]	f				- input face iterator.
-		*	\param	[in]	positions		- container of positions of the computed polygon.
-		*	\param	[in]	polyConnects	- container of polygon connectivity of the computed polygon.
-		*	\param	[in]	polyCounts		- container of number of vertices in the computed polygon.
-		*	\param	[in]	positionVertex	- map of position and vertices, to remove overlapping vertices.
+		*	\param	[in]	contour			- buffer of the computed polygons.
 		*	\param	[in]	thresholdLow	- field threshold domain minimum.
 		*	\param	[in]	thresholdHigh	- field threshold domain maximum.
 		*	\since version 0.0.2
 		*/
-		void getIsobandPoly(zItMeshFace& f, zPointArray &positions, zIntArray &polyConnects, zIntArray &polyCounts, unordered_map <string, int> &positionVertex, float &thresholdLow, float &thresholdHigh);
+		void getIsobandPoly(zItMeshFace& f, zIsoContourBuffer &contour, float &thresholdLow, float &thresholdHigh);
 
 	};	
 
+	//---- explicit specialization declarations
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::from(string path, zFileTpye type, bool _setValuesperVertex, bool _trimesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::from(string path, zFileTpye type, bool _setValuesperVertex, bool _trimesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::to(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::to(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _NR, bool _setValuesperVertex, bool _triMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _NR, bool _setValuesperVertex, bool _triMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::create(double _unit_X, double _unit_Y, int _n_X, int _n_Y, zPoint _minBB, int _NR, bool _setValuesperVertex, bool _triMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::create(double _unit_X, double _unit_Y, int _n_X, int _n_Y, zPoint _minBB, int _NR, bool _setValuesperVertex, bool _triMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::createVectorFromScalarField(zObjMeshField<zScalar> &scalarFieldObj);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getNeighbour_Contained(zPoint &pos, vector<int> &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::getNeighbour_Contained(zPoint &pos, vector<int> &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getNeighbourPosition_Contained(zPoint &pos, zPointArray &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::getNeighbourPosition_Contained(zPoint &pos, zPointArray &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::getFieldValue(zPoint &samplePos, zFieldValueType type, zScalar& fieldValue);
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zVector>::getFieldValue(zPoint &samplePos, zFieldValueType type, zVector& fieldValue);
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::getScalarValue(zScalarArray& scalars, zPoint& samplePos, zFieldValueType type, zScalar& fieldValue);
+
+	template<>
+	ZSPACE_INLINE zVector zFnMeshField<zScalar>::getGradient(zItMeshScalarField &s, float epsilon);
+
+	template<>
+	ZSPACE_INLINE vector<zVector> zFnMeshField<zScalar>::getGradients(float epsilon);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, zScalarArray &fieldValues);
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::sampleGradient(zPoint &samplePos, zVector &gradient);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleGradients(zPointArray &samplePositions, zVectorArray &gradients);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::setFieldValues(zScalarArray& fValues);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::setFieldValues(vector<zVector>& fValues);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zPointArray &inPositions, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zPointArray &inPositions, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjMesh &inMeshObj, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjGraph &inGraphObj, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjMesh &inMeshObj, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjGraph &inGraphObj, float offset, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_depthPolygon(zScalarArray& scalars, zScalarArray& polygonScalars, zObjGraph& inGraphObj, int startVertexId, float offset, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_VariableDepth(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, zDomainFloat offset1, zDomainFloat offset2, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_VariableDepth(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, vector<zDomainFloat>& thicknessOffsets1, vector<zDomainFloat>& thicknessOffsets2, vector<zDomainFloat> &intervals, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_VariableDepth(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, zObjGraph& inThkGraphObj, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_SineInfill(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, zDomainFloat offset1, zDomainFloat offset2, int numTriangles, float transY, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_SineInfill(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, vector<zDomainFloat>& thicknessOffsets1, vector<zDomainFloat>& thicknessOffsets2, vector<zDomainFloat>& intervals, int numTriangles, float transY, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_SineInfill(zScalarArray& scalars, zScalarArray& polygonScalars, zObjGraph& inGraphObj, zObjGraph& inPolyObj, int startVertexId, float numTriangles, float offset, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_Infill(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_InfillBoundary(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_topBottomTrim(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float offset, int type, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_InfillTrim(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool normalise, zObjGraph& outGraph);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_InfillTrimBoundary(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool stepTrim, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_InfillInteriorTrimBoundary(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool stepTrim, bool normalise, zObjGraph& outGraph);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_Pattern(zScalarArray& scalars, zObjGraph& inPolyObj, zItGraphHalfEdgeArray& topHE, zItGraphHalfEdgeArray& bottomHE, float& topLength, float& bottomLength, int numTriangles, float maxTriangleLength, float printWidth, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_3dp_Triangle(zScalarArray& scalars, zObjGraph& inGraphObj, int startVertexId, zFloatArray& offsets, zFloatArray& intervals, zVector planeNorm, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Polygon(zScalarArray& scalars, zObjGraph& inGraphObj, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Circle(zScalarArray &scalars, zVector &cen, float r, double annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Ellipse(zScalarArray& scalars, zVector& cen, float a, float b, double annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Line(zScalarArray &scalars, zVector &v0, zVector &v1, double annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Triangle(zScalarArray& scalars, zPoint& p0, zPoint& p1, zPoint& p2, double annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Square(zScalarArray &scalars, zVector& cen, zVector &dimensions, float annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Trapezoid(zScalarArray &scalars, float r1, float r2, float he, float annularVal, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_SinBands(zScalarArray& scalars, zObjGraph& inGraphObj, zVector& pNorm, zPoint& pCen, float scale);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::normliseValues(zScalarArray &fieldValues);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::normliseValues(vector<zVector> &fieldValues);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp, zDiffusionType type, int numRings);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::computePositionsInFieldIndex(zPointArray &positions, vector<zPointArray> &fieldIndexPositions);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::computePositionsInFieldIndex(zPointArray &positions, vector<zPointArray> &fieldIndexPositions);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::computePositionIndicesInFieldIndex(zPointArray &positions, vector<zIntArray> &fieldIndexPositionIndicies);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::computePositionIndicesInFieldIndex(zPointArray &positions, vector<zIntArray> &fieldIndexPositionIndicies);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_union(zScalarArray& scalars0, zScalarArray& scalars1, zScalarArray& scalarsResult, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_subtract(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_intersect(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_difference(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_clipwithPlane(zScalarArray& scalars, zPlane& clipPlane);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_clipwithPlane(zScalarArray& fieldValues_A, zScalarArray& fieldValues_Result, zPoint& O, zVector& Z);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::updateColors();
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsocontour(zObjGraph &coutourGraphObj, float inThreshold);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsolineMesh(zObjMesh &coutourMeshObj, float inThreshold, bool invertMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsobandMesh(zObjMesh &coutourMeshObj, float inThresholdLow, float inThresholdHigh, bool invertMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::toBMP(string outfilename);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::fromBMP(string infilename);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Polygon(zObjGraph& inGraphObj, zPoint& p);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Circle(zPoint &cen, zPoint &p, float r);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Ellipse(zPoint& cen, zPoint& p, float a, float b);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Line(zPoint &p, zPoint &v0, zPoint &v1);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Triangle(zPoint& p, zPoint& p0, zPoint& p1, zPoint& p2);
+
+	template<>
+	ZSPACE_INLINE float zFnMeshField<zScalar>::getScalar_Square(zPoint &p, zVector& cen, zVector &dimensions);
+
+	template<>
+	ZSPACE_INLINE double zFnMeshField<zScalar>::getScalar_Trapezoid(zPoint &p, float &r1, float &r2, float &he);
+
+	template<>
+	ZSPACE_INLINE int zFnMeshField<zScalar>::getIsolineCase(bool vertexBinary[4]);
+
+	template<>
+	ZSPACE_INLINE int zFnMeshField<zScalar>::getIsobandCase(int vertexTernary[4]);
+
+	template<>
+	ZSPACE_INLINE zVector zFnMeshField<zScalar>::getContourPosition(float &threshold, zVector& vertex_lower, zVector& vertex_higher, float& thresholdLow, float& thresholdHigh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsolinePoly(zItMeshFace& f, zIsoContourBuffer &contour, float &threshold, bool invertMesh);
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsobandPoly(zItMeshFace& f, zIsoContourBuffer &contour, float &thresholdLow, float &thresholdHigh);
+
 	/** \addtogroup zInterface
 	*	\brief The Application Program Interface of the library.
 	*  @{
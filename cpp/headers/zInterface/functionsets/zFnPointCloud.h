@@ -226,6 +226,20 @@ namespace zSpace
 		*/
 		void toCSV(string outfilename);
 
+		/*! \brief This method imports a point cloud from a zBIN binary file. The file is memory mapped and the containers are copied directly from its blocks.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void fromBIN(string infilename);
+
+		/*! \brief This method exports the point cloud to a zBIN binary file, storing the positions, colors and weights as contiguous little-endian blocks.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toBIN(string outfilename);
+
 	};
 }
 
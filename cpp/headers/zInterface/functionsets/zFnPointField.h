@@ -26,6 +26,10 @@
 
 #include<headers/zInterface/iterators/zItPointField.h>
 
+#include<headers/zCore/spatial/zKdTree.h>
+#include<headers/zCore/spatial/zBVH.h>
+#include<headers/zCore/base/zThreadPool.h>
+
 namespace zSpace
 {
 	/** \addtogroup zInterface
@@ -268,6 +272,48 @@ namespace zSpace
 		*/
 		vector<zVector> getGradients(float epsilon = EPS);
 
+		//--------------------------
+		//---- SAMPLE METHODS
+		//--------------------------
+
+		/*! \brief This method samples the field at the input position with grid arithmetic on the field values, without neighbour queries or heap allocation. Positions outside the field are clamped to its bounds.
+		*
+		*	\param		[in]	samplePos	- sample position.
+		*	\param		[in]	type		- type of sampling. zFieldIndex / zFieldNearest / zFieldLinear (trilinear)
+		*	\param		[out]	fieldValue	- output field value.
+		*	\return				bool		- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		bool sampleFieldValue(zPoint &samplePos, zFieldValueType type, T &fieldValue);
+
+		/*! \brief This method samples the field at the input positions in parallel. Scalar fields use SIMD for zFieldLinear where available.
+		*
+		*	\param		[in]	samplePositions	- container of sample positions.
+		*	\param		[in]	type			- type of sampling. zFieldIndex / zFieldNearest / zFieldLinear (trilinear)
+		*	\param		[out]	fieldValues		- container of field values, one per sample position.
+		*	\since version 0.0.4
+		*/
+		void sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, vector<T> &fieldValues);
+
+		/*! \brief This method computes the gradient of the trilinear interpolation of the field at the input position.
+		*
+		*	\param		[in]	samplePos	- sample position.
+		*	\param		[out]	gradient	- output gradient vector.
+		*	\return				bool		- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		bool sampleGradient(zPoint &samplePos, zVector &gradient);
+
+		/*! \brief This method computes the gradients of the trilinear interpolation of the field at the input positions in parallel.
+		*
+		*	\param		[in]	samplePositions	- container of sample positions.
+		*	\param		[out]	gradients		- container of gradient vectors, one per sample position.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		void sampleGradients(zPointArray &samplePositions, zVectorArray &gradients);
+
 		//--------------------------
 		//---- SET METHODS
 		//--------------------------
@@ -307,9 +353,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values as inverse weighted distance from the input graph vertex positions.
 		*
@@ -319,9 +366,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -331,9 +379,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 		
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -343,9 +392,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -355,9 +405,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
@@ -368,9 +419,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double influenceRadius = 0.0);
 
 		//--------------------------
 		//----  3D SCALAR FIELD METHODS
@@ -592,10 +644,192 @@ namespace zSpace
 		*	\since version 0.0.2
 		*/
 		void createPointCloud();
+
+		/*! \brief This method gets the grid coordinates of the input position, clamped to the field bounds.
+		*
+		*	\param	[in]	samplePos		- sample position.
+		*	\param	[out]	fX				- grid coordinate in X.
+		*	\param	[out]	fY				- grid coordinate in Y.
+		*	\param	[out]	fZ				- grid coordinate in Z.
+		*	\return			bool			- true if sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		bool getSampleCoordinates(zPoint &samplePos, float &fX, float &fY, float &fZ);
+
+		/*! \brief This method computes the trilinear field values and / or gradients of a range of sample positions, 4 at a time with SIMD where available.
+		*
+		*	\param	[in]	samplePositions	- input pointer to the sample positions.
+		*	\param	[in]	numSamples		- number of sample positions.
+		*	\param	[out]	fieldValues		- output pointer to the field values, nullptr if not required.
+		*	\param	[out]	gradients		- output pointer to the gradients, nullptr if not required.
+		*	\since version 0.0.4
+		*	\warning works only with scalar fields
+		*/
+		void sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients);
+
+		//--------------------------
+		//---- PROTECTED DISTANCE METHODS
+		//--------------------------
+
+		/*! \brief This method computes the field values as inverse weighted distance from all the input positions, or the ones within the influence radius using a k-d tree.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	values				- value to be propagated for each input position.
+		*	\param	[in]	influences			- influence value of each input position.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
+		*	\since version 0.0.4
+		*/
+		void computeIDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, vector<T> &values, zDoubleArray &influences, double power, double influenceRadius);
+
+		/*! \brief This method computes the field values as inverse weighted distance from the input positions which are closer than all the positions before them. Blocks of consecutive positions farther than the closest position so far are skipped.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	value				- value to be propagated.
+		*	\param	[in]	influence			- influence value.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	influenceRadius		- input positions farther than the radius are ignored. All the positions are used if the radius is 0.
+		*	\since version 0.0.4
+		*/
+		void computeIDW_Nearest(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T value, double influence, double power, double influenceRadius);
+
+		/*! \brief This method computes the scalars as the distance function of the square distance to the nearest input position, using a k-d tree.
+		*
+		*	\param	[out]	scalars				- container for storing scalar values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	a					- input variable for distance function.
+		*	\param	[in]	b					- input variable for distance function.
+		*	\since version 0.0.4
+		*/
+		void computeVertexDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, double a, double b);
+
+		/*! \brief This method computes the scalars as the distance function of the distance to the closest input edge, using a bounding volume hierarchy.
+		*
+		*	\param	[out]	scalars				- container for storing scalar values.
+		*	\param	[in]	inPositions			- input pointer to the positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	edgeVertices		- input container of edge vertex indicies, 2 per edge.
+		*	\param	[in]	a					- input variable for distance function.
+		*	\param	[in]	b					- input variable for distance function.
+		*	\since version 0.0.4
+		*/
+		void computeEdgeDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, zIntArray &edgeVertices, double a, double b);
 		
 
 	};	
 
+	//---- explicit specialization declarations
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, int _NR);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, int _NR);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::create(double _unit_X, double _unit_Y, double _unit_Z, int _n_X, int _n_Y, int _n_Z, zPoint _minBB, int _NR);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::create(double _unit_X, double _unit_Y, double _unit_Z, int _n_X, int _n_Y, int _n_Z, zPoint _minBB, int _NR);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::createVectorFromScalarField(zFnPointField<zScalar> &inFnScalarField);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getNeighbour_Contained(zPoint &pos, zIntArray &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getNeighbourPosition_Contained(zPoint &pos, zPointArray &containedNeighbour);
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zScalar>::getFieldValue(zPoint &samplePos, zFieldValueType type, zScalar& fieldValue);
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zVector>::getFieldValue(zVector &samplePos, zFieldValueType type, zVector& fieldValue);
+
+	template<>
+	ZSPACE_INLINE zVector zFnPointField<zScalar>::getGradient(zItPointScalarField &s, float epsilon);
+
+	template<>
+	ZSPACE_INLINE vector<zVector> zFnPointField<zScalar>::getGradients(float epsilon);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, zScalarArray &fieldValues);
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zScalar>::sampleGradient(zPoint &samplePos, zVector &gradient);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleGradients(zPointArray &samplePositions, zVectorArray &gradients);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::setFieldValues(zScalarArray &fValues);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::setFieldValues(vector<zVector>& fValues);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjMesh &inMeshObj, double a, double b, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjGraph &inGraphObj, double a, double b, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjMesh &inMeshObj, double a, double b, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjGraph &inGraphObj, double a, double b, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::normliseValues(zScalarArray &fieldValues);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::normliseValues(vector<zVector> &fieldValues);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::smoothField(int numSmooth, double diffuseDamp, zDiffusionType type);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::computePositionsInFieldIndex(zPointArray &positions, vector<zPointArray> &fieldIndexPositions);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::computePositionsInFieldIndex(zPointArray &positions, vector<zPointArray> &fieldIndexPositions);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::computePositionIndicesInFieldIndex(zPointArray &positions, vector<zIntArray> &fieldIndexPositionIndicies);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zVector>::computePositionIndicesInFieldIndex(zPointArray &positions, vector<zIntArray> &fieldIndexPositionIndicies);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_union(zScalarArray& scalars0, zScalarArray& scalars1, zScalarArray& scalarsResult, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_subtract(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_intersect(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_difference(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_clipwithPlane(zScalarArray& scalars, zMatrix4& clipPlane);
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::updateColors();
+
 	/** \addtogroup zInterface
 	*	\brief The Application Program Interface of the library.
 	*  @{
@@ -15,6 +15,7 @@
 
 #pragma once
 #include <headers/zInterface/objects/zObj.h>
+#include <headers/zCore/utilities/zUtilsRaster.h>
 
 #if defined (ZSPACE_UNREAL_INTEROP) || defined (ZSPACE_MAYA_INTEROP) || defined (ZSPACE_RHINO_INTEROP)
 	// Do Nothing
@@ -99,9 +100,11 @@ namespace zSpace
 
 		/*! \brief Overloaded constructor.
 		*
+		*	\param		[in]	_buffersize		- size of the display buffer.
+		*	\param		[in]	_headless		- true if the display buffer is stored in host memory, to be drawn with zUtilsRaster without an OPENGL context.
 		*	\since version 0.0.2
 		*/
-		zModel(int _buffersize);
+		zModel(int _buffersize, bool _headless = false);
 
 		//--------------------------
 		//---- DESTRUCTOR
@@ -141,6 +144,13 @@ namespace zSpace
 		*/
 		void draw();
 
+		/*! \brief This method draws the shown contents of the headless display buffer to the input rasteriser. Scene objects are drawn only if they are appended to the buffer.
+		*
+		*	\param		[in]	raster			- input rasteriser.
+		*	\since version 0.0.4
+		*/
+		void draw(zUtilsRaster &raster);
+
 		//--------------------------
 		//---- SET METHODS
 		//--------------------------
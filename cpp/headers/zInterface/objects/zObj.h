@@ -16,6 +16,8 @@
 #pragma once
 
 #include <headers/zCore/utilities/zUtilsCore.h>
+#include <headers/zCore/utilities/zUtilsBinary.h>
+#include <headers/zCore/utilities/zUtilsText.h>
 
 #ifndef __CUDACC__
 	#include <headers/zCore/utilities/zUtilsJson.h>
@@ -18,6 +18,9 @@
 
 #include <headers/zInterface/functionsets/zFnMesh.h>
 #include <headers/zCore/base/zMatrix.h>
+#include <headers/zCore/base/zThreadPool.h>
+
+#include <random>
 
 namespace zSpace
 {
@@ -39,7 +42,8 @@ namespace zSpace
 
 	/*! \class zTsKMeans
 	*	\brief A tool set for doing K-Means clustering.
-	*	\details Based on https://www.geeksforgeeks.org/k-means-clustering-introduction/
+	*	\details Based on https://www.geeksforgeeks.org/k-means-clustering-introduction/ . The means are seeded with k-means++ ( http://ilpubs.stanford.edu:8090/778/1/2006-13.pdf ), 
+	*	the assignment uses Hamerly bounds ( https://epubs.siam.org/doi/pdf/10.1137/1.9781611972801.12 ) and the mini-batch mode is based on https://www.eecs.tufts.edu/~dsculley/papers/fastkmeans.pdf
 	*
 	*	\since version 0.0.2
 	*/
@@ -84,6 +88,12 @@ namespace zSpace
 		
 		/*!	\brief 2 dimensional container of cluster items*/
 		vector<vector<int>> clusters;
+
+		/*!	\brief container of cluster index per data point*/
+		zIntArray clusterIDs;
+
+		/*!	\brief initialisation type of the means - zKMeansRandom / zKMeansPlusPlus.*/
+		zKMeansInitType initType;
 	
 		//--------------------------
 		//---- CONSTRUCTOR
@@ -139,21 +149,64 @@ namespace zSpace
 		*/
 		void setNumIterations(int &_numIterations);
 
+		/*! \brief This method sets the initialisation type of the means.
+		*
+		*	\param		[in]	_initType			- input initialisation type - zKMeansRandom / zKMeansPlusPlus.
+		*	\since version 0.0.4
+		*/
+		void setInitType(zKMeansInitType _initType);
+
+		/*! \brief This method sets the seed of the random number generator used for the initialisation and the mini-batches.
+		*
+		*	\param		[in]	seed				- input seed.
+		*	\since version 0.0.4
+		*/
+		void setSeed(unsigned int seed);
+
 		//--------------------------
 		//---- CLUSTERING METHODS
 		//--------------------------
 			   
 		/*! \brief This method computes classify the input data into input number of clusters using the K-Means Algorithm.
 		*
+		*	\details The distances of the first assignment are computed in blocks as matrix products over the global thread pool. Later assignments skip the points whose Hamerly bounds show that their cluster cannot change.
 		*	\param	[out]	actualNumClusters		- actual number of clusters after removing clusters of size 0.
 		*	\return			int						- number of interations the algorithm ran.
 		*/
 		int getKMeansClusters(int &actualNumClusters);
 
+		/*! \brief This method classifies the input data into input number of clusters using the mini-batch K-Means Algorithm.
+		*
+		*	\details Each iteration updates the means with a random batch of the data points. All data points are assigned to the final means.
+		*	\param	[out]	actualNumClusters		- actual number of clusters after removing clusters of size 0.
+		*	\param	[in]	batchSize				- input number of data points per batch.
+		*	\return			int						- number of interations the algorithm ran.
+		*	\since version 0.0.4
+		*/
+		int getKMeansClusters_MiniBatch(int &actualNumClusters, int batchSize = 1024);
+
+		/*! \brief This method updates the means with the input batch of data points, for streaming data.
+		*
+		*	\details The means are initialised from the batch if they do not have the number of clusters as rows.
+		*	\param	[in]	batch					- input matrix of data points, one per row.
+		*	\since version 0.0.4
+		*/
+		void updateMeans_MiniBatch(MatrixXf &batch);
+
 		//--------------------------
 		//---- PROTECTED METHODS
 		//--------------------------
 	protected:
+
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief random number generator.*/
+		std::mt19937 randomEngine;
+
+		/*!	\brief number of data points per mean of the mini-batch updates.*/
+		VectorXi meanCounts;
 			
 		/*! \brief This method initialises the means based on the minimum and maximum value in the data points.
 		*
@@ -170,13 +223,33 @@ namespace zSpace
 		*/
 		int getClusterIndex(MatrixXf &data, MatrixXf &means);
 
-		/*! \brief This method updates the mean value of the cluster based on the input data point and cluster size.
+		/*! \brief This method initialises the means using k-means++ seeding.
+		*
+		*	\param	[in]	points			- input matrix of data points, one per column.
+		*	\return			MatrixXf		- matrix of means, one per column.
+		*	\since version 0.0.4
+		*/
+		MatrixXf intialiseMeans_PlusPlus(MatrixXf &points);
+
+		/*! \brief This method assigns the input data points to the nearest means, computing the distances in blocks as matrix products.
+		*
+		*	\param	[in]	points			- input matrix of data points, one per column.
+		*	\param	[in]	centers			- input matrix of means, one per column.
+		*	\param	[out]	ids				- output container of cluster index per data point.
+		*	\param	[out]	upper			- output distance per data point to its mean.
+		*	\param	[out]	lower			- output distance per data point to its second nearest mean.
+		*	\since version 0.0.4
+		*/
+		void assignClusters(MatrixXf &points, MatrixXf &centers, zIntArray &ids, VectorXf &upper, VectorXf &lower);
+
+		/*! \brief This method sets the clusters, cluster indicies and means from the input assignment, removing clusters of size 0.
 		*
-		*	\param	[in]	data			- input row matrix of datapoints.
-		*	\param	[in]	mean			- input row matrix of means.
-		*	\param	[in]	clusterSize		- current cluster size.
+		*	\param	[in]	ids					- input container of cluster index per data point.
+		*	\param	[in]	centers				- input matrix of means, one per column.
+		*	\param	[out]	actualNumClusters	- actual number of clusters after removing clusters of size 0.
+		*	\since version 0.0.4
 		*/
-		void updateMean(MatrixXf &data, MatrixXf &mean, int clusterSize);
+		void setClusters(zIntArray &ids, MatrixXf &centers, int &actualNumClusters);
 			
 		
 	};
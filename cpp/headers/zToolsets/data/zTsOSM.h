@@ -252,6 +252,38 @@ namespace zSpace
 		/*!	\brief database needed to acces the OSM and other data.  */
 		zDatabase *zDB;
 
+		//--------------------------
+		//---- PRIVATE METHODS
+		//--------------------------
+
+		/*! \brief This method binds the lat_lon bounds to the parameters ?1 to ?4 of the input cursor, as minimum latitude, minimum longitude, maximum latitude and maximum longitude.
+		*
+		*	\param		[in]	cursor		- input cursor.
+		*	\since version 0.0.4
+		*/
+		void bindBounds(zDatabaseCursor &cursor);
+
+		/*! \brief This method returns the query selecting the ids of the ways with the input tag condition. If inBounds is true the ways are limited to the ones overlapping the lat_lon bounds through the ways R*Tree, and the query expects the bounds bound with bindBounds.
+		*
+		*	\param		[in]	tagCondition	- condition on the ways_tags columns.
+		*	\param		[in]	inBounds		- true if the ways are to be limited to the bounds.
+		*	\return				string			- sub query returning way ids.
+		*	\since version 0.0.4
+		*/
+		string getWayIdsQuery(string tagCondition, bool inBounds);
+
+		/*! \brief This method reads the records of the input CSV data file with format - lat,lon,data. The lines are parsed in parallel and lines without 3 fields or with an empty first field are skipped.
+		*
+		*	\param		[in]	infilename	- input file name including the directory path and extension.
+		*	\param		[out]	csvFile		- text reader holding the file buffer the data tokens point to.
+		*	\param		[out]	lats		- container of record latitudes.
+		*	\param		[out]	lons		- container of record longitudes.
+		*	\param		[out]	dataTokens	- container of record data tokens.
+		*	\return				bool		- true if the file is read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readCoordinatesCSV(string infilename, zUtilsTextReader &csvFile, zDoubleArray &lats, zDoubleArray &lons, vector<zUtilsTextToken> &dataTokens);
+
 	public:
 
 		//--------------------------
@@ -360,14 +392,20 @@ namespace zSpace
 		*/
 		void createFieldFromBounds(int _n_X = 100, int _n_Y = 100);
 
-		/*! \brief This method creates the streets from the OSM data.
+		/*! \brief This method creates the R*Tree spatial index tables of the OSM data, for the way bounds, the building shape bounds and the tube station points, along with the indices needed to join them back to the data tables.
+		*	\details It is an import step, run once per database. Once it exists, the create methods only load the features overlapping the lat_lon bounds, so a region load is bounded by the number of features in view.
+		*	\since version 0.0.4
+		*/
+		void createSpatialIndex();
+
+		/*! \brief This method creates the streets from the OSM data. If the spatial index exists, only the streets overlapping the lat_lon bounds are loaded.
 		*
 		*	\param		[in]	edgeCol		- input color to be assigned to the edges of the graph.
 		*	\since version 0.0.1
 		*/
 		void createStreets(zColor streetCol = zColor(0, 0, 0, 1));
 
-		/*! \brief This method creates the building graph from the OSM data.
+		/*! \brief This method creates the building graph from the OSM data. If the spatial index exists, only the buildings overlapping the lat_lon bounds are loaded.
 		*
 		*	\param		[in]	edgeCol		- input color to be assigned to the edges of the graph.
 		*	\since version 0.0.1
@@ -401,6 +439,13 @@ namespace zSpace
 		*/
 		zDataStreet getStreetType(string wayId);
 
+		/*! \brief This method checks if the R*Tree spatial index tables exist in the database.
+		*
+		*	\return				bool		- true if the spatial index exists.
+		*	\since version 0.0.4
+		*/
+		bool hasSpatialIndex();
+
 		/*! \brief This method extracts the edges from the street graph based on the input key and value for OSM ways tags.
 		*
 		*	\param		[in]	k			- key of the relations tag.
@@ -514,28 +559,16 @@ namespace zSpace
 			s.setValue(0.0, i);
 		}
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
-
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return;
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		}
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -551,7 +584,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				string inData = (perlineData[2]);
+				string inData = csvFile.toString(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -563,8 +596,6 @@ namespace zSpace
 			}
 
 		}
-
-		myfile.close();
 	}
 	
 	//---- double specialization for updateScalars_fromCSV 
@@ -579,28 +610,16 @@ namespace zSpace
 			s.setValue(0.0, i);
 		}
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -617,7 +636,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atof(perlineData[2].c_str());
+				double inData = csvFile.toDouble(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -633,8 +652,6 @@ namespace zSpace
 
 
 		}
-
-		myfile.close();
 	}
 
 	//---- float specialization for updateScalars_fromCSV 
@@ -649,28 +666,16 @@ namespace zSpace
 			s.setValue(0.0, i);
 		}
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -686,7 +691,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atof(perlineData[2].c_str());
+				double inData = csvFile.toDouble(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -697,8 +702,6 @@ namespace zSpace
 
 
 		}
-
-		myfile.close();
 	}
 
 	//---- int specialization for updateScalars_fromCSV 
@@ -713,28 +716,16 @@ namespace zSpace
 			s.setValue(0.0, i);
 		}
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -750,7 +741,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atoi(perlineData[2].c_str());
+				double inData = csvFile.toInt(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -761,8 +752,6 @@ namespace zSpace
 			}
 
 		}
-
-		myfile.close();
 	}
 
 	//---------------//
@@ -774,28 +763,16 @@ namespace zSpace
 		dataPositions.clear();
 		data.clear();
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " \n error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 
 
@@ -815,7 +792,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				string inData = (perlineData[2]);
+				string inData = csvFile.toString(dataTokens[j]);
 
 				data.push_back(inData);
 				
@@ -829,8 +806,6 @@ namespace zSpace
 			}
 
 		}
-
-		myfile.close();
 	}
 
 	//---- double specialization for updateScalars_fromCSV  with datapositions
@@ -840,28 +815,16 @@ namespace zSpace
 		dataPositions.clear();
 		data.clear();
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " \n error in opening file  " << infilename.c_str() << endl;
-			return;
-
-		}
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -879,7 +842,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atof(perlineData[2].c_str());
+				double inData = csvFile.toDouble(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -895,8 +858,6 @@ namespace zSpace
 
 
 		}
-
-		myfile.close();
 	}
 
 	//---- float specialization for updateScalars_fromCSV  with datapositions
@@ -906,28 +867,16 @@ namespace zSpace
 		dataPositions.clear();
 		data.clear();
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " \n error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 
 
@@ -947,7 +896,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atof(perlineData[2].c_str());
+				double inData = csvFile.toDouble(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -962,8 +911,6 @@ namespace zSpace
 
 
 		}
-
-		myfile.close();
 	}
 
 	//---- int specialization for updateScalars_fromCSV  with datapositions
@@ -973,29 +920,16 @@ namespace zSpace
 		dataPositions.clear();
 		data.clear();
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		zDoubleArray lats, lons;
+		vector<zUtilsTextToken> dataTokens;
 
-		if (myfile.fail())
-		{
-			cout << " \n error in opening file  " << infilename.c_str() << endl;
-			return;
+		if (!readCoordinatesCSV(infilename, csvFile, lats, lons, dataTokens)) return;
 
-		}
-
-		while (!myfile.eof())
+		for (int j = 0; j < lats.size(); j++)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = coreUtils.splitString(str, ",");
-
-			if (perlineData.size() != 3) continue;
-			if (perlineData[0] == " ") continue;
-
-
-			double lat = atof(perlineData[0].c_str());
-			double lon = atof(perlineData[1].c_str());
+			double lat = lats[j];
+			double lon = lons[j];
 
 			if (lat >= lat_lon[0] && lat <= lat_lon[2] && lon >= lat_lon[1] && lon <= lat_lon[3])
 			{
@@ -1013,7 +947,7 @@ namespace zSpace
 				zItMeshScalarField s(*fnField.fieldObj, fieldIndex);
 
 				// get data
-				double inData = atoi(perlineData[2].c_str());
+				double inData = csvFile.toInt(dataTokens[j]);
 
 				data.push_back(inData);
 
@@ -1025,8 +959,6 @@ namespace zSpace
 			}
 
 		}
-
-		myfile.close();
 	}
 
 	
@@ -18,6 +18,8 @@
 #include <headers/zInterface/functionsets/zFnMesh.h>
 #include <headers/zInterface/functionsets/zFnGraph.h>
 
+#include <headers/zCore/base/zThreadPool.h>
+
 #include <iostream>
 using namespace std;
 
@@ -154,6 +156,44 @@ namespace zSpace
 	*  @{
 	*/
 
+	/*! \struct zIKSolution
+	*	\brief A struct to store the inverse kinematics solution of a target.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	/** @}*/
+	struct zIKSolution
+	{
+		double rotations[DOF]; // joint rotations in degrees
+
+		zVector robotTCP_position;
+		zVector target_position;
+
+		double distDifference; // distance of joint 6 to its target
+
+		bool reachable;
+		int jointLimitViolations; // bit i is set if joint i is outside its limits
+	};
+
+	/** \addtogroup zToolsets
+	*	\brief Collection of toolsets for applications.
+	*  @{
+	*/
+
+	/** \addtogroup zTsDigiFab
+	*	\brief toolsets for digital fabrication related utilities.
+	*  @{
+	*/
+
+	/** \addtogroup zInverseKinematics
+	*	\brief toolsets for inverse kinematics chain.
+	*  @{
+	*/
+
 	/*! \class zTsRobot
 	*	\brief A class for inverse kinematics chain of a 6 Axis Robot.
 	*	\since version 0.0.2
@@ -218,6 +258,14 @@ namespace zSpace
 		*/
 		void updateTransform();
 
+		/*! \brief This method computes the transform of the link for the input joint angle, without changing the link.
+		*
+		*	\param		[in]	theta			- input joint angle in radians.
+		*	\param		[out]	outT			- output transform.
+		*	\since version 0.0.4
+		*/
+		void computeTransform(double theta, zTransform &outT) const;
+
 	};
 
 
@@ -439,6 +487,17 @@ namespace zSpace
 		*/
 		zVector inverseKinematics();
 
+		/*! \brief This Methods computes the inverse kinematics chain of the robot for a batch of targets, without updating the joint graph and meshes.
+		*	\details The targets are solved across threads in chunks. Each solution is then warm started from the previous one, taking the turn of every joint closest to the previous joint state and within the joint limits if possible. The first solution starts from the current joint rotations.
+		*
+		*	\param		[in]	targets			- input container of target matrices, as used by setTarget.
+		*	\param		[out]	solutions		- output container of solutions, one per target.
+		*	\param		[in]	tolerance		- distance of joint 6 to its target below which the target is reachable.
+		*	\param		[in]	grainSize		- number of targets per task, computed from the number of targets and threads if 0.
+		*	\since version 0.0.4
+		*/
+		void inverseKinematicsBatch(vector<zTransform> &targets, vector<zIKSolution> &solutions, double tolerance = 0.1, int grainSize = 0);
+
 		//--------------------------
 		//----MESH METHODS
 		//--------------------------
@@ -476,6 +535,15 @@ namespace zSpace
 		*/
 		void gCode_store(zVector &target_position, double velocity, zRobotMoveType moveType, zRobotEEControlType endEffectorControl);
 
+		/*! \brief This method stores the robot gcode of a solution from inverseKinematicsBatch.
+		*
+		*	\param [in]		solution				- solution to be stored.
+		*	\param [in]		velocity				- robot velocity.
+		*	\param [in]		moveType				- robot move type - zMoveLinear/zMoveJoint .
+		*	\since version 0.0.4
+		*/
+		void gCode_store(zIKSolution &solution, double velocity, zRobotMoveType moveType, zRobotEEControlType endEffectorControl);
+
 		/*! \brief This method exports the robot gcode to the input folder.
 		*
 		*	\param [in]		directoryPath			- input directory path.
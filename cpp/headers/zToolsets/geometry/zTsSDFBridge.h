@@ -25,6 +25,9 @@
 
 #include <headers/zInterface/functionsets/zFnMeshField.h>
 
+#include <headers/zCore/base/zThreadPool.h>
+
+#include <chrono>
 #include <stdlib.h>
 #include <stdio.h>
 #include <iostream>
@@ -214,6 +217,44 @@ namespace zSpace
 		bool footingBlock = false;
 	
 	};
+
+	/** \addtogroup zToolsets
+	*	\brief Collection of toolsets for applications.
+	*  @{
+	*/
+
+	/** \addtogroup zTsGeometry
+	*	\brief tool sets for geometry related utilities.
+	*  @{
+	*/
+
+	/*! \struct zSDFTimings
+	*	\brief A struct to hold the per stage timings of the SDF slicing, in seconds.
+	*	\details The stage timings are summed over all the layers, so with multiple threads they can exceed the wall time.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct zSDFTimings
+	{
+		/*!	\brief time spent computing the layer frames and evaluating the scalar fields  */
+		double fieldEvaluation = 0;
+
+		/*!	\brief time spent on the boolean, clipping and smoothing operations of the fields  */
+		double booleans = 0;
+
+		/*!	\brief time spent contouring the fields  */
+		double contouring = 0;
+
+		/*!	\brief wall time of the whole slicing  */
+		double total = 0;
+
+		/*!	\brief number of layers sliced  */
+		int numLayers = 0;
+	};
 	
 	/** \addtogroup zToolsets
 	*	\brief Collection of toolsets for applications.
@@ -701,11 +742,19 @@ namespace zSpace
 		*/
 		void computeBlockMesh(int blockId);
 
-		/*! \brief This method computes the SDF for the blocks.
+		/*! \brief This method computes the SDF for all the print layers of the block.
+		*	\details The layers are sliced in parallel, each on a scratch field allocated once per block. The last layer is sliced on the SDF field, so the field returned by getRawFieldMesh always holds it. The contour graph of a layer is passed to the layer callback as soon as it is computed.
 		*
+		*	\param		[in]	_block						- input block.
+		*	\param		[in]	printWidth					- input print width.
+		*	\param		[in]	neopreneOffset				- input neoprene offset.
+		*	\param		[in]	raftWidth					- input raft width.
+		*	\param		[in]	layerComputed				- input callback called with the section graph index and contour graph of every computed layer. The calls are serialised.
+		*	\param		[out]	timings						- output per stage timings of the slicing, if not null.
+		*	\param		[in]	printInfo					- input boolean indicating print of the timings.
 		*	\since version 0.0.4
 		*/
-		void computeSDF(zPrintBlock& _block, float printWidth, float neopreneOffset, float raftWidth);
+		void computeSDF(zPrintBlock& _block, float printWidth, float neopreneOffset, float raftWidth, std::function<void(int, zObjGraph&)> layerComputed = nullptr, zSDFTimings *timings = nullptr, bool printInfo = false);
 
 		//--------------------------
 		//---- UTILITY METHODS
@@ -875,17 +924,31 @@ namespace zSpace
 		*
 		*	\param		[in]	_block						- input block.
 		*	\param		[in]	graphId						- input index of section graph.
+		*	\param		[in]	fieldObj					- input scratch field to evaluate the layer on. The SDF field is used if null.
+		*	\param		[out]	timings						- output stage timings of the layer are added to it, if not null.
 		*	\since version 0.0.4
 		*/
-		void computeBlockSDF_Internal(zPrintBlock& _block, int graphId, int printLayerId, bool rightSide,  float printWidth = 0.020, float neopreneOffset = 0.005, bool addRaft = false, int raftId = 0, float raftWidth = 0.030 , bool exportBMP = false);
+		void computeBlockSDF_Internal(zPrintBlock& _block, int graphId, int printLayerId, bool rightSide,  float printWidth = 0.020, float neopreneOffset = 0.005, bool addRaft = false, int raftId = 0, float raftWidth = 0.030 , bool exportBMP = false, zObjMeshScalarField *fieldObj = nullptr, zSDFTimings *timings = nullptr);
 
 		/*! \brief This method compute the block SDF for the balustrade.
 		*
 		*	\param		[in]	_block						- input block.
 		*	\param		[in]	graphId						- input index of section graph.
+		*	\param		[in]	fieldObj					- input scratch field to evaluate the layer on. The SDF field is used if null.
+		*	\param		[out]	timings						- output stage timings of the layer are added to it, if not null.
+		*	\since version 0.0.4
+		*/
+		void computeBlockSDF_Boundary(zPrintBlock& _block, int graphId, float printWidth = 0.020, float neopreneOffset = 0.005, bool addRaft = false, int raftId = 0, float raftWidth = 0.030, zObjMeshScalarField *fieldObj = nullptr, zSDFTimings *timings = nullptr);
+
+		/*! \brief This method computes the inward facing trim plane of a section, without modifying the plane mesh.
+		*
+		*	\param		[in]	faceId						- input index of the plane mesh face.
+		*	\param		[in]	transform					- input transform to the local space of the section.
+		*	\param		[out]	cen							- output center of the plane.
+		*	\param		[out]	norm						- output inward normal of the plane.
 		*	\since version 0.0.4
 		*/
-		void computeBlockSDF_Boundary(zPrintBlock& _block, int graphId, float printWidth = 0.020, float neopreneOffset = 0.005, bool addRaft = false, int raftId = 0, float raftWidth = 0.030);
+		void computeSectionTrimPlane(int faceId, zTransform &transform, zPoint &cen, zVector &norm);
 
 		/*! \brief This method compute the transform from input Vectors.
 		*
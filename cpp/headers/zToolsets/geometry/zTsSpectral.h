@@ -21,6 +21,8 @@
 #include <depends/spectra/include/Spectra/MatOp/SparseSymShiftSolve.h>
 using namespace Spectra;
 
+#include <memory>
+
 namespace zSpace
 {
 
@@ -35,6 +37,11 @@ namespace zSpace
 	*  @{
 	*/
 
+	/*! \class zSpectralShiftSolve
+	*	\brief A shift-solve operator for the Spectra eigen solvers, keeping the sparse Cholesky factorisation of the shifted matrix between solves.
+	*	\since version 0.0.4
+	*/
+
 	/*! \class zTsSpectral
 	*	\brief A mesh spectral processing tool set class on triangular meshes.
 	*	\details Based on http://lgg.epfl.ch/publications/2006/botsch_2006_GMT_eg.pdf page 64 -67
@@ -45,6 +52,72 @@ namespace zSpace
 
 	/** @}*/
 
+	class ZSPACE_TOOLS zSpectralShiftSolve
+	{
+	protected:
+
+		/*!	\brief factorisation of the shifted matrix, shared between copies.  */
+		std::shared_ptr<SimplicialLDLT<zSparseMatrix>> solver;
+
+		/*!	\brief matrix to shift and factorise.  */
+		zSparseMatrix matrix;
+
+		/*!	\brief shift of the factorisation.  */
+		double shift;
+
+	public:
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zSpectralShiftSolve();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method sets the symmetric matrix of the operator, clearing the factorisation.
+		*
+		*	\param		[in]	_matrix			- input symmetric sparse matrix.
+		*	\since version 0.0.4
+		*/
+		void setMatrix(zSparseMatrix &_matrix);
+
+		/*! \brief This method gets the number of rows of the matrix.
+		*
+		*	\return			int				- number of rows.
+		*	\since version 0.0.4
+		*/
+		int rows() const;
+
+		/*! \brief This method gets the number of columns of the matrix.
+		*
+		*	\return			int				- number of columns.
+		*	\since version 0.0.4
+		*/
+		int cols() const;
+
+		/*! \brief This method factorises the matrix minus the input shift times identity, if it is not factorised with the same shift already.
+		*
+		*	\param		[in]	sigma			- input shift.
+		*	\since version 0.0.4
+		*/
+		void set_shift(double sigma);
+
+		/*! \brief This method solves the shifted matrix for the input vector.
+		*
+		*	\param		[in]	x_in			- input vector.
+		*	\param		[out]	y_out			- output vector.
+		*	\since version 0.0.4
+		*/
+		void perform_op(const double *x_in, double *y_out) const;
+	};
+
 	class ZSPACE_TOOLS zTsSpectral
 	{
 	protected:
@@ -83,6 +156,24 @@ namespace zSpace
 
 		/*!	\brief number of eigen vectors required.  */
 		int n_Eigens;
+
+		/*!	\brief number of eigen vectors computed for the current eigen operator.  */
+		int n_Solved = 0;
+
+		/*!	\brief solves the generalised eigen problem with the lumped mass matrix if true.  */
+		bool useMassMatrix = false;
+
+		/*!	\brief inverse square root of the lumped mass matrix, empty if the mass matrix is not used.  */
+		VectorXd massInvSqrt;
+
+		/*!	\brief symmetric matrix of the eigen problem.  */
+		zSparseMatrix eigenOperator;
+
+		/*!	\brief shift of the eigen solves, below the smallest eigen value.  */
+		double eigenShift = 0.0;
+
+		/*!	\brief cached shift-solve operator of the eigen operator.  */
+		zSpectralShiftSolve shiftSolve;
 		
 	public:
 
@@ -93,7 +184,7 @@ namespace zSpace
 		/*!	\brief mesh function set  */
 		zFnMesh fnMesh;	
 
-		/*!	\brief Eigen vectors matrix  */		
+		/*!	\brief Eigen vectors matrix. It has at least the requested number of eigen columns, as eigen vectors of a larger request are kept. */		
 		MatrixXd eigenVectors;
 
 		/*!	\brief Eigen values vector  */
@@ -151,6 +242,22 @@ namespace zSpace
 		*/
 		double computeEigenFunction(double &frequency, bool &computeEigenVectors);
 
+		/*! \brief This method computes the eigen operator from the mesh laplacian, and the lumped mass matrix if it is used, and factorises it for the eigen solves. 
+		*
+		*	\details The eigen vectors of the previous operator are kept as the start vector of the next solve. Needs to be called after the vertex positions change.
+		*	\since version 0.0.4
+		*/
+		void computeEigenOperator();
+
+		/*! \brief This method computes the eigen pairs of the smallest eigen values in a single Lanczos solve, reusing the cached factorisation.
+		*
+		*	\details No solve is done if the eigen pairs are computed already for the current eigen operator. The solve is warm started from the computed eigen vectors.
+		*	\param		[in]	numEigen		- input number of eigen pairs.
+		*	\return				bool			- true if the solve converged.
+		*	\since version 0.0.4
+		*/
+		bool computeEigenPairs(int numEigen);
+
 		/*! \brief This method computes the vertex type.
 		*
 		*	\param		[in]	frequency		- input frequency value.
@@ -170,6 +277,13 @@ namespace zSpace
 		*/
 		void setNumEigens(int _numEigen);
 
+		/*! \brief This method sets if the generalised eigen problem of the mesh laplacian and the lumped vertex area mass matrix is solved. The eigen vectors are then orthonormal with respect to the mass matrix.
+		*
+		*	\param		[in]	_useMassMatrix	- input boolean.
+		*	\since version 0.0.4
+		*/
+		void setUseMassMatrix(bool _useMassMatrix);
+
 		/*! \brief This method sets the color domain.
 		*
 		*	\param		[in]	colDomain		- input color domain.
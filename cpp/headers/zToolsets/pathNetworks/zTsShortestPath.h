@@ -18,6 +18,8 @@
 #include <headers/zInterface/functionsets/zFnMesh.h>
 #include <headers/zInterface/functionsets/zFnGraph.h>
 
+#include <thread>
+
 namespace zSpace
 {
 
@@ -52,6 +54,21 @@ namespace zSpace
 		/*! \brief core utilities object			*/
 		zUtilsCore coreUtils;
 
+		/*!	\brief container of start offsets of each vertex in the adjacency containers (compressed sparse row), of size numVertices + 1.  */
+		zIntArray adjacencyOffsets;
+
+		/*!	\brief container of connected vertex indicies of each vertex (compressed sparse row).  */
+		zIntArray adjacencyVertices;
+
+		/*!	\brief container of edge lengths to the connected vertices (compressed sparse row).  */
+		zFloatArray adjacencyWeights;
+
+		/*!	\brief container of symmetry half edge indicies of each half edge.  */
+		zIntArray symHalfEdges;
+
+		/*!	\brief number of threads used by the multi source walk methods. If 0, the number of hardware threads is used.  */
+		int numThreads;
+
 
 	public:
 		
@@ -173,6 +190,45 @@ namespace zSpace
 		*/
 		void walk_Animate( double MaxDistance, vector<double>& vertexDistances, vector<zVector>& walkedEdges, vector<zVector>& currentWalkingEdges);
 
+		/*! \brief This method computes the shortest path from the nearest of the input source vertices to all vertices of the zGraph/zMesh.
+		*
+		*	\details All the sources are seeded with zero distance, so a single Dijkstra run returns the minimum distance over the sources.
+		*	\param		[in]	sourceVertices			- container of source vertex indicies.
+		*	\param		[out]	dist					- container of distance to each vertex from the nearest source.
+		*	\param		[out]	parent					- container of parent vertex index of each vertex. Required to get the path information.
+		*	\since version 0.0.4
+		*/
+		void shortestDistance(zIntArray &sourceVertices, vector<float> &dist, vector<int> &parent);
+
+		/*! \brief This method computes the shortest distances from each of the input source vertices to all vertices of the zGraph/zMesh. The sources are distributed over threads.
+		*
+		*	\param		[in]	sourceVertices			- container of source vertex indicies.
+		*	\param		[out]	dists					- container of distances to each vertex, per source.
+		*	\since version 0.0.4
+		*/
+		void shortestDistance_AllSources(zIntArray &sourceVertices, vector<zFloatArray> &dists);
+
+		//--------------------------
+		//--- SET METHODS 
+		//--------------------------
+
+		/*! \brief This method sets the number of threads used by the multi source walk methods.
+		*
+		*	\param		[in]	_numThreads				- number of threads. If 0, the number of hardware threads is used.
+		*	\since version 0.0.4
+		*/
+		void setNumThreads(int _numThreads);
+
+		//--------------------------
+		//--- ADJACENCY METHODS 
+		//--------------------------
+
+		/*! \brief This method computes the compressed sparse row adjacency snapshot of the zGraph/zMesh used by the walk methods.
+		*
+		*	\since version 0.0.4
+		*/
+		void computeAdjacency();
+
 		//--------------------------
 		//--- SPANNING TREE METHODS 
 		//--------------------------
@@ -186,6 +242,41 @@ namespace zSpace
 		*/
 		int minDistance(vector<float> &dist, vector<bool> &sptSet);
 
+	protected:
+
+		//--------------------------
+		//--- PROTECTED WALK METHODS 
+		//--------------------------
+
+		/*! \brief This method computes the shortest path tree from the input source vertices on the adjacency snapshot, using an indexed binary heap.
+		*
+		*	\details Ties in distance are resolved towards the higher vertex index, matching the linear minDistance scan.
+		*	\param		[in]	sourceVertices			- container of source vertex indicies.
+		*	\param		[out]	dist					- container of distance to each vertex from the nearest source.
+		*	\param		[out]	parent					- container of parent vertex index of each vertex.
+		*	\param		[out]	order					- container of reachable vertex indicies in the order they are added to the tree.
+		*	\since version 0.0.4
+		*/
+		void dijkstra(zIntArray &sourceVertices, vector<float> &dist, vector<int> &parent, zIntArray &order);
+
+		/*! \brief This method computes the number of times each half edge is visited by the shortest paths from each source vertex to the target vertices. The sources are distributed over threads.
+		*
+		*	\param		[in]	sourceVertices			- container of source vertex indicies.
+		*	\param		[in]	targetVertices			- container of target vertex indicies.
+		*	\param		[in]	targetsAfterSource		- if true, only the targets stored after the source index in the containers are walked to, else all targets are.
+		*	\param		[out]	edgeVisited				- container of number of times half edge is visited, incremented in place.
+		*	\since version 0.0.4
+		*/
+		void edgeVisits(zIntArray &sourceVertices, zIntArray &targetVertices, bool targetsAfterSource, vector<int> &edgeVisited);
+
+		/*! \brief This method returns the number of threads to be used.
+		*
+		*	\param		[in]	numTasks				- number of tasks to be distributed.
+		*	\return				int						- number of threads.
+		*	\since version 0.0.4
+		*/
+		int getNumThreads(int numTasks);
+
 	};
 
 
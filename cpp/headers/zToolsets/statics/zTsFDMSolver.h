@@ -0,0 +1,242 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_TS_STATICS_FDM_SOLVER_H
+#define ZSPACE_TS_STATICS_FDM_SOLVER_H
+
+#pragma once
+
+#include <headers/zCore/base/zInline.h>
+#include <headers/zCore/base/zTypeDef.h>
+
+#include <depends/Eigen_Unsupported/Eigen/IterativeSolvers>
+
+namespace zSpace
+{
+	/** \addtogroup zToolsets
+	*	\brief Collection of toolsets for applications.
+	*  @{
+	*/
+
+	/** \addtogroup zTsStatics
+	*	\brief tool sets for graphic statics.
+	*  @{
+	*/
+
+	/*! \class zTsFDMSolver
+	*	\brief A solver for the linear system of the force density method, which keeps the sparsity pattern and symbolic factorisation between calls.
+	*	\details The system Dn * Xn = Pn - Df * Xf, with Dn = Cn^T * Q * Cn and Df = Cn^T * Q * Cf, is assembled in place from the force densities. The pattern, fill reducing ordering and elimination tree are only recomputed if the edge node matrix changes.
+	*	Positive force densities are solved with a sparse Cholesky (LL^T) factorisation, mixed sign force densities with a sparse LDL^T factorisation, falling back to MINRES if the LDL^T residual is above the tolerance.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_TOOLS zTsFDMSolver
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief number of vertices of the edge node matrix.	*/
+		int numVertices;
+
+		/*!	\brief number of free vertices.	*/
+		int numFree;
+
+		/*!	\brief container of the outer indicies of the cached edge node matrix.	*/
+		zIntArray patternOuter;
+
+		/*!	\brief container of the inner indicies of the cached edge node matrix.	*/
+		zIntArray patternInner;
+
+		/*!	\brief container of the values of the cached edge node matrix.	*/
+		zDoubleArray patternValues;
+
+		/*!	\brief container of the cached fixed vertex booleans.	*/
+		zBoolArray patternFixed;
+
+		/*!	\brief container of the free vertex index per vertex, -1 for fixed vertices.	*/
+		zIntArray freeIds;
+
+		/*!	\brief container of the start of the vertices of each edge in edgeVertices.	*/
+		zIntArray edgeOffsets;
+
+		/*!	\brief container of the vertices of the edges.	*/
+		zIntArray edgeVertices;
+
+		/*!	\brief container of the edge node matrix coefficient of each vertex in edgeVertices.	*/
+		zDoubleArray edgeCoefficients;
+
+		/*!	\brief container of the start of the entries of each edge in entryIds.	*/
+		zIntArray entryOffsets;
+
+		/*!	\brief container of the indicies in the value array of Dn, each edge contributes to.	*/
+		zIntArray entryIds;
+
+		/*!	\brief container of the coefficient of each contribution, multiplied by the force density of the edge.	*/
+		zDoubleArray entryCoefficients;
+
+		/*!	\brief system matrix of the free vertices.	*/
+		zSparseMatrix Dn;
+
+		/*!	\brief force densities of the last factorisation.	*/
+		VectorXd q;
+
+		/*!	\brief sparse Cholesky solver for positive force densities.	*/
+		SimplicialLLT<zSparseMatrix> solverLLT;
+
+		/*!	\brief sparse LDL^T solver for mixed sign force densities.	*/
+		SimplicialLDLT<zSparseMatrix> solverLDLT;
+
+		/*!	\brief booleans indicating if the symbolic factorisation of the solvers is up to date.	*/
+		bool analysedLLT, analysedLDLT;
+
+		/*!	\brief boolean indicating if all the force densities are positive.	*/
+		bool positiveDensities;
+
+		/*!	\brief boolean indicating if the numeric factorisation succeeded.	*/
+		bool factorised;
+
+		/*!	\brief relative residual of the last solve.	*/
+		double relativeResidual;
+
+		/*!	\brief number of MINRES iterations of the last solve, 0 if it was solved with the factorisation.	*/
+		int iterations;
+
+		/*!	\brief number of symbolic analyses.	*/
+		int analyses;
+
+	public:
+		//--------------------------
+		//---- PUBLIC ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief relative residual tolerance of the mixed sign solve.	*/
+		double tolerance;
+
+		/*!	\brief maximum number of MINRES iterations.	*/
+		int maxIterations;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*	\since version 0.0.4
+		*/
+		zTsFDMSolver();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*	\since version 0.0.4
+		*/
+		~zTsFDMSolver();
+
+		//--------------------------
+		//---- COMPUTE METHODS
+		//--------------------------
+
+		/*! \brief This method assembles and factorises the system matrix for the input force densities. The symbolic analysis is reused if the edge node matrix and fixed vertices are the same as in the previous call.
+		*
+		*	\param		[in]	C					- input edge node matrix, one row per edge and one column per vertex.
+		*	\param		[in]	fixedVertices		- input container of booleans of fixed vertices.
+		*	\param		[in]	_q					- input force density per row of the edge node matrix.
+		*	\return				bool				- true if the factorisation succeeded, or the MINRES fallback is available.
+		*	\since version 0.0.4
+		*/
+		bool compute(zSparseMatrix &C, zBoolArray &fixedVertices, VectorXd &_q);
+
+		/*! \brief This method solves the positions of the free vertices with the last factorisation.
+		*
+		*	\param		[in]	P				- input load matrix, one row per vertex.
+		*	\param		[in]	X				- input position matrix, one row per vertex. Only the rows of the fixed vertices are used.
+		*	\param		[out]	Xn				- output position matrix of the free vertices, in ascending vertex order.
+		*	\return				bool			- true if the relative residual is below the tolerance, or the positive factorisation succeeded.
+		*	\since version 0.0.4
+		*/
+		bool solve(MatrixXd &P, MatrixXd &X, MatrixXd &Xn);
+
+		/*! \brief This method clears the cached pattern and factorisations.
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method returns if the force densities of the last factorisation are all positive.
+		*
+		*	\return				bool		- true if all the force densities are positive.
+		*	\since version 0.0.4
+		*/
+		bool isPositive();
+
+		/*! \brief This method returns the relative residual |Dn * Xn - B| / |B| of the last solve.
+		*
+		*	\return				double		- relative residual.
+		*	\since version 0.0.4
+		*/
+		double getRelativeResidual();
+
+		/*! \brief This method returns the number of MINRES iterations of the last solve.
+		*
+		*	\return				int			- number of iterations, 0 if the factorisation was used.
+		*	\since version 0.0.4
+		*/
+		int numIterations();
+
+		/*! \brief This method returns the number of symbolic analyses since construction, which only increases if the pattern changes.
+		*
+		*	\return				int			- number of analyses.
+		*	\since version 0.0.4
+		*/
+		int numAnalyses();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method returns if the input edge node matrix and fixed vertices are the same as the cached pattern.
+		*
+		*	\param		[in]	C					- input edge node matrix.
+		*	\param		[in]	fixedVertices		- input container of booleans of fixed vertices.
+		*	\return				bool				- true if the pattern is the same.
+		*	\since version 0.0.4
+		*/
+		bool samePattern(zSparseMatrix &C, zBoolArray &fixedVertices);
+
+		/*! \brief This method computes the pattern of the system matrix and the contributions of each edge to it.
+		*
+		*	\param		[in]	C					- input edge node matrix.
+		*	\param		[in]	fixedVertices		- input container of booleans of fixed vertices.
+		*	\since version 0.0.4
+		*/
+		void analysePattern(zSparseMatrix &C, zBoolArray &fixedVertices);
+	};
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zToolsets/statics/zTsFDMSolver.cpp>
+#endif
+
+#endif
@@ -477,6 +477,36 @@ namespace zSpace
 		*/
 		bool get_EquilibriumMatrix(zDiagramType type, MatrixXd &out);
 
+		/*! \brief This method gets the sparse equlibrium matrix of the primal.
+		*
+		*	\param		[in]	type						- input type of primal - zForceDiagram / zFormDiagram.
+		*	\param		[out]	out							- output sparse equilibrium matrix of size 3 * internal edges by internal faces.
+		*	\return				bool						- true if the matrix is computed.
+		*	\since version 0.0.4
+		*/
+		bool get_EquilibriumMatrix(zDiagramType type, zSparseMatrix &out);
+
+		/*! \brief This method computes the rank and an orthonormal null space basis of the input equilibrium matrix using a column pivoting sparse QR.
+		*
+		*	\details The basis is dense, of size internal faces by null space dimension, and is orthonormalised with a dense QR. It is not needed for the force densities, see getDual_ForceDensities_Sparse.
+		*
+		*	\param		[in]	A							- input sparse equilibrium matrix.
+		*	\param		[in]	threshold					- input pivot threshold, columns with a remaining norm below it are considered dependent.
+		*	\param		[out]	nullSpace					- output null space basis, one column per independent self-stress.
+		*	\return				int							- rank of the equilibrium matrix.
+		*	\since version 0.0.4
+		*/
+		int get_EquilibriumNullSpace(zSparseMatrix &A, double threshold, MatrixXd &nullSpace);
+
+		/*! \brief This method gets the force densities as the minimum norm projection of unit force densities to the null space of the sparse equilibrium matrix.
+		*
+		*	\details Computes q = 1 - A^T y, with y the least squares solution of A^T y = 1 from a conjugate gradient solve of A A^T y = A 1. Gives the same force densities as the Moore-Penrose inverse method without forming the dense equilibrium matrix or a null space basis.
+		*	\param		[out]	q							- output vector of force densities.
+		*	\param		[in]	tolerance					- input relative residual tolerance of the least squares solve.
+		*	\since version 0.0.4
+		*/
+		void getDual_ForceDensities_Sparse(VectorXd &q, double tolerance = 0.000000000001);
+
 		/*! \brief This method gets the force densities using the Linear Programing Approach method.
 		*
 		*	\details based on http://www.alglib.net/translator/man/manual.cpp.html#unit_minbleic
@@ -20,6 +20,8 @@
 #include <headers/zInterface/functionsets/zFnGraph.h>
 #include <headers/zInterface/functionsets/zFnParticle.h>
 
+#include <headers/zToolsets/statics/zTsFDMSolver.h>
+
 namespace zSpace
 {
 
@@ -140,6 +142,9 @@ namespace zSpace
 		/*!	\brief container storing the horizontal equilibrium target for force edges.  */
 		vector<zVector> targetEdges_force;
 
+		/*!	\brief force density solver, caching the symbolic factorisation between iterations.  */
+		zTsFDMSolver fdmSolver;
+
 		//--------------------------
 		//---- FDM CONSTRAINT SOLVE ATTRIBUTES
 		//--------------------------
@@ -636,6 +641,245 @@ namespace zSpace
 
 		void getPleatDataJSON(string infilename);
 	};
+
+	//---- explicit specialization declarations
+
+	template<>
+	ZSPACE_INLINE zTsVault<zObjGraph, zFnGraph>::zTsVault(zObjGraph & _resultObj);
+
+	template<>
+	ZSPACE_INLINE zTsVault<zObjMesh, zFnMesh>::zTsVault(zObjMesh & _resultObj);
+
+	template<>
+	ZSPACE_INLINE zTsVault<zObjGraph, zFnGraph>::zTsVault(zObjGraph & _resultObj, zObjGraph &_formObj, zObjMesh &_forceObj);
+
+	template<>
+	ZSPACE_INLINE zTsVault<zObjMesh, zFnMesh>::zTsVault(zObjMesh & _resultObj, zObjMesh &_formObj, zObjMesh &_forceObj);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::createResultfromFile(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createResultfromFile(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::createForcefromFile(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createForcefromFile(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createFormfromFile(string path, zFileTpye type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::createFormFromResult();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createFormFromResult();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::createFormFromForce(bool excludeBoundary, bool PlanarForceMesh, bool rotate90);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createForceFromForm(bool rotate90);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::createResultFromForm();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::createResultFromForm();
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjGraph, zFnGraph>::forceDensityMethod();
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjMesh, zFnMesh>::forceDensityMethod();
+
+	template<>
+	ZSPACE_INLINE double zTsVault<zObjMesh, zFnMesh>::fdm_constraintsolve(bool & computeQInitial, float alpha, float tolerance, float qLB, float qUB);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getSymmetryPairs(zIntPairArray &vPairs, zIntPairArray & ePairs, zPoint &p_center, zVector &p_norm);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::boundForceDensities(zIntArray &fdMap, VectorXd &fDensities, float qLB, float qUB);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::boundGradientForceDensities(VectorXd & grad_fDensities, VectorXd & current_fDensities, float qLB, float qUB);
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjMesh, zFnMesh>::checkObjectiveAchieved(MatrixXd & currentX, MatrixXd & prevX, float tolerance);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::updateEquilibriumPositions(VectorXd & q);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::perturbPleatPositions(MatrixXd &origX);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getBestFitForceDensities(VectorXd &bestfit_fDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getBestFitForceDensities(zFloatArray &bestfit_fDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getResidual_Gradient(VectorXd & current_fDensities, zVectorArray &targets, VectorXd & residual, VectorXd & gradient_fDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getResiduals(float alpha, VectorXd & current_fDensities, VectorXd &residual, VectorXd & residualU, VectorXd & residualC);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getGradients(VectorXd & current_fDensities, VectorXd & residualU, VectorXd & residualC, VectorXd & gradPos, VectorXd & gradFDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getfreeVertices(zIntArray & freeVerts);
+
+	template<>
+	ZSPACE_INLINE int zTsVault<zObjMesh, zFnMesh>::getNumFreeEdges(zIntArray &fdMap);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::getPositionMatrix(MatrixXd & X);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getPositionMatrix(MatrixXd & X);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getLoadVector(VectorXd & Pn);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getConstraint_Planarity(zVectorArray &targets, float planarityTolerance);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setConstraint_plan(const zIntArray & vertex_PlanWeights);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setConstraint_pleats(zFloatArray & vertex_ValleyRidge, zFloatArray & vertex_PleatDepth);
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjGraph, zFnGraph>::equilibriumVertical(bool &computeForceDensitities, float forceDiagramScale);
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjMesh, zFnMesh>::equilibriumVertical(bool &computeForceDensitities, float forceDiagramScale);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setConstraints(zDiagramType type, const vector<int>& _fixedVertices);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setConstraints(zDiagramType type, const vector<int>& _fixedVertices);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setForceDensity(float fDensity);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setForceDensity(float fDensity);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setForceDensities(vector<float> &fDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setForceDensities(vector<float> &fDensities);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setForceDensitiesFromDiagrams(float forceDiagramScale, bool negate);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setForceDensitiesFromDiagrams(float forceDiagramScale, bool negate);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setTensionEdges(zDiagramType type, const vector<int>& _tensionEdges);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setTensionEdges(zDiagramType type, const vector<int>& _tensionEdges);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setForceTensionEdgesfromForm();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setForceTensionEdgesfromForm();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setFormTensionEdgesfromForce();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setFormTensionEdgesfromForce();
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setElementColorDomain(zDiagramType type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setElementColorDomain(zDiagramType type);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setVertexWeights(zDiagramType type, const vector<float>& vWeights);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexWeights(zDiagramType type, const vector<float>& vWeights);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setVertexThickness(float thickness);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexThickness(float thickness);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setVertexThickness(vector<float> &thickness);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexThickness(vector<float> &thickness);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setVertexMass(float mass);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexMass(float mass);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::setVertexMass(vector<float> &mass);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexMass(vector<float> &mass);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::setVertexMassfromVertexArea();
+
+	template<>
+	ZSPACE_INLINE void zTsVault < zObjGraph, zFnGraph>::getForces_GradientDescent(vector<zVector>& forces);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getForces_GradientDescent(vector<zVector>& forces);
+
+	template<>
+	ZSPACE_INLINE zSparseMatrix zTsVault<zObjGraph, zFnGraph>::getEdgeNodeMatrix(int numRows);
+
+	template<>
+	ZSPACE_INLINE zSparseMatrix zTsVault<zObjMesh, zFnMesh>::getEdgeNodeMatrix(int numRows);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::getHorizontalTargets(float formWeight);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getHorizontalTargets(float formWeight);
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjGraph, zFnGraph>::checkHorizontalParallelity(zDomainFloat &deviation, float angleTolerance, bool colorEdges, bool printInfo);
+
+	template<>
+	ZSPACE_INLINE bool zTsVault<zObjMesh, zFnMesh>::checkHorizontalParallelity(zDomainFloat &deviation, float angleTolerance, bool colorEdges, bool printInfo);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::updateFormDiagram(float minmax_Edge, float dT, zIntergrationType type, int numIterations);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::updateFormDiagram(float minmax_Edge, float dT, zIntergrationType type, int numIterations);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjGraph, zFnGraph>::updateForceDiagram(float minmax_Edge, float dT, zIntergrationType type, int numIterations);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::updateForceDiagram(float minmax_Edge, float dT, zIntergrationType type, int numIterations);
+
+	template<>
+	ZSPACE_INLINE void zTsVault<zObjMesh, zFnMesh>::getPleatDataJSON(string infilename);
 	   
 	/** \addtogroup zToolsets
 	*	\brief Collection of toolsets for applications.
@@ -22,6 +22,11 @@
 #include <headers/zInterface/functionsets/zFnGraph.h>
 #include <headers/zInterface/functionsets/zFnParticle.h>
 
+#include <headers/zCore/base/zThreadPool.h>
+
+#include <set>
+#include <tuple>
+
 
 namespace zSpace
 {
@@ -95,6 +100,114 @@ namespace zSpace
 
 	};
 
+	/** \addtogroup zToolsets
+	*	\brief Collection of tool sets for applications. 
+	*  @{
+	*/
+
+	/** \addtogroup zTsStreamlines
+	*	\brief tool sets for field stream lines.
+	*  @{
+	*/
+
+	/*! \class zStreamGrid
+	*	\brief A uniform grid of stream positions for separation distance queries.
+	*	\details Positions are only added in the ordered commit of the stream engine, so concurrent queries need no locks.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_TOOLS zStreamGrid
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief minimum bounds of the grid.  */
+		zVector minBB;
+
+		/*!	\brief size of a grid cell.  */
+		double cellSize;
+
+		/*!	\brief number of cells in X and Y.  */
+		int n_X, n_Y;
+
+		/*!	\brief container of position indices per cell.  */
+		vector<zIntArray> cells;
+
+		/*!	\brief container of non empty cell indices.  */
+		zIntArray occupiedCells;
+
+		/*!	\brief container of positions.  */
+		zPointArray positions;
+
+		/*!	\brief container of stream indices per position.  */
+		zIntArray streamIds;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zStreamGrid();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method creates an empty grid over the input bounds.
+		*
+		*	\param		[in]	_minBB			- minimum bounds.
+		*	\param		[in]	_maxBB			- maximum bounds.
+		*	\param		[in]	_cellSize		- size of a grid cell, typically the largest query distance.
+		*	\since version 0.0.4
+		*/
+		void create(zVector &_minBB, zVector &_maxBB, double _cellSize);
+
+		/*! \brief This method removes all positions from the grid.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		/*! \brief This method adds a position to the grid.
+		*
+		*	\param		[in]	inPoint			- input position.
+		*	\param		[in]	streamId		- index of the stream of the position.
+		*	\since version 0.0.4
+		*/
+		void addPosition(zVector &inPoint, int streamId);
+
+		/*! \brief This method checks if no position of the grid is closer than the input distance.
+		*
+		*	\param		[in]	inPoint			- input position.
+		*	\param		[in]	distance		- clearance distance.
+		*	\param		[in]	minStreamId		- positions of streams with a lower index are ignored.
+		*	\return			bool			- true if the input position is clear.
+		*	\since version 0.0.4
+		*/
+		bool checkClearance(zVector &inPoint, double distance, int minStreamId = -1);
+
+	protected:
+
+		/*! \brief This method returns the index of the cell containing the input coordinates, clamped to the grid.
+		*
+		*	\param		[in]	x				- input x coordinate.
+		*	\param		[in]	y				- input y coordinate.
+		*	\return			int				- cell index.
+		*	\since version 0.0.4
+		*/
+		int getCellIndex(double x, double y);
+	};
+
 
 	/** \addtogroup zToolsets
 	*	\brief Collection of tool sets for applications. 
@@ -108,7 +221,7 @@ namespace zSpace
 
 	/*! \class zTsStreams2D
 	*	\brief A streamlines tool set for creating streams on a 2D field.
-	*	\details Based on evenly spaced streamlines (http://citeseerx.ist.psu.edu/viewdoc/download?doi=10.1.1.29.9498&rep=rep1&integrationType=pdf)
+	*	\details Based on evenly spaced streamlines (http://citeseerx.ist.psu.edu/viewdoc/download?doi=10.1.1.29.9498&rep=rep1&integrationType=pdf). Streams are integrated speculatively in parallel and committed in the serial seed order, so the result does not depend on the number of threads.
 	*	\since version 0.0.2
 	*/
 
@@ -157,6 +270,12 @@ namespace zSpace
 		/*!<\brief boolean is true if the backward direction is flipped.*/
 		bool *flipBackward;
 
+		/*!	\brief grid of the committed stream positions.  */
+		zStreamGrid streamGrid;
+
+		/*!	\brief grid of the speculative seed positions of a round.  */
+		zStreamGrid seedGrid;
+
 	public:
 
 		//--------------------------
@@ -273,9 +392,10 @@ namespace zSpace
 		*	\param	[out]	streams							- container of streams.
 		*	\param	[in]	start_seedPoints				- container of start seed positions. If empty a random position in the field is considered.
 		*	\param	[in]	seedStreamsOnly					- generates streams from the seed points only if true.
+		*	\param	[in]	maxStreams						- maximum number of streams.
 		*	\since version 0.0.1
 		*/
-		void createStreams(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, bool seedStreamsOnly = false);
+		void createStreams(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, bool seedStreamsOnly = false, int maxStreams = 5000);
 
 		//--------------------------
 		//----  2D STREAM LINES METHODS WITH INFLUENCE SCALAR FIELD
@@ -289,23 +409,75 @@ namespace zSpace
 		*	\param	[in]	min_Power						- input minimum power value.
 		*	\param	[in]	max_Power						- input maximum power value.
 		*	\param	[in]	seedStreamsOnly					- generates streams from the seed points only if true.
+		*	\param	[in]	maxStreams						- maximum number of streams.
 		*	\since version 0.0.1
 		*/
-		void createStreams_Influence(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, bool seedStreamsOnly = false);
+		void createStreams_Influence(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, bool seedStreamsOnly = false, int maxStreams = 100);
 
 		//--------------------------
 		//---- PROTECTED METHODS
 		//--------------------------
 	protected:
 
-		/*! \brief This method creates a single stream line as a graph.
+		/*! \brief This method grows the streams from the start seed points and the seed points of the created streams.
+		*
+		*	\details Each round integrates the well separated seeds of the next seed sources in parallel. The streams are then committed in the serial seed order and kept if they are clear of the streams committed after the round started, else integrated again.
+		*	\param	[in]	streams							- container of streams.
+		*	\param	[in]	streamCounter					- number of created streams.
+		*	\param	[in]	start_seedPoints				- container of start seed positions.
+		*	\param	[in]	seedStreamsOnly					- generates streams from the seed points only if true.
+		*	\param	[in]	fnInfluenceField				- input pointer to the influence scalar field, nullptr for plain streams.
+		*	\param	[in]	min_Power						- input minimum power value.
+		*	\param	[in]	max_Power						- input maximum power value.
+		*	\since version 0.0.4
+		*/
+		void growStreams(vector<zStreamLine>& streams, int &streamCounter, vector<zVector> &start_seedPoints, bool seedStreamsOnly, zFnMeshField<zScalar> *fnInfluenceField, double min_Power, double max_Power);
+
+		/*! \brief This method moves the input seed source to the next valid source. Sources are the start seed points (-1, seed index), followed by the stream vertices (stream index, vertex index).
+		*
+		*	\param	[in]	streams							- container of streams.
+		*	\param	[in]	streamCounter					- number of created streams.
+		*	\param	[in]	start_seedPoints				- container of start seed positions.
+		*	\param	[in]	seedStreamsOnly					- only start seed points are sources if true.
+		*	\param	[in]	source							- input seed source.
+		*	\return			bool							- true if a valid source is found.
+		*	\since version 0.0.4
+		*/
+		bool checkSeedSource(vector<zStreamLine>& streams, int streamCounter, vector<zVector> &start_seedPoints, bool seedStreamsOnly, zIntPair &source);
+
+		/*! \brief This method computes the seed points of the input seed source.
+		*
+		*	\param	[in]	streams							- container of streams.
+		*	\param	[in]	start_seedPoints				- container of start seed positions.
+		*	\param	[in]	source							- input seed source.
+		*	\param	[in]	fnInfluenceField				- input pointer to the influence scalar field, nullptr for plain streams.
+		*	\param	[in]	min_Power						- input minimum power value.
+		*	\param	[in]	max_Power						- input maximum power value.
+		*	\param	[out]	seedPoints						- container of seed points.
+		*	\since version 0.0.4
+		*/
+		void getSourceSeedPoints(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zIntPair &source, zFnMeshField<zScalar> *fnInfluenceField, double min_Power, double max_Power, vector<zVector> &seedPoints);
+
+		/*! \brief This method creates the stream graph of the next stream and adds its positions to the stream grid.
+		*
+		*	\param	[in]	streams							- container of streams.
+		*	\param	[in]	streamCounter					- number of created streams, incremented.
+		*	\param	[in]	parentId						- index of the parent stream, -1 if there is no parent.
+		*	\param	[in]	positions						- container of stream positions.
+		*	\param	[in]	edgeConnects					- container of stream edge connections.
+		*	\since version 0.0.4
+		*/
+		void commitStream(vector<zStreamLine>& streams, int &streamCounter, int parentId, vector<zVector> &positions, vector<int> &edgeConnects);
+
+		/*! \brief This method integrates a single stream line. The stream grid is only read, so streams can be integrated concurrently.
 		*
-		*	\param	[in]	streamGraph						- stream graph created from the field.
 		*	\param	[in]	seedPoint						- input seed point.
-		*	\return			bool							- true if the graph is created.
-		*	\since version 0.0.1
+		*	\param	[out]	positions						- container of stream positions.
+		*	\param	[out]	edgeConnects					- container of stream edge connections.
+		*	\return			bool							- true if the stream is longer than the minimum length.
+		*	\since version 0.0.4
 		*/
-		bool createStreamGraph(zObjGraph &streamGraphObj, zVector &seedPoint);
+		bool integrateStream(zVector &seedPoint, vector<zVector> &positions, vector<int> &edgeConnects);
 
 		/*! \brief This method computes the seed points.
 		*
@@ -316,17 +488,18 @@ namespace zSpace
 		*/
 		void getSeedPoints(zStreamLine& currentStream, int vertexId, vector<zVector> &seedPoints);
 		
-		/*! \brief This method creates a single stream line as a graph based on a influence scalar field.
+		/*! \brief This method integrates a single stream line based on a influence scalar field. The stream grid is only read, so streams can be integrated concurrently.
 		*
-		*	\param	[in]	streamGraph						- stream graph created from the field.
 		*	\param	[in]	seedPoint						- input seed point.
 		*	\param	[in]	influenceField					- input scalar field.
 		*	\param	[in]	min_Power						- input minimum power value.
 		*	\param	[in]	max_Power						- input maximum power value.
-		*	\return			bool							- true if the graph is created.
-		*	\since version 0.0.1
+		*	\param	[out]	positions						- container of stream positions.
+		*	\param	[out]	edgeConnects					- container of stream edge connections.
+		*	\return			bool							- true if the stream is longer than the minimum length.
+		*	\since version 0.0.4
 		*/
-		bool createStreamGraph_Influence(zObjGraph &streamGraphObj, zVector &seedPoint, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power);
+		bool integrateStream_Influence(zVector &seedPoint, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, vector<zVector> &positions, vector<int> &edgeConnects);
 
 		/*! \brief This method computes the seed points.
 		*
@@ -370,6 +543,21 @@ namespace zSpace
 		*/
 		bool checkValidSeedPosition(zVector &inPoint, double &dSep);
 
+		/*! \brief This method checks if the input stream positions, except the seed, are clear of the positions of the streams from the input index.
+		*
+		*	\param	[in]	positions						- container of stream positions.
+		*	\param	[in]	minStreamId						- positions of streams with a lower index are ignored.
+		*	\return			bool							- true if the stream is clear.
+		*	\since version 0.0.4
+		*/
+		bool checkStreamClearance(vector<zVector> &positions, int minStreamId);
+
+		/*! \brief This method creates the stream grid over the field bounds and adds the existing field stream positions.
+		*
+		*	\since version 0.0.4
+		*/
+		void createStreamGrid();
+
 		/*! \brief This method adds the input position to the field stream position container.
 		*
 		*	\param	[in]	inPoint							- input point.
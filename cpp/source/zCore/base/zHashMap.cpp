@@ -0,0 +1,231 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/base/zHashMap.h>
+
+namespace zSpace
+{
+	//---- zPositionKey
+
+	ZSPACE_INLINE zPositionKey::zPositionKey()
+	{
+		x = y = z = 0;
+	}
+
+	ZSPACE_INLINE zPositionKey::zPositionKey(zVector &pos, int precisionfactor)
+	{
+		static const double factors[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+		double factor = (precisionfactor >= 0 && precisionfactor <= 9) ? factors[precisionfactor] : pow(10, precisionfactor);
+
+		x = (long long) std::round(pos.x * factor);
+		y = (long long) std::round(pos.y * factor);
+		z = (long long) std::round(pos.z * factor);
+	}
+
+	ZSPACE_INLINE bool zPositionKey::operator==(const zPositionKey &other) const
+	{
+		return (x == other.x && y == other.y && z == other.z);
+	}
+
+	//---- CONSTRUCTOR
+
+	template <typename T>
+	ZSPACE_INLINE zHashMap<T>::zHashMap()
+	{
+		n_active = n_used = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	template <typename T>
+	ZSPACE_INLINE zHashMap<T>::~zHashMap() {}
+
+	//---- METHODS
+
+	template <typename T>
+	ZSPACE_INLINE void zHashMap<T>::reserve(int numElements)
+	{
+		// keep the load factor below 0.5
+		int newCapacity = 16;
+		while (newCapacity < numElements * 2) newCapacity *= 2;
+
+		if (newCapacity > (int)states.size()) rehash(newCapacity);
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zHashMap<T>::clear()
+	{
+		keys.clear();
+		values.clear();
+		states.clear();
+
+		n_active = n_used = 0;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE int zHashMap<T>::size()
+	{
+		return n_active;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zHashMap<T>::insert(const T &key, int value)
+	{
+		if ((n_used + 1) * 2 > (int)states.size())
+		{
+			// grow only if the occupied slots need it, else just drop the erased slots
+			if ((n_active + 1) * 4 > (int)states.size()) rehash((states.size() > 0) ? (int)states.size() * 2 : 16);
+			else rehash((int)states.size());
+		}
+
+		size_t mask = states.size() - 1;
+		size_t id = hashKey(key) & mask;
+
+		int erasedSlot = -1;
+
+		while (states[id] != 0)
+		{
+			if (states[id] == 1 && keys[id] == key)
+			{
+				values[id] = value;
+				return;
+			}
+
+			if (states[id] == 2 && erasedSlot == -1) erasedSlot = (int)id;
+
+			id = (id + 1) & mask;
+		}
+
+		if (erasedSlot != -1) id = erasedSlot;
+		else n_used++;
+
+		keys[id] = key;
+		values[id] = value;
+		states[id] = 1;
+
+		n_active++;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zHashMap<T>::erase(const T &key)
+	{
+		int id = findSlot(key);
+		if (id == -1) return;
+
+		states[id] = 2;
+		n_active--;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE bool zHashMap<T>::find(const T &key, int &outValue)
+	{
+		int id = findSlot(key);
+
+		if (id == -1)
+		{
+			outValue = -1;
+			return false;
+		}
+
+		outValue = values[id];
+		return true;
+	}
+
+	//---- PROTECTED METHODS
+
+	template <>
+	ZSPACE_INLINE size_t zHashMap<unsigned long long>::hashKey(const unsigned long long &key)
+	{
+		// splitmix64 finalizer
+		unsigned long long h = key;
+		h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ULL;
+		h ^= h >> 27; h *= 0x94d049bb133111ebULL;
+		h ^= h >> 31;
+
+		return (size_t)h;
+	}
+
+	template <>
+	ZSPACE_INLINE size_t zHashMap<zPositionKey>::hashKey(const zPositionKey &key)
+	{
+		unsigned long long h = (unsigned long long)key.x * 0x9e3779b97f4a7c15ULL;
+		h ^= (unsigned long long)key.y * 0xc2b2ae3d27d4eb4fULL;
+		h ^= (unsigned long long)key.z * 0x165667b19e3779f9ULL;
+
+		h ^= h >> 29; h *= 0xbf58476d1ce4e5b9ULL;
+		h ^= h >> 32;
+
+		return (size_t)h;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE int zHashMap<T>::findSlot(const T &key)
+	{
+		if (n_active == 0) return -1;
+
+		size_t mask = states.size() - 1;
+		size_t id = hashKey(key) & mask;
+
+		while (states[id] != 0)
+		{
+			if (states[id] == 1 && keys[id] == key) return (int)id;
+			id = (id + 1) & mask;
+		}
+
+		return -1;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zHashMap<T>::rehash(int newCapacity)
+	{
+		vector<T> oldKeys;
+		vector<int> oldValues;
+		vector<unsigned char> oldStates;
+
+		oldKeys.swap(keys);
+		oldValues.swap(values);
+		oldStates.swap(states);
+
+		keys.assign(newCapacity, T());
+		values.assign(newCapacity, -1);
+		states.assign(newCapacity, 0);
+
+		n_active = n_used = 0;
+
+		size_t mask = newCapacity - 1;
+
+		for (int i = 0; i < oldStates.size(); i++)
+		{
+			if (oldStates[i] != 1) continue;
+
+			size_t id = hashKey(oldKeys[i]) & mask;
+			while (states[id] != 0) id = (id + 1) & mask;
+
+			keys[id] = oldKeys[i];
+			values[id] = oldValues[i];
+			states[id] = 1;
+
+			n_active++;
+			n_used++;
+		}
+	}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+	// explicit instantiation
+	template class zHashMap<zPositionKey>;
+
+	template class zHashMap<unsigned long long>;
+
+#endif
+
+}
@@ -0,0 +1,248 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/base/zThreadPool.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zThreadPool::zThreadPool(int _numThreads)
+	{
+		nThreads = 1;
+		job = nullptr;
+		jobId = 0;
+		pendingTasks = 0;
+		activeWorkers = 0;
+		stop = false;
+
+		setNumThreads(_numThreads);
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zThreadPool::~zThreadPool()
+	{
+		stopWorkers();
+	}
+
+	//---- STATIC METHODS
+
+	ZSPACE_INLINE zThreadPool& zThreadPool::getGlobal()
+	{
+		static zThreadPool globalPool;
+		return globalPool;
+	}
+
+	//---- GET SET METHODS
+
+	ZSPACE_INLINE int zThreadPool::numThreads()
+	{
+		return nThreads;
+	}
+
+	ZSPACE_INLINE void zThreadPool::setNumThreads(int _numThreads)
+	{
+		std::lock_guard<std::mutex> runGuard(runLock);
+
+		if (_numThreads <= 0) _numThreads = std::thread::hardware_concurrency();
+		if (_numThreads <= 0) _numThreads = 1;
+
+		stopWorkers();
+
+		nThreads = _numThreads;
+
+		queues.clear();
+		for (int i = 0; i < nThreads; i++) queues.push_back(unique_ptr<zTaskQueue>(new zTaskQueue()));
+
+		startWorkers();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zThreadPool::parallel_for(int start, int end, std::function<void(int, int)> kernel, int grainSize)
+	{
+		int n = end - start;
+		if (n <= 0) return;
+
+		if (grainSize <= 0) grainSize = std::max(1, n / (nThreads * 8));
+
+		// nested loops and loops with a single task run serially on the calling thread
+		if (nThreads == 1 || insideTask() || n <= grainSize)
+		{
+			kernel(start, end);
+			return;
+		}
+
+		std::lock_guard<std::mutex> runGuard(runLock);
+
+		// deal the tasks in contiguous blocks, so neighbouring indicies stay on the same thread unless stolen
+		int numTasks = (n + grainSize - 1) / grainSize;
+		int tasksPerQueue = (numTasks + nThreads - 1) / nThreads;
+
+		for (int t = 0; t < numTasks; t++)
+		{
+			int taskStart = start + t * grainSize;
+			int taskEnd = std::min(end, taskStart + grainSize);
+
+			queues[t / tasksPerQueue]->tasks.push_back(std::make_pair(taskStart, taskEnd));
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(jobLock);
+
+			pendingTasks = numTasks;
+			jobException = nullptr;
+			job = &kernel;
+			jobId++;
+		}
+
+		jobStart.notify_all();
+
+		runTasks(0, kernel);
+
+		{
+			// wait for the workers to finish their last task and let go of the kernel
+			std::unique_lock<std::mutex> guard(jobLock);
+			jobDone.wait(guard, [this] { return pendingTasks == 0 && activeWorkers == 0; });
+
+			job = nullptr;
+		}
+
+		if (jobException)
+		{
+			std::exception_ptr e = jobException;
+			jobException = nullptr;
+			std::rethrow_exception(e);
+		}
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zThreadPool::startWorkers()
+	{
+		stop = false;
+
+		for (int i = 1; i < nThreads; i++)
+		{
+			workers.push_back(std::thread(&zThreadPool::workerLoop, this, i));
+		}
+	}
+
+	ZSPACE_INLINE void zThreadPool::stopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> guard(jobLock);
+			stop = true;
+		}
+
+		jobStart.notify_all();
+
+		for (auto &w : workers) w.join();
+		workers.clear();
+	}
+
+	ZSPACE_INLINE void zThreadPool::workerLoop(int workerId)
+	{
+		unsigned long long seenJobId = 0;
+
+		while (true)
+		{
+			std::function<void(int, int)> *kernel;
+
+			{
+				std::unique_lock<std::mutex> guard(jobLock);
+				jobStart.wait(guard, [&] { return stop || jobId != seenJobId; });
+
+				if (stop) return;
+
+				seenJobId = jobId;
+
+				// the loop may have completed before this worker woke up
+				if (job == nullptr) continue;
+
+				kernel = job;
+				activeWorkers++;
+			}
+
+			runTasks(workerId, *kernel);
+
+			{
+				std::lock_guard<std::mutex> guard(jobLock);
+				activeWorkers--;
+			}
+
+			jobDone.notify_all();
+		}
+	}
+
+	ZSPACE_INLINE void zThreadPool::runTasks(int queueId, std::function<void(int, int)> &kernel)
+	{
+		insideTask() = true;
+
+		while (pendingTasks > 0)
+		{
+			std::pair<int, int> task(0, 0);
+			bool found = false;
+
+			// own queue from the front, other queues from the back
+			for (int k = 0; k < nThreads && !found; k++)
+			{
+				zTaskQueue &q = *queues[(queueId + k) % nThreads];
+
+				std::lock_guard<std::mutex> guard(q.lock);
+				if (q.tasks.empty()) continue;
+
+				if (k == 0)
+				{
+					task = q.tasks.front();
+					q.tasks.pop_front();
+				}
+				else
+				{
+					task = q.tasks.back();
+					q.tasks.pop_back();
+				}
+
+				found = true;
+			}
+
+			if (!found) break;
+
+			try
+			{
+				kernel(task.first, task.second);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> guard(jobLock);
+				if (!jobException) jobException = std::current_exception();
+			}
+
+			if (--pendingTasks == 0)
+			{
+				std::lock_guard<std::mutex> guard(jobLock);
+				jobDone.notify_all();
+			}
+		}
+
+		insideTask() = false;
+	}
+
+	ZSPACE_INLINE bool& zThreadPool::insideTask()
+	{
+		static thread_local bool inside = false;
+		return inside;
+	}
+
+}
@@ -15,6 +15,165 @@
 namespace zSpace
 {
 
+	//---- zDatabaseCursor
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor()
+	{
+		stmt = nullptr;
+		RC = SQLITE_OK;
+	}
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor(sqlite3_stmt *_stmt, std::shared_ptr<zDatabaseCachedStatement> _cacheEntry)
+	{
+		stmt = _stmt;
+		cacheEntry = std::move(_cacheEntry);
+		RC = SQLITE_OK;
+	}
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor(zDatabaseCursor &&other)
+	{
+		stmt = other.stmt;
+		cacheEntry = std::move(other.cacheEntry);
+		RC = other.RC;
+
+		other.stmt = nullptr;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zDatabaseCursor::~zDatabaseCursor()
+	{
+		release();
+	}
+
+	//---- OPERATORS
+
+	ZSPACE_INLINE zDatabaseCursor& zDatabaseCursor::operator=(zDatabaseCursor &&other)
+	{
+		if (this != &other)
+		{
+			release();
+
+			stmt = other.stmt;
+			cacheEntry = std::move(other.cacheEntry);
+			RC = other.RC;
+
+			other.stmt = nullptr;
+		}
+
+		return *this;
+	}
+
+	//---- PRIVATE METHODS
+
+	ZSPACE_INLINE void zDatabaseCursor::release()
+	{
+		if (stmt)
+		{
+			if (cacheEntry && cacheEntry->cached)
+			{
+				reset();
+				cacheEntry->inUse = false;
+			}
+			else sqlite3_finalize(stmt);
+		}
+
+		stmt = nullptr;
+		cacheEntry.reset();
+	}
+
+	//---- STEP METHODS
+
+	ZSPACE_INLINE bool zDatabaseCursor::step()
+	{
+		if (!stmt) throw std::invalid_argument(" error: cursor has no statement.");
+
+		RC = sqlite3_step(stmt);
+		return (RC == SQLITE_ROW);
+	}
+
+	ZSPACE_INLINE bool zDatabaseCursor::execute()
+	{
+		while (step());
+
+		bool out = (RC == SQLITE_DONE);
+
+		// keep the bindings, so only the changed parameters need to be bound again
+		sqlite3_reset(stmt);
+
+		return out;
+	}
+
+	ZSPACE_INLINE void zDatabaseCursor::reset()
+	{
+		if (!stmt) return;
+
+		sqlite3_reset(stmt);
+		sqlite3_clear_bindings(stmt);
+		RC = SQLITE_OK;
+	}
+
+	ZSPACE_INLINE int zDatabaseCursor::getResultCode()
+	{
+		return RC;
+	}
+
+	//---- BIND METHODS
+
+	ZSPACE_INLINE void zDatabaseCursor::bindInt64(int index, long long value)
+	{
+		if (sqlite3_bind_int64(stmt, index, value) != SQLITE_OK) throw std::invalid_argument(" error: invalid parameter index.");
+	}
+
+	ZSPACE_INLINE void zDatabaseCursor::bindDouble(int index, double value)
+	{
+		if (sqlite3_bind_double(stmt, index, value) != SQLITE_OK) throw std::invalid_argument(" error: invalid parameter index.");
+	}
+
+	ZSPACE_INLINE void zDatabaseCursor::bindText(int index, std::string_view value)
+	{
+		if (sqlite3_bind_text(stmt, index, value.data(), (int)value.size(), SQLITE_TRANSIENT) != SQLITE_OK) throw std::invalid_argument(" error: invalid parameter index.");
+	}
+
+	ZSPACE_INLINE void zDatabaseCursor::bindNull(int index)
+	{
+		if (sqlite3_bind_null(stmt, index) != SQLITE_OK) throw std::invalid_argument(" error: invalid parameter index.");
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zDatabaseCursor::numColumns()
+	{
+		return sqlite3_data_count(stmt);
+	}
+
+	ZSPACE_INLINE bool zDatabaseCursor::isNull(int column)
+	{
+		return (sqlite3_column_type(stmt, column) == SQLITE_NULL);
+	}
+
+	ZSPACE_INLINE long long zDatabaseCursor::getInt64(int column)
+	{
+		return sqlite3_column_int64(stmt, column);
+	}
+
+	ZSPACE_INLINE double zDatabaseCursor::getDouble(int column)
+	{
+		return sqlite3_column_double(stmt, column);
+	}
+
+	ZSPACE_INLINE std::string_view zDatabaseCursor::getText(int column)
+	{
+		const unsigned char *text = sqlite3_column_text(stmt, column);
+		if (!text) return std::string_view();
+
+		return std::string_view(reinterpret_cast<const char*>(text), sqlite3_column_bytes(stmt, column));
+	}
+
+	//---- zDatabase
+
 	//---- CONSTRUCTOR
 
 	ZSPACE_INLINE zDatabase::zDatabase()
@@ -34,7 +193,10 @@ namespace zSpace
 
 	//---- DESTRUCTOR
 
-	ZSPACE_INLINE zDatabase::~zDatabase() {}
+	ZSPACE_INLINE zDatabase::~zDatabase()
+	{
+		clearStatementCache();
+	}
 
 	//---- DATABASE METHODS
 
@@ -48,7 +210,11 @@ namespace zSpace
 
 	ZSPACE_INLINE void zDatabase::close()
 	{
-		sqlite3_close(database);
+		clearStatementCache();
+
+		// statements still stepped by cursors keep the connection until they are finalized
+		sqlite3_close_v2(database);
+		database = NULL;
 	}
 
 	ZSPACE_INLINE bool zDatabase::sqlCommand(zStringArray &sqlStatment, zSQLCommand sqlCommandType, bool displayError, zStringArray &outStatment, bool colType)
@@ -59,40 +225,13 @@ namespace zSpace
 		int RC;
 		int extended_RC;
 
-		char* sql;
-
 		sqlite3_stmt * Selectionstmt;
-		int arraySize = 0;
-
-		// get array size
-		for (int i = 0; i < sqlStatment.size(); i++)
-		{
-			int lenS = strlen(sqlStatment[i].c_str());
-			arraySize += lenS;
-		}
 
+		// join the statements
+		string sqlString;
+		for (auto &s : sqlStatment) sqlString += s;
 
-		// intialise dyanmic array
-		sql = new char[arraySize];
-		int counter = 0;
-
-		//printf("\n ");
-		for (int i = 0; i < sqlStatment.size(); i++)
-		{
-
-			int lenS = strlen(sqlStatment[i].c_str());
-
-
-			for (int j = 0; j < lenS; j++)
-			{
-				sql[counter] = sqlStatment[i].c_str()[j];
-
-				//printf("%c", sqlStatment[i].c_str()[j]);
-				counter++;
-			}
-			//printf("\n ");
-		}
-
+		const char* sql = sqlString.c_str();
 
 
 
@@ -331,4 +470,122 @@ namespace zSpace
 
 		sqlStatment.push_back(");");
 	}
+
+	ZSPACE_INLINE bool zDatabase::tableInsert(string &tableName, zStringArray &columnNames, int numRows, std::function<void(zDatabaseCursor&, int)> bindRow)
+	{
+		string sql = "INSERT INTO " + tableName + " ( ";
+
+		for (int i = 0; i < columnNames.size(); i++)
+		{
+			sql += columnNames[i];
+			if (i != columnNames.size() - 1) sql += ", ";
+		}
+
+		sql += " ) VALUES ( ";
+
+		for (int i = 0; i < columnNames.size(); i++)
+		{
+			sql += "?";
+			if (i != columnNames.size() - 1) sql += ", ";
+		}
+
+		sql += " );";
+
+		zDatabaseCursor cursor = query(sql);
+
+		// a single transaction, instead of one journal sync per row
+		if (!beginTransaction()) return false;
+
+		for (int i = 0; i < numRows; i++)
+		{
+			try
+			{
+				bindRow(cursor, i);
+			}
+			catch (...)
+			{
+				rollbackTransaction();
+				throw;
+			}
+
+			if (!cursor.execute())
+			{
+				printf("\n Table Insert Failed, row: %i, ext_RC: %i \n", i, sqlite3_extended_errcode(database));
+
+				rollbackTransaction();
+				return false;
+			}
+		}
+
+		return commitTransaction();
+	}
+
+	//---- STATEMENT METHODS
+
+	ZSPACE_INLINE zDatabaseCursor zDatabase::query(const string &sql)
+	{
+		if (!database) throw std::invalid_argument(" error: database not open.");
+
+		std::shared_ptr<zDatabaseCachedStatement> &cached = statementCache[sql];
+
+		// the cached statement is being stepped by another cursor, so this one gets its own
+		if (cached && cached->inUse)
+		{
+			sqlite3_stmt *stmt;
+			if (sqlite3_prepare_v2(database, sql.c_str(), -1, &stmt, NULL) != SQLITE_OK) throw std::invalid_argument(" error: " + string(sqlite3_errmsg(database)));
+
+			return zDatabaseCursor(stmt, nullptr);
+		}
+
+		if (!cached)
+		{
+			sqlite3_stmt *stmt;
+			if (sqlite3_prepare_v2(database, sql.c_str(), -1, &stmt, NULL) != SQLITE_OK)
+			{
+				statementCache.erase(sql);
+				throw std::invalid_argument(" error: " + string(sqlite3_errmsg(database)));
+			}
+
+			cached = std::make_shared<zDatabaseCachedStatement>();
+			cached->stmt = stmt;
+		}
+
+		cached->inUse = true;
+		return zDatabaseCursor(cached->stmt, cached);
+	}
+
+	ZSPACE_INLINE void zDatabase::clearStatementCache()
+	{
+		for (auto &cached : statementCache)
+		{
+			// a statement stepped by a cursor is finalized by the cursor
+			if (cached.second->inUse) cached.second->cached = false;
+			else sqlite3_finalize(cached.second->stmt);
+		}
+
+		statementCache.clear();
+	}
+
+	ZSPACE_INLINE bool zDatabase::tableExists(const string &tableName)
+	{
+		zDatabaseCursor cursor = query("SELECT 1 FROM sqlite_master WHERE (type = 'table' OR type = 'view') AND name = ?;");
+		cursor.bindText(1, tableName);
+
+		return cursor.step();
+	}
+
+	ZSPACE_INLINE bool zDatabase::beginTransaction()
+	{
+		return (sqlite3_exec(database, "BEGIN TRANSACTION;", NULL, NULL, NULL) == SQLITE_OK);
+	}
+
+	ZSPACE_INLINE bool zDatabase::commitTransaction()
+	{
+		return (sqlite3_exec(database, "COMMIT TRANSACTION;", NULL, NULL, NULL) == SQLITE_OK);
+	}
+
+	ZSPACE_INLINE bool zDatabase::rollbackTransaction()
+	{
+		return (sqlite3_exec(database, "ROLLBACK TRANSACTION;", NULL, NULL, NULL) == SQLITE_OK);
+	}
 }
\ No newline at end of file
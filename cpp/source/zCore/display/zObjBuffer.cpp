@@ -28,9 +28,10 @@ namespace zSpace
 
 		max_nVertices = 0;
 
+		headless = false;
 	}
 
-	ZSPACE_INLINE zObjBuffer::zObjBuffer(GLint _Max_Num_Verts)
+	ZSPACE_INLINE zObjBuffer::zObjBuffer(GLint _Max_Num_Verts, bool _headless)
 	{
 		nVertices = 0;
 		nColors = 0;
@@ -39,6 +40,19 @@ namespace zSpace
 
 		max_nVertices = _Max_Num_Verts;
 
+		headless = _headless;
+
+		if (headless)
+		{
+			hostVertices.reserve(max_nVertices * vertexAttribStride);
+			hostColors.reserve(max_nVertices * vertexColorStride);
+
+			hostEdgeIndices.reserve(max_nVertices * 2 * edgeIndexStride);
+			hostFaceIndices.reserve(max_nVertices * 2 * faceIndexStride);
+
+			return;
+		}
+
 		GLfloat *vertices = new GLfloat[max_nVertices * vertexAttribStride];
 		GLfloat *colors = new GLfloat[max_nVertices * vertexColorStride];
 
@@ -89,7 +103,7 @@ namespace zSpace
 
 		int out = nVertices;
 
-		GLfloat *vertices = new GLfloat[size * vertexAttribStride];
+		GLfloat *vertices = new GLfloat[size * vertexAttribStride]();
 
 		for (int i = 0; i < size; i++)
 		{
@@ -98,7 +112,7 @@ namespace zSpace
 			vertices[(i * vertexAttribStride) + 2] = _positions[i].z;
 
 
-			if (!_normals)
+			if (_normals)
 			{
 				vertices[(i * vertexAttribStride) + 3] = _normals[i].x;
 				vertices[(i * vertexAttribStride) + 4] = _normals[i].y;
@@ -106,8 +120,16 @@ namespace zSpace
 			}
 		}
 
-		glBindBuffer(GL_ARRAY_BUFFER, VBO_vertices);
-		glBufferSubData(GL_ARRAY_BUFFER, nVertices * vertexAttribStride * GLFloatSize, size  * vertexAttribStride * GLFloatSize, vertices);
+		if (headless)
+		{
+			hostVertices.resize((nVertices + size) * vertexAttribStride);
+			std::copy(vertices, vertices + size * vertexAttribStride, hostVertices.begin() + nVertices * vertexAttribStride);
+		}
+		else
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, VBO_vertices);
+			glBufferSubData(GL_ARRAY_BUFFER, nVertices * vertexAttribStride * GLFloatSize, size  * vertexAttribStride * GLFloatSize, vertices);
+		}
 
 		nVertices += size;
 
@@ -132,8 +154,16 @@ namespace zSpace
 		}
 
 
-		glBindBuffer(GL_ARRAY_BUFFER, VBO_vertexColors);
-		glBufferSubData(GL_ARRAY_BUFFER, nColors * vertexColorStride *GLFloatSize, size * vertexColorStride * GLFloatSize, colors);
+		if (headless)
+		{
+			hostColors.resize((nColors + size) * vertexColorStride);
+			std::copy(colors, colors + size * vertexColorStride, hostColors.begin() + nColors * vertexColorStride);
+		}
+		else
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, VBO_vertexColors);
+			glBufferSubData(GL_ARRAY_BUFFER, nColors * vertexColorStride *GLFloatSize, size * vertexColorStride * GLFloatSize, colors);
+		}
 
 		nColors += size;
 
@@ -155,8 +185,16 @@ namespace zSpace
 		}
 
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, VBO_edgeIndices);
-		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, nEdges * edgeIndexStride *GLIntSize, _edgeIndicies.size() * edgeIndexStride * GLIntSize, edgeIndicies);
+		if (headless)
+		{
+			hostEdgeIndices.resize((nEdges + _edgeIndicies.size()) * edgeIndexStride);
+			std::copy(edgeIndicies, edgeIndicies + _edgeIndicies.size() * edgeIndexStride, hostEdgeIndices.begin() + nEdges * edgeIndexStride);
+		}
+		else
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, VBO_edgeIndices);
+			glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, nEdges * edgeIndexStride *GLIntSize, _edgeIndicies.size() * edgeIndexStride * GLIntSize, edgeIndicies);
+		}
 
 		nEdges += _edgeIndicies.size();
 
@@ -178,8 +216,16 @@ namespace zSpace
 		}
 
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, VBO_faceIndices);
-		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, nFaces * faceIndexStride *GLIntSize, _faceIndicies.size() * faceIndexStride * GLIntSize, faceIndicies);
+		if (headless)
+		{
+			hostFaceIndices.resize((nFaces + _faceIndicies.size()) * faceIndexStride);
+			std::copy(faceIndicies, faceIndicies + _faceIndicies.size() * faceIndexStride, hostFaceIndices.begin() + nFaces * faceIndexStride);
+		}
+		else
+		{
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, VBO_faceIndices);
+			glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, nFaces * faceIndexStride *GLIntSize, _faceIndicies.size() * faceIndexStride * GLIntSize, faceIndicies);
+		}
 
 		nFaces += _faceIndicies.size();
 
@@ -193,6 +239,17 @@ namespace zSpace
 
 	ZSPACE_INLINE void zObjBuffer::updateVertexPositions(zPoint* _positions, int size, int startId)
 	{
+		if (headless)
+		{
+			for (int i = 0; i < size; i++)
+			{
+				hostVertices[((startId + i) * vertexAttribStride) + 0] = _positions[i].x;
+				hostVertices[((startId + i) * vertexAttribStride) + 1] = _positions[i].y;
+				hostVertices[((startId + i) * vertexAttribStride) + 2] = _positions[i].z;
+			}
+
+			return;
+		}
 
 		GLfloat *positions = new GLfloat[size * vertexAttribStride];
 
@@ -212,6 +269,18 @@ namespace zSpace
 
 	ZSPACE_INLINE void zObjBuffer::updateVertexNormals(zVector* _normals, int size, int &startId)
 	{
+		if (headless)
+		{
+			for (int i = 0; i < size; i++)
+			{
+				hostVertices[((startId + i) * vertexAttribStride) + 3] = _normals[i].x;
+				hostVertices[((startId + i) * vertexAttribStride) + 4] = _normals[i].y;
+				hostVertices[((startId + i) * vertexAttribStride) + 5] = _normals[i].z;
+			}
+
+			return;
+		}
+
 		GLfloat *normals = new GLfloat[size * vertexAttribStride];
 
 		for (int i = 0; i < size; i++)
@@ -230,6 +299,19 @@ namespace zSpace
 
 	ZSPACE_INLINE void zObjBuffer::updateVertexColors(zColor*_colors, int size, int &startId)
 	{
+		if (headless)
+		{
+			for (int i = 0; i < size; i++)
+			{
+				hostColors[((startId + i) * vertexColorStride) + 0] = _colors[i].r;
+				hostColors[((startId + i) * vertexColorStride) + 1] = _colors[i].g;
+				hostColors[((startId + i) * vertexColorStride) + 2] = _colors[i].b;
+				hostColors[((startId + i) * vertexColorStride) + 3] = _colors[i].a;
+			}
+
+			return;
+		}
+
 		GLfloat *colors = new GLfloat[size * vertexColorStride];
 
 		for (int i = 0; i < size; i++)
@@ -254,6 +336,15 @@ namespace zSpace
 	{
 		nVertices = nColors = nEdges = nFaces = 0;
 
+		if (headless)
+		{
+			hostVertices.clear();
+			hostColors.clear();
+
+			hostEdgeIndices.clear();
+			hostFaceIndices.clear();
+		}
+
 	}
 
 }
\ No newline at end of file
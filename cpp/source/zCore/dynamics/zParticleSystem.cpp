@@ -0,0 +1,363 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/dynamics/zParticleSystem.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zParticleSystem::zParticleSystem()
+	{
+		n = 0;
+		positions = nullptr;
+
+		grainSize = 4096;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zParticleSystem::~zParticleSystem() {}
+
+	//---- CREATE METHODS
+
+	ZSPACE_INLINE void zParticleSystem::create(zPoint *_positions, int numParticles)
+	{
+		clear();
+
+		n = numParticles;
+		positions = _positions;
+
+		for (zFloatArray *a : { &vx, &vy, &vz, &fx, &fy, &fz, &dPx, &dPy, &dPz, &dVx, &dVy, &dVz }) a->assign(n, 0);
+
+		invMass.assign(n, 1);
+		freeMask.assign(n, 1);
+
+		neighbourOffsets.assign(n + 1, 0);
+		faceOffsets.assign(n + 1, 0);
+	}
+
+	ZSPACE_INLINE void zParticleSystem::setNeighbours(const zIntArray &_neighbourOffsets, const zIntArray &_neighbours)
+	{
+		if (_neighbourOffsets.size() != n + 1) throw std::invalid_argument(" error: number of neighbour offsets not equal to the number of particles + 1.");
+		if (_neighbourOffsets[n] != _neighbours.size()) throw std::invalid_argument(" error: number of neighbours not equal to the last neighbour offset.");
+
+		neighbourOffsets = _neighbourOffsets;
+		neighbours = _neighbours;
+	}
+
+	ZSPACE_INLINE void zParticleSystem::setFaces(const zIntArray &_faceOffsets, const zIntArray &_particleFaces)
+	{
+		if (_faceOffsets.size() != n + 1) throw std::invalid_argument(" error: number of face offsets not equal to the number of particles + 1.");
+		if (_faceOffsets[n] != _particleFaces.size()) throw std::invalid_argument(" error: number of particle faces not equal to the last face offset.");
+
+		faceOffsets = _faceOffsets;
+		particleFaces = _particleFaces;
+	}
+
+	ZSPACE_INLINE void zParticleSystem::clear()
+	{
+		n = 0;
+		positions = nullptr;
+
+		for (zFloatArray *a : { &vx, &vy, &vz, &fx, &fy, &fz, &dPx, &dPy, &dPz, &dVx, &dVy, &dVz, &invMass, &freeMask }) a->clear();
+
+		neighbourOffsets.clear();
+		neighbours.clear();
+		faceOffsets.clear();
+		particleFaces.clear();
+	}
+
+	//---- GET SET METHODS
+
+	ZSPACE_INLINE int zParticleSystem::numParticles()
+	{
+		return n;
+	}
+
+	ZSPACE_INLINE void zParticleSystem::setFixed(int index, bool fixed)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		freeMask[index] = (fixed) ? 0 : 1;
+	}
+
+	ZSPACE_INLINE bool zParticleSystem::getFixed(int index)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		return (freeMask[index] == 0);
+	}
+
+	ZSPACE_INLINE void zParticleSystem::setMass(int index, double mass)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		if (mass <= 0) throw std::invalid_argument(" error: mass needs to be positive.");
+
+		invMass[index] = 1.0 / mass;
+	}
+
+	ZSPACE_INLINE double zParticleSystem::getMass(int index)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		return 1.0 / invMass[index];
+	}
+
+	ZSPACE_INLINE void zParticleSystem::setVelocity(int index, zVector &velocity)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+
+		vx[index] = velocity.x;
+		vy[index] = velocity.y;
+		vz[index] = velocity.z;
+	}
+
+	ZSPACE_INLINE zVector zParticleSystem::getVelocity(int index)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		return zVector(vx[index], vy[index], vz[index]);
+	}
+
+	ZSPACE_INLINE zVector zParticleSystem::getForce(int index)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+		return zVector(fx[index], fy[index], fz[index]);
+	}
+
+	//---- FORCE METHODS
+
+	ZSPACE_INLINE void zParticleSystem::addForce(zVector force)
+	{
+		float *_fx = fx.data();
+		float *_fy = fy.data();
+		float *_fz = fz.data();
+
+		for (int i = 0; i < n; i++)
+		{
+			_fx[i] += force.x;
+			_fy[i] += force.y;
+			_fz[i] += force.z;
+		}
+	}
+
+	ZSPACE_INLINE void zParticleSystem::addForce(int index, zVector &force)
+	{
+		if (index < 0 || index >= n) throw std::invalid_argument(" error: index out of bounds.");
+
+		fx[index] += force.x;
+		fy[index] += force.y;
+		fz[index] += force.z;
+	}
+
+	ZSPACE_INLINE void zParticleSystem::addEdgeForce(const zDoubleArray &weights)
+	{
+		if (weights.size() > 0 && weights.size() != n) throw std::invalid_argument(" error: number of weights not equal to the number of particles.");
+
+		zThreadPool::getGlobal().parallel_for(0, n, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				if (freeMask[i] == 0) continue;
+
+				zPoint &p = positions[i];
+				float sx = 0, sy = 0, sz = 0;
+
+				for (int k = neighbourOffsets[i]; k < neighbourOffsets[i + 1]; k++)
+				{
+					zPoint &q = positions[neighbours[k]];
+
+					sx += q.x - p.x;
+					sy += q.y - p.y;
+					sz += q.z - p.z;
+				}
+
+				float w = (weights.size() > 0) ? weights[i] : 1;
+
+				fx[i] += sx * w;
+				fy[i] += sy * w;
+				fz[i] += sz * w;
+			}
+		}, grainSize);
+	}
+
+	ZSPACE_INLINE void zParticleSystem::addPlanarityForce(zVectorArray &fNormals, zPointArray &fCenters, zDoubleArray &fVolumes, double tolerance)
+	{
+		if (fCenters.size() != fNormals.size()) throw std::invalid_argument(" error: number of face centers not equal to the number of face normals.");
+		if (fVolumes.size() != fNormals.size()) throw std::invalid_argument(" error: number of face volumes not equal to the number of face normals.");
+
+		zThreadPool::getGlobal().parallel_for(0, n, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				if (freeMask[i] == 0) continue;
+
+				zPoint &p = positions[i];
+				float sx = 0, sy = 0, sz = 0;
+
+				for (int k = faceOffsets[i]; k < faceOffsets[i + 1]; k++)
+				{
+					int f = particleFaces[k];
+					if (fVolumes[f] <= tolerance) continue;
+
+					zVector norm = fNormals[f];
+					norm.normalize();
+
+					// signed distance to the face plane
+					float dist = (p - fCenters[f]) * norm;
+
+					sx -= norm.x * dist;
+					sy -= norm.y * dist;
+					sz -= norm.z * dist;
+				}
+
+				fx[i] += sx;
+				fy[i] += sy;
+				fz[i] += sz;
+			}
+		}, grainSize);
+	}
+
+	ZSPACE_INLINE void zParticleSystem::clearForces()
+	{
+		std::fill(fx.begin(), fx.end(), 0.0f);
+		std::fill(fy.begin(), fy.end(), 0.0f);
+		std::fill(fz.begin(), fz.end(), 0.0f);
+	}
+
+	//---- UPDATE METHODS
+
+	ZSPACE_INLINE void zParticleSystem::update(double dT, zIntergrationType type, bool clearForce, bool clearVelocity, bool clearDerivatives)
+	{
+		if (type != zEuler && type != zRK4 && type != zPixel) throw std::invalid_argument(" error: invalid zIntergrationType ");
+
+		zThreadPool::getGlobal().parallel_for(0, n, [&](int start, int end)
+		{
+			if (type == zEuler) integrateEuler(start, end, dT);
+			else if (type == zRK4) integrateRK4(start, end, dT);
+
+			applyDerivatives(start, end, clearForce, clearVelocity, clearDerivatives);
+		}, grainSize);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zParticleSystem::integrateEuler(int start, int end, float dT)
+	{
+		// the component loops have no dependencies between particles, so they vectorise
+		float *f[3] = { fx.data(), fy.data(), fz.data() };
+		float *dP[3] = { dPx.data(), dPy.data(), dPz.data() };
+		float *dV[3] = { dVx.data(), dVy.data(), dVz.data() };
+		const float *w = invMass.data();
+		const float *free = freeMask.data();
+
+		for (int c = 0; c < 3; c++)
+		{
+			float *_f = f[c];
+			float *_dP = dP[c];
+			float *_dV = dV[c];
+
+			for (int i = start; i < end; i++)
+			{
+				float a = _f[i] * w[i] * dT;
+				float p = _dV[i] + a * dT;
+
+				// fixed particles keep their derivatives
+				_dP[i] = (free[i] != 0) ? p : _dP[i];
+				_dV[i] = (free[i] != 0) ? a : _dV[i];
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zParticleSystem::integrateRK4(int start, int end, float dT)
+	{
+		float *f[3] = { fx.data(), fy.data(), fz.data() };
+		float *dP[3] = { dPx.data(), dPy.data(), dPz.data() };
+		float *dV[3] = { dVx.data(), dVy.data(), dVz.data() };
+		const float *w = invMass.data();
+		const float *free = freeMask.data();
+
+		for (int c = 0; c < 3; c++)
+		{
+			float *_f = f[c];
+			float *_dP = dP[c];
+			float *_dV = dV[c];
+
+			for (int i = start; i < end; i++)
+			{
+				// the force is constant over the timestep, so each stage has the same velocity derivative
+				float a = _f[i] * w[i] * dT;
+				float v0 = _dV[i];
+
+				float aP = (v0 + a * dT) * 0.5f;
+				float aV = a * 0.5f;
+
+				float bP = ((v0 + aV) + a * dT) * 0.5f;
+				float bV = a * 0.5f;
+
+				float cP = (v0 + bV) + a * dT;
+				float cV = a;
+
+				float dP_ = (v0 + cV) + a * dT;
+				float dV_ = a;
+
+				float p = aP * 0.167f + bP * 0.334f + cP * 0.334f + dP_ * 0.167f;
+				float v = aV * 0.167f + bV * 0.334f + cV * 0.334f + dV_ * 0.167f;
+
+				_dP[i] = (free[i] != 0) ? p : _dP[i];
+				_dV[i] = (free[i] != 0) ? v : _dV[i];
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zParticleSystem::applyDerivatives(int start, int end, bool clearForce, bool clearVelocity, bool clearDerivatives)
+	{
+		const float *free = freeMask.data();
+
+		for (int i = start; i < end; i++)
+		{
+			if (free[i] == 0) continue;
+
+			positions[i].x += dPx[i];
+			positions[i].y += dPy[i];
+			positions[i].z += dPz[i];
+		}
+
+		float *v[3] = { vx.data(), vy.data(), vz.data() };
+		float *f[3] = { fx.data(), fy.data(), fz.data() };
+		float *dP[3] = { dPx.data(), dPy.data(), dPz.data() };
+		float *dV[3] = { dVx.data(), dVy.data(), dVz.data() };
+
+		for (int c = 0; c < 3; c++)
+		{
+			float *_v = v[c];
+			float *_f = f[c];
+			float *_dP = dP[c];
+			float *_dV = dV[c];
+
+			for (int i = start; i < end; i++)
+			{
+				float isFree = free[i];
+
+				float vel = (clearVelocity) ? 0 : _v[i] + _dV[i];
+				_v[i] = (isFree != 0) ? vel : _v[i];
+
+				if (clearForce) _f[i] = (isFree != 0) ? 0 : _f[i];
+
+				if (clearDerivatives)
+				{
+					_dP[i] = (isFree != 0) ? 0 : _dP[i];
+					_dV[i] = (isFree != 0) ? 0 : _dV[i];
+				}
+			}
+		}
+	}
+
+}
@@ -38,6 +38,12 @@ namespace zSpace
 		edges.reserve(floor(edgeConnects.size() * 0.5));
 		halfEdges.reserve(edgeConnects.size());
 
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.reserve(_positions.size());
+			halfEdgeHashMap.reserve(edgeConnects.size());
+		}
+
 
 		//// temp containers
 		vector<connectedEdgesPerVerts> cEdgesperVert;
@@ -120,6 +126,12 @@ namespace zSpace
 		edges.reserve(floor(edgeConnects.size() * 0.5) + 1);
 		halfEdges.reserve(edgeConnects.size() + 2);
 
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.reserve(_positions.size());
+			halfEdgeHashMap.reserve(edgeConnects.size());
+		}
+
 		// temp containers
 		connectedEdgesPerVerts *cEdgesperVert = new connectedEdgesPerVerts[_positions.size()];
 
@@ -195,6 +207,7 @@ namespace zSpace
 		vertexColors.clear();
 		vertexWeights.clear();
 		positionVertex.clear();
+		positionHashMap.clear();
 
 		edges.clear();
 		edgeColors.clear();
@@ -203,6 +216,7 @@ namespace zSpace
 
 		halfEdges.clear();
 		existingHalfEdges.clear();
+		halfEdgeHashMap.clear();
 
 		vHandles.clear();
 		eHandles.clear();
@@ -251,6 +265,8 @@ namespace zSpace
 		bool out = false;;
 		outVertexId = -1;
 
+		if (hashMapType == zIntegerHashMap) return positionHashMap.find(zPositionKey(pos, precisionfactor), outVertexId);
+
 		double factor = pow(10, precisionfactor);
 		double x = std::round(pos.x *factor) / factor;
 		double y = std::round(pos.y *factor) / factor;
@@ -279,6 +295,12 @@ namespace zSpace
 
 	ZSPACE_INLINE void zGraph::addToPositionMap(zPoint &pos, int index, int precisionfactor)
 	{
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.insert(zPositionKey(pos, precisionfactor), index);
+			return;
+		}
+
 		double factor = pow(10, precisionfactor);
 		double x = std::round(pos.x *factor) / factor;
 		double y = std::round(pos.y *factor) / factor;
@@ -290,6 +312,12 @@ namespace zSpace
 
 	ZSPACE_INLINE void zGraph::removeFromPositionMap(zPoint &pos, int precisionfactor)
 	{
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.erase(zPositionKey(pos, precisionfactor));
+			return;
+		}
+
 		double factor = pow(10, precisionfactor);
 		double x = std::round(pos.x *factor) / factor;
 		double y = std::round(pos.y *factor) / factor;
@@ -301,6 +329,12 @@ namespace zSpace
 
 	ZSPACE_INLINE void zGraph::addToHalfEdgesMap(int v1, int v2, int index)
 	{
+		if (hashMapType == zIntegerHashMap)
+		{
+			halfEdgeHashMap.insert(coreUtils.packIntPair(v1, v2), index);
+			halfEdgeHashMap.insert(coreUtils.packIntPair(v2, v1), index + 1);
+			return;
+		}
 
 		string e1 = (to_string(v1) + "," + to_string(v2));
 		existingHalfEdges[e1] = index;
@@ -313,6 +347,12 @@ namespace zSpace
 
 	ZSPACE_INLINE void zGraph::removeFromHalfEdgesMap(int v1, int v2)
 	{
+		if (hashMapType == zIntegerHashMap)
+		{
+			halfEdgeHashMap.erase(coreUtils.packIntPair(v1, v2));
+			halfEdgeHashMap.erase(coreUtils.packIntPair(v2, v1));
+			return;
+		}
 
 		string e1 = (to_string(v1) + "," + to_string(v2));
 		existingHalfEdges.erase(e1);
@@ -323,6 +363,7 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zGraph::halfEdgeExists(int v1, int v2, int &outEdgeId)
 	{
+		if (hashMapType == zIntegerHashMap) return halfEdgeHashMap.find(coreUtils.packIntPair(v1, v2), outEdgeId);
 
 		bool out = false;
 
@@ -340,6 +381,41 @@ namespace zSpace
 		return out;
 	}
 
+	ZSPACE_INLINE void zGraph::setHashMapType(zHashMapType type, int precisionfactor)
+	{
+		if (type != zStringHashMap && type != zIntegerHashMap) throw std::invalid_argument(" error: invalid zHashMapType type");
+
+		hashMapType = type;
+
+		positionVertex.clear();
+		positionHashMap.clear();
+
+		existingHalfEdges.clear();
+		halfEdgeHashMap.clear();
+
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.reserve(n_v);
+			halfEdgeHashMap.reserve(n_he);
+		}
+
+		// rebuild maps
+		for (int i = 0; i < n_v; i++)
+		{
+			addToPositionMap(vertexPositions[i], i, precisionfactor);
+		}
+
+		for (int i = 0; i < n_e; i++)
+		{
+			if (eHandles[i].he0 == -1 || eHandles[i].he1 == -1) continue;
+
+			int v1 = heHandles[eHandles[i].he1].v;
+			int v2 = heHandles[eHandles[i].he0].v;
+
+			addToHalfEdgesMap(v1, v2, eHandles[i].he0);
+		}
+	}
+
 	//---- EDGE METHODS
 
 	ZSPACE_INLINE bool zGraph::addEdges(int &v1, int &v2)
@@ -22,6 +22,7 @@ namespace zSpace
 	{
 		n_v = n_e = n_he = n_f = 0;
 
+		cachedAttributes = 0;
 	}
 	
 	//---- DESTRUCTOR
@@ -35,7 +36,9 @@ namespace zSpace
 
 	ZSPACE_INLINE void zMesh::create(zPointArray(&_positions), zIntArray(&polyCounts), zIntArray(&polyConnects))
 	{
-		//clear containers
+		if (createBulk(_positions, polyCounts, polyConnects)) return;
+
+		// non manifold input, built per polygon
 		clear();
 
 		int num_edges = computeNumEdges(polyCounts, polyConnects);
@@ -45,6 +48,12 @@ namespace zSpace
 		edges.reserve(num_edges/* + 1*/);
 		halfEdges.reserve(num_edges * 2 /*+ 2*/);
 
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.reserve(_positions.size());
+			halfEdgeHashMap.reserve(num_edges * 2);
+		}
+
 		// create vertices
 
 		for (int i = 0; i < _positions.size(); i++) addVertex(_positions[i]);
@@ -75,6 +84,232 @@ namespace zSpace
 
 	}
 
+	ZSPACE_INLINE bool zMesh::createBulk(zPointArray(&_positions), zIntArray(&polyCounts), zIntArray(&polyConnects))
+	{
+		//clear containers
+		clear();
+
+		int numV = _positions.size();
+		int numF = polyCounts.size();
+
+		zIntArray faceOffsets(numF + 1);
+		faceOffsets[0] = 0;
+		for (int i = 0; i < numF; i++)
+		{
+			if (polyCounts[i] < 1) return false;
+			faceOffsets[i + 1] = faceOffsets[i] + polyCounts[i];
+		}
+
+		int numC = faceOffsets[numF];
+		if (numC != polyConnects.size()) throw std::invalid_argument(" error: size of polyConnects not equal to the sum of polyCounts.");
+
+		// end vertex of each face half edge
+		zIntArray heEnd(numC);
+
+		for (int i = 0; i < numF; i++)
+		{
+			for (int j = faceOffsets[i]; j < faceOffsets[i + 1]; j++)
+			{
+				int v0 = polyConnects[j];
+				int v1 = polyConnects[(j + 1 < faceOffsets[i + 1]) ? j + 1 : faceOffsets[i]];
+
+				if (v0 < 0 || v0 >= numV) throw std::invalid_argument(" error: polyConnects vertex index out of bounds.");
+				if (v0 == v1) return false;
+
+				heEnd[j] = v1;
+			}
+		}
+
+		// bucket the face half edges by their smaller vertex, keeping the face order in each bucket
+		zIntArray bucketOffsets(numV + 1, 0);
+		for (int j = 0; j < numC; j++) bucketOffsets[std::min(polyConnects[j], heEnd[j]) + 1]++;
+		for (int i = 0; i < numV; i++) bucketOffsets[i + 1] += bucketOffsets[i];
+
+		zIntArray bucketFill(bucketOffsets.begin(), bucketOffsets.end() - 1);
+		zIntArray bucketHEs(numC);
+		for (int j = 0; j < numC; j++) bucketHEs[bucketFill[std::min(polyConnects[j], heEnd[j])]++] = j;
+
+		// sort the buckets by the larger vertex, which makes the two face half edges of an edge adjacent
+		zIntArray heTwin(numC, -1);
+		std::atomic<bool> manifold(true);
+
+		zIntArray &connects = polyConnects;
+		auto maxVertex = [&connects, &heEnd](int j) { return std::max(connects[j], heEnd[j]); };
+
+		zThreadPool::getGlobal().parallel_for(0, numV, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				int b0 = bucketOffsets[i];
+				int b1 = bucketOffsets[i + 1];
+
+				if (b1 - b0 > 1) std::sort(bucketHEs.begin() + b0, bucketHEs.begin() + b1, [&maxVertex](int a, int b)
+				{
+					int ma = maxVertex(a);
+					int mb = maxVertex(b);
+					return (ma < mb) || (ma == mb && a < b);
+				});
+
+				for (int k = b0; k < b1; k++)
+				{
+					int j = bucketHEs[k];
+					if (k + 1 == b1 || maxVertex(bucketHEs[k + 1]) != maxVertex(j)) continue;
+
+					int jTwin = bucketHEs[k + 1];
+
+					// edges of more than two faces, and edges used twice in the same direction
+					if ((k + 2 < b1 && maxVertex(bucketHEs[k + 2]) == maxVertex(j)) || connects[j] == connects[jTwin]) manifold = false;
+
+					heTwin[j] = jTwin;
+					heTwin[jTwin] = j;
+					k++;
+				}
+			}
+		}, 1024);
+
+		if (!manifold) return false;
+
+		// edges are numbered in the order they are first met, as in the per polygon construction
+		zIntArray heIds(numC);
+		zIntArray edgeFirstHE;
+		edgeFirstHE.reserve(numC / 2 + 1);
+
+		for (int j = 0; j < numC; j++)
+		{
+			if (heTwin[j] == -1 || heTwin[j] > j)
+			{
+				heIds[j] = 2 * edgeFirstHE.size();
+				edgeFirstHE.push_back(j);
+			}
+			else heIds[j] = heIds[heTwin[j]] + 1;
+		}
+
+		int numE = edgeFirstHE.size();
+
+		// vertices
+		vertices.resize(numV);
+		vHandles.resize(numV);
+		vertexPositions = _positions;
+		vertexColors.assign(numV, zColor(1, 0, 0, 1));
+		vertexWeights.assign(numV, 2.0);
+
+		for (int i = 0; i < numV; i++)
+		{
+			vertices[i].setId(i);
+			vHandles[i].id = i;
+		}
+
+		n_v = numV;
+
+		// edges and half edges
+		edges.resize(numE);
+		halfEdges.resize(numE * 2);
+		eHandles.resize(numE);
+		heHandles.resize(numE * 2);
+		edgeColors.assign(numE, zColor(0, 0, 0, 0));
+		edgeWeights.assign(numE, 1.0);
+
+		zThreadPool::getGlobal().parallel_for(0, numE, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				int j = edgeFirstHE[i];
+				int v1 = polyConnects[j];
+				int v2 = heEnd[j];
+
+				zHalfEdge &he0 = halfEdges[2 * i];
+				zHalfEdge &he1 = halfEdges[2 * i + 1];
+
+				he0.setId(2 * i);
+				he0.setVertex(&vertices[v2]);
+				he0.setEdge(&edges[i]);
+
+				he1.setId(2 * i + 1);
+				he1.setVertex(&vertices[v1]);
+				he1.setEdge(&edges[i]);
+				he1.setSym(&he0);
+
+				edges[i].setId(i);
+				edges[i].setHalfEdge(&he0, 0);
+				edges[i].setHalfEdge(&he1, 1);
+
+				heHandles[2 * i].id = 2 * i;
+				heHandles[2 * i].v = v2;
+				heHandles[2 * i].e = i;
+
+				heHandles[2 * i + 1].id = 2 * i + 1;
+				heHandles[2 * i + 1].v = v1;
+				heHandles[2 * i + 1].e = i;
+
+				eHandles[i].id = i;
+				eHandles[i].he0 = 2 * i;
+				eHandles[i].he1 = 2 * i + 1;
+			}
+		}, 4096);
+
+		n_e = numE;
+		n_he = numE * 2;
+
+		// faces, each face only links its own half edges
+		faces.resize(numF);
+		fHandles.resize(numF);
+		faceColors.assign(numF, zColor(0.5, 0.5, 0.5, 1));
+
+		zThreadPool::getGlobal().parallel_for(0, numF, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				int f0 = faceOffsets[i];
+				int f1 = faceOffsets[i + 1];
+
+				for (int j = f0; j < f1; j++)
+				{
+					int he = heIds[j];
+					int heNext = heIds[(j + 1 < f1) ? j + 1 : f0];
+					int hePrev = heIds[(j > f0) ? j - 1 : f1 - 1];
+
+					halfEdges[he].setFace(&faces[i]);
+					halfEdges[he].setNext(&halfEdges[heNext]);
+					halfEdges[he].setPrev(&halfEdges[hePrev]);
+
+					heHandles[he].f = i;
+					heHandles[he].n = heNext;
+					heHandles[he].p = hePrev;
+				}
+
+				faces[i].setId(i);
+				faces[i].setHalfEdge(&halfEdges[heIds[f0]]);
+
+				fHandles[i].id = i;
+				fHandles[i].he = heIds[f0];
+			}
+		}, 4096);
+
+		n_f = numF;
+
+		// the vertex half edge is the one of its last face, as in the per polygon construction
+		for (int j = 0; j < numC; j++)
+		{
+			vertices[polyConnects[j]].setHalfEdge(&halfEdges[heIds[j]]);
+			vHandles[polyConnects[j]].he = heIds[j];
+		}
+
+		// lookup maps
+		if (hashMapType == zIntegerHashMap)
+		{
+			positionHashMap.reserve(numV);
+			halfEdgeHashMap.reserve(numE * 2);
+		}
+
+		for (int i = 0; i < numV; i++) addToPositionMap(_positions[i], i);
+		for (int i = 0; i < numE; i++) addToHalfEdgesMap(heHandles[2 * i + 1].v, heHandles[2 * i].v, 2 * i);
+
+		// update boundary pointers
+		update_BoundaryEdgePointers();
+
+		return true;
+	}
+
 	ZSPACE_INLINE void zMesh::clear()
 	{
 		vertices.clear();
@@ -83,6 +318,7 @@ namespace zSpace
 		vertexColors.clear();
 		vertexWeights.clear();
 		positionVertex.clear();
+		positionHashMap.clear();
 
 		edges.clear();
 		edgeColors.clear();
@@ -91,11 +327,18 @@ namespace zSpace
 
 		halfEdges.clear();
 		existingHalfEdges.clear();
+		halfEdgeHashMap.clear();
 
 		faces.clear();
 		faceColors.clear();
 		faceNormals.clear();
 
+		faceAreas.clear();
+		vertexAreas.clear();
+		vertexCurvatures.clear();
+		cachePositions.clear();
+		cachedAttributes = 0;
+
 		vHandles.clear();
 		eHandles.clear();
 		heHandles.clear();
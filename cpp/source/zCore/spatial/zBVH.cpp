@@ -0,0 +1,510 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/spatial/zBVH.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zBVH::zBVH()
+	{
+		leafSize = 4;
+		primitiveSize = 2;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zBVH::~zBVH() {}
+
+	//---- CREATE METHODS
+
+	ZSPACE_INLINE void zBVH::buildEdges(zPoint *inPositions, int numPositions, zIntArray &_edgeVertices, int _leafSize)
+	{
+		if (_edgeVertices.size() % 2 != 0) throw std::invalid_argument(" error: edge vertices size is not a multiple of 2.");
+
+		buildPrimitives(inPositions, numPositions, _edgeVertices, 2, _leafSize);
+	}
+
+	ZSPACE_INLINE void zBVH::buildEdges(zGraph &inGraph, int _leafSize)
+	{
+		zIntArray _edgeVertices;
+		_edgeVertices.assign(inGraph.edges.size() * 2, -1);
+
+		for (int i = 0; i < inGraph.edges.size(); i++)
+		{
+			if (!inGraph.edges[i].isActive()) continue;
+
+			zHalfEdge *he = inGraph.edges[i].getHalfEdge(0);
+
+			_edgeVertices[i * 2 + 0] = he->getSym()->getVertex()->getId();
+			_edgeVertices[i * 2 + 1] = he->getVertex()->getId();
+		}
+
+		zPoint *inPositions = (inGraph.vertexPositions.size() > 0) ? &inGraph.vertexPositions[0] : NULL;
+		buildPrimitives(inPositions, inGraph.vertexPositions.size(), _edgeVertices, 2, _leafSize);
+	}
+
+	ZSPACE_INLINE void zBVH::buildTriangles(zPoint *inPositions, int numPositions, zIntArray &_triangleVertices, int _leafSize)
+	{
+		if (_triangleVertices.size() % 3 != 0) throw std::invalid_argument(" error: triangle vertices size is not a multiple of 3.");
+
+		buildPrimitives(inPositions, numPositions, _triangleVertices, 3, _leafSize);
+	}
+
+	ZSPACE_INLINE void zBVH::buildTriangles(zMesh &inMesh, int _leafSize)
+	{
+		zIntArray _triangleVertices;
+		zIntArray _triangleFaces;
+		zIntArray fVerts;
+
+		for (int i = 0; i < inMesh.faces.size(); i++)
+		{
+			if (!inMesh.faces[i].isActive()) continue;
+
+			fVerts.clear();
+
+			zHalfEdge *start = inMesh.faces[i].getHalfEdge();
+			zHalfEdge *he = start;
+
+			do
+			{
+				fVerts.push_back(he->getVertex()->getId());
+				he = he->getNext();
+
+			} while (he != start);
+
+			for (int j = 1; j + 1 < fVerts.size(); j++)
+			{
+				_triangleVertices.push_back(fVerts[0]);
+				_triangleVertices.push_back(fVerts[j]);
+				_triangleVertices.push_back(fVerts[j + 1]);
+
+				_triangleFaces.push_back(i);
+			}
+		}
+
+		zPoint *inPositions = (inMesh.vertexPositions.size() > 0) ? &inMesh.vertexPositions[0] : NULL;
+		buildPrimitives(inPositions, inMesh.vertexPositions.size(), _triangleVertices, 3, _leafSize);
+
+		triangleFaces = _triangleFaces;
+	}
+
+	ZSPACE_INLINE void zBVH::refit(zPoint *inPositions, int numPositions)
+	{
+		if (numPositions != positions.size()) throw std::invalid_argument(" error: number of positions not equal to the number of positions in the hierarchy.");
+
+		positions.assign(inPositions, inPositions + numPositions);
+
+		// children are stored after their parent, so a reverse sweep visits them first
+		for (int i = nodes.size() - 1; i >= 0; i--)
+		{
+			zKdNode &node = nodes[i];
+
+			if (node.left == -1) computeLeafBounds(node);
+			else
+			{
+				node.bbMin = nodes[node.left].bbMin;
+				node.bbMax = nodes[node.left].bbMax;
+				node.expand(nodes[node.right].bbMin);
+				node.expand(nodes[node.right].bbMax);
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zBVH::clear()
+	{
+		positions.clear();
+		primitiveVertices.clear();
+		triangleFaces.clear();
+		indices.clear();
+		nodes.clear();
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE int zBVH::numPrimitives()
+	{
+		return primitiveVertices.size() / primitiveSize;
+	}
+
+	ZSPACE_INLINE int zBVH::getTriangleFace(int triangleId)
+	{
+		if (triangleId < 0 || triangleId >= triangleFaces.size()) return -1;
+
+		return triangleFaces[triangleId];
+	}
+
+	ZSPACE_INLINE int zBVH::getNearest(zPoint &pos, double &outDistance, zPoint &outClosestPt)
+	{
+		int bestId = -1;
+		outDistance = DBL_MAX;
+
+		if (nodes.size() > 0) nearestNode(0, pos, bestId, outDistance, outClosestPt);
+
+		return bestId;
+	}
+
+	ZSPACE_INLINE void zBVH::getWithinRadius(zPoint &pos, double radius, zIntArray &outIndices)
+	{
+		outIndices.clear();
+
+		if (nodes.size() > 0) radiusNode(0, pos, radius, outIndices);
+
+		sort(outIndices.begin(), outIndices.end());
+	}
+
+	ZSPACE_INLINE int zBVH::getRayIntersection(zPoint &origin, zVector &direction, double &outDistance, zPoint &outHitPt)
+	{
+		if (primitiveSize != 3) throw std::invalid_argument(" error: ray intersection needs a triangle hierarchy.");
+
+		int bestId = -1;
+		outDistance = DBL_MAX;
+
+		if (nodes.size() > 0) rayNode(0, origin, direction, bestId, outDistance, outHitPt);
+
+		return bestId;
+	}
+
+	ZSPACE_INLINE bool zBVH::hasRayIntersection(zPoint &origin, zVector &direction)
+	{
+		if (primitiveSize != 3) throw std::invalid_argument(" error: ray intersection needs a triangle hierarchy.");
+
+		if (nodes.size() == 0) return false;
+
+		return rayAnyNode(0, origin, direction);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zBVH::buildPrimitives(zPoint *inPositions, int numPositions, zIntArray &_primitiveVertices, int _primitiveSize, int _leafSize)
+	{
+		clear();
+
+		leafSize = (_leafSize < 1) ? 1 : _leafSize;
+		primitiveSize = _primitiveSize;
+
+		positions.assign(inPositions, inPositions + numPositions);
+		primitiveVertices = _primitiveVertices;
+
+		int nPrimitives = primitiveVertices.size() / primitiveSize;
+
+		for (int i = 0; i < nPrimitives; i++)
+		{
+			bool valid = true;
+			for (int k = 0; k < primitiveSize; k++)
+			{
+				int vId = primitiveVertices[i * primitiveSize + k];
+
+				if (vId >= numPositions) throw std::invalid_argument(" error: primitive vertex index out of bounds.");
+				if (vId < 0) valid = false;
+			}
+
+			if (valid) indices.push_back(i);
+		}
+
+		nodes.reserve(2 * (indices.size() / leafSize) + 1);
+
+		if (indices.size() > 0) buildNode(0, indices.size());
+	}
+
+	ZSPACE_INLINE int zBVH::buildNode(int start, int end)
+	{
+		int nodeId = nodes.size();
+		nodes.push_back(zKdNode());
+
+		zKdNode node;
+		node.start = start;
+		node.end = end;
+		node.left = node.right = -1;
+		computeLeafBounds(node);
+
+		if (end - start > leafSize)
+		{
+			const int numBins = 16;
+
+			// split along the longest axis of the centroid bounds
+			zKdNode centroidBounds;
+			centroidBounds.bbMin = centroidBounds.bbMax = getCentroid(indices[start]);
+			for (int i = start + 1; i < end; i++)
+			{
+				zPoint c = getCentroid(indices[i]);
+				centroidBounds.expand(c);
+			}
+
+			zVector extents = centroidBounds.bbMax - centroidBounds.bbMin;
+
+			int axis = 0;
+			if (extents.y > extents.x) axis = 1;
+			if (extents.z > ((axis == 0) ? extents.x : extents.y)) axis = 2;
+
+			float axisMin = (axis == 0) ? centroidBounds.bbMin.x : ((axis == 1) ? centroidBounds.bbMin.y : centroidBounds.bbMin.z);
+			float axisExtent = (axis == 0) ? extents.x : ((axis == 1) ? extents.y : extents.z);
+
+			int mid = start;
+
+			if (axisExtent > 0)
+			{
+				auto getBin = [&](int id)
+				{
+					zPoint c = getCentroid(id);
+					float coord = (axis == 0) ? c.x : ((axis == 1) ? c.y : c.z);
+
+					int b = (int)(numBins * ((coord - axisMin) / axisExtent));
+					return std::min(std::max(b, 0), numBins - 1);
+				};
+
+				auto getArea = [](zKdNode &box)
+				{
+					zVector d = box.bbMax - box.bbMin;
+					return (double)d.x * d.y + (double)d.y * d.z + (double)d.z * d.x;
+				};
+
+				zKdNode bins[numBins];
+				int binCounts[numBins];
+				for (int b = 0; b < numBins; b++) binCounts[b] = 0;
+
+				for (int i = start; i < end; i++)
+				{
+					int b = getBin(indices[i]);
+
+					zKdNode primitiveBounds;
+					primitiveBounds.start = i;
+					primitiveBounds.end = i + 1;
+					computeLeafBounds(primitiveBounds);
+
+					if (binCounts[b] == 0)
+					{
+						bins[b].bbMin = primitiveBounds.bbMin;
+						bins[b].bbMax = primitiveBounds.bbMax;
+					}
+					else
+					{
+						bins[b].expand(primitiveBounds.bbMin);
+						bins[b].expand(primitiveBounds.bbMax);
+					}
+
+					binCounts[b]++;
+				}
+
+				// sweep the bins from the right, then evaluate each split from the left
+				double rightCosts[numBins];
+				zKdNode sweep;
+				int sweepCount = 0;
+
+				for (int b = numBins - 1; b > 0; b--)
+				{
+					if (binCounts[b] > 0)
+					{
+						if (sweepCount == 0) sweep = bins[b];
+						else { sweep.expand(bins[b].bbMin); sweep.expand(bins[b].bbMax); }
+						sweepCount += binCounts[b];
+					}
+
+					rightCosts[b] = (sweepCount > 0) ? getArea(sweep) * sweepCount : 0;
+				}
+
+				int bestSplit = -1;
+				double bestCost = DBL_MAX;
+				sweepCount = 0;
+
+				for (int b = 0; b < numBins - 1; b++)
+				{
+					if (binCounts[b] > 0)
+					{
+						if (sweepCount == 0) sweep = bins[b];
+						else { sweep.expand(bins[b].bbMin); sweep.expand(bins[b].bbMax); }
+						sweepCount += binCounts[b];
+					}
+
+					if (sweepCount == 0 || sweepCount == end - start) continue;
+
+					double cost = getArea(sweep) * sweepCount + rightCosts[b + 1];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestSplit = b + 1;
+					}
+				}
+
+				if (bestSplit != -1)
+				{
+					mid = partition(indices.begin() + start, indices.begin() + end, [&](int id) { return getBin(id) < bestSplit; }) - indices.begin();
+				}
+			}
+
+			// coincident centroids, split the range in half
+			if (mid == start || mid == end)
+			{
+				mid = (start + end) / 2;
+				sort(indices.begin() + start, indices.begin() + end);
+			}
+
+			node.left = buildNode(start, mid);
+			node.right = buildNode(mid, end);
+		}
+
+		nodes[nodeId] = node;
+
+		return nodeId;
+	}
+
+	ZSPACE_INLINE void zBVH::computeLeafBounds(zKdNode &node)
+	{
+		node.bbMin = node.bbMax = positions[primitiveVertices[indices[node.start] * primitiveSize]];
+
+		for (int i = node.start; i < node.end; i++)
+		{
+			for (int k = 0; k < primitiveSize; k++) node.expand(positions[primitiveVertices[indices[i] * primitiveSize + k]]);
+		}
+	}
+
+	ZSPACE_INLINE zPoint zBVH::getCentroid(int primitiveId)
+	{
+		zPoint c;
+		for (int k = 0; k < primitiveSize; k++) c += positions[primitiveVertices[primitiveId * primitiveSize + k]];
+
+		return c / primitiveSize;
+	}
+
+	ZSPACE_INLINE double zBVH::getDistance(int primitiveId, zPoint &pos, zPoint &closestPt)
+	{
+		int *pVerts = &primitiveVertices[primitiveId * primitiveSize];
+
+		if (primitiveSize == 2) return coreUtils.minDist_Edge_Point(pos, positions[pVerts[0]], positions[pVerts[1]], closestPt);
+		else return coreUtils.minDist_Triangle_Point(pos, positions[pVerts[0]], positions[pVerts[1]], positions[pVerts[2]], closestPt);
+	}
+
+	ZSPACE_INLINE void zBVH::nearestNode(int nodeId, zPoint &pos, int &bestId, double &bestDistance, zPoint &bestPt)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				int id = indices[i];
+
+				zPoint closestPt;
+				double d = getDistance(id, pos, closestPt);
+
+				if (d < bestDistance || (d == bestDistance && id < bestId))
+				{
+					bestDistance = d;
+					bestId = id;
+					bestPt = closestPt;
+				}
+			}
+
+			return;
+		}
+
+		// the box distance is a lower bound of the primitive distance, so a node is skipped only if it is farther than the current best
+		double dLeft = sqrt(nodes[node.left].squareDistanceTo(pos));
+		double dRight = sqrt(nodes[node.right].squareDistanceTo(pos));
+
+		int first = (dLeft <= dRight) ? node.left : node.right;
+		int second = (dLeft <= dRight) ? node.right : node.left;
+		double dSecond = (dLeft <= dRight) ? dRight : dLeft;
+
+		if (std::min(dLeft, dRight) <= bestDistance) nearestNode(first, pos, bestId, bestDistance, bestPt);
+		if (dSecond <= bestDistance) nearestNode(second, pos, bestId, bestDistance, bestPt);
+	}
+
+	ZSPACE_INLINE void zBVH::radiusNode(int nodeId, zPoint &pos, double radius, zIntArray &outIndices)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (sqrt(node.squareDistanceTo(pos)) > radius) return;
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				zPoint closestPt;
+				if (getDistance(indices[i], pos, closestPt) <= radius) outIndices.push_back(indices[i]);
+			}
+
+			return;
+		}
+
+		radiusNode(node.left, pos, radius, outIndices);
+		radiusNode(node.right, pos, radius, outIndices);
+	}
+
+	ZSPACE_INLINE void zBVH::rayNode(int nodeId, zPoint &origin, zVector &direction, int &bestId, double &bestDistance, zPoint &bestPt)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.left == -1)
+		{
+			double dirSquared = direction * direction;
+
+			for (int i = node.start; i < node.end; i++)
+			{
+				int id = indices[i];
+				int *pVerts = &primitiveVertices[id * primitiveSize];
+
+				zPoint hitPt;
+				if (!coreUtils.ray_triangleIntersection(positions[pVerts[0]], positions[pVerts[1]], positions[pVerts[2]], direction, origin, hitPt)) continue;
+
+				double t = ((hitPt - origin) * direction) / dirSquared;
+
+				if (t < bestDistance || (t == bestDistance && id < bestId))
+				{
+					bestDistance = t;
+					bestId = id;
+					bestPt = hitPt;
+				}
+			}
+
+			return;
+		}
+
+		// visit the child entered first, and skip the ones entered after the current hit
+		float tLeft = nodes[node.left].rayEntry(origin, direction);
+		float tRight = nodes[node.right].rayEntry(origin, direction);
+
+		int first = (tLeft <= tRight) ? node.left : node.right;
+		int second = (tLeft <= tRight) ? node.right : node.left;
+		float tFirst = std::min(tLeft, tRight);
+		float tSecond = std::max(tLeft, tRight);
+
+		// the entry is computed in single precision, so it is compared with a small tolerance
+		if (tFirst != FLT_MAX && tFirst <= bestDistance * (1 + 1e-5) + 1e-6) rayNode(first, origin, direction, bestId, bestDistance, bestPt);
+		if (tSecond != FLT_MAX && tSecond <= bestDistance * (1 + 1e-5) + 1e-6) rayNode(second, origin, direction, bestId, bestDistance, bestPt);
+	}
+
+	ZSPACE_INLINE bool zBVH::rayAnyNode(int nodeId, zPoint &origin, zVector &direction)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.rayEntry(origin, direction) == FLT_MAX) return false;
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				int *pVerts = &primitiveVertices[indices[i] * primitiveSize];
+
+				zPoint hitPt;
+				if (coreUtils.ray_triangleIntersection(positions[pVerts[0]], positions[pVerts[1]], positions[pVerts[2]], direction, origin, hitPt)) return true;
+			}
+
+			return false;
+		}
+
+		return rayAnyNode(node.left, origin, direction) || rayAnyNode(node.right, origin, direction);
+	}
+
+}
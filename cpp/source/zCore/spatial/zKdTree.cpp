@@ -0,0 +1,322 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/spatial/zKdTree.h>
+
+namespace zSpace
+{
+	//---- zKdNode
+
+	ZSPACE_INLINE float zKdNode::squareDistanceTo(zVector &pos)
+	{
+		float dx = (pos.x < bbMin.x) ? bbMin.x - pos.x : ((pos.x > bbMax.x) ? pos.x - bbMax.x : 0);
+		float dy = (pos.y < bbMin.y) ? bbMin.y - pos.y : ((pos.y > bbMax.y) ? pos.y - bbMax.y : 0);
+		float dz = (pos.z < bbMin.z) ? bbMin.z - pos.z : ((pos.z > bbMax.z) ? pos.z - bbMax.z : 0);
+
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	ZSPACE_INLINE void zKdNode::expand(zVector &pos)
+	{
+		bbMin.x = std::min(bbMin.x, pos.x); bbMax.x = std::max(bbMax.x, pos.x);
+		bbMin.y = std::min(bbMin.y, pos.y); bbMax.y = std::max(bbMax.y, pos.y);
+		bbMin.z = std::min(bbMin.z, pos.z); bbMax.z = std::max(bbMax.z, pos.z);
+	}
+
+	ZSPACE_INLINE float zKdNode::rayEntry(zPoint &origin, zVector &direction)
+	{
+		float tMin = 0;
+		float tMax = FLT_MAX;
+
+		float o[3] = { origin.x, origin.y, origin.z };
+		float d[3] = { direction.x, direction.y, direction.z };
+		float lo[3] = { bbMin.x, bbMin.y, bbMin.z };
+		float hi[3] = { bbMax.x, bbMax.y, bbMax.z };
+
+		for (int k = 0; k < 3; k++)
+		{
+			if (d[k] == 0)
+			{
+				// parallel to the slab
+				if (o[k] < lo[k] || o[k] > hi[k]) return FLT_MAX;
+				continue;
+			}
+
+			float t0 = (lo[k] - o[k]) / d[k];
+			float t1 = (hi[k] - o[k]) / d[k];
+			if (t0 > t1) std::swap(t0, t1);
+
+			tMin = std::max(tMin, t0);
+			tMax = std::min(tMax, t1);
+
+			if (tMin > tMax) return FLT_MAX;
+		}
+
+		return tMin;
+	}
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zKdTree::zKdTree()
+	{
+		leafSize = 8;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zKdTree::~zKdTree() {}
+
+	//---- CREATE METHODS
+
+	ZSPACE_INLINE void zKdTree::build(zPointArray &inPositions, int _leafSize)
+	{
+		build((inPositions.size() > 0) ? &inPositions[0] : NULL, inPositions.size(), _leafSize);
+	}
+
+	ZSPACE_INLINE void zKdTree::build(zPointCloud &inPointCloud, int _leafSize)
+	{
+		build(inPointCloud.vertexPositions, _leafSize);
+	}
+
+	ZSPACE_INLINE void zKdTree::build(zPoint *inPositions, int numPositions, int _leafSize)
+	{
+		clear();
+
+		leafSize = (_leafSize < 1) ? 1 : _leafSize;
+
+		positions.assign(inPositions, inPositions + numPositions);
+
+		indices.resize(numPositions);
+		for (int i = 0; i < numPositions; i++) indices[i] = i;
+
+		nodes.reserve(2 * (numPositions / leafSize) + 1);
+
+		if (numPositions > 0) buildNode(0, numPositions);
+	}
+
+	ZSPACE_INLINE void zKdTree::refit(zPoint *inPositions, int numPositions)
+	{
+		if (numPositions != positions.size()) throw std::invalid_argument(" error: number of positions not equal to the number of positions in the tree.");
+
+		positions.assign(inPositions, inPositions + numPositions);
+
+		// children are stored after their parent, so a reverse sweep visits them first
+		for (int i = nodes.size() - 1; i >= 0; i--)
+		{
+			zKdNode &node = nodes[i];
+
+			if (node.left == -1)
+			{
+				node.bbMin = node.bbMax = positions[indices[node.start]];
+				for (int j = node.start + 1; j < node.end; j++) node.expand(positions[indices[j]]);
+			}
+			else
+			{
+				node.bbMin = nodes[node.left].bbMin;
+				node.bbMax = nodes[node.left].bbMax;
+				node.expand(nodes[node.right].bbMin);
+				node.expand(nodes[node.right].bbMax);
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zKdTree::clear()
+	{
+		positions.clear();
+		indices.clear();
+		nodes.clear();
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE int zKdTree::numPositions()
+	{
+		return positions.size();
+	}
+
+	ZSPACE_INLINE int zKdTree::getNearest(zPoint &pos, float &outDistanceSquared)
+	{
+		int bestId = -1;
+		outDistanceSquared = FLT_MAX;
+
+		if (nodes.size() > 0) nearestNode(0, pos, bestId, outDistanceSquared);
+
+		return bestId;
+	}
+
+	ZSPACE_INLINE void zKdTree::getWithinRadius(zPoint &pos, float radius, zIntArray &outIndices)
+	{
+		outIndices.clear();
+
+		if (nodes.size() > 0) radiusNode(0, pos, radius * radius, outIndices);
+
+		sort(outIndices.begin(), outIndices.end());
+	}
+
+	ZSPACE_INLINE void zKdTree::getKNearest(zPoint &pos, int k, zIntArray &outIndices, zFloatArray &outDistancesSquared)
+	{
+		outIndices.clear();
+		outDistancesSquared.clear();
+
+		if (k <= 0 || nodes.size() == 0) return;
+
+		vector<pair<float, int>> heap;
+		heap.reserve(k + 1);
+
+		kNearestNode(0, pos, k, heap);
+
+		sort_heap(heap.begin(), heap.end());
+
+		for (auto &h : heap)
+		{
+			outDistancesSquared.push_back(h.first);
+			outIndices.push_back(h.second);
+		}
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE int zKdTree::buildNode(int start, int end)
+	{
+		int nodeId = nodes.size();
+		nodes.push_back(zKdNode());
+
+		zKdNode node;
+		node.start = start;
+		node.end = end;
+		node.left = node.right = -1;
+		node.bbMin = node.bbMax = positions[indices[start]];
+
+		for (int i = start + 1; i < end; i++) node.expand(positions[indices[i]]);
+
+		if (end - start > leafSize)
+		{
+			// split at the median of the longest axis
+			zVector extents = node.bbMax - node.bbMin;
+
+			int axis = 0;
+			if (extents.y > extents.x) axis = 1;
+			if (extents.z > ((axis == 0) ? extents.x : extents.y)) axis = 2;
+
+			zPointArray &pts = positions;
+			auto coord = [&pts, axis](int id) { return (axis == 0) ? pts[id].x : ((axis == 1) ? pts[id].y : pts[id].z); };
+
+			int mid = (start + end) / 2;
+			nth_element(indices.begin() + start, indices.begin() + mid, indices.begin() + end, [&coord](int a, int b)
+			{
+				float ca = coord(a);
+				float cb = coord(b);
+				return (ca < cb) || (ca == cb && a < b);
+			});
+
+			node.left = buildNode(start, mid);
+			node.right = buildNode(mid, end);
+		}
+
+		nodes[nodeId] = node;
+
+		return nodeId;
+	}
+
+	ZSPACE_INLINE void zKdTree::nearestNode(int nodeId, zPoint &pos, int &bestId, float &bestDistanceSquared)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				int id = indices[i];
+				float d = pos.squareDistanceTo(positions[id]);
+
+				if (d < bestDistanceSquared || (d == bestDistanceSquared && id < bestId))
+				{
+					bestDistanceSquared = d;
+					bestId = id;
+				}
+			}
+
+			return;
+		}
+
+		// visit the closer child first to shrink the search radius early
+		float dLeft = nodes[node.left].squareDistanceTo(pos);
+		float dRight = nodes[node.right].squareDistanceTo(pos);
+
+		int first = (dLeft <= dRight) ? node.left : node.right;
+		int second = (dLeft <= dRight) ? node.right : node.left;
+		float dSecond = (dLeft <= dRight) ? dRight : dLeft;
+
+		if (std::min(dLeft, dRight) <= bestDistanceSquared) nearestNode(first, pos, bestId, bestDistanceSquared);
+		if (dSecond <= bestDistanceSquared) nearestNode(second, pos, bestId, bestDistanceSquared);
+	}
+
+	ZSPACE_INLINE void zKdTree::radiusNode(int nodeId, zPoint &pos, float radiusSquared, zIntArray &outIndices)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.squareDistanceTo(pos) > radiusSquared) return;
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				if (pos.squareDistanceTo(positions[indices[i]]) <= radiusSquared) outIndices.push_back(indices[i]);
+			}
+
+			return;
+		}
+
+		radiusNode(node.left, pos, radiusSquared, outIndices);
+		radiusNode(node.right, pos, radiusSquared, outIndices);
+	}
+
+	ZSPACE_INLINE void zKdTree::kNearestNode(int nodeId, zPoint &pos, int k, vector<pair<float, int>> &heap)
+	{
+		zKdNode &node = nodes[nodeId];
+
+		if (node.left == -1)
+		{
+			for (int i = node.start; i < node.end; i++)
+			{
+				pair<float, int> candidate(pos.squareDistanceTo(positions[indices[i]]), indices[i]);
+
+				// the heap top is the farthest of the nearest positions, ties are resolved to the lowest index
+				if (heap.size() < k)
+				{
+					heap.push_back(candidate);
+					push_heap(heap.begin(), heap.end());
+				}
+				else if (candidate < heap.front())
+				{
+					pop_heap(heap.begin(), heap.end());
+					heap.back() = candidate;
+					push_heap(heap.begin(), heap.end());
+				}
+			}
+
+			return;
+		}
+
+		float dLeft = nodes[node.left].squareDistanceTo(pos);
+		float dRight = nodes[node.right].squareDistanceTo(pos);
+
+		int first = (dLeft <= dRight) ? node.left : node.right;
+		int second = (dLeft <= dRight) ? node.right : node.left;
+		float dSecond = (dLeft <= dRight) ? dRight : dLeft;
+
+		if (heap.size() < k || std::min(dLeft, dRight) <= heap.front().first) kNearestNode(first, pos, k, heap);
+		if (heap.size() < k || dSecond <= heap.front().first) kNearestNode(second, pos, k, heap);
+	}
+
+}
@@ -0,0 +1,390 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsBinary.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace zSpace
+{
+	// zBIN files are little-endian and are written and read without byte swapping
+	static const uint32_t zBinaryVersion = 1;
+	static const uint64_t zBinaryAlignment = 16;
+
+	static bool binaryHostLittleEndian()
+	{
+		const uint32_t test = 1;
+		unsigned char first;
+		memcpy(&first, &test, 1);
+		return first == 1;
+	}
+
+	//---- zUtilsBinaryWriter
+
+	//----  CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryWriter::zUtilsBinaryWriter() {}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryWriter::~zUtilsBinaryWriter() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, const void *data, uint32_t elementSize, uint64_t count)
+	{
+		if (count == 0) return;
+		if (elementSize == 0) throw std::invalid_argument(" error: zBIN block element size is 0.");
+
+		zUtilsBinaryBlock block;
+		block.blockType = blockType;
+		block.elementSize = elementSize;
+		block.count = count;
+		block.offset = 0;
+
+		blocks.push_back(block);
+
+		const char *bytes = static_cast<const char*>(data);
+		blockData.push_back(vector<char>(bytes, bytes + elementSize * count));
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, zIntArray &data, int stride)
+	{
+		vector<int32_t> values(data.begin(), data.end());
+		addBlock(blockType, values.data(), sizeof(int32_t) * stride, values.size() / stride);
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, zDoubleArray &data)
+	{
+		addBlock(blockType, data.data(), sizeof(double), data.size());
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, zFloatArray &data)
+	{
+		addBlock(blockType, data.data(), sizeof(float), data.size());
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, zPointArray &data)
+	{
+		vector<float> values(data.size() * 3);
+		for (int i = 0; i < data.size(); i++)
+		{
+			values[i * 3 + 0] = data[i].x;
+			values[i * 3 + 1] = data[i].y;
+			values[i * 3 + 2] = data[i].z;
+		}
+
+		addBlock(blockType, values.data(), sizeof(float) * 3, data.size());
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(zBinaryBlockType blockType, zColorArray &data)
+	{
+		vector<float> values(data.size() * 4);
+		for (int i = 0; i < data.size(); i++)
+		{
+			values[i * 4 + 0] = data[i].r;
+			values[i * 4 + 1] = data[i].g;
+			values[i * 4 + 2] = data[i].b;
+			values[i * 4 + 3] = data[i].a;
+		}
+
+		addBlock(blockType, values.data(), sizeof(float) * 4, data.size());
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryWriter::write(string outfilename, int objectType)
+	{
+		if (!binaryHostLittleEndian()) throw std::invalid_argument(" error: zBIN files can only be written on little-endian hosts.");
+
+		zUtilsBinaryHeader header;
+		memcpy(header.magic, "ZBIN", 4);
+		header.version = zBinaryVersion;
+		header.objectType = (uint32_t) objectType;
+		header.numBlocks = (uint32_t) blocks.size();
+		header.reserved[0] = header.reserved[1] = 0;
+
+		// block offsets
+		uint64_t offset = sizeof(zUtilsBinaryHeader) + blocks.size() * sizeof(zUtilsBinaryBlock);
+		for (auto &b : blocks)
+		{
+			offset = (offset + zBinaryAlignment - 1) / zBinaryAlignment * zBinaryAlignment;
+			b.offset = offset;
+
+			if (b.elementSize == 0 || b.count > (UINT64_MAX - offset) / b.elementSize) throw std::invalid_argument(" error: zBIN block size overflow in " + outfilename);
+			offset += b.elementSize * b.count;
+		}
+
+		ofstream myfile;
+		myfile.open(outfilename.c_str(), ios::out | ios::binary);
+
+		if (myfile.fail())
+		{
+			cout << " error in opening file  " << outfilename.c_str() << endl;
+			return false;
+		}
+
+		myfile.write(reinterpret_cast<const char*>(&header), sizeof(zUtilsBinaryHeader));
+		if (blocks.size() > 0) myfile.write(reinterpret_cast<const char*>(blocks.data()), blocks.size() * sizeof(zUtilsBinaryBlock));
+
+		uint64_t position = sizeof(zUtilsBinaryHeader) + blocks.size() * sizeof(zUtilsBinaryBlock);
+		const char padding[zBinaryAlignment] = {};
+
+		for (int i = 0; i < blocks.size(); i++)
+		{
+			myfile.write(padding, blocks[i].offset - position);
+			myfile.write(blockData[i].data(), blockData[i].size());
+
+			position = blocks[i].offset + blockData[i].size();
+		}
+
+		myfile.close();
+
+		cout << endl << " BIN exported. File:   " << outfilename.c_str() << endl;
+
+		return true;
+	}
+
+	//---- zUtilsBinaryReader
+
+	//----  CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryReader::zUtilsBinaryReader()
+	{
+		mappedData = nullptr;
+		mappedSize = 0;
+
+#ifdef _WIN32
+		fileHandle = nullptr;
+		mappingHandle = nullptr;
+#else
+		fileDescriptor = -1;
+#endif
+
+		objectType = -1;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryReader::~zUtilsBinaryReader()
+	{
+		close();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::open(string infilename)
+	{
+		close();
+
+		if (!binaryHostLittleEndian()) throw std::invalid_argument(" error: zBIN files can only be read on little-endian hosts.");
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA(infilename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		GetFileSizeEx(file, &fileSize);
+		mappedSize = (size_t)fileSize.QuadPart;
+
+		HANDLE mapping = (mappedSize > 0) ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+		fileHandle = file;
+		mappingHandle = mapping;
+
+		if (mapping != NULL) mappedData = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		fileDescriptor = ::open(infilename.c_str(), O_RDONLY);
+		if (fileDescriptor < 0)
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		struct stat fileStat;
+		fstat(fileDescriptor, &fileStat);
+		mappedSize = (size_t)fileStat.st_size;
+
+		if (mappedSize > 0)
+		{
+			void *mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mapped != MAP_FAILED)
+			{
+				madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+				mappedData = static_cast<const char*>(mapped);
+			}
+		}
+#endif
+
+		if (mappedData == nullptr || mappedSize < sizeof(zUtilsBinaryHeader))
+		{
+			cout << " error in mapping file  " << infilename.c_str() << endl;
+			close();
+			return false;
+		}
+
+		// header
+		zUtilsBinaryHeader header;
+		memcpy(&header, mappedData, sizeof(zUtilsBinaryHeader));
+
+		if (memcmp(header.magic, "ZBIN", 4) != 0)
+		{
+			close();
+			throw std::invalid_argument(" error: " + infilename + " is not a zBIN file.");
+		}
+
+		if (header.version > zBinaryVersion)
+		{
+			close();
+			throw std::invalid_argument(" error: unsupported zBIN version in " + infilename);
+		}
+
+		// block table
+		uint64_t tableEnd = sizeof(zUtilsBinaryHeader) + (uint64_t)header.numBlocks * sizeof(zUtilsBinaryBlock);
+		if (tableEnd > mappedSize)
+		{
+			close();
+			throw std::invalid_argument(" error: truncated zBIN file " + infilename);
+		}
+
+		blocks.assign(header.numBlocks, zUtilsBinaryBlock());
+		if (header.numBlocks > 0) memcpy(blocks.data(), mappedData + sizeof(zUtilsBinaryHeader), header.numBlocks * sizeof(zUtilsBinaryBlock));
+
+		for (auto &b : blocks)
+		{
+			// division instead of elementSize * count, which a corrupt count can wrap
+			if (b.elementSize == 0 || b.offset > mappedSize || b.count > (mappedSize - b.offset) / b.elementSize)
+			{
+				close();
+				throw std::invalid_argument(" error: truncated zBIN file " + infilename);
+			}
+		}
+
+		objectType = (int)header.objectType;
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryReader::close()
+	{
+#ifdef _WIN32
+		if (mappedData != nullptr) UnmapViewOfFile(mappedData);
+		if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+		if (fileHandle != nullptr) CloseHandle(fileHandle);
+
+		fileHandle = nullptr;
+		mappingHandle = nullptr;
+#else
+		if (mappedData != nullptr) munmap(const_cast<char*>(mappedData), mappedSize);
+		if (fileDescriptor >= 0) ::close(fileDescriptor);
+
+		fileDescriptor = -1;
+#endif
+
+		mappedData = nullptr;
+		mappedSize = 0;
+		objectType = -1;
+		blocks.clear();
+	}
+
+	ZSPACE_INLINE int zUtilsBinaryReader::getObjectType()
+	{
+		return objectType;
+	}
+
+	ZSPACE_INLINE const void* zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, uint32_t elementSize, uint64_t &count)
+	{
+		count = 0;
+
+		for (auto &b : blocks)
+		{
+			if (b.blockType != blockType) continue;
+
+			if (b.elementSize != elementSize) throw std::invalid_argument(" error: zBIN block element size mismatch.");
+
+			count = b.count;
+			return mappedData + b.offset;
+		}
+
+		return nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, zIntArray &data, int stride)
+	{
+		uint64_t count;
+		const int32_t *values = static_cast<const int32_t*>(getBlock(blockType, sizeof(int32_t) * stride, count));
+
+		data.assign(values, values + count * stride);
+		return values != nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, zDoubleArray &data)
+	{
+		uint64_t count;
+		const double *values = static_cast<const double*>(getBlock(blockType, sizeof(double), count));
+
+		data.assign(values, values + count);
+		return values != nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, zFloatArray &data)
+	{
+		uint64_t count;
+		const float *values = static_cast<const float*>(getBlock(blockType, sizeof(float), count));
+
+		data.assign(values, values + count);
+		return values != nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, zPointArray &data)
+	{
+		uint64_t count;
+		const float *values = static_cast<const float*>(getBlock(blockType, sizeof(float) * 3, count));
+
+		data.resize(count);
+		for (uint64_t i = 0; i < count; i++)
+		{
+			data[i].x = values[i * 3 + 0];
+			data[i].y = values[i * 3 + 1];
+			data[i].z = values[i * 3 + 2];
+		}
+
+		return values != nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::getBlock(zBinaryBlockType blockType, zColorArray &data)
+	{
+		uint64_t count;
+		const float *values = static_cast<const float*>(getBlock(blockType, sizeof(float) * 4, count));
+
+		data.clear();
+		data.reserve(count);
+		for (uint64_t i = 0; i < count; i++) data.push_back(zColor(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]));
+
+		return values != nullptr;
+	}
+
+}
@@ -275,6 +275,26 @@ namespace zSpace
 		positionVertex[hashKey] = index;
 	}
 
+	ZSPACE_INLINE bool zUtilsCore::vertexExists(zPositionHashMap& positionVertex, zVector & pos, int precisionFac, int & outVertexId)
+	{
+		int id;
+		bool out = positionVertex.find(zPositionKey(pos, precisionFac), id);
+
+		if (out) outVertexId = id;
+
+		return out;
+	}
+
+	ZSPACE_INLINE void zUtilsCore::addToPositionMap(zPositionHashMap& positionVertex, zVector &pos, int index, int precisionFac)
+	{
+		positionVertex.insert(zPositionKey(pos, precisionFac), index);
+	}
+
+	ZSPACE_INLINE unsigned long long zUtilsCore::packIntPair(int v1, int v2)
+	{
+		return ((unsigned long long)(unsigned int)v1 << 32) | (unsigned long long)(unsigned int)v2;
+	}
+
 	//---- VECTOR METHODS 
 	
 	ZSPACE_INLINE zVector zUtilsCore::zMin(vector<zVector> &vals)
@@ -384,16 +404,18 @@ namespace zSpace
 		center = out;
 	}
 
-	ZSPACE_INLINE int zUtilsCore::getClosest_PointCloud(zVector &pos, vector<zVector> inPositions)
+	ZSPACE_INLINE int zUtilsCore::getClosest_PointCloud(zVector &pos, vector<zVector> &inPositions)
 	{
 		int out = -1;
 		double dist = 1000000000;
 
 		for (int i = 0; i < inPositions.size(); i++)
 		{
-			if (inPositions[i].squareDistanceTo(pos) < dist)
+			double d = inPositions[i].squareDistanceTo(pos);
+
+			if (d < dist)
 			{
-				dist = inPositions[i].squareDistanceTo(pos);
+				dist = d;
 				out = i;
 			}
 		}
@@ -868,6 +890,77 @@ namespace zSpace
 		return closest_Pt.distanceTo(pt);
 	}
 
+	ZSPACE_INLINE double zUtilsCore::minDist_Triangle_Point(zVector & pt, zVector & t0, zVector & t1, zVector & t2, zVector & closest_Pt)
+	{
+		zVector ab = t1 - t0;
+		zVector ac = t2 - t0;
+
+		// vertex region of t0
+		zVector ap = pt - t0;
+		double d1 = ab * ap;
+		double d2 = ac * ap;
+		if (d1 <= 0 && d2 <= 0)
+		{
+			closest_Pt = t0;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// vertex region of t1
+		zVector bp = pt - t1;
+		double d3 = ab * bp;
+		double d4 = ac * bp;
+		if (d3 >= 0 && d4 <= d3)
+		{
+			closest_Pt = t1;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// edge region of t0-t1
+		double vc = d1 * d4 - d3 * d2;
+		if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{
+			double v = d1 / (d1 - d3);
+			closest_Pt = t0 + ab * v;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// vertex region of t2
+		zVector cp = pt - t2;
+		double d5 = ab * cp;
+		double d6 = ac * cp;
+		if (d6 >= 0 && d5 <= d6)
+		{
+			closest_Pt = t2;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// edge region of t0-t2
+		double vb = d5 * d2 - d1 * d6;
+		if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{
+			double w = d2 / (d2 - d6);
+			closest_Pt = t0 + ac * w;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// edge region of t1-t2
+		double va = d3 * d6 - d5 * d4;
+		if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+		{
+			double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			closest_Pt = t1 + (t2 - t1) * w;
+			return closest_Pt.distanceTo(pt);
+		}
+
+		// face region
+		double denom = 1.0 / (va + vb + vc);
+		double v = vb * denom;
+		double w = vc * denom;
+
+		closest_Pt = t0 + ab * v + ac * w;
+		return closest_Pt.distanceTo(pt);
+	}
+
 	ZSPACE_INLINE double zUtilsCore::minDist_Point_Plane(zVector & pA, zVector & pB, zVector & norm)
 	{
 		norm.normalize();
@@ -0,0 +1,788 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zCore/utilities/zUtilsRaster.h>
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef ZSPACE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace zSpace
+{
+	//---- RASTER DATA
+
+	/*!	\brief tile size of the rasteriser in pixels.  */
+	static const int zRasterTileSize = 64;
+
+	/*!	\brief clip space position and color of a vertex.  */
+	struct zRasterVertex
+	{
+		float x, y, z, w;
+		float r, g, b, a;
+	};
+
+	/*!	\brief screen space position of a vertex, with the color divided by w for perspective correct interpolation.  */
+	struct zRasterScreenVertex
+	{
+		float x, y, z, invW;
+		float r, g, b, a;
+	};
+
+	/*!	\brief set up triangle with its edge functions E = A * x + B * y + C, and its inclusive pixel bounds.  */
+	struct zRasterTriangle
+	{
+		zRasterScreenVertex v[3];
+		float A[3], B[3], C[3];
+		bool topLeft[3];
+		float invArea;
+		int minX, minY, maxX, maxY;
+	};
+
+	/*!	\brief set up line and its inclusive pixel bounds.  */
+	struct zRasterLine
+	{
+		zRasterScreenVertex v[2];
+		int minX, minY, maxX, maxY;
+	};
+
+	/*!	\brief set up point and its inclusive pixel bounds.  */
+	struct zRasterPoint
+	{
+		zRasterScreenVertex v;
+		int minX, minY, maxX, maxY;
+	};
+
+	//---- RASTER HELPERS
+
+	static inline void zRasterTransform(zTransform &viewProjection, const float *positions, int positionStride, const float *colors, int numColors, int numVertices, zColor &drawColor, vector<zRasterVertex> &out)
+	{
+		out.resize(numVertices);
+
+		zThreadPool::getGlobal().parallel_for(0, numVertices, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				const float *p = positions + (size_t)i * positionStride;
+				zRasterVertex &v = out[i];
+
+				v.x = viewProjection(0, 0) * p[0] + viewProjection(0, 1) * p[1] + viewProjection(0, 2) * p[2] + viewProjection(0, 3);
+				v.y = viewProjection(1, 0) * p[0] + viewProjection(1, 1) * p[1] + viewProjection(1, 2) * p[2] + viewProjection(1, 3);
+				v.z = viewProjection(2, 0) * p[0] + viewProjection(2, 1) * p[1] + viewProjection(2, 2) * p[2] + viewProjection(2, 3);
+				v.w = viewProjection(3, 0) * p[0] + viewProjection(3, 1) * p[1] + viewProjection(3, 2) * p[2] + viewProjection(3, 3);
+
+				if (colors && i < numColors)
+				{
+					const float *c = colors + (size_t)i * vertexColorStride;
+					v.r = c[0]; v.g = c[1]; v.b = c[2]; v.a = c[3];
+				}
+				else
+				{
+					v.r = drawColor.r; v.g = drawColor.g; v.b = drawColor.b; v.a = drawColor.a;
+				}
+			}
+		}, 4096);
+	}
+
+	// signed distance to the near clipping plane, z >= -w
+	static inline float zRasterNearDistance(const zRasterVertex &v)
+	{
+		return v.z + v.w;
+	}
+
+	static inline zRasterVertex zRasterLerp(const zRasterVertex &v0, const zRasterVertex &v1, float t)
+	{
+		zRasterVertex out;
+		out.x = v0.x + t * (v1.x - v0.x);
+		out.y = v0.y + t * (v1.y - v0.y);
+		out.z = v0.z + t * (v1.z - v0.z);
+		out.w = v0.w + t * (v1.w - v0.w);
+		out.r = v0.r + t * (v1.r - v0.r);
+		out.g = v0.g + t * (v1.g - v0.g);
+		out.b = v0.b + t * (v1.b - v0.b);
+		out.a = v0.a + t * (v1.a - v0.a);
+		return out;
+	}
+
+	static inline zRasterScreenVertex zRasterToScreen(const zRasterVertex &v, int width, int height)
+	{
+		zRasterScreenVertex out;
+		out.invW = 1.0f / v.w;
+		out.x = (v.x * out.invW * 0.5f + 0.5f) * width;
+		out.y = (0.5f - v.y * out.invW * 0.5f) * height;
+		out.z = v.z * out.invW * 0.5f + 0.5f;
+		out.r = v.r * out.invW;
+		out.g = v.g * out.invW;
+		out.b = v.b * out.invW;
+		out.a = v.a * out.invW;
+		return out;
+	}
+
+	static inline bool zRasterBounds(float minX, float minY, float maxX, float maxY, int width, int height, int &outMinX, int &outMinY, int &outMaxX, int &outMaxY)
+	{
+		// negated comparisons also reject NaN
+		if (!(maxX >= 0 && maxY >= 0 && minX < width && minY < height)) return false;
+
+		outMinX = (int)floor(std::max(minX, 0.0f));
+		outMinY = (int)floor(std::max(minY, 0.0f));
+		outMaxX = (int)std::min(ceil(maxX), (float)(width - 1));
+		outMaxY = (int)std::min(ceil(maxY), (float)(height - 1));
+
+		return outMinX <= outMaxX && outMinY <= outMaxY;
+	}
+
+	static inline void zRasterWritePixel(unsigned char *color, float r, float g, float b, float a)
+	{
+		color[0] = (unsigned char)(std::min(std::max(r, 0.0f), 1.0f) * 255.0f + 0.5f);
+		color[1] = (unsigned char)(std::min(std::max(g, 0.0f), 1.0f) * 255.0f + 0.5f);
+		color[2] = (unsigned char)(std::min(std::max(b, 0.0f), 1.0f) * 255.0f + 0.5f);
+		color[3] = (unsigned char)(std::min(std::max(a, 0.0f), 1.0f) * 255.0f + 0.5f);
+	}
+
+	// bins the primitives to screen tiles and calls the kernel for each primitive of a tile, in primitive order, with the tile rectangle clipped to the primitive bounds
+	template<typename T, typename K>
+	static inline void zRasterTiles(vector<T> &primitives, int width, int height, K kernel)
+	{
+		int numTilesX = (width + zRasterTileSize - 1) / zRasterTileSize;
+		int numTilesY = (height + zRasterTileSize - 1) / zRasterTileSize;
+
+		vector<zIntArray> tiles(numTilesX * numTilesY);
+
+		for (int i = 0; i < primitives.size(); i++)
+		{
+			T &p = primitives[i];
+			if (p.minX > p.maxX) continue;
+
+			for (int ty = p.minY / zRasterTileSize; ty <= p.maxY / zRasterTileSize; ty++)
+			{
+				for (int tx = p.minX / zRasterTileSize; tx <= p.maxX / zRasterTileSize; tx++)
+				{
+					tiles[ty * numTilesX + tx].push_back(i);
+				}
+			}
+		}
+
+		zThreadPool::getGlobal().parallel_for(0, (int)tiles.size(), [&](int start, int end)
+		{
+			for (int t = start; t < end; t++)
+			{
+				int tileMinX = (t % numTilesX) * zRasterTileSize;
+				int tileMinY = (t / numTilesX) * zRasterTileSize;
+				int tileMaxX = std::min(tileMinX + zRasterTileSize, width) - 1;
+				int tileMaxY = std::min(tileMinY + zRasterTileSize, height) - 1;
+
+				for (int i : tiles[t])
+				{
+					T &p = primitives[i];
+					kernel(p, std::max(tileMinX, p.minX), std::max(tileMinY, p.minY), std::min(tileMaxX, p.maxX), std::min(tileMaxY, p.maxY));
+				}
+			}
+		}, 1);
+	}
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsRaster::zUtilsRaster()
+	{
+		width = height = 0;
+
+		viewMatrix.setIdentity();
+		projectionMatrix.setIdentity();
+
+		pointSize = 1;
+		lineWidth = 1;
+	}
+
+	ZSPACE_INLINE zUtilsRaster::zUtilsRaster(int _width, int _height)
+	{
+		viewMatrix.setIdentity();
+		projectionMatrix.setIdentity();
+
+		pointSize = 1;
+		lineWidth = 1;
+
+		setSize(_width, _height);
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsRaster::~zUtilsRaster() {}
+
+	//---- SET METHODS
+
+	ZSPACE_INLINE void zUtilsRaster::setSize(int _width, int _height)
+	{
+		if (_width <= 0 || _height <= 0) throw std::invalid_argument(" error: framebuffer size must be positive.");
+
+		width = _width;
+		height = _height;
+
+		colorBuffer.assign((size_t)width * height * 4, 0);
+		depthBuffer.assign((size_t)width * height, 1.0f);
+
+		for (size_t i = 3; i < colorBuffer.size(); i += 4) colorBuffer[i] = 255;
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setCamera(zPoint &eye, zPoint &target, zVector &up)
+	{
+		zVector f = target - eye;
+		f.normalize();
+
+		zVector s = f ^ up;
+		s.normalize();
+
+		zVector u = s ^ f;
+
+		viewMatrix.setIdentity();
+
+		viewMatrix(0, 0) = s.x; viewMatrix(0, 1) = s.y; viewMatrix(0, 2) = s.z;
+		viewMatrix(1, 0) = u.x; viewMatrix(1, 1) = u.y; viewMatrix(1, 2) = u.z;
+		viewMatrix(2, 0) = -f.x; viewMatrix(2, 1) = -f.y; viewMatrix(2, 2) = -f.z;
+
+		viewMatrix(0, 3) = -(s.x * eye.x + s.y * eye.y + s.z * eye.z);
+		viewMatrix(1, 3) = -(u.x * eye.x + u.y * eye.y + u.z * eye.z);
+		viewMatrix(2, 3) = (f.x * eye.x + f.y * eye.y + f.z * eye.z);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setPerspective(float fovY, float zNear, float zFar)
+	{
+		if (width <= 0 || height <= 0) throw std::invalid_argument(" error: framebuffer size not set.");
+
+		float aspect = (float)width / (float)height;
+		float f = 1.0f / tan(fovY * 0.5f * DEG_TO_RAD);
+
+		projectionMatrix.setZero();
+
+		projectionMatrix(0, 0) = f / aspect;
+		projectionMatrix(1, 1) = f;
+		projectionMatrix(2, 2) = (zFar + zNear) / (zNear - zFar);
+		projectionMatrix(2, 3) = (2.0f * zFar * zNear) / (zNear - zFar);
+		projectionMatrix(3, 2) = -1.0f;
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setOrthographic(float halfHeight, float zNear, float zFar)
+	{
+		if (width <= 0 || height <= 0) throw std::invalid_argument(" error: framebuffer size not set.");
+
+		float aspect = (float)width / (float)height;
+
+		projectionMatrix.setIdentity();
+
+		projectionMatrix(0, 0) = 1.0f / (halfHeight * aspect);
+		projectionMatrix(1, 1) = 1.0f / halfHeight;
+		projectionMatrix(2, 2) = -2.0f / (zFar - zNear);
+		projectionMatrix(2, 3) = -(zFar + zNear) / (zFar - zNear);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setDrawColor(zColor &_drawColor)
+	{
+		drawColor = _drawColor;
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setPointSize(int _pointSize)
+	{
+		pointSize = std::max(_pointSize, 1);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::setLineWidth(int _lineWidth)
+	{
+		lineWidth = std::max(_lineWidth, 1);
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zUtilsRaster::getWidth()
+	{
+		return width;
+	}
+
+	ZSPACE_INLINE int zUtilsRaster::getHeight()
+	{
+		return height;
+	}
+
+	ZSPACE_INLINE vector<unsigned char>& zUtilsRaster::getColorBuffer()
+	{
+		return colorBuffer;
+	}
+
+	ZSPACE_INLINE zFloatArray& zUtilsRaster::getDepthBuffer()
+	{
+		return depthBuffer;
+	}
+
+	//---- DRAW METHODS
+
+	ZSPACE_INLINE void zUtilsRaster::clear(zColor &backgroundColor)
+	{
+		unsigned char col[4];
+		zRasterWritePixel(col, backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a);
+
+		for (size_t i = 0; i < colorBuffer.size(); i += 4)
+		{
+			colorBuffer[i + 0] = col[0];
+			colorBuffer[i + 1] = col[1];
+			colorBuffer[i + 2] = col[2];
+			colorBuffer[i + 3] = col[3];
+		}
+
+		std::fill(depthBuffer.begin(), depthBuffer.end(), 1.0f);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawPoints(zPointArray &positions, zColorArray &colors)
+	{
+		if (positions.size() == 0) return;
+
+		zFloatArray _positions, _colors;
+		for (auto &p : positions) { _positions.push_back(p.x); _positions.push_back(p.y); _positions.push_back(p.z); }
+		for (auto &c : colors) { _colors.push_back(c.r); _colors.push_back(c.g); _colors.push_back(c.b); _colors.push_back(c.a); }
+
+		rasterPoints(&_positions[0], 3, (colors.size() > 0) ? &_colors[0] : nullptr, colors.size(), positions.size());
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawLines(zPointArray &positions, zColorArray &colors, zIntArray &edgeIndices)
+	{
+		if (positions.size() == 0 || edgeIndices.size() == 0) return;
+
+		zFloatArray _positions, _colors;
+		for (auto &p : positions) { _positions.push_back(p.x); _positions.push_back(p.y); _positions.push_back(p.z); }
+		for (auto &c : colors) { _colors.push_back(c.r); _colors.push_back(c.g); _colors.push_back(c.b); _colors.push_back(c.a); }
+
+		rasterLines(&_positions[0], 3, (colors.size() > 0) ? &_colors[0] : nullptr, colors.size(), positions.size(), &edgeIndices[0], edgeIndices.size());
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawTriangles(zPointArray &positions, zColorArray &colors, zIntArray &triIndices)
+	{
+		if (positions.size() == 0 || triIndices.size() == 0) return;
+
+		zFloatArray _positions, _colors;
+		for (auto &p : positions) { _positions.push_back(p.x); _positions.push_back(p.y); _positions.push_back(p.z); }
+		for (auto &c : colors) { _colors.push_back(c.r); _colors.push_back(c.g); _colors.push_back(c.b); _colors.push_back(c.a); }
+
+		rasterPolygons(&_positions[0], 3, (colors.size() > 0) ? &_colors[0] : nullptr, colors.size(), positions.size(), &triIndices[0], triIndices.size(), 3);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawQuads(zPointArray &positions, zColorArray &colors, zIntArray &quadIndices)
+	{
+		if (positions.size() == 0 || quadIndices.size() == 0) return;
+
+		zFloatArray _positions, _colors;
+		for (auto &p : positions) { _positions.push_back(p.x); _positions.push_back(p.y); _positions.push_back(p.z); }
+		for (auto &c : colors) { _colors.push_back(c.r); _colors.push_back(c.g); _colors.push_back(c.b); _colors.push_back(c.a); }
+
+		rasterPolygons(&_positions[0], 3, (colors.size() > 0) ? &_colors[0] : nullptr, colors.size(), positions.size(), &quadIndices[0], quadIndices.size(), 4);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawPointsFromBuffer(zObjBuffer &bufferObj, bool colors)
+	{
+		if (!bufferObj.headless) throw std::invalid_argument(" error: buffer is not headless.");
+		if (bufferObj.nVertices == 0) return;
+
+		rasterPoints(&bufferObj.hostVertices[0], vertexAttribStride, (colors && bufferObj.nColors > 0) ? &bufferObj.hostColors[0] : nullptr, bufferObj.nColors, bufferObj.nVertices);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawLinesFromBuffer(zObjBuffer &bufferObj, bool colors)
+	{
+		if (!bufferObj.headless) throw std::invalid_argument(" error: buffer is not headless.");
+		if (bufferObj.nVertices == 0 || bufferObj.nEdges == 0) return;
+
+		rasterLines(&bufferObj.hostVertices[0], vertexAttribStride, (colors && bufferObj.nColors > 0) ? &bufferObj.hostColors[0] : nullptr, bufferObj.nColors, bufferObj.nVertices, &bufferObj.hostEdgeIndices[0], bufferObj.nEdges);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawTrianglesFromBuffer(zObjBuffer &bufferObj, bool colors)
+	{
+		if (!bufferObj.headless) throw std::invalid_argument(" error: buffer is not headless.");
+		if (bufferObj.nVertices == 0 || bufferObj.nFaces == 0) return;
+
+		rasterPolygons(&bufferObj.hostVertices[0], vertexAttribStride, (colors && bufferObj.nColors > 0) ? &bufferObj.hostColors[0] : nullptr, bufferObj.nColors, bufferObj.nVertices, &bufferObj.hostFaceIndices[0], bufferObj.nFaces, 3);
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::drawQuadsFromBuffer(zObjBuffer &bufferObj, bool colors)
+	{
+		if (!bufferObj.headless) throw std::invalid_argument(" error: buffer is not headless.");
+		if (bufferObj.nVertices == 0 || bufferObj.nFaces == 0) return;
+
+		rasterPolygons(&bufferObj.hostVertices[0], vertexAttribStride, (colors && bufferObj.nColors > 0) ? &bufferObj.hostColors[0] : nullptr, bufferObj.nColors, bufferObj.nVertices, &bufferObj.hostFaceIndices[0], bufferObj.nFaces, 4);
+	}
+
+	//---- EXPORT METHODS
+
+	ZSPACE_INLINE bool zUtilsRaster::toPNG(string outfilename)
+	{
+		if (width <= 0 || height <= 0) return false;
+
+		unsigned error = lodepng::encode(outfilename, colorBuffer, width, height);
+
+		if (error)
+		{
+			std::cout << "encoder error " << error << ": " << lodepng_error_text(error) << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	//---- PRIVATE METHODS
+
+	ZSPACE_INLINE void zUtilsRaster::rasterPoints(const float *positions, int positionStride, const float *colors, int numColors, int numVertices)
+	{
+		if (width <= 0 || height <= 0) throw std::invalid_argument(" error: framebuffer size not set.");
+
+		zTransform viewProjection = projectionMatrix * viewMatrix;
+
+		vector<zRasterVertex> clipVertices;
+		zRasterTransform(viewProjection, positions, positionStride, colors, numColors, numVertices, drawColor, clipVertices);
+
+		// set up points
+		vector<zRasterPoint> points(numVertices);
+
+		zThreadPool::getGlobal().parallel_for(0, numVertices, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				zRasterPoint &p = points[i];
+				p.minX = 1; p.maxX = 0;
+
+				if (zRasterNearDistance(clipVertices[i]) < 0 || clipVertices[i].w <= 0) continue;
+
+				p.v = zRasterToScreen(clipVertices[i], width, height);
+
+				float minX = floor(p.v.x - pointSize * 0.5f + 0.5f);
+				float minY = floor(p.v.y - pointSize * 0.5f + 0.5f);
+
+				if (!zRasterBounds(minX, minY, minX + pointSize - 1, minY + pointSize - 1, width, height, p.minX, p.minY, p.maxX, p.maxY)) p.minX = 1, p.maxX = 0;
+			}
+		}, 4096);
+
+		zRasterTiles(points, width, height, [&](zRasterPoint &p, int x0, int y0, int x1, int y1)
+		{
+			float w = 1.0f / p.v.invW;
+
+			for (int y = y0; y <= y1; y++)
+			{
+				for (int x = x0; x <= x1; x++)
+				{
+					size_t id = (size_t)y * width + x;
+
+					if (p.v.z >= 0 && p.v.z <= depthBuffer[id])
+					{
+						depthBuffer[id] = p.v.z;
+						zRasterWritePixel(&colorBuffer[id * 4], p.v.r * w, p.v.g * w, p.v.b * w, p.v.a * w);
+					}
+				}
+			}
+		});
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::rasterLines(const float *positions, int positionStride, const float *colors, int numColors, int numVertices, const int *indices, int numIndices)
+	{
+		if (width <= 0 || height <= 0) throw std::invalid_argument(" error: framebuffer size not set.");
+
+		zTransform viewProjection = projectionMatrix * viewMatrix;
+
+		vector<zRasterVertex> clipVertices;
+		zRasterTransform(viewProjection, positions, positionStride, colors, numColors, numVertices, drawColor, clipVertices);
+
+		// set up lines, clipped to the near plane
+		int numLines = numIndices / 2;
+		vector<zRasterLine> lines(numLines);
+
+		float halfWidth = lineWidth * 0.5f;
+
+		zThreadPool::getGlobal().parallel_for(0, numLines, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				zRasterLine &l = lines[i];
+				l.minX = 1; l.maxX = 0;
+
+				int i0 = indices[i * 2 + 0];
+				int i1 = indices[i * 2 + 1];
+				if (i0 < 0 || i0 >= numVertices || i1 < 0 || i1 >= numVertices) continue;
+
+				zRasterVertex v0 = clipVertices[i0];
+				zRasterVertex v1 = clipVertices[i1];
+
+				float d0 = zRasterNearDistance(v0);
+				float d1 = zRasterNearDistance(v1);
+
+				if (d0 < 0 && d1 < 0) continue;
+				if (d0 < 0) v0 = zRasterLerp(v0, v1, d0 / (d0 - d1));
+				else if (d1 < 0) v1 = zRasterLerp(v0, v1, d0 / (d0 - d1));
+
+				if (v0.w <= 0 || v1.w <= 0) continue;
+
+				l.v[0] = zRasterToScreen(v0, width, height);
+				l.v[1] = zRasterToScreen(v1, width, height);
+
+				zRasterBounds(std::min(l.v[0].x, l.v[1].x) - halfWidth, std::min(l.v[0].y, l.v[1].y) - halfWidth, std::max(l.v[0].x, l.v[1].x) + halfWidth, std::max(l.v[0].y, l.v[1].y) + halfWidth, width, height, l.minX, l.minY, l.maxX, l.maxY);
+			}
+		}, 4096);
+
+		int widthOffset = (lineWidth - 1) / 2;
+
+		zRasterTiles(lines, width, height, [&](zRasterLine &l, int x0, int y0, int x1, int y1)
+		{
+			zRasterScreenVertex &a = l.v[0];
+			zRasterScreenVertex &b = l.v[1];
+
+			float dx = b.x - a.x;
+			float dy = b.y - a.y;
+
+			bool xMajor = fabs(dx) >= fabs(dy);
+			float dMajor = xMajor ? dx : dy;
+
+			// step along the major axis through the pixel centers of the tile, widening along the minor axis
+			int majorStart = xMajor ? x0 : y0;
+			int majorEnd = xMajor ? x1 : y1;
+
+			for (int m = majorStart; m <= majorEnd; m++)
+			{
+				float t;
+
+				if (dMajor == 0)
+				{
+					// zero length line, drawn as a single pixel
+					if (m != (int)floor(xMajor ? a.x : a.y)) continue;
+					t = 0;
+				}
+				else
+				{
+					t = ((m + 0.5f) - (xMajor ? a.x : a.y)) / dMajor;
+					if (t < 0 || t > 1) continue;
+				}
+
+				float minor = xMajor ? (a.y + t * dy) : (a.x + t * dx);
+				int minorStart = (int)floor(minor) - widthOffset;
+
+				float z = a.z + t * (b.z - a.z);
+				if (z < 0) continue;
+
+				float invW = a.invW + t * (b.invW - a.invW);
+				float w = 1.0f / invW;
+
+				for (int k = 0; k < lineWidth; k++)
+				{
+					int x = xMajor ? m : minorStart + k;
+					int y = xMajor ? minorStart + k : m;
+
+					if (x < x0 || x > x1 || y < y0 || y > y1) continue;
+
+					size_t id = (size_t)y * width + x;
+
+					if (z <= depthBuffer[id])
+					{
+						depthBuffer[id] = z;
+						zRasterWritePixel(&colorBuffer[id * 4], (a.r + t * (b.r - a.r)) * w, (a.g + t * (b.g - a.g)) * w, (a.b + t * (b.b - a.b)) * w, (a.a + t * (b.a - a.a)) * w);
+					}
+				}
+			}
+		});
+	}
+
+	ZSPACE_INLINE void zUtilsRaster::rasterPolygons(const float *positions, int positionStride, const float *colors, int numColors, int numVertices, const int *indices, int numIndices, int polygonSize)
+	{
+		if (width <= 0 || height <= 0) throw std::invalid_argument(" error: framebuffer size not set.");
+
+		zTransform viewProjection = projectionMatrix * viewMatrix;
+
+		vector<zRasterVertex> clipVertices;
+		zRasterTransform(viewProjection, positions, positionStride, colors, numColors, numVertices, drawColor, clipVertices);
+
+		// set up the fan triangles of each polygon, clipped to the near plane. A clipped triangle gives at most 2 triangles.
+		int numPolygons = numIndices / polygonSize;
+		int trisPerPolygon = polygonSize - 2;
+
+		vector<zRasterTriangle> triangles(numPolygons * trisPerPolygon * 2);
+
+		zThreadPool::getGlobal().parallel_for(0, numPolygons * trisPerPolygon, [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				triangles[i * 2 + 0].minX = triangles[i * 2 + 1].minX = 1;
+				triangles[i * 2 + 0].maxX = triangles[i * 2 + 1].maxX = 0;
+
+				int polygon = i / trisPerPolygon;
+				int fan = i % trisPerPolygon;
+
+				int ids[3] = { indices[polygon * polygonSize], indices[polygon * polygonSize + fan + 1], indices[polygon * polygonSize + fan + 2] };
+
+				bool validIds = true;
+				for (int j = 0; j < 3; j++) if (ids[j] < 0 || ids[j] >= numVertices) validIds = false;
+				if (!validIds) continue;
+
+				// clip to the near plane
+				zRasterVertex clipped[4];
+				int numClipped = 0;
+
+				for (int j = 0; j < 3; j++)
+				{
+					zRasterVertex &v0 = clipVertices[ids[j]];
+					zRasterVertex &v1 = clipVertices[ids[(j + 1) % 3]];
+
+					float d0 = zRasterNearDistance(v0);
+					float d1 = zRasterNearDistance(v1);
+
+					if (d0 >= 0) clipped[numClipped++] = v0;
+					if ((d0 >= 0) != (d1 >= 0)) clipped[numClipped++] = zRasterLerp(v0, v1, d0 / (d0 - d1));
+				}
+
+				for (int j = 0; j + 2 < numClipped; j++)
+				{
+					if (clipped[0].w <= 0 || clipped[j + 1].w <= 0 || clipped[j + 2].w <= 0) continue;
+
+					zRasterTriangle &tri = triangles[i * 2 + j];
+
+					tri.v[0] = zRasterToScreen(clipped[0], width, height);
+					tri.v[1] = zRasterToScreen(clipped[j + 1], width, height);
+					tri.v[2] = zRasterToScreen(clipped[j + 2], width, height);
+
+					float area = (tri.v[1].x - tri.v[0].x) * (tri.v[2].y - tri.v[0].y) - (tri.v[1].y - tri.v[0].y) * (tri.v[2].x - tri.v[0].x);
+					if (!(area != 0 && std::isfinite(area))) continue;
+
+					// both windings are drawn, as with OPENGL face culling disabled
+					if (area < 0)
+					{
+						std::swap(tri.v[1], tri.v[2]);
+						area = -area;
+					}
+
+					tri.invArea = 1.0f / area;
+
+					// edge k is opposite to vertex k, so that its edge function is the barycentric weight of vertex k times the area
+					for (int k = 0; k < 3; k++)
+					{
+						zRasterScreenVertex &p = tri.v[(k + 1) % 3];
+						zRasterScreenVertex &q = tri.v[(k + 2) % 3];
+
+						tri.A[k] = p.y - q.y;
+						tri.B[k] = q.x - p.x;
+						tri.C[k] = p.x * q.y - q.x * p.y;
+
+						// top-left fill rule, so that pixels on an edge shared by two triangles are drawn once
+						tri.topLeft[k] = tri.A[k] > 0 || (tri.A[k] == 0 && tri.B[k] > 0);
+					}
+
+					zRasterBounds(std::min(std::min(tri.v[0].x, tri.v[1].x), tri.v[2].x), std::min(std::min(tri.v[0].y, tri.v[1].y), tri.v[2].y),
+						std::max(std::max(tri.v[0].x, tri.v[1].x), tri.v[2].x), std::max(std::max(tri.v[0].y, tri.v[1].y), tri.v[2].y),
+						width, height, tri.minX, tri.minY, tri.maxX, tri.maxY);
+				}
+			}
+		}, 1024);
+
+		zRasterTiles(triangles, width, height, [&](zRasterTriangle &tri, int x0, int y0, int x1, int y1)
+		{
+			float b[3][4];
+			float z[4];
+
+#ifdef ZSPACE_SSE2
+			__m128 A[3], B[3], C[3], topLeft[3];
+			for (int k = 0; k < 3; k++)
+			{
+				A[k] = _mm_set1_ps(tri.A[k]);
+				B[k] = _mm_set1_ps(tri.B[k]);
+				C[k] = _mm_set1_ps(tri.C[k]);
+				topLeft[k] = _mm_castsi128_ps(_mm_set1_epi32(tri.topLeft[k] ? -1 : 0));
+			}
+
+			__m128 zero = _mm_setzero_ps();
+			__m128 invArea = _mm_set1_ps(tri.invArea);
+			__m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+#endif
+
+			for (int y = y0; y <= y1; y++)
+			{
+				float py = y + 0.5f;
+
+				for (int x = x0; x <= x1; x += 4)
+				{
+					int laneMask = (x1 - x >= 3) ? 15 : (1 << (x1 - x + 1)) - 1;
+
+#ifdef ZSPACE_SSE2
+					__m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneOffsets);
+					__m128 pyv = _mm_set1_ps(py);
+
+					__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+					__m128 E[3];
+
+					for (int k = 0; k < 3; k++)
+					{
+						E[k] = _mm_add_ps(_mm_mul_ps(A[k], px), _mm_add_ps(_mm_mul_ps(B[k], pyv), C[k]));
+						inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(E[k], zero), _mm_and_ps(_mm_cmpeq_ps(E[k], zero), topLeft[k])));
+					}
+
+					int mask = _mm_movemask_ps(inside) & laneMask;
+					if (!mask) continue;
+
+					__m128 b0 = _mm_mul_ps(E[0], invArea);
+					__m128 b1 = _mm_mul_ps(E[1], invArea);
+					__m128 b2 = _mm_mul_ps(E[2], invArea);
+
+					__m128 zv = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, _mm_set1_ps(tri.v[0].z)), _mm_mul_ps(b1, _mm_set1_ps(tri.v[1].z))), _mm_mul_ps(b2, _mm_set1_ps(tri.v[2].z)));
+
+					_mm_storeu_ps(b[0], b0);
+					_mm_storeu_ps(b[1], b1);
+					_mm_storeu_ps(b[2], b2);
+					_mm_storeu_ps(z, zv);
+#else
+					int mask = 0;
+
+					for (int lane = 0; lane < 4; lane++)
+					{
+						if (!(laneMask & (1 << lane))) continue;
+
+						float px = x + lane + 0.5f;
+						bool inside = true;
+
+						for (int k = 0; k < 3; k++)
+						{
+							float E = tri.A[k] * px + (tri.B[k] * py + tri.C[k]);
+							inside = inside && (E > 0 || (E == 0 && tri.topLeft[k]));
+							b[k][lane] = E * tri.invArea;
+						}
+
+						if (inside) mask |= 1 << lane;
+						z[lane] = b[0][lane] * tri.v[0].z + b[1][lane] * tri.v[1].z + b[2][lane] * tri.v[2].z;
+					}
+
+					if (!mask) continue;
+#endif
+
+					size_t rowId = (size_t)y * width + x;
+
+					for (int lane = 0; lane < 4; lane++)
+					{
+						if (!(mask & (1 << lane))) continue;
+
+						size_t id = rowId + lane;
+						if (!(z[lane] >= 0 && z[lane] <= depthBuffer[id])) continue;
+
+						depthBuffer[id] = z[lane];
+
+						float b0 = b[0][lane], b1 = b[1][lane], b2 = b[2][lane];
+						float w = 1.0f / (b0 * tri.v[0].invW + b1 * tri.v[1].invW + b2 * tri.v[2].invW);
+
+						zRasterWritePixel(&colorBuffer[id * 4],
+							(b0 * tri.v[0].r + b1 * tri.v[1].r + b2 * tri.v[2].r) * w,
+							(b0 * tri.v[0].g + b1 * tri.v[1].g + b2 * tri.v[2].g) * w,
+							(b0 * tri.v[0].b + b1 * tri.v[1].b + b2 * tri.v[2].b) * w,
+							(b0 * tri.v[0].a + b1 * tri.v[1].a + b2 * tri.v[2].a) * w);
+					}
+				}
+			}
+		});
+	}
+
+}
@@ -0,0 +1,196 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsText.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+namespace zSpace
+{
+	// minimum number of lines per parallel parse task
+	static const int zTextMinLinesPerBlock = 4096;
+
+	//----  CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsTextReader::zUtilsTextReader() {}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsTextReader::~zUtilsTextReader() {}
+
+	//---- READ METHODS
+
+	ZSPACE_INLINE bool zUtilsTextReader::read(string infilename, size_t blockSize)
+	{
+		buffer.clear();
+		lineStarts.clear();
+
+		ifstream myfile;
+		myfile.open(infilename.c_str(), ios::in | ios::binary);
+
+		if (myfile.fail())
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		myfile.seekg(0, ios::end);
+		size_t fileSize = (size_t)myfile.tellg();
+		myfile.seekg(0, ios::beg);
+
+		buffer.resize(fileSize);
+
+		for (size_t offset = 0; offset < fileSize; offset += blockSize)
+		{
+			myfile.read(buffer.data() + offset, std::min(blockSize, fileSize - offset));
+		}
+
+		myfile.close();
+
+		// index the line breaks of each byte range in parallel
+		zThreadPool &pool = zThreadPool::getGlobal();
+
+		int numRanges = (int)std::min<size_t>(pool.numThreads() * 4, fileSize / (1 << 20) + 1);
+		vector<vector<size_t>> rangeBreaks(numRanges);
+
+		pool.parallel_for(0, numRanges, [&](int start, int end)
+		{
+			for (int r = start; r < end; r++)
+			{
+				const char *rangeBegin = buffer.data() + fileSize * r / numRanges;
+				const char *rangeEnd = buffer.data() + fileSize * (r + 1) / numRanges;
+
+				const char *p = rangeBegin;
+				while (p < rangeEnd)
+				{
+					const char *lineBreak = static_cast<const char*>(memchr(p, '\n', rangeEnd - p));
+					if (lineBreak == nullptr) break;
+
+					rangeBreaks[r].push_back(lineBreak - buffer.data() + 1);
+					p = lineBreak + 1;
+				}
+			}
+		}, 1);
+
+		size_t numBreaks = 0;
+		for (auto &breaks : rangeBreaks) numBreaks += breaks.size();
+
+		lineStarts.reserve(numBreaks + 2);
+		lineStarts.push_back(0);
+		for (auto &breaks : rangeBreaks) lineStarts.insert(lineStarts.end(), breaks.begin(), breaks.end());
+
+		// last line without a line break
+		if (lineStarts.back() < fileSize) lineStarts.push_back(fileSize + 1);
+
+		return true;
+	}
+
+	//---- LINE METHODS
+
+	ZSPACE_INLINE int zUtilsTextReader::numLines()
+	{
+		return (lineStarts.size() > 0) ? (int)lineStarts.size() - 1 : 0;
+	}
+
+	ZSPACE_INLINE int zUtilsTextReader::numLineBlocks()
+	{
+		int linesPerBlock = std::max(zTextMinLinesPerBlock, numLines() / (zThreadPool::getGlobal().numThreads() * 8) + 1);
+		return (numLines() + linesPerBlock - 1) / linesPerBlock;
+	}
+
+	ZSPACE_INLINE void zUtilsTextReader::getLineBlock(int blockId, int &start, int &end)
+	{
+		int numBlocks = numLineBlocks();
+
+		start = (int)((long long)numLines() * blockId / numBlocks);
+		end = (int)((long long)numLines() * (blockId + 1) / numBlocks);
+	}
+
+	ZSPACE_INLINE zUtilsTextToken zUtilsTextReader::getLine(int lineId)
+	{
+		zUtilsTextToken line;
+		line.begin = buffer.data() + lineStarts[lineId];
+		line.end = buffer.data() + lineStarts[lineId + 1] - 1;
+
+		if (line.end > line.begin && *(line.end - 1) == '\r') line.end--;
+
+		return line;
+	}
+
+	ZSPACE_INLINE int zUtilsTextReader::getTokens(int lineId, const char *delimiters, vector<zUtilsTextToken> &tokens)
+	{
+		return getTokens(getLine(lineId), delimiters, tokens);
+	}
+
+	ZSPACE_INLINE int zUtilsTextReader::getTokens(const zUtilsTextToken &token, const char *delimiters, vector<zUtilsTextToken> &tokens)
+	{
+		tokens.clear();
+
+		const char *p = token.begin;
+		while (p < token.end)
+		{
+			// skip delimiters
+			while (p < token.end && strchr(delimiters, *p) != nullptr) p++;
+			if (p == token.end) break;
+
+			zUtilsTextToken t;
+			t.begin = p;
+
+			while (p < token.end && strchr(delimiters, *p) == nullptr) p++;
+			t.end = p;
+
+			tokens.push_back(t);
+		}
+
+		return (int)tokens.size();
+	}
+
+	//---- TOKEN METHODS
+
+	ZSPACE_INLINE bool zUtilsTextReader::equals(const zUtilsTextToken &token, const char *str)
+	{
+		size_t length = strlen(str);
+		return (size_t)(token.end - token.begin) == length && memcmp(token.begin, str, length) == 0;
+	}
+
+	ZSPACE_INLINE string zUtilsTextReader::toString(const zUtilsTextToken &token)
+	{
+		return string(token.begin, token.end);
+	}
+
+	ZSPACE_INLINE double zUtilsTextReader::toDouble(const zUtilsTextToken &token)
+	{
+		const char *p = token.begin;
+		while (p < token.end && isspace((unsigned char)*p)) p++;
+		if (p < token.end && *p == '+') p++;
+
+		double value = 0;
+		std::from_chars(p, token.end, value);
+
+		return value;
+	}
+
+	ZSPACE_INLINE int zUtilsTextReader::toInt(const zUtilsTextToken &token)
+	{
+		const char *p = token.begin;
+		while (p < token.end && isspace((unsigned char)*p)) p++;
+		if (p < token.end && *p == '+') p++;
+
+		int value = 0;
+		std::from_chars(p, token.end, value);
+
+		return value;
+	}
+
+}
@@ -4,7 +4,21 @@ namespace zSpace
 {
 	//---- CONSTRUCTOR
 
-	ZSPACE_INLINE zTsSolarAnalysis::zTsSolarAnalysis() {}
+	ZSPACE_INLINE zTsSolarAnalysis::zTsSolarAnalysis()
+	{
+		normals = nullptr;
+		sunVecs_hour = nullptr;
+		sunVecs_days = nullptr;
+		compassPts = nullptr;
+		epwData_radiation = nullptr;
+		cummulativeRadiation = nullptr;
+		colors = nullptr;
+		norm_sunvecs = nullptr;
+
+		numNorms = 0;
+		numData = 0;
+		memSize = 0;
+	}
 
 	//---- DESTRUCTOR
 
@@ -34,14 +48,8 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zTsSolarAnalysis::setEPWData(string path)
 	{
-		ifstream myfile;
-		myfile.open(path.c_str());
-
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << path.c_str() << endl;
-			return false;
-		}
+		zUtilsTextReader epwFile;
+		if (!epwFile.read(path)) return false;
 
 		epwData_radiation = new float[MAX_SUNVECS_HOUR];
 
@@ -50,29 +58,28 @@ namespace zSpace
 		bool startCount = false;
 		int count = 0;
 
-		while (!myfile.eof())
-		{
-			string str;
-			getline(myfile, str);
+		vector<zUtilsTextToken> perlineData;
 
-			vector<string> perlineData = coreUtils.splitString(str, ",");
+		for (int l = 0; l < epwFile.numLines(); l++)
+		{
+			epwFile.getTokens(l, ",", perlineData);
 
 			if (perlineData.size() > 0)
 			{
-				if (perlineData[0] == "LOCATION")
+				if (epwFile.equals(perlineData[0], "LOCATION"))
 				{
 					//location.location = perlineData[1];
-					location.latitude = atof(perlineData[6].c_str());
-					location.longitude = atof(perlineData[7].c_str());
-					location.timeZone = atoi(perlineData[8].c_str());
+					location.latitude = epwFile.toDouble(perlineData[6]);
+					location.longitude = epwFile.toDouble(perlineData[7]);
+					location.timeZone = epwFile.toInt(perlineData[8]);
 				}
 
 				if (startCount)
 				{
 							
-					epwData_radiation[count * 3 + 0] = atof(perlineData[5].c_str()); // temperature
-					epwData_radiation[count * 3 + 1] = atof(perlineData[8].c_str()); //pressure
-					epwData_radiation[count * 3 + 2] = atof(perlineData[11].c_str()); //radiation
+					epwData_radiation[count * 3 + 0] = epwFile.toDouble(perlineData[5]); // temperature
+					epwData_radiation[count * 3 + 1] = epwFile.toDouble(perlineData[8]); //pressure
+					epwData_radiation[count * 3 + 2] = epwFile.toDouble(perlineData[11]); //radiation
 
 					if (leapYear && count == (59 *24)) // Feb 28
 					{
@@ -108,14 +115,13 @@ namespace zSpace
 					count++;
 				}
 
-				if (perlineData[0] == "DATA PERIODS") startCount = true;
+				if (epwFile.equals(perlineData[0], "DATA PERIODS")) startCount = true;
 			}
 
 		}
 
 
 		printf("\n count : %i ", count);
-		myfile.close();
 
 		return true;
 	}
@@ -135,6 +141,18 @@ namespace zSpace
 		location = _location;
 	}
 
+	ZSPACE_INLINE void zTsSolarAnalysis::setFaceCenters(const float *_centers, int _numCenters)
+	{
+		if (_numCenters != numNorms) throw std::invalid_argument(" error: number of face centers not equal to the number of normals.");
+
+		centers.assign(_centers, _centers + _numCenters);
+	}
+
+	ZSPACE_INLINE void zTsSolarAnalysis::setContextMesh(zMesh &contextMesh)
+	{
+		contextBVH.buildTriangles(contextMesh);
+	}
+
 	//---- GET METHODS
 
 	ZSPACE_INLINE int zTsSolarAnalysis::numNormals()
@@ -351,6 +369,164 @@ namespace zSpace
 		}
 	}
 
+	ZSPACE_INLINE void zTsSolarAnalysis::computeCummulativeRadiation_CPU(bool EPWRead, float rayOffset)
+	{
+		if (EPWRead && epwData_radiation == nullptr) throw std::invalid_argument(" error: EPW data not set.");
+
+		bool occlusion = contextBVH.numPrimitives() > 0;
+		if (occlusion && centers.size() != numNorms) throw std::invalid_argument(" error: number of face centers not equal to the number of normals.");
+
+		computeSunVectors_Packed(EPWRead);
+
+		int numPacked = sunVecs_x.size();
+
+		const float *sx = sunVecs_x.data();
+		const float *sy = sunVecs_y.data();
+		const float *sz = sunVecs_z.data();
+		const float *sRad = sunVecs_radiation.data();
+		const float *sMask = sunVecs_mask.data();
+
+		zThreadPool::getGlobal().parallel_for(0, numNorms / 3, [&](int start, int end)
+		{
+			zFloatArray visibility(numPacked);
+			zFloatArray angles(numPacked);
+
+			for (int n = start; n < end; n++)
+			{
+				int i = n * 3;
+
+				zVector norm(normals[i + 0], normals[i + 1], normals[i + 2]);
+				norm.normalize();
+
+				float nx = norm.x;
+				float ny = norm.y;
+				float nz = norm.z;
+
+				float *vis = visibility.data();
+				float *ang = angles.data();
+
+				// incidence angles, with the polynomial acos approximation of Abramowitz & Stegun 4.4.46 (error < 2e-8), which vectorises unlike the library acos
+				for (int k = 0; k < numPacked; k++)
+				{
+					float d = nx * sx[k] + ny * sy[k] + nz * sz[k];
+					d = std::min(1.0f, std::max(-1.0f, d));
+
+					float x = std::fabs(d);
+					float p = -0.0012624911f;
+					p = p * x + 0.0066700901f;
+					p = p * x - 0.0170881256f;
+					p = p * x + 0.0308918810f;
+					p = p * x - 0.0501743046f;
+					p = p * x + 0.0889789874f;
+					p = p * x - 0.2145988016f;
+					p = p * x + 1.5707963050f;
+					p *= std::sqrt(1.0f - x);
+
+					ang[k] = ((d < 0) ? (float)PI - p : p) * (float)RAD_TO_DEG;
+				}
+
+				if (occlusion)
+				{
+					zPoint origin(centers[i + 0], centers[i + 1], centers[i + 2]);
+					origin += norm * rayOffset;
+
+					for (int k = 0; k < numPacked; k++)
+					{
+						zVector sVec(sx[k], sy[k], sz[k]);
+						vis[k] = (sMask[k] > 0 && !contextBVH.hasRayIntersection(origin, sVec)) ? 1.0f : 0.0f;
+					}
+				}
+				else
+				{
+					for (int k = 0; k < numPacked; k++) vis[k] = sMask[k];
+				}
+
+				// accumulate in independent lanes, each summed in a fixed order
+				float angleSum[SUNVECS_LANES], angleCount[SUNVECS_LANES], radSum[SUNVECS_LANES], radCount[SUNVECS_LANES];
+				for (int l = 0; l < SUNVECS_LANES; l++) angleSum[l] = angleCount[l] = radSum[l] = radCount[l] = 0;
+
+				for (int k = 0; k < numPacked; k += SUNVECS_LANES)
+				{
+					for (int l = 0; l < SUNVECS_LANES; l++)
+					{
+						float a = ang[k + l];
+						float v = vis[k + l];
+
+						float aValid = (a > 0.001f) ? v : 0.0f;
+						angleSum[l] += a * aValid;
+						angleCount[l] += aValid;
+
+						float r = (1.0f - (a / 180.0f)) * sRad[k + l] * v;
+
+						float rValid = (r > 0.001f) ? 1.0f : 0.0f;
+						radSum[l] += r * rValid;
+						radCount[l] += rValid;
+					}
+				}
+
+				float angle = 0, angleN = 0, rad = 0, radN = 0;
+				for (int l = 0; l < SUNVECS_LANES; l++)
+				{
+					angle += angleSum[l];
+					angleN += angleCount[l];
+					rad += radSum[l];
+					radN += radCount[l];
+				}
+
+				// fully occluded normals get the minimum color
+				angle = (angleN > 0) ? angle / angleN : 180.0f;
+				rad = (radN > 0) ? rad / radN : 0.0f;
+
+				if (EPWRead)
+				{
+					cummulativeRadiation[i + 0] = angle;
+					cummulativeRadiation[i + 1] = rad;
+					cummulativeRadiation[i + 2] = INVALID_VAL;
+
+					if (rad < RAD_MIN)
+					{
+						colors[i + 0] = dColor.min.h;
+						colors[i + 1] = dColor.min.s;
+						colors[i + 2] = dColor.min.v;
+					}
+					else if (rad <= RAD_MAX)
+					{
+						colors[i + 0] = coreUtils.ofMap(rad, (float)RAD_MIN, (float)RAD_MAX, dColor.min.h, dColor.max.h);
+						colors[i + 1] = coreUtils.ofMap(rad, (float)RAD_MIN, (float)RAD_MAX, dColor.min.s, dColor.max.s);
+						colors[i + 2] = coreUtils.ofMap(rad, (float)RAD_MIN, (float)RAD_MAX, dColor.min.v, dColor.max.v);
+					}
+					else
+					{
+						colors[i + 0] = dColor.max.h;
+						colors[i + 1] = dColor.max.s;
+						colors[i + 2] = dColor.max.v;
+					}
+				}
+				else
+				{
+					if (angle > RAD_ANGLE_MAX)
+					{
+						colors[i + 0] = dColor.min.h;
+						colors[i + 1] = dColor.min.s;
+						colors[i + 2] = dColor.min.v;
+					}
+					else if (angle >= RAD_ANGLE_MIN)
+					{
+						colors[i + 0] = coreUtils.ofMap(angle, (float)RAD_ANGLE_MAX, (float)RAD_ANGLE_MIN, dColor.min.h, dColor.max.h);
+						colors[i + 1] = coreUtils.ofMap(angle, (float)RAD_ANGLE_MAX, (float)RAD_ANGLE_MIN, dColor.min.s, dColor.max.s);
+						colors[i + 2] = coreUtils.ofMap(angle, (float)RAD_ANGLE_MAX, (float)RAD_ANGLE_MIN, dColor.min.v, dColor.max.v);
+					}
+					else
+					{
+						colors[i + 0] = dColor.max.h;
+						colors[i + 1] = dColor.max.s;
+						colors[i + 2] = dColor.max.v;
+					}
+				}
+			}
+		});
+	}
+
 	//---- PROTECTED METHODS
 
 
@@ -463,12 +639,16 @@ namespace zSpace
 			hrCount++;
 		}
 
-    // for non leap years
+    // for non leap years, the last day of each hour is not computed
 		if (min.tm_year % 4 != 0)
 		{
-			for (int i = (365 * 24 * 3); i < MAX_SUNVECS_HOUR; i++)
+			for (int h = 0; h < hrCount; h++)
 			{
-				sunVecs_hour[i] = INVALID_VAL;				
+				int i = ((h * 366) + 365) * 3;
+
+				sunVecs_hour[i + 0] = INVALID_VAL;
+				sunVecs_hour[i + 1] = INVALID_VAL;
+				sunVecs_hour[i + 2] = INVALID_VAL;
 			}
 		}
 	}
@@ -550,4 +730,49 @@ namespace zSpace
 		}
 	}
 
-}
+	ZSPACE_INLINE void zTsSolarAnalysis::computeSunVectors_Packed(bool EPWRead)
+	{
+		sunVecs_x.clear();
+		sunVecs_y.clear();
+		sunVecs_z.clear();
+		sunVecs_radiation.clear();
+		sunVecs_mask.clear();
+
+		// sun vectors are stored per hour and day, EPW records per day and hour
+		for (int h = 0; h < 24; h++)
+		{
+			for (int d = 0; d < 366; d++)
+			{
+				int s = ((h * 366) + d) * 3;
+
+				if (sunVecs_hour[s + 0] == INVALID_VAL || sunVecs_hour[s + 1] == INVALID_VAL || sunVecs_hour[s + 2] == INVALID_VAL) continue;
+
+				zVector sVec(sunVecs_hour[s + 0], sunVecs_hour[s + 1], sunVecs_hour[s + 2]);
+				sVec.normalize();
+
+				float rad = 0;
+				if (EPWRead)
+				{
+					rad = epwData_radiation[(((d * 24) + h) * 3) + 2];
+					if (rad == INVALID_VAL) rad = 0;
+				}
+
+				sunVecs_x.push_back(sVec.x);
+				sunVecs_y.push_back(sVec.y);
+				sunVecs_z.push_back(sVec.z);
+				sunVecs_radiation.push_back(rad);
+				sunVecs_mask.push_back(1);
+			}
+		}
+
+		while (sunVecs_x.size() % SUNVECS_LANES != 0)
+		{
+			sunVecs_x.push_back(0);
+			sunVecs_y.push_back(0);
+			sunVecs_z.push_back(1);
+			sunVecs_radiation.push_back(0);
+			sunVecs_mask.push_back(0);
+		}
+	}
+
+}
\ No newline at end of file
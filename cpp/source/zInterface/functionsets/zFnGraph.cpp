@@ -61,6 +61,11 @@ namespace zSpace
 			fromJSON(path);
 			setStaticContainers();
 		}
+		else if (type == zBIN)
+		{
+			fromBIN(path);
+			setStaticContainers();
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -69,6 +74,7 @@ namespace zSpace
 	{
 		if (type == zTXT) toTXT(path);
 		else if (type == zJSON) toJSON(path);
+		else if (type == zBIN) toBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -1433,6 +1439,132 @@ namespace zSpace
 
 	}
 
+	ZSPACE_INLINE bool zFnGraph::fromBIN(string infilename)
+	{
+		zUtilsBinaryReader binFile;
+		if (!binFile.open(infilename)) return false;
+
+		if (binFile.getObjectType() != zGraphFn) throw std::invalid_argument(" error: " + infilename + " does not contain a graph.");
+
+		// connectivity blocks, read in place from the mapped file
+		uint64_t numV, numHE;
+		const int32_t *vertexHalfEdges = static_cast<const int32_t*>(binFile.getBlock(zBinVertexHalfEdges, sizeof(int32_t), numV));
+		const int32_t *halfEdges = static_cast<const int32_t*>(binFile.getBlock(zBinHalfEdges, sizeof(int32_t) * 3, numHE));
+
+		if (numHE % 2 != 0) throw std::invalid_argument(" error: odd number of half edges in " + infilename);
+
+		// indices are either -1 ( unset ) or in range of the block they point into
+		auto validId = [](int32_t id, uint64_t count) { return id >= -1 && id < (int64_t)count; };
+
+		for (uint64_t i = 0; i < numV; i++) if (!validId(vertexHalfEdges[i], numHE)) throw std::invalid_argument(" error: invalid vertex half edge in " + infilename);
+		for (uint64_t i = 0; i < numHE; i++)
+		{
+			if (!validId(halfEdges[i * 3], numHE) || !validId(halfEdges[i * 3 + 1], numHE) || !validId(halfEdges[i * 3 + 2], numV))
+				throw std::invalid_argument(" error: invalid half edge in " + infilename);
+		}
+
+		// update graph
+		graphObj->graph.clear();
+		graphObj->graph.vertices.assign(numV, zVertex());
+		graphObj->graph.halfEdges.assign(numHE, zHalfEdge());
+		graphObj->graph.edges.assign(numHE / 2, zEdge());
+		graphObj->graph.vHandles.assign(numV, zVertexHandle());
+		graphObj->graph.eHandles.assign(numHE / 2, zEdgeHandle());
+		graphObj->graph.heHandles.assign(numHE, zHalfEdgeHandle());
+
+		// set IDs
+		for (int i = 0; i < numV; i++) graphObj->graph.vertices[i].setId(i);
+		for (int i = 0; i < numHE; i++)graphObj->graph.halfEdges[i].setId(i);
+
+		// set Pointers
+		int n_v = 0;
+		for (zItGraphVertex v(*graphObj); !v.end(); v++)
+		{
+			if (vertexHalfEdges[n_v] != -1)
+			{
+				zItGraphHalfEdge he(*graphObj, vertexHalfEdges[n_v]);
+				v.setHalfEdge(he);
+				graphObj->graph.vHandles[n_v].id = n_v;
+				graphObj->graph.vHandles[n_v].he = vertexHalfEdges[n_v];
+			}
+			n_v++;
+		}
+		graphObj->graph.setNumVertices(n_v);
+
+		int n_he = 0;
+		int n_e = 0;
+		for (zItGraphHalfEdge he(*graphObj); !he.end(); he++)
+		{
+			const int32_t *heData = halfEdges + n_he * 3;
+			graphObj->graph.heHandles[n_he].id = n_he;
+
+			if (heData[0] != -1)
+			{
+				zItGraphHalfEdge e(*graphObj, heData[0]);
+				he.setPrev(e);
+				graphObj->graph.heHandles[n_he].p = heData[0];
+			}
+			if (heData[1] != -1)
+			{
+				zItGraphHalfEdge e(*graphObj, heData[1]);
+				he.setNext(e);
+				graphObj->graph.heHandles[n_he].n = heData[1];
+			}
+			if (heData[2] != -1)
+			{
+				zItGraphVertex v(*graphObj, heData[2]);
+				he.setVertex(v);
+				graphObj->graph.heHandles[n_he].v = heData[2];
+			}
+			// symmetry half edges
+			if (n_he % 2 == 1)
+			{
+				zItGraphHalfEdge heSym(*graphObj, n_he - 1);
+				he.setSym(heSym);
+				zItGraphEdge e(*graphObj, n_e);
+				e.setId(n_e);
+				e.setHalfEdge(heSym, 0);
+				e.setHalfEdge(he, 1);
+				he.setEdge(e);
+				heSym.setEdge(e);
+				graphObj->graph.heHandles[n_he].e = n_e;
+				graphObj->graph.heHandles[n_he - 1].e = n_e;
+				graphObj->graph.eHandles[n_e].id = n_e;
+				graphObj->graph.eHandles[n_e].he0 = n_he - 1;
+				graphObj->graph.eHandles[n_e].he1 = n_he;
+				n_e++;
+			}
+			n_he++;
+		}
+		graphObj->graph.setNumEdges(n_e);
+
+		// vertex attributes
+		binFile.getBlock(zBinVertexPositions, graphObj->graph.vertexPositions);
+		if (graphObj->graph.vertexPositions.size() != numV) throw std::invalid_argument(" error: vertex positions do not match the vertices in " + infilename);
+
+		if (!binFile.getBlock(zBinVertexColors, graphObj->graph.vertexColors) || graphObj->graph.vertexColors.size() != numV) graphObj->graph.vertexColors.assign(numV, zColor(1, 0, 0, 1));
+		if (!binFile.getBlock(zBinVertexWeights, graphObj->graph.vertexWeights) || graphObj->graph.vertexWeights.size() != numV) graphObj->graph.vertexWeights.assign(numV, 2.0);
+
+		// edge attributes
+		if (!binFile.getBlock(zBinEdgeColors, graphObj->graph.edgeColors) || graphObj->graph.edgeColors.size() != n_e) graphObj->graph.edgeColors.assign(n_e, zColor());
+		if (!binFile.getBlock(zBinEdgeWeights, graphObj->graph.edgeWeights) || graphObj->graph.edgeWeights.size() != n_e) graphObj->graph.edgeWeights.assign(n_e, 1.0);
+
+		printf("\n graph: %i %i ", numVertices(), numEdges());
+
+		// add to maps
+		for (int i = 0; i < graphObj->graph.vertexPositions.size(); i++)
+		{
+			graphObj->graph.addToPositionMap(graphObj->graph.vertexPositions[i], i);
+		}
+		for (zItGraphEdge e(*graphObj); !e.end(); e++)
+		{
+			int v1 = e.getHalfEdge(0).getVertex().getId();
+			int v2 = e.getHalfEdge(1).getVertex().getId();
+			graphObj->graph.addToHalfEdgesMap(v1, v2, e.getHalfEdge(0).getId());
+		}
+		return true;
+	}
+
 	ZSPACE_INLINE void zFnGraph::toTXT(string outfilename)
 	{
 		// remove inactive elements
@@ -1564,6 +1696,48 @@ namespace zSpace
 		myfile.close();
 	}
 
+	ZSPACE_INLINE void zFnGraph::toBIN(string outfilename)
+	{
+		// remove inactive elements
+		if (numVertices() != graphObj->graph.vertices.size()) removeInactiveElements(zVertexData);
+		if (numEdges() != graphObj->graph.edges.size()) removeInactiveElements(zEdgeData);
+
+		// connectivity blocks
+		zIntArray vertexHalfEdges;
+		vertexHalfEdges.reserve(numVertices());
+
+		for (zItGraphVertex v(*graphObj); !v.end(); v++)
+		{
+			if (v.getHalfEdge().isActive()) vertexHalfEdges.push_back(v.getHalfEdge().getId());
+			else vertexHalfEdges.push_back(-1);
+		}
+
+		zIntArray halfEdges;
+		halfEdges.reserve(numHalfEdges() * 3);
+
+		for (zItGraphHalfEdge he(*graphObj); !he.end(); he++)
+		{
+			halfEdges.push_back((he.getPrev().isActive()) ? he.getPrev().getId() : -1);
+			halfEdges.push_back((he.getNext().isActive()) ? he.getNext().getId() : -1);
+			halfEdges.push_back((he.getVertex().isActive()) ? he.getVertex().getId() : -1);
+		}
+
+		zUtilsBinaryWriter binFile;
+
+		binFile.addBlock(zBinVertexHalfEdges, vertexHalfEdges);
+		binFile.addBlock(zBinHalfEdges, halfEdges, 3);
+
+		// attribute blocks
+		binFile.addBlock(zBinVertexPositions, graphObj->graph.vertexPositions);
+		binFile.addBlock(zBinVertexColors, graphObj->graph.vertexColors);
+		binFile.addBlock(zBinVertexWeights, graphObj->graph.vertexWeights);
+
+		binFile.addBlock(zBinEdgeColors, graphObj->graph.edgeColors);
+		binFile.addBlock(zBinEdgeWeights, graphObj->graph.edgeWeights);
+
+		binFile.write(outfilename, zGraphFn);
+	}
+
 	//---- PRIVATE METHODS
 
 	ZSPACE_INLINE void zFnGraph::setStaticContainers()
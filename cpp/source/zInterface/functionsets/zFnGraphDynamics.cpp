@@ -79,33 +79,46 @@ namespace zSpace
 	{
 		zFnGraph::clear();
 
-		fnParticles.clear();
-		particlesObj.clear();
+		particles.clear();
 	}
 
 	//---- CREATE METHODS
 
 	ZSPACE_INLINE void zFnGraphDynamics::makeDynamic(bool fixBoundary)
 	{
-		fnParticles.clear();
+		zPointArray &positions = graphObj->graph.vertexPositions;
+		int nV = positions.size();
+
+		particles.create((nV > 0) ? &positions[0] : nullptr, nV);
+
+		// compressed vertex neighbour container, so the edge force gathers per particle
+		zIntArray neighbourOffsets(1, 0);
+		zIntArray neighbours;
+
+		bool anyFree = false;
 
 		for (zItGraphVertex v(*graphObj); !v.end(); v++)
 		{
+			int i = v.getId();
+
 			bool fixed = false;
 
 			if (fixBoundary) fixed = (v.checkValency(1));
 
-			zObjParticle p;
-			p.particle = zParticle(*v.getRawPosition(), fixed);
-			particlesObj.push_back(p);
+			if (v.isActive()) v.getConnectedVertices(neighbours);
+			else fixed = true;
 
-			if (!fixed) setVertexColor(zColor(0, 0, 1, 1));
-		}
+			neighbourOffsets.push_back(neighbours.size());
 
-		for (int i = 0; i < particlesObj.size(); i++)
-		{
-			fnParticles.push_back(zFnParticle(particlesObj[i]));
+			particles.setFixed(i, fixed);
+
+			if (!fixed) anyFree = true;
 		}
+
+		// colors all the vertices, so it is set once
+		if (anyFree) setVertexColor(zColor(0, 0, 1, 1));
+
+		particles.setNeighbours(neighbourOffsets, neighbours);
 	}
 
 	ZSPACE_INLINE void zFnGraphDynamics::create(zObjGraph &_graphObj, bool fixBoundary)
@@ -120,10 +133,7 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnGraphDynamics::addGravityForce(zVector grav)
 	{
-		for (int i = 0; i < fnParticles.size(); i++)
-		{
-			fnParticles[i].addForce(grav);
-		}
+		particles.addForce(grav);
 	}
 
 	ZSPACE_INLINE void zFnGraphDynamics::addEdgeForce(const zDoubleArray &weights)
@@ -131,50 +141,14 @@ namespace zSpace
 
 		if (weights.size() > 0 && weights.size() != graphObj->graph.vertices.size()) throw std::invalid_argument("cannot apply edge force.");
 
-		for (zItGraphVertex v(*graphObj); !v.end(); v++)
-		{
-			int i = v.getId();
-
-			if (v.isActive())
-			{
-				if (fnParticles[i].getFixed()) continue;
-
-				vector<zItGraphHalfEdge> cEdges;
-				v.getConnectedHalfEdges(cEdges);
-
-				zVector eForce;
-
-				for (auto &he : cEdges)
-				{
-					int v1 = he.getVertex().getId();
-					zVector e = graphObj->graph.vertexPositions[v1] - graphObj->graph.vertexPositions[i];
-
-					double len = e.length();
-					e.normalize();
-
-					if (weights.size() > 0) e *= weights[i];
-
-					eForce += (e * len);
-				}
-
-				fnParticles[i].addForce(eForce);
-
-			}
-			else  fnParticles[i].setFixed(true);;
-
-		}
-
+		particles.addEdgeForce(weights);
 	}
 
 	//---- UPDATE METHODS 
 
 	ZSPACE_INLINE void zFnGraphDynamics::update(double dT, zIntergrationType type, bool clearForce , bool clearVelocity, bool clearDerivatives)
 	{
-		for (int i = 0; i < fnParticles.size(); i++)
-		{
-			fnParticles[i].integrateForces(dT, type);
-			fnParticles[i].updateParticle(clearForce, clearVelocity, clearDerivatives);
-		}
+		particles.update(dT, type, clearForce, clearVelocity, clearDerivatives);
 	}
 
 	//---- PRIVATE METHODS
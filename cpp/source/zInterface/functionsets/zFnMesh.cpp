@@ -13,8 +13,262 @@
 
 #include<headers/zInterface/functionsets/zFnMesh.h>
 
+// the library builds compile the quickhull implementation once here. Header only builds include this file in every
+// translation unit, so define QUICKHULL_IMPLEMENTATION before the zSpace headers in the ones calling makeConvexHull.
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+#ifndef QUICKHULL_IMPLEMENTATION
+#define QUICKHULL_IMPLEMENTATION
+#include <depends/quickhull/quickhull.h>
+#endif
+#endif
+
 namespace zSpace
 {
+	//---- zIsoContourBuffer
+
+	ZSPACE_INLINE zIsoContourBuffer::zIsoContourBuffer()
+	{
+		bandScalars = nullptr;
+		bandLow = bandHigh = 0;
+	}
+
+	ZSPACE_INLINE int zIsoContourBuffer::addVertex(zItMeshFace &f, zPoint &pos, int precisionFac, zColor col)
+	{
+		zPositionKey posKey(pos, precisionFac);
+
+		unsigned long long key = 0;
+		bool onVertex = false;
+
+		int closestEdge = -1;
+		float closestDistance = 0;
+		float closestParam = 0;
+		int closestV0 = -1, closestV1 = -1;
+
+		zItMeshHalfEdge start = f.getHalfEdge();
+		zItMeshHalfEdge he = start;
+
+		do
+		{
+			zItMeshVertex v0 = he.getStartVertex();
+			zItMeshVertex v1 = he.getVertex();
+
+			zPoint p0 = v0.getPosition();
+			zPoint p1 = v1.getPosition();
+
+			// positions rounding to a face vertex are welded to the vertex, as with the position keys
+			if (zPositionKey(p0, precisionFac) == posKey)
+			{
+				key = (unsigned long long)v0.getId() << 1;
+				onVertex = true;
+				break;
+			}
+
+			zVector e = p1 - p0;
+			float eLenSq = e * e;
+
+			float t = (eLenSq > 0) ? ((pos - p0) * e) / eLenSq : 0;
+			t = (t < 0) ? 0 : ((t > 1) ? 1 : t);
+
+			zPoint closest = p0 + e * t;
+			float d = closest.squareDistanceTo(pos);
+
+			if (closestEdge == -1 || d < closestDistance)
+			{
+				closestDistance = d;
+				closestEdge = he.getEdge().getId();
+				closestParam = t;
+				closestV0 = v0.getId();
+				closestV1 = v1.getId();
+			}
+
+			he = he.getNext();
+
+		} while (he != start);
+
+		if (!onVertex)
+		{
+			// an edge has one crossing per threshold, the band level picks the threshold from the interpolated scalar
+			int level = 0;
+
+			if (bandScalars != nullptr)
+			{
+				float s = (*bandScalars)[closestV0] + closestParam * ((*bandScalars)[closestV1] - (*bandScalars)[closestV0]);
+				level = (abs(s - bandLow) <= abs(s - bandHigh)) ? 0 : 1;
+			}
+
+			key = ((unsigned long long)closestEdge << 2) | (level << 1) | 1;
+		}
+
+		int id;
+		if (!keyVertex.find(key, id))
+		{
+			id = positions.size();
+
+			positions.push_back(pos);
+			colors.push_back(col);
+			keys.push_back(key);
+
+			keyVertex.insert(key, id);
+		}
+
+		return id;
+	}
+
+	ZSPACE_INLINE void zIsoContourBuffer::removeRepeatedVertices()
+	{
+		zIntArray tempConnects;
+		tempConnects.reserve(connects.size());
+
+		if (counts.size() == 0)
+		{
+			for (int i = 0; i + 1 < connects.size(); i += 2)
+			{
+				if (connects[i] == connects[i + 1]) continue;
+
+				tempConnects.push_back(connects[i]);
+				tempConnects.push_back(connects[i + 1]);
+			}
+
+			connects = tempConnects;
+			return;
+		}
+
+		zIntArray tempCounts;
+		tempCounts.reserve(counts.size());
+
+		int offset = 0;
+		for (int count : counts)
+		{
+			int polyStart = tempConnects.size();
+
+			for (int i = 0; i < count; i++)
+			{
+				int v = connects[offset + i];
+				if (tempConnects.size() > polyStart && tempConnects.back() == v) continue;
+
+				tempConnects.push_back(v);
+			}
+
+			while (tempConnects.size() - polyStart > 1 && tempConnects.back() == tempConnects[polyStart]) tempConnects.pop_back();
+
+			// polygons collapsing to less than 3 vertices are removed
+			if (tempConnects.size() - polyStart < 3) tempConnects.resize(polyStart);
+			else tempCounts.push_back(tempConnects.size() - polyStart);
+
+			offset += count;
+		}
+
+		connects = tempConnects;
+		counts = tempCounts;
+	}
+
+	ZSPACE_INLINE void zIsoContourBuffer::compute(zObjMesh &meshObj, vector<zIsoContourBuffer> &buffers, std::function<void(zItMeshFace&, zIsoContourBuffer&)> faceContour, zScalarArray *_bandScalars, float _bandLow, float _bandHigh)
+	{
+		int numFaces = meshObj.mesh.faces.size();
+		int chunkSize = 512;
+
+		buffers.clear();
+		buffers.resize((numFaces + chunkSize - 1) / chunkSize);
+
+		for (auto &b : buffers)
+		{
+			b.bandScalars = _bandScalars;
+			b.bandLow = _bandLow;
+			b.bandHigh = _bandHigh;
+		}
+
+		zThreadPool::getGlobal().parallel_for(0, buffers.size(), [&](int start, int end)
+		{
+			for (int c = start; c < end; c++)
+			{
+				int fEnd = std::min((c + 1) * chunkSize, numFaces);
+
+				for (int i = c * chunkSize; i < fEnd; i++)
+				{
+					zItMeshFace f(meshObj, i);
+					faceContour(f, buffers[c]);
+				}
+			}
+		}, 1);
+	}
+
+	ZSPACE_INLINE void zIsoContourBuffer::merge(vector<zIsoContourBuffer> &buffers, zPointArray &outPositions, zIntArray &outConnects, zIntArray &outCounts, zColorArray &outColors)
+	{
+		int numBuffers = buffers.size();
+
+		// crossings welded to the same vertex leave repeated consecutive vertices, which are removed
+		zThreadPool::getGlobal().parallel_for(0, numBuffers, [&](int start, int end)
+		{
+			for (int c = start; c < end; c++) buffers[c].removeRepeatedVertices();
+		}, 1);
+
+		// assign the global vertex indicies in buffer order, which is the order of the serial face walk
+		zIntArray vertexOffsets(numBuffers + 1, 0);
+		zIntArray connectOffsets(numBuffers + 1, 0);
+		zIntArray countOffsets(numBuffers + 1, 0);
+
+		int numKeys = 0;
+		for (auto &b : buffers) numKeys += b.keys.size();
+
+		zHashMap<unsigned long long> globalVertex;
+		globalVertex.reserve(numKeys);
+
+		vector<zIntArray> bufferVertex(numBuffers);
+
+		int numVertices = 0;
+		for (int c = 0; c < numBuffers; c++)
+		{
+			zIsoContourBuffer &b = buffers[c];
+
+			bufferVertex[c].resize(b.keys.size());
+			vertexOffsets[c] = numVertices;
+
+			for (int i = 0; i < b.keys.size(); i++)
+			{
+				int id;
+				if (!globalVertex.find(b.keys[i], id))
+				{
+					id = numVertices++;
+					globalVertex.insert(b.keys[i], id);
+				}
+
+				bufferVertex[c][i] = id;
+			}
+
+			connectOffsets[c + 1] = connectOffsets[c] + b.connects.size();
+			countOffsets[c + 1] = countOffsets[c] + b.counts.size();
+		}
+		vertexOffsets[numBuffers] = numVertices;
+
+		outPositions.assign(numVertices, zPoint());
+		outColors.assign(numVertices, zColor());
+		outConnects.assign(connectOffsets[numBuffers], -1);
+		outCounts.assign(countOffsets[numBuffers], 0);
+
+		// compact the buffers into the output containers at their prefix sum offsets
+		zThreadPool::getGlobal().parallel_for(0, numBuffers, [&](int start, int end)
+		{
+			for (int c = start; c < end; c++)
+			{
+				zIsoContourBuffer &b = buffers[c];
+
+				for (int i = 0; i < b.keys.size(); i++)
+				{
+					int id = bufferVertex[c][i];
+
+					// vertices first seen in this buffer
+					if (id >= vertexOffsets[c] && id < vertexOffsets[c + 1])
+					{
+						outPositions[id] = b.positions[i];
+						outColors[id] = b.colors[i];
+					}
+				}
+
+				for (int i = 0; i < b.connects.size(); i++) outConnects[connectOffsets[c] + i] = bufferVertex[c][b.connects[i]];
+				for (int i = 0; i < b.counts.size(); i++) outCounts[countOffsets[c] + i] = b.counts[i];
+			}
+		}, 1);
+	}
 
 	//---- CONSTRUCTOR
 
@@ -56,6 +310,12 @@ namespace zSpace
 			if (chk && staticGeom) setStaticContainers();
 		}
 
+		else if (type == zBIN)
+		{
+			bool chk = fromBIN(path);
+			if (chk && staticGeom) setStaticContainers();
+		}
+
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
 
@@ -63,6 +323,7 @@ namespace zSpace
 	{
 		if (type == zOBJ) toOBJ(path);
 		else if (type == zJSON) toJSON(path);
+		else if (type == zBIN) toBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileType type");
 	}
@@ -234,6 +495,8 @@ namespace zSpace
 		zSparseMatrix meshLaplacian(n_v, n_v);
 		//meshLaplacian.setZero();
 
+		vector<zTriplet> coefs;
+		coefs.reserve(numHalfEdges() + n_v);
 
 		// compute laplacian weights
 		for (zItMeshVertex v(*meshObj); !v.end(); v++)
@@ -253,10 +516,10 @@ namespace zSpace
 
 				int i = cEdges[k].getVertex().getId();
 
-				meshLaplacian.insert(j, i) = val * -1;
+				coefs.push_back(zTriplet(j, i, val * -1));
 			}
 
-			meshLaplacian.insert(j, j) = out;
+			coefs.push_back(zTriplet(j, j, out));
 
 			/*for (int i = 0; i < n_v; i++)
 			{
@@ -286,6 +549,8 @@ namespace zSpace
 			}*/
 		}
 
+		meshLaplacian.setFromTriplets(coefs.begin(), coefs.end());
+
 		return meshLaplacian;
 	}
 
@@ -521,26 +786,7 @@ namespace zSpace
 
 		for (zItMeshVertex v(*meshObj); !v.end(); v++)
 		{
-			if (v.isActive())
-			{
-
-				//if (v.getHalfEdge().onBoundary()) v.setHalfEdge(v.getHalfEdge().getSym().getNext());
-
-				vector<int> cFaces;
-				v.getConnectedFaces(cFaces);
-
-				zVector norm;
-
-				for (int j = 0; j < cFaces.size(); j++)
-				{
-					norm += meshObj->mesh.faceNormals[cFaces[j]];
-				}
-
-				norm /= cFaces.size();
-				norm.normalize();
-				meshObj->mesh.vertexNormals.push_back(norm);
-			}
-			else meshObj->mesh.vertexNormals.push_back(zVector());
+			meshObj->mesh.vertexNormals.push_back(computeVertexNormal(v));
 		}
 	}
 
@@ -550,71 +796,26 @@ namespace zSpace
 
 		for (zItMeshFace f(*meshObj); !f.end(); f++)
 		{
-			if (f.isActive())
-			{
-				// get face vertices and correspondiing positions
-
-				//printf("\n f %i :", i);
-				vector<int> fVerts;
-				f.getVertices(fVerts);
-
-				zVector fCen; // face center
-
-				vector<zVector> points;
-				for (int i = 0; i < fVerts.size(); i++)
-				{
-					//printf(" %i ", fVerts[i]);
-					points.push_back(meshObj->mesh.vertexPositions[fVerts[i]]);
-
-					fCen += meshObj->mesh.vertexPositions[fVerts[i]];
-				}
-
-				fCen /= fVerts.size();
-
-				zVector fNorm; // face normal
-
-				if (fVerts.size() != 3)
-				{
-					for (int j = 0; j < fVerts.size(); j++)
-					{
-						fNorm += (points[j] - fCen) ^ (points[(j + 1) % fVerts.size()] - fCen);
-					}
-
-
-					//  https://stackoverflow.com/questions/27326636/calculate-normal-vector-of-a-polygon-newells-method
-					/*for (int j = 0; j < fVerts.size(); j++) 
-					{
-						int k = (j + 1) % (fVerts.size());
-						fNorm.x += (points[j].y - points[k].y) * (points[j].z + points[k].z);
-						fNorm.y += (points[j].z - points[k].z) * (points[j].x + points[k].x);
-						fNorm.z += (points[j].x - points[k].x) * (points[j].y + points[k].y);						
-					}*/
-					
-
-
-				}
-				else
-				{
-					zVector cross = (points[1] - points[0]) ^ (points[fVerts.size() - 1] - points[0]);
-					cross.normalize();
-
-					fNorm = cross;
-
-					//printf("\n working! %i ", i);
-				}
-
-				fNorm.normalize();
-				meshObj->mesh.faceNormals.push_back(fNorm);
-
-							}
-			else meshObj->mesh.faceNormals.push_back(zVector());
+			meshObj->mesh.faceNormals.push_back(computeFaceNormal(f));
 		}
+
 		// compute vertex normal
 		computeVertexNormalfromFaceNormal();
 
 		
 	}
 
+	ZSPACE_INLINE void zFnMesh::updateMeshNormals()
+	{
+		updateAttributeCaches(zCacheNormals);
+	}
+
+	ZSPACE_INLINE void zFnMesh::clearAttributeCaches()
+	{
+		meshObj->mesh.cachePositions.clear();
+		meshObj->mesh.cachedAttributes = 0;
+	}
+
 	ZSPACE_INLINE void zFnMesh::averageVertices(int numSteps)
 	{
 		for (int k = 0; k < numSteps; k++)
@@ -804,6 +1005,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::setFaceNormals(zVector &fNormal)
 	{
+		clearAttributeCaches();
+
 		meshObj->mesh.faceNormals.clear();
 		meshObj->mesh.faceNormals.assign(meshObj->mesh.n_f, fNormal);
 
@@ -813,6 +1016,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::setFaceNormals(zVectorArray &fNormals)
 	{
+		clearAttributeCaches();
+
 		if (meshObj->mesh.faces.size() != fNormals.size()) throw std::invalid_argument("size of color contatiner is not equal to number of mesh faces.");
 
 		meshObj->mesh.faceNormals.clear();
@@ -1500,7 +1705,7 @@ namespace zSpace
 		}
 	}
 
-	void zFnMesh::getPrincipalCurvaturesPerFace(zCurvatureArray& faceCurvatures)
+	ZSPACE_INLINE void zFnMesh::getPrincipalCurvaturesPerFace(zCurvatureArray& faceCurvatures)
 	{
 		for (zItMeshFace f(*meshObj); !f.end(); f++)
 		{
@@ -1598,38 +1803,8 @@ namespace zSpace
 		{
 			double vArea = 0;
 
-			int i = v.getId();
-
-			if (v.isActive())
-			{
-				vector<zItMeshHalfEdge> cEdges;
-				v.getConnectedHalfEdges(cEdges);
-
-				for (int j = 0; j < cEdges.size(); j++)
-				{
-
-
-					zItMeshHalfEdge cE = cEdges[j];
-					zItMeshHalfEdge nE = cEdges[(j + 1) % cEdges.size()];
-
-					if (cE.onBoundary() || nE.getSym().onBoundary()) continue;
-
-					if (cE.getFace().getId() != nE.getSym().getFace().getId()) continue;
-
-					zVector vPos = meshObj->mesh.vertexPositions[i];
-					zVector fCen = faceCenters[cE.getFace().getId()];
-					zVector currentEdge_cen = edgeCenters[cE.getId()];
-					zVector nextEdge_cen = edgeCenters[nE.getId()];
+			if (v.isActive()) vArea = computeVertexArea(v, &faceCenters, &edgeCenters);
 
-					double Area1 = meshObj->mesh.coreUtils.getTriangleArea(vPos, currentEdge_cen, fCen);
-					vArea += (Area1);
-
-					double Area2 = meshObj->mesh.coreUtils.getTriangleArea(vPos, nextEdge_cen, fCen);
-					vArea += (Area2);
-
-				}
-
-			}
 			out.push_back(vArea);
 
 			totalArea += vArea;
@@ -1661,6 +1836,38 @@ namespace zSpace
 		return totalArea;
 	}
 
+	ZSPACE_INLINE double zFnMesh::updatePlanarFaceAreas(zDoubleArray &faceAreas)
+	{
+		// the planar areas are computed with the face normals
+		updateAttributeCaches(zCacheNormals | zCacheFaceAreas);
+
+		faceAreas = meshObj->mesh.faceAreas;
+
+		double totalArea = 0;
+		for (auto &fArea : faceAreas) totalArea += fArea;
+
+		return totalArea;
+	}
+
+	ZSPACE_INLINE double zFnMesh::updateVertexAreas(zFloatArray &vertexAreas)
+	{
+		updateAttributeCaches(zCacheVertexAreas);
+
+		vertexAreas = meshObj->mesh.vertexAreas;
+
+		double totalArea = 0;
+		for (auto &vArea : vertexAreas) totalArea += vArea;
+
+		return totalArea;
+	}
+
+	ZSPACE_INLINE void zFnMesh::updatePrincipalCurvatures(zCurvatureArray &vertexCurvatures)
+	{
+		updateAttributeCaches(zCacheCurvatures);
+
+		vertexCurvatures = meshObj->mesh.vertexCurvatures;
+	}
+
 	ZSPACE_INLINE void zFnMesh::getPolygonData(zIntArray(&polyConnects), zIntArray(&polyCounts))
 	{
 		polyConnects.clear();
@@ -1839,14 +2046,15 @@ namespace zSpace
 		vector<zVector>positions;
 		vector<int>polyConnects;
 		vector<int>polyCounts;
+		zColorArray colors;
 
-		unordered_map <string, int> positionVertex;
-
-
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		vector<zIsoContourBuffer> buffers;
+		zIsoContourBuffer::compute(*meshObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 		{
-			getIsolinePoly_mixed(vertexScalars, f, positions, polyConnects, polyCounts, positionVertex, threshold, invertMesh);
-		}
+			getIsolinePoly_mixed(vertexScalars, f, contour, threshold, invertMesh);
+		});
+
+		zIsoContourBuffer::merge(buffers, positions, polyConnects, polyCounts, colors);
 
 		tempFn.create(positions, polyCounts, polyConnects);;
 
@@ -1861,22 +2069,20 @@ namespace zSpace
 			return;
 		}
 
-			positions.clear();
-		edgeConnects.clear();
-		cVertexColor.clear();
-
-		unordered_map <string, int> positionVertex;
-
+		zIntArray edgeCounts;
 
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		vector<zIsoContourBuffer> buffers;
+		zIsoContourBuffer::compute(*meshObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 		{
 			if (selectedFaces)
 			{
 				if(f.getColor() == selectedFaceColor)
-					getIsoline(vertexScalars, f, positions, edgeConnects, cVertexColor, positionVertex, threshold);
+					getIsoline(vertexScalars, f, contour, threshold);
 			}
-			else getIsoline(vertexScalars, f, positions, edgeConnects, cVertexColor, positionVertex, threshold);
-		}
+			else getIsoline(vertexScalars, f, contour, threshold);
+		});
+
+		zIsoContourBuffer::merge(buffers, positions, edgeConnects, edgeCounts, cVertexColor);
 		
 
 	}
@@ -1897,14 +2103,15 @@ namespace zSpace
 		vector<zVector>positions;
 		vector<int>polyConnects;
 		vector<int>polyCounts;
+		zColorArray colors;
 
-		unordered_map <string, int> positionVertex;
-
-
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		vector<zIsoContourBuffer> buffers;
+		zIsoContourBuffer::compute(*meshObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 		{
-			getIsolinePoly(vertexScalars, f, positions, polyConnects, polyCounts, positionVertex, threshold, invertMesh);
-		}
+			getIsolinePoly(vertexScalars, f, contour, threshold, invertMesh);
+		});
+
+		zIsoContourBuffer::merge(buffers, positions, polyConnects, polyCounts, colors);
 
 		tempFn.create(positions, polyCounts, polyConnects);;
 
@@ -1918,14 +2125,22 @@ namespace zSpace
 		vector<zVector>positions;
 		vector<int>polyConnects;
 		vector<int>polyCounts;
+		zColorArray colors;
 
-		unordered_map <string, int> positionVertex;
+		float thresholdLow = (inThresholdLow < inThresholdHigh) ? inThresholdLow : inThresholdHigh;
+		float thresholdHigh = (inThresholdLow < inThresholdHigh) ? inThresholdHigh : inThresholdLow;
 
-		
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		// the band is computed from the red channel of the vertex colors
+		zScalarArray bandScalars(meshObj->mesh.vertices.size());
+		for (zItMeshVertex v(*meshObj); !v.end(); v++) bandScalars[v.getId()] = v.getColor().r;
+
+		vector<zIsoContourBuffer> buffers;
+		zIsoContourBuffer::compute(*meshObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 		{
-			getIsobandPoly(f, positions, polyConnects, polyCounts, positionVertex, (inThresholdLow < inThresholdHigh) ? inThresholdLow : inThresholdHigh, (inThresholdLow < inThresholdHigh) ? inThresholdHigh : inThresholdLow);
-		}
+			getIsobandPoly(f, contour, thresholdLow, thresholdHigh);
+		}, &bandScalars, thresholdLow, thresholdHigh);
+
+		zIsoContourBuffer::merge(buffers, positions, polyConnects, polyCounts, colors);
 
 		tempFn.create(positions, polyCounts, polyConnects);;
 		
@@ -2062,6 +2277,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::deleteVertex(int index, bool removeInactiveElems)
 	{
+		clearAttributeCaches();
+
 		//if (index >= meshObj->mesh.vertices.size()) throw std::invalid_argument(" error: index out of bounds.");
 		//if (!meshObj->mesh.indexToVertex[index]->isActive()) throw std::invalid_argument(" error: index out of bounds.");
 
@@ -2188,6 +2405,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::deleteFace(int index, bool removeInactiveElems)
 	{
+		clearAttributeCaches();
+
 		//if (index > meshObj->mesh.faceActive.size()) throw std::invalid_argument(" error: index out of bounds.");
 		//if (!meshObj->mesh.faceActive[index]) throw std::invalid_argument(" error: index out of bounds.");
 
@@ -2286,6 +2505,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::deleteEdge(zItMeshEdge &edge, bool removeInactiveElements)
 	{
+		clearAttributeCaches();
+
 		//// check if the edge is boundary.
 		if (edge.onBoundary())
 		{
@@ -2356,6 +2577,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::collapseEdge(zItMeshEdge &edge, double edgeFactor, bool removeInactiveElems )
 	{
+		clearAttributeCaches();
+
 		//if (index > meshObj->mesh.edgeActive.size()) throw std::invalid_argument(" error: index out of bounds.");
 		//if (!meshObj->mesh.edgeActive[index]) throw std::invalid_argument(" error: index out of bounds.");
 
@@ -2757,6 +2980,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::flipTriangleEdge(zItMeshEdge &edge)
 	{
+		clearAttributeCaches();
+
 		if(edge.onBoundary())
 		{
 			throw std::invalid_argument("\n Cannot flip boundary edge ");
@@ -3699,98 +3924,147 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zFnMesh::fromOBJ(string infilename)
 	{
-		vector<zVector>positions;
-		vector<int>polyConnects;
-		vector<int>polyCounts;
-
-		vector<zVector>  vertexNormals;
-		vector<zVector>  faceNormals;
-
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader objFile;
+		if (!objFile.read(infilename)) return false;
 
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return false;
-		}
+		// count the vertices, normals, faces and face indices of each line block
+		int numBlocks = objFile.numLineBlocks();
+		zIntArray blockVertices(numBlocks + 1, 0), blockNormals(numBlocks + 1, 0), blockFaces(numBlocks + 1, 0), blockConnects(numBlocks + 1, 0);
 
-		while (!myfile.eof())
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = meshObj->mesh.coreUtils.splitString(str, " ");
+			vector<zUtilsTextToken> perlineData;
 
-			if (perlineData.size() > 0)
+			for (int b = start; b < end; b++)
 			{
-				// vertex
-				if (perlineData[0] == "v")
-				{
-					if (perlineData.size() == 4)
-					{
-						zVector pos;
-						pos.x = atof(perlineData[1].c_str());
-						pos.y = atof(perlineData[2].c_str());
-						pos.z = atof(perlineData[3].c_str());
+				int lineStart, lineEnd;
+				objFile.getLineBlock(b, lineStart, lineEnd);
 
-						positions.push_back(pos);
-					}
-					//printf("\n working vertex");
-				}
-
-				// vertex normal
-				if (perlineData[0] == "vn")
+				for (int l = lineStart; l < lineEnd; l++)
 				{
-					//printf("\n working vertex normal ");
-					if (perlineData.size() == 4)
-					{
-						zVector norm;
-						norm.x = atof(perlineData[1].c_str());
-						norm.y = atof(perlineData[2].c_str());
-						norm.z = atof(perlineData[3].c_str());
+					int numTokens = objFile.getTokens(l, " \t", perlineData);
+					if (numTokens == 0) continue;
 
-						vertexNormals.push_back(norm);
+					if (objFile.equals(perlineData[0], "v") && numTokens == 4) blockVertices[b + 1]++;
+					else if (objFile.equals(perlineData[0], "vn") && numTokens == 4) blockNormals[b + 1]++;
+					else if (objFile.equals(perlineData[0], "f"))
+					{
+						blockFaces[b + 1]++;
+						blockConnects[b + 1] += numTokens - 1;
 					}
-					//printf("\n working vertex");
 				}
+			}
+		}, 1);
 
-				// face
-				if (perlineData[0] == "f")
-				{
-					zVector norm;
+		for (int b = 0; b < numBlocks; b++)
+		{
+			blockVertices[b + 1] += blockVertices[b];
+			blockNormals[b + 1] += blockNormals[b];
+			blockFaces[b + 1] += blockFaces[b];
+			blockConnects[b + 1] += blockConnects[b];
+		}
 
-					for (int i = 1; i < perlineData.size(); i++)
-					{
-						vector<string> faceData = meshObj->mesh.coreUtils.splitString(perlineData[i], "/");
+		vector<zVector>positions(blockVertices[numBlocks]);
+		vector<int>polyConnects(blockConnects[numBlocks]);
+		vector<int>polyCounts(blockFaces[numBlocks]);
 
-						//vector<string> cleanFaceData = splitString(faceData[0], "/\/");
+		vector<zVector>  vertexNormals(blockNormals[numBlocks]);
+		vector<zVector>  faceNormals(blockFaces[numBlocks]);
 
-						int id = atoi(faceData[0].c_str()) - 1;
-						polyConnects.push_back(id);
+		// normal index of each face index, -1 if the face index has no normal
+		vector<int> polyNormals(blockConnects[numBlocks], -1);
 
-						//printf(" %i ", id);
+		// parse each line block into the preallocated containers
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
+		{
+			vector<zUtilsTextToken> perlineData;
+			vector<zUtilsTextToken> faceData;
 
-						int normId = atoi(faceData[faceData.size() - 1].c_str()) - 1;
-						norm += vertexNormals[normId];
+			for (int b = start; b < end; b++)
+			{
+				int lineStart, lineEnd;
+				objFile.getLineBlock(b, lineStart, lineEnd);
+
+				int v = blockVertices[b];
+				int vn = blockNormals[b];
+				int f = blockFaces[b];
+				int c = blockConnects[b];
+
+				for (int l = lineStart; l < lineEnd; l++)
+				{
+					int numTokens = objFile.getTokens(l, " \t", perlineData);
+					if (numTokens == 0) continue;
+
+					// vertex
+					if (objFile.equals(perlineData[0], "v") && numTokens == 4)
+					{
+						positions[v].x = objFile.toDouble(perlineData[1]);
+						positions[v].y = objFile.toDouble(perlineData[2]);
+						positions[v].z = objFile.toDouble(perlineData[3]);
+						v++;
 					}
 
-					norm /= (perlineData.size() - 1);
-					norm.normalize();
-					faceNormals.push_back(norm);
+					// vertex normal
+					else if (objFile.equals(perlineData[0], "vn") && numTokens == 4)
+					{
+						vertexNormals[vn].x = objFile.toDouble(perlineData[1]);
+						vertexNormals[vn].y = objFile.toDouble(perlineData[2]);
+						vertexNormals[vn].z = objFile.toDouble(perlineData[3]);
+						vn++;
+					}
+
+					// face
+					else if (objFile.equals(perlineData[0], "f"))
+					{
+						for (int i = 1; i < numTokens; i++)
+						{
+							int numFaceData = objFile.getTokens(perlineData[i], "/", faceData);
+
+							polyConnects[c] = (numFaceData > 0) ? objFile.toInt(faceData[0]) - 1 : -1;
+
+							// files without normals only have the vertex index, normals are used once declared
+							int normId = (numFaceData > 0) ? objFile.toInt(faceData[numFaceData - 1]) - 1 : -1;
+							if (numFaceData > 1 && normId >= 0 && normId < vn) polyNormals[c] = normId;
 
-					polyCounts.push_back(perlineData.size() - 1);
-					//printf("\n working face ");
+							c++;
+						}
+
+						polyCounts[f] = numTokens - 1;
+						f++;
+					}
 				}
 			}
-		}
+		}, 1);
 
-		myfile.close();
+		// face normals as the average of the face vertex normals
+		if (vertexNormals.size() > 0)
+		{
+			zIntArray faceStarts(polyCounts.size() + 1, 0);
+			for (int i = 0; i < polyCounts.size(); i++) faceStarts[i + 1] = faceStarts[i] + polyCounts[i];
+
+			zThreadPool::getGlobal().parallel_for(0, (int)polyCounts.size(), [&](int start, int end)
+			{
+				for (int i = start; i < end; i++)
+				{
+					zVector norm;
+
+					for (int j = faceStarts[i]; j < faceStarts[i + 1]; j++)
+					{
+						if (polyNormals[j] != -1) norm += vertexNormals[polyNormals[j]];
+					}
+
+					norm /= polyCounts[i];
+					norm.normalize();
+					faceNormals[i] = norm;
+				}
+			});
+		}
 
 		meshObj->mesh.create(positions, polyCounts, polyConnects);;
 		printf("\n mesh: %i %i %i", numVertices(), numEdges(), numPolygons());
 
-		setFaceNormals(faceNormals);
+		if (vertexNormals.size() > 0) setFaceNormals(faceNormals);
+		else computeMeshNormals();
 
 		return true;
 	}
@@ -3947,7 +4221,7 @@ namespace zSpace
 		{
 			f.setId(n_f);
 
-			if (meshJSON.vertices[n_f] != -1)
+			if (meshJSON.faces[n_f] != -1)
 			{
 				zItMeshHalfEdge he(*meshObj, meshJSON.faces[n_f]);
 				f.setHalfEdge(he);
@@ -4137,6 +4411,248 @@ namespace zSpace
 		return true;
 	}
 
+	ZSPACE_INLINE void zFnMesh::toBIN(string outfilename)
+	{
+		// remove inactive elements
+		if (numVertices() != meshObj->mesh.vertices.size()) garbageCollection(zVertexData);
+		if (numEdges() != meshObj->mesh.edges.size()) garbageCollection(zEdgeData);
+		if (numPolygons() != meshObj->mesh.faces.size())garbageCollection(zFaceData);
+
+		// connectivity blocks
+		zIntArray vertexHalfEdges;
+		vertexHalfEdges.reserve(numVertices());
+
+		for (zItMeshVertex v(*meshObj); !v.end(); v++)
+		{
+			if (v.getHalfEdge().isActive()) vertexHalfEdges.push_back(v.getHalfEdge().getId());
+			else vertexHalfEdges.push_back(-1);
+		}
+
+		zIntArray halfEdges;
+		halfEdges.reserve(numHalfEdges() * 4);
+
+		for (zItMeshHalfEdge he(*meshObj); !he.end(); he++)
+		{
+			halfEdges.push_back((he.getPrev().isActive()) ? he.getPrev().getId() : -1);
+			halfEdges.push_back((he.getNext().isActive()) ? he.getNext().getId() : -1);
+			halfEdges.push_back((he.getVertex().isActive()) ? he.getVertex().getId() : -1);
+			halfEdges.push_back((!he.onBoundary()) ? he.getFace().getId() : -1);
+		}
+
+		zIntArray faceHalfEdges;
+		faceHalfEdges.reserve(numPolygons());
+
+		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		{
+			if (f.getHalfEdge().isActive()) faceHalfEdges.push_back(f.getHalfEdge().getId());
+			else faceHalfEdges.push_back(-1);
+		}
+
+		zUtilsBinaryWriter binFile;
+
+		binFile.addBlock(zBinVertexHalfEdges, vertexHalfEdges);
+		binFile.addBlock(zBinHalfEdges, halfEdges, 4);
+		binFile.addBlock(zBinFaceHalfEdges, faceHalfEdges);
+
+		// attribute blocks
+		binFile.addBlock(zBinVertexPositions, meshObj->mesh.vertexPositions);
+		binFile.addBlock(zBinVertexNormals, meshObj->mesh.vertexNormals);
+		binFile.addBlock(zBinVertexColors, meshObj->mesh.vertexColors);
+		binFile.addBlock(zBinVertexWeights, meshObj->mesh.vertexWeights);
+
+		binFile.addBlock(zBinEdgeColors, meshObj->mesh.edgeColors);
+		binFile.addBlock(zBinEdgeWeights, meshObj->mesh.edgeWeights);
+
+		binFile.addBlock(zBinFaceNormals, meshObj->mesh.faceNormals);
+		binFile.addBlock(zBinFaceColors, meshObj->mesh.faceColors);
+
+		binFile.write(outfilename, zMeshFn);
+	}
+
+	ZSPACE_INLINE bool zFnMesh::fromBIN(string infilename)
+	{
+		zUtilsBinaryReader binFile;
+		if (!binFile.open(infilename)) return false;
+
+		if (binFile.getObjectType() != zMeshFn) throw std::invalid_argument(" error: " + infilename + " does not contain a mesh.");
+
+		// connectivity blocks, read in place from the mapped file
+		uint64_t numV, numHE, numF;
+		const int32_t *vertexHalfEdges = static_cast<const int32_t*>(binFile.getBlock(zBinVertexHalfEdges, sizeof(int32_t), numV));
+		const int32_t *halfEdges = static_cast<const int32_t*>(binFile.getBlock(zBinHalfEdges, sizeof(int32_t) * 4, numHE));
+		const int32_t *faceHalfEdges = static_cast<const int32_t*>(binFile.getBlock(zBinFaceHalfEdges, sizeof(int32_t), numF));
+
+		if (numHE % 2 != 0) throw std::invalid_argument(" error: odd number of half edges in " + infilename);
+
+		// indices are either -1 ( unset ) or in range of the block they point into
+		auto validId = [](int32_t id, uint64_t count) { return id >= -1 && id < (int64_t)count; };
+
+		for (uint64_t i = 0; i < numV; i++) if (!validId(vertexHalfEdges[i], numHE)) throw std::invalid_argument(" error: invalid vertex half edge in " + infilename);
+		for (uint64_t i = 0; i < numF; i++) if (!validId(faceHalfEdges[i], numHE)) throw std::invalid_argument(" error: invalid face half edge in " + infilename);
+		for (uint64_t i = 0; i < numHE; i++)
+		{
+			if (!validId(halfEdges[i * 4], numHE) || !validId(halfEdges[i * 4 + 1], numHE) || !validId(halfEdges[i * 4 + 2], numV) || !validId(halfEdges[i * 4 + 3], numF))
+				throw std::invalid_argument(" error: invalid half edge in " + infilename);
+		}
+
+		// update  mesh
+		meshObj->mesh.clear();
+
+		meshObj->mesh.vertices.assign(numV, zVertex());
+		meshObj->mesh.halfEdges.assign(numHE, zHalfEdge());
+		meshObj->mesh.edges.assign(numHE / 2, zEdge());
+		meshObj->mesh.faces.assign(numF, zFace());
+
+		meshObj->mesh.vHandles.assign(numV, zVertexHandle());
+		meshObj->mesh.eHandles.assign(numHE / 2, zEdgeHandle());
+		meshObj->mesh.heHandles.assign(numHE, zHalfEdgeHandle());
+		meshObj->mesh.fHandles.assign(numF, zFaceHandle());
+
+		// set IDs
+		for (int i = 0; i < numV; i++) meshObj->mesh.vertices[i].setId(i);
+		for (int i = 0; i < numHE; i++) meshObj->mesh.halfEdges[i].setId(i);
+		for (int i = 0; i < numF; i++) meshObj->mesh.faces[i].setId(i);
+
+		// set Pointers
+		int n_v = 0;
+		for (zItMeshVertex v(*meshObj); !v.end(); v++)
+		{
+			if (vertexHalfEdges[n_v] != -1)
+			{
+				zItMeshHalfEdge he(*meshObj, vertexHalfEdges[n_v]);
+				v.setHalfEdge(he);
+
+				meshObj->mesh.vHandles[n_v].id = n_v;
+				meshObj->mesh.vHandles[n_v].he = vertexHalfEdges[n_v];
+			}
+
+			n_v++;
+		}
+		meshObj->mesh.setNumVertices(n_v);
+
+		int n_he = 0;
+		int n_e = 0;
+
+		for (zItMeshHalfEdge he(*meshObj); !he.end(); he++)
+		{
+			const int32_t *heData = halfEdges + n_he * 4;
+			meshObj->mesh.heHandles[n_he].id = n_he;
+
+			if (heData[0] != -1)
+			{
+				zItMeshHalfEdge hePrev(*meshObj, heData[0]);
+				he.setPrev(hePrev);
+
+				meshObj->mesh.heHandles[n_he].p = heData[0];
+			}
+
+			if (heData[1] != -1)
+			{
+				zItMeshHalfEdge heNext(*meshObj, heData[1]);
+				he.setNext(heNext);
+
+				meshObj->mesh.heHandles[n_he].n = heData[1];
+			}
+
+			if (heData[2] != -1)
+			{
+				zItMeshVertex v(*meshObj, heData[2]);
+				he.setVertex(v);
+
+				meshObj->mesh.heHandles[n_he].v = heData[2];
+			}
+
+			if (heData[3] != -1)
+			{
+				zItMeshFace f(*meshObj, heData[3]);
+				he.setFace(f);
+
+				meshObj->mesh.heHandles[n_he].f = heData[3];
+			}
+
+			// symmetry half edges && Edge
+			if (n_he % 2 == 1)
+			{
+				zItMeshHalfEdge heSym(*meshObj, n_he - 1);
+				he.setSym(heSym);
+
+				zItMeshEdge e(*meshObj, n_e);
+				e.setId(n_e);
+
+				e.setHalfEdge(heSym, 0);
+				e.setHalfEdge(he, 1);
+
+				he.setEdge(e);
+				heSym.setEdge(e);
+
+				meshObj->mesh.heHandles[n_he].e = n_e;
+				meshObj->mesh.heHandles[n_he - 1].e = n_e;
+
+				meshObj->mesh.eHandles[n_e].id = n_e;
+				meshObj->mesh.eHandles[n_e].he0 = n_he - 1;
+				meshObj->mesh.eHandles[n_e].he1 = n_he;
+
+				n_e++;
+			}
+
+			n_he++;
+		}
+		meshObj->mesh.setNumEdges(n_e);
+
+		int n_f = 0;
+		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		{
+			if (faceHalfEdges[n_f] != -1)
+			{
+				zItMeshHalfEdge he(*meshObj, faceHalfEdges[n_f]);
+				f.setHalfEdge(he);
+
+				meshObj->mesh.fHandles[n_f].id = n_f;
+				meshObj->mesh.fHandles[n_f].he = faceHalfEdges[n_f];
+			}
+
+			n_f++;
+		}
+		meshObj->mesh.setNumPolygons(n_f);
+
+		// vertex attributes
+		binFile.getBlock(zBinVertexPositions, meshObj->mesh.vertexPositions);
+		if (meshObj->mesh.vertexPositions.size() != numV) throw std::invalid_argument(" error: vertex positions do not match the vertices in " + infilename);
+
+		bool normals = binFile.getBlock(zBinVertexNormals, meshObj->mesh.vertexNormals) && meshObj->mesh.vertexNormals.size() == numV;
+
+		if (!binFile.getBlock(zBinVertexColors, meshObj->mesh.vertexColors) || meshObj->mesh.vertexColors.size() != numV) meshObj->mesh.vertexColors.assign(numV, zColor(1, 0, 0, 1));
+		if (!binFile.getBlock(zBinVertexWeights, meshObj->mesh.vertexWeights) || meshObj->mesh.vertexWeights.size() != numV) meshObj->mesh.vertexWeights.assign(numV, 2.0);
+
+		// edge attributes
+		if (!binFile.getBlock(zBinEdgeColors, meshObj->mesh.edgeColors) || meshObj->mesh.edgeColors.size() != n_e) meshObj->mesh.edgeColors.assign(n_e, zColor());
+		if (!binFile.getBlock(zBinEdgeWeights, meshObj->mesh.edgeWeights) || meshObj->mesh.edgeWeights.size() != n_e) meshObj->mesh.edgeWeights.assign(n_e, 1.0);
+
+		// face attributes
+		normals = binFile.getBlock(zBinFaceNormals, meshObj->mesh.faceNormals) && meshObj->mesh.faceNormals.size() == numF && normals;
+		if (!normals) computeMeshNormals();
+
+		if (!binFile.getBlock(zBinFaceColors, meshObj->mesh.faceColors) || meshObj->mesh.faceColors.size() != numF) setFaceColor(zColor(0.5, 0.5, 0.5, 1));
+
+		// add to maps
+		for (int i = 0; i < meshObj->mesh.vertexPositions.size(); i++)
+		{
+			meshObj->mesh.addToPositionMap(meshObj->mesh.vertexPositions[i], i);
+		}
+
+		for (zItMeshEdge e(*meshObj); !e.end(); e++)
+		{
+			int v1 = e.getHalfEdge(0).getVertex().getId();
+			int v2 = e.getHalfEdge(1).getVertex().getId();
+
+			meshObj->mesh.addToHalfEdgesMap(v1, v2, e.getHalfEdge(0).getId());
+		}
+
+		printf("\n mesh: %i %i %i ", numVertices(), numEdges(), numPolygons());
+
+		return true;
+	}
+
 	//---- PROTECTED CONTOUR METHODS
 
 	ZSPACE_INLINE int zFnMesh::getIsolineCase_triangle(bool vertexBinary[3])
@@ -4347,7 +4863,7 @@ namespace zSpace
 		return (vertex_lower + (e * edgeLen *scaleVal));
 	}
 
-	ZSPACE_INLINE void zFnMesh::getIsoline(zScalarArray& vertexScalars, zItMeshFace& f, zPointArray& positions, zIntArray& edgeConnects, zColorArray& cVertexColor, unordered_map <string, int>& positionVertex, float& threshold)
+	ZSPACE_INLINE void zFnMesh::getIsoline(zScalarArray& vertexScalars, zItMeshFace& f, zIsoContourBuffer& contour, float& threshold)
 	{
 		vector<zItMeshVertex> fVerts;
 		f.getVertices(fVerts);
@@ -4881,24 +5397,9 @@ namespace zSpace
 			for (int i = 0; i < newPositions.size(); i++)
 			{
 				zVector p0 = newPositions[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, PRECISION, v0);
-				//bool vExists = coreUtils.checkRepeatVector(p0, positions, v0, 3);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
-					cVertexColor.push_back(newColors[i]);
-
-					//string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					//positionVertex[hashKey] = v0;
-
-					coreUtils.addToPositionMap(positionVertex, p0, v0, PRECISION);
-				}
+				int v0 = contour.addVertex(f, p0, PRECISION, newColors[i]);
 
-				edgeConnects.push_back(v0);
+				contour.connects.push_back(v0);
 
 				
 			}
@@ -4927,22 +5428,9 @@ namespace zSpace
 			for (int i = 0; i < newPositions2.size(); i++)
 			{
 				zVector p0 = newPositions2[i];
-				int v0;
+				int v0 = contour.addVertex(f, p0, PRECISION, newColors2[i]);
 
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, PRECISION, v0);
-
-				//bool vExists = coreUtils.checkRepeatVector( p0, positions, v0,3);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
-					cVertexColor.push_back(newColors2[i]);
-					
-					coreUtils.addToPositionMap(positionVertex, p0, v0, PRECISION);
-				}
-
-				edgeConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 			
 		}	
@@ -4951,7 +5439,7 @@ namespace zSpace
 	}
 
 
-	ZSPACE_INLINE void zFnMesh::getIsolinePoly_mixed(zScalarArray& vertexScalars, zItMeshFace& f, zPointArray& positions, zIntArray& polyConnects, zIntArray& polyCounts, unordered_map <string, int>& positionVertex, float& threshold, bool invertMesh)
+	ZSPACE_INLINE void zFnMesh::getIsolinePoly_mixed(zScalarArray& vertexScalars, zItMeshFace& f, zIsoContourBuffer& contour, float& threshold, bool invertMesh)
 	{
 		vector<zItMeshVertex> fVerts;
 		f.getVertices(fVerts);
@@ -5177,25 +5665,12 @@ namespace zSpace
 				for (int i = 0; i < newPositions.size(); i++)
 				{
 					zVector p0 = newPositions[i];
-					int v0;
-
-					bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-					if (!vExists)
-					{
-						v0 = positions.size();
-						positions.push_back(p0);
-
-						/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-						positionVertex[hashKey] = v0;*/
-
-						coreUtils.addToPositionMap(positionVertex, p0, v0, 3);
-					}
+					int v0 = contour.addVertex(f, p0, 3);
 
-					polyConnects.push_back(v0);
+					contour.connects.push_back(v0);
 				}
 
-				polyCounts.push_back(newPositions.size());
+				contour.counts.push_back(newPositions.size());
 			}
 
 
@@ -5227,25 +5702,12 @@ namespace zSpace
 				for (int i = 0; i < newPositions2.size(); i++)
 				{
 					zVector p0 = newPositions2[i];
-					int v0;
-
-					bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-					if (!vExists)
-					{
-						v0 = positions.size();
-						positions.push_back(p0);
-
-						/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-						positionVertex[hashKey] = v0;*/
+					int v0 = contour.addVertex(f, p0, 3);
 
-						coreUtils.addToPositionMap(positionVertex, p0, v0, 3);
-					}
-
-					polyConnects.push_back(v0);
+					contour.connects.push_back(v0);
 				}
 
-				polyCounts.push_back(newPositions2.size());
+				contour.counts.push_back(newPositions2.size());
 			}
 		}
 
@@ -5817,25 +6279,12 @@ namespace zSpace
 				for (int i = 0; i < newPositions.size(); i++)
 				{
 					zVector p0 = newPositions[i];
-					int v0;
-
-					bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-					if (!vExists)
-					{
-						v0 = positions.size();
-						positions.push_back(p0);
-
-						/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-						positionVertex[hashKey] = v0;*/
+					int v0 = contour.addVertex(f, p0, 3);
 
-						coreUtils.addToPositionMap(positionVertex, p0, v0, 3);
-					}
-
-					polyConnects.push_back(v0);
+					contour.connects.push_back(v0);
 				}
 
-				polyCounts.push_back(newPositions.size());
+				contour.counts.push_back(newPositions.size());
 			}
 
 
@@ -5852,7 +6301,7 @@ namespace zSpace
 
 					if (newPositions2[i].distanceTo(newPositions2[next]) < distanceTolerance)
 					{
-						newPositions2.erase(newPositions.begin() + i);
+						newPositions2.erase(newPositions2.begin() + i);
 					}
 
 				}
@@ -5865,25 +6314,12 @@ namespace zSpace
 				for (int i = 0; i < newPositions2.size(); i++)
 				{
 					zVector p0 = newPositions2[i];
-					int v0;
-
-					bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-					if (!vExists)
-					{
-						v0 = positions.size();
-						positions.push_back(p0);
-
-						/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-						positionVertex[hashKey] = v0;*/
+					int v0 = contour.addVertex(f, p0, 3);
 
-						coreUtils.addToPositionMap(positionVertex, p0, v0, 3);
-					}
-
-					polyConnects.push_back(v0);
+					contour.connects.push_back(v0);
 				}
 
-				polyCounts.push_back(newPositions2.size());
+				contour.counts.push_back(newPositions2.size());
 			}
 		}
 
@@ -5893,7 +6329,7 @@ namespace zSpace
 
 	}
 
-	ZSPACE_INLINE void zFnMesh::getIsolinePoly(zScalarArray &vertexScalars , zItMeshFace& f, zPointArray& positions, zIntArray& polyConnects, zIntArray& polyCounts, unordered_map <string, int>& positionVertex, float& threshold, bool invertMesh)
+	ZSPACE_INLINE void zFnMesh::getIsolinePoly(zScalarArray &vertexScalars , zItMeshFace& f, zIsoContourBuffer& contour, float& threshold, bool invertMesh)
 	{
 		vector<zItMeshVertex> fVerts;
 		f.getVertices(fVerts);
@@ -6426,26 +6862,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions.size(); i++)
 			{
 				zVector p0 = newPositions[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-				//if (vExists) printf("\n working");
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
+				int v0 = contour.addVertex(f, p0, 3);
 
-					//string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					//positionVertex[hashKey] = v0;
-
-					coreUtils.addToPositionMap(positionVertex, p0, v0,3);
-				}
-
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions.size());
+			contour.counts.push_back(newPositions.size());
 		}
 
 
@@ -6462,7 +6884,7 @@ namespace zSpace
 
 				if (newPositions2[i].distanceTo(newPositions2[next]) < distanceTolerance)
 				{
-					newPositions2.erase(newPositions.begin() + i);
+					newPositions2.erase(newPositions2.begin() + i);
 				}
 
 			}
@@ -6475,24 +6897,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions2.size(); i++)
 			{
 				zVector p0 = newPositions2[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
+				int v0 = contour.addVertex(f, p0, 3);
 
-					//string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					//positionVertex[hashKey] = v0;
-					coreUtils.addToPositionMap(positionVertex, p0, v0, 3);
-				}
-
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions2.size());
+			contour.counts.push_back(newPositions2.size());
 		}
 
 
@@ -6500,7 +6910,7 @@ namespace zSpace
 	}
 
 
-	ZSPACE_INLINE void zFnMesh::getIsobandPoly(zItMeshFace & f, zPointArray & positions, zIntArray & polyConnects, zIntArray & polyCounts, unordered_map<string, int>& positionVertex, float& thresholdLow, float& thresholdHigh)
+	ZSPACE_INLINE void zFnMesh::getIsobandPoly(zItMeshFace & f, zIsoContourBuffer& contour, float& thresholdLow, float& thresholdHigh)
 
 	{
 		vector<zItMeshVertex> fVerts;
@@ -7283,23 +7693,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions.size(); i++)
 			{
 				zVector p0 = newPositions[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
+				int v0 = contour.addVertex(f, p0, 3);
 
-					string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;
-				}
-
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions.size());
+			contour.counts.push_back(newPositions.size());
 		}
 
 
@@ -7317,7 +7716,7 @@ namespace zSpace
 
 				if (newPositions2[i].distanceTo(newPositions2[next]) < distanceTolerance)
 				{
-					newPositions2.erase(newPositions.begin() + i);
+					newPositions2.erase(newPositions2.begin() + i);
 
 
 				}
@@ -7332,23 +7731,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions2.size(); i++)
 			{
 				zVector p0 = newPositions2[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
+				int v0 = contour.addVertex(f, p0, 3);
 
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
-
-					string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;
-				}
-
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions2.size());
+			contour.counts.push_back(newPositions2.size());
 		}
 
 	}
@@ -7384,6 +7772,237 @@ namespace zSpace
 		meshObj->mesh.setStaticFaceVertices(faceVerts);
 	}
 
+	//---- PRIVATE ATTRIBUTE CACHE METHODS
+
+	ZSPACE_INLINE zVector zFnMesh::computeFaceNormal(zItMeshFace &f)
+	{
+		if (!f.isActive()) return zVector();
+
+		// get face vertices and correspondiing positions
+		vector<int> fVerts;
+		f.getVertices(fVerts);
+
+		zVector fCen; // face center
+
+		vector<zVector> points;
+		for (int i = 0; i < fVerts.size(); i++)
+		{
+			points.push_back(meshObj->mesh.vertexPositions[fVerts[i]]);
+
+			fCen += meshObj->mesh.vertexPositions[fVerts[i]];
+		}
+
+		fCen /= fVerts.size();
+
+		zVector fNorm; // face normal
+
+		if (fVerts.size() != 3)
+		{
+			for (int j = 0; j < fVerts.size(); j++)
+			{
+				fNorm += (points[j] - fCen) ^ (points[(j + 1) % fVerts.size()] - fCen);
+			}
+
+			//  https://stackoverflow.com/questions/27326636/calculate-normal-vector-of-a-polygon-newells-method
+			/*for (int j = 0; j < fVerts.size(); j++) 
+			{
+				int k = (j + 1) % (fVerts.size());
+				fNorm.x += (points[j].y - points[k].y) * (points[j].z + points[k].z);
+				fNorm.y += (points[j].z - points[k].z) * (points[j].x + points[k].x);
+				fNorm.z += (points[j].x - points[k].x) * (points[j].y + points[k].y);						
+			}*/
+		}
+		else
+		{
+			zVector cross = (points[1] - points[0]) ^ (points[fVerts.size() - 1] - points[0]);
+			cross.normalize();
+
+			fNorm = cross;
+		}
+
+		fNorm.normalize();
+
+		return fNorm;
+	}
+
+	ZSPACE_INLINE zVector zFnMesh::computeVertexNormal(zItMeshVertex &v)
+	{
+		if (!v.isActive()) return zVector();
+
+		//if (v.getHalfEdge().onBoundary()) v.setHalfEdge(v.getHalfEdge().getSym().getNext());
+
+		vector<int> cFaces;
+		v.getConnectedFaces(cFaces);
+
+		zVector norm;
+
+		for (int j = 0; j < cFaces.size(); j++)
+		{
+			norm += meshObj->mesh.faceNormals[cFaces[j]];
+		}
+
+		norm /= cFaces.size();
+		norm.normalize();
+
+		return norm;
+	}
+
+	ZSPACE_INLINE double zFnMesh::computeVertexArea(zItMeshVertex &v, zPointArray *faceCenters, zPointArray *edgeCenters)
+	{
+		double vArea = 0;
+
+		vector<zItMeshHalfEdge> cEdges;
+		v.getConnectedHalfEdges(cEdges);
+
+		for (int j = 0; j < cEdges.size(); j++)
+		{
+			zItMeshHalfEdge cE = cEdges[j];
+			zItMeshHalfEdge nE = cEdges[(j + 1) % cEdges.size()];
+
+			if (cE.onBoundary() || nE.getSym().onBoundary()) continue;
+
+			if (cE.getFace().getId() != nE.getSym().getFace().getId()) continue;
+
+			zVector vPos = meshObj->mesh.vertexPositions[v.getId()];
+			zVector fCen = (faceCenters) ? (*faceCenters)[cE.getFace().getId()] : cE.getFace().getCenter();
+			zVector currentEdge_cen = (edgeCenters) ? (*edgeCenters)[cE.getId()] : cE.getCenter();
+			zVector nextEdge_cen = (edgeCenters) ? (*edgeCenters)[nE.getId()] : nE.getCenter();
+
+			double Area1 = meshObj->mesh.coreUtils.getTriangleArea(vPos, currentEdge_cen, fCen);
+			vArea += (Area1);
+
+			double Area2 = meshObj->mesh.coreUtils.getTriangleArea(vPos, nextEdge_cen, fCen);
+			vArea += (Area2);
+		}
+
+		return vArea;
+	}
+
+	ZSPACE_INLINE void zFnMesh::updateAttributeCaches(int attributes)
+	{
+		int numV = meshObj->mesh.vertices.size();
+		int numF = meshObj->mesh.faces.size();
+
+		int &cached = meshObj->mesh.cachedAttributes;
+
+		// the cache is dropped if the element counts changed
+		if (meshObj->mesh.cachePositions.size() != numV) cached = 0;
+		if ((cached & zCacheNormals) && (meshObj->mesh.faceNormals.size() != numF || meshObj->mesh.vertexNormals.size() != numV)) cached = 0;
+		if ((cached & zCacheFaceAreas) && meshObj->mesh.faceAreas.size() != numF) cached = 0;
+		if ((cached & zCacheVertexAreas) && meshObj->mesh.vertexAreas.size() != numV) cached = 0;
+		if ((cached & zCacheCurvatures) && meshObj->mesh.vertexCurvatures.size() != numV) cached = 0;
+
+		zPoint *positions = meshObj->mesh.vertexPositions.data();
+		zPoint *cachePositions = meshObj->mesh.cachePositions.data();
+
+		// vertices moved since the last update
+		zIntArray movedVertices;
+
+		if (cached != 0)
+		{
+			for (int i = 0; i < numV; i++)
+			{
+				if (positions[i].x != cachePositions[i].x || positions[i].y != cachePositions[i].y || positions[i].z != cachePositions[i].z) movedVertices.push_back(i);
+			}
+
+			// the local update gains nothing if most of the mesh moved
+			if (movedVertices.size() * 4 > numV) cached = 0;
+		}
+
+		if (cached != 0 && movedVertices.size() > 0)
+		{
+			// faces around the moved vertices, and the vertices of those faces
+			zBoolArray faceVisited, vertexVisited;
+			faceVisited.assign(numF, false);
+			vertexVisited.assign(numV, false);
+
+			zIntArray dirtyFaces, dirtyVertices;
+
+			for (int vId : movedVertices)
+			{
+				vertexVisited[vId] = true;
+				dirtyVertices.push_back(vId);
+
+				zItMeshVertex v(*meshObj, vId);
+				if (!v.isActive()) continue;
+
+				zIntArray cFaces;
+				v.getConnectedFaces(cFaces);
+
+				for (int fId : cFaces)
+				{
+					if (faceVisited[fId]) continue;
+
+					faceVisited[fId] = true;
+					dirtyFaces.push_back(fId);
+				}
+			}
+
+			for (int fId : dirtyFaces)
+			{
+				zItMeshFace f(*meshObj, fId);
+
+				zIntArray fVerts;
+				f.getVertices(fVerts);
+
+				for (int vId : fVerts)
+				{
+					if (vertexVisited[vId]) continue;
+
+					vertexVisited[vId] = true;
+					dirtyVertices.push_back(vId);
+				}
+
+				if (cached & zCacheNormals) meshObj->mesh.faceNormals[fId] = computeFaceNormal(f);
+				if (cached & zCacheFaceAreas) meshObj->mesh.faceAreas[fId] = f.getPlanarFaceArea();
+			}
+
+			for (int vId : dirtyVertices)
+			{
+				zItMeshVertex v(*meshObj, vId);
+
+				if (cached & zCacheNormals) meshObj->mesh.vertexNormals[vId] = computeVertexNormal(v);
+				if (cached & zCacheVertexAreas) meshObj->mesh.vertexAreas[vId] = (v.isActive()) ? computeVertexArea(v, nullptr, nullptr) : 0;
+
+				if (cached & zCacheCurvatures)
+				{
+					zCurvature curv;
+					curv.k1 = curv.k2 = -1;
+
+					meshObj->mesh.vertexCurvatures[vId] = (v.isActive()) ? v.getPrincipalCurvature() : curv;
+				}
+			}
+
+			for (int vId : movedVertices) cachePositions[vId] = positions[vId];
+		}
+
+		if (cached == 0) meshObj->mesh.cachePositions.assign(meshObj->mesh.vertexPositions.begin(), meshObj->mesh.vertexPositions.begin() + numV);
+
+		// attributes computed for the whole mesh
+		int missing = attributes & ~cached;
+
+		if (missing & zCacheNormals) computeMeshNormals();
+
+		if (missing & zCacheFaceAreas) getPlanarFaceAreas(meshObj->mesh.faceAreas);
+
+		if (missing & zCacheVertexAreas)
+		{
+			zPointArray fCenters, eCenters;
+			getCenters(zFaceData, fCenters);
+			getCenters(zHalfEdgeData, eCenters);
+
+			getVertexAreas(fCenters, eCenters, meshObj->mesh.vertexAreas);
+		}
+
+		if (missing & zCacheCurvatures)
+		{
+			meshObj->mesh.vertexCurvatures.clear();
+			getPrincipalCurvatures(meshObj->mesh.vertexCurvatures);
+		}
+
+		cached |= attributes;
+	}
+
 	//---- PRIVATE DEACTIVATE AND REMOVE METHODS
 
 	ZSPACE_INLINE void zFnMesh::addToHalfEdgesMap(zItMeshHalfEdge &he)
@@ -7398,6 +8017,8 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMesh::removeInactive(zHEData type)
 	{
+		clearAttributeCaches();
+
 		//  Vertex		
 		if (type == zVertexData)
 		{
@@ -69,35 +69,76 @@ namespace zSpace
 
 		zFnMesh::clear();
 
-		fnParticles.clear();
-		particlesObj.clear();
+		particles.clear();
 	}
 
 	//---- CREATE METHODS
 
 	ZSPACE_INLINE void zFnMeshDynamics::makeDynamic(bool fixBoundary)
 	{
-		fnParticles.clear();
-		particlesObj.clear();
+		zPointArray &positions = meshObj->mesh.vertexPositions;
+		int nV = positions.size();
+
+		particles.create((nV > 0) ? &positions[0] : nullptr, nV);
+
+		// compressed vertex neighbour and vertex face containers, so the forces gather per particle
+		zIntArray neighbourOffsets(1, 0);
+		zIntArray neighbours;
+
+		bool anyFree = false;
 
 		for (zItMeshVertex v(*meshObj); !v.end(); v++)
 		{
+			int i = v.getId();
+
 			bool fixed = false;
 
 			if (fixBoundary) fixed = (v.onBoundary());
 
-			zObjParticle p;
-			p.particle = zParticle(*v.getRawPosition(), fixed);
-			particlesObj.push_back(p);
+			if (v.isActive()) v.getConnectedVertices(neighbours);
+			else fixed = true;
+
+			neighbourOffsets.push_back(neighbours.size());
+
+			particles.setFixed(i, fixed);
 
-			if (!fixed) setVertexColor(zColor(0, 0, 1, 1));
+			if (!fixed) anyFree = true;
 		}
 
-		for (int i = 0; i < particlesObj.size(); i++)
+		// colors all the vertices, so it is set once
+		if (anyFree) setVertexColor(zColor(0, 0, 1, 1));
+
+		particles.setNeighbours(neighbourOffsets, neighbours);
+
+		zIntArray faceOffsets(nV + 1, 0);
+		zIntArray vertexFaces;
+
+		for (zItMeshFace f(*meshObj); !f.end(); f++)
 		{
-			fnParticles.push_back(zFnParticle(particlesObj[i]));
+			if (!f.isActive()) continue;
+
+			zIntArray fVerts;
+			f.getVertices(fVerts);
+
+			for (int v : fVerts) faceOffsets[v + 1]++;
 		}
 
+		for (int i = 0; i < nV; i++) faceOffsets[i + 1] += faceOffsets[i];
+
+		vertexFaces.assign(faceOffsets[nV], -1);
+		zIntArray fill(faceOffsets.begin(), faceOffsets.end() - 1);
+
+		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		{
+			if (!f.isActive()) continue;
+
+			zIntArray fVerts;
+			f.getVertices(fVerts);
+
+			for (int v : fVerts) vertexFaces[fill[v]++] = f.getId();
+		}
+
+		particles.setFaces(faceOffsets, vertexFaces);
 	}
 
 	ZSPACE_INLINE void zFnMeshDynamics::create(zObjMesh &_meshObj, bool fixBoundary)
@@ -111,10 +152,7 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnMeshDynamics::addGravityForce(zVector grav)
 	{
-		for (int i = 0; i < fnParticles.size(); i++)
-		{
-			fnParticles[i].addForce(grav);
-		}
+		particles.addForce(grav);
 	}
 
 	ZSPACE_INLINE void zFnMeshDynamics::addEdgeForce(const zDoubleArray &weights)
@@ -122,41 +160,7 @@ namespace zSpace
 
 		if (weights.size() > 0 && weights.size() != meshObj->mesh.vertices.size()) throw std::invalid_argument("cannot apply edge force.");
 
-		for (zItMeshVertex v(*meshObj); !v.end(); v++)
-		{
-			int i = v.getId();
-
-			if (v.isActive())
-			{
-				if (fnParticles[i].getFixed()) continue;
-
-				vector<zItMeshHalfEdge> cEdges;
-				v.getConnectedHalfEdges(cEdges);
-
-				zVector eForce;
-
-				for (auto &he : cEdges)
-				{
-
-
-					int v1 = he.getVertex().getId();
-					zVector e = meshObj->mesh.vertexPositions[v1] - meshObj->mesh.vertexPositions[i];
-
-					double len = e.length();
-					e.normalize();
-
-					if (weights.size() > 0) e *= weights[i];
-
-					eForce += (e * len);
-				}
-
-				fnParticles[i].addForce(eForce);
-
-			}
-			else  fnParticles[i].setFixed(true);;
-
-		}
-
+		particles.addEdgeForce(weights);
 	}
 
 	ZSPACE_INLINE void zFnMeshDynamics::addPlanarityForce(vector<double> &fVolumes, vector<zVector> fCenters, double tolerance)
@@ -164,46 +168,16 @@ namespace zSpace
 		if (fVolumes.size() != meshObj->mesh.faces.size()) throw std::invalid_argument("sizes of face Volumes and mesh faces dont match.");
 		if (fCenters.size() != meshObj->mesh.faces.size()) throw std::invalid_argument("sizes of face Centers and mesh faces dont match.");
 
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
-		{
-			int i = f.getId();
-
-			if (f.isActive() && fVolumes[i] > tolerance)
-			{
-				vector<int> fVerts;
-				f.getVertices(fVerts);
-
-				vector<zVector> fVertPositions;
-				f.getVertexPositions(fVertPositions);
-
-				zVector fNormal = meshObj->mesh.faceNormals[i];
-
-				for (int j = 0; j < fVertPositions.size(); j++)
-				{
-					if (fnParticles[fVerts[j]].getFixed()) continue;
-
-					double dist = meshObj->mesh.coreUtils.minDist_Point_Plane(fVertPositions[j], fCenters[i], fNormal);
-
-					zVector pForce = fNormal * dist * -1.0;
-					fnParticles[fVerts[j]].addForce(pForce);
-
-				}
-			}
-
-		}
+		particles.addPlanarityForce(meshObj->mesh.faceNormals, fCenters, fVolumes, tolerance);
 	}
 
 	//---- UPDATE METHODS 
 
 	ZSPACE_INLINE void zFnMeshDynamics::update(double dT, zIntergrationType type, bool clearForce, bool clearVelocity, bool clearDerivatives)
 	{
-		for (int i = 0; i < fnParticles.size(); i++)
-		{
-			fnParticles[i].integrateForces(dT, type);
-			fnParticles[i].updateParticle(clearForce, clearVelocity, clearDerivatives);
-		}
+		particles.update(dT, type, clearForce, clearVelocity, clearDerivatives);
 
-		computeMeshNormals();
+		updateMeshNormals();
 	}
 
 }
\ No newline at end of file
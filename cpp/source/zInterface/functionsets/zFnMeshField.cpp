@@ -13,6 +13,10 @@
 
 #include<headers/zInterface/functionsets/zFnMeshField.h>
 
+#ifdef ZSPACE_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace zSpace
 {
 
@@ -63,6 +67,7 @@ namespace zSpace
 
 		else if (type == zOBJ) fnMesh.from(path, type, true);
 		else if (type == zJSON) fnMesh.from(path, type, true);
+		else if (type == zBIN) fromBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 
@@ -78,6 +83,7 @@ namespace zSpace
 
 		if (type == zOBJ) fnMesh.from(path, type, true);
 		else if (type == zJSON) fnMesh.from(path, type, true);
+		else if (type == zBIN) fromBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 
@@ -91,6 +97,7 @@ namespace zSpace
 		if (type == zBMP) toBMP(path);
 		else if (type == zOBJ) fnMesh.to(path, type);
 		else if (type == zJSON) fnMesh.to(path, type);
+		else if (type == zBIN) toBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -100,6 +107,7 @@ namespace zSpace
 	{
 		if (type == zOBJ) fnMesh.to(path, type);
 		else if (type == zJSON) fnMesh.to(path, type);
+		else if (type == zBIN) toBIN(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -130,6 +138,7 @@ namespace zSpace
 		setValuesperVertex = _setValuesperVertex;
 		if (!_setValuesperVertex) _triMesh = false;
 		triMesh = _triMesh;
+		numNeighbourRings = _NR;
 
 
 		fieldObj->field = zField2D<zScalar>(_minBB, _maxBB, _n_X, _n_Y);
@@ -167,6 +176,7 @@ namespace zSpace
 		setValuesperVertex = _setValuesperVertex;
 		if (!_setValuesperVertex) _triMesh = false;
 		triMesh = _triMesh;
+		numNeighbourRings = _NR;
 
 
 		fieldObj->field = zField2D<zVector>(_minBB, _maxBB, _n_X, _n_Y);
@@ -204,6 +214,7 @@ namespace zSpace
 		setValuesperVertex = _setValuesperVertex;
 		if (!_setValuesperVertex) _triMesh = false;
 		triMesh = _triMesh;
+		numNeighbourRings = _NR;
 
 		fieldObj->field = zField2D<zScalar>(_unit_X, _unit_Y, _n_X, _n_Y, _minBB);
 		fieldObj->field.valuesperVertex = setValuesperVertex;
@@ -238,6 +249,7 @@ namespace zSpace
 		setValuesperVertex = _setValuesperVertex;
 		if (!_setValuesperVertex) _triMesh = false;
 		triMesh = _triMesh;
+		numNeighbourRings = _NR;
 
 		fieldObj->field = zField2D<zVector>(_unit_X, _unit_Y, _n_X, _n_Y, _minBB);
 		fieldObj->field.valuesperVertex = setValuesperVertex;
@@ -689,6 +701,7 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE bool zFnMeshField<zScalar>::getFieldValue(zPoint &samplePos, zFieldValueType type, zScalar& fieldValue)
 	{
+		if (type == zFieldNearest || type == zFieldLinear) return sampleFieldValue(samplePos, type, fieldValue);
 
 		bool out = false;
 
@@ -811,6 +824,7 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE bool zFnMeshField<zVector>::getFieldValue(zPoint &samplePos, zFieldValueType type, zVector& fieldValue)
 	{
+		if (type == zFieldNearest || type == zFieldLinear) return sampleFieldValue(samplePos, type, fieldValue);
 
 		bool out = false;
 
@@ -1123,6 +1137,116 @@ namespace zSpace
 		return out;
 	}
 
+	//---- SAMPLE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::sampleFieldValue(zPoint &samplePos, zFieldValueType type, T &fieldValue)
+	{
+		float fX, fY;
+		bool out = getSampleCoordinates(samplePos, fX, fY);
+
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		T *values = fieldObj->field.fieldValues.data();
+
+		if (type == zFieldIndex)
+		{
+			fieldValue = values[std::min((int)fX, n_X - 1) * n_Y + std::min((int)fY, n_Y - 1)];
+		}
+
+		else if (type == zFieldNearest)
+		{
+			fieldValue = values[(int)(fX + 0.5f) * n_Y + (int)(fY + 0.5f)];
+		}
+
+		else if (type == zFieldLinear)
+		{
+			if (n_X < 2 || n_Y < 2) throw std::invalid_argument(" error: zFieldLinear needs at least 2 field values in X and Y.");
+
+			int iX = std::min((int)fX, n_X - 2);
+			int iY = std::min((int)fY, n_Y - 2);
+
+			float tX = fX - iX;
+			float tY = fY - iY;
+
+			int id = iX * n_Y + iY;
+
+			T v0 = values[id] + (values[id + n_Y] - values[id]) * tX;
+			T v1 = values[id + 1] + (values[id + n_Y + 1] - values[id + 1]) * tX;
+
+			fieldValue = v0 + (v1 - v0) * tY;
+		}
+
+		else throw std::invalid_argument(" error: invalid zFieldValueType.");
+
+		return out;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, vector<T> &fieldValues)
+	{
+		fieldValues.resize(samplePositions.size());
+
+		zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++) sampleFieldValue(samplePositions[i], type, fieldValues[i]);
+		}, 4096);
+	}
+
+	//---- zScalar specilization for sampleFieldValues
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, zScalarArray &fieldValues)
+	{
+		fieldValues.resize(samplePositions.size());
+		if (samplePositions.size() == 0) return;
+
+		if (type == zFieldLinear)
+		{
+			if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2) throw std::invalid_argument(" error: zFieldLinear needs at least 2 field values in X and Y.");
+
+			zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+			{
+				sampleLinear(&samplePositions[start], end - start, &fieldValues[start], nullptr);
+			}, 4096);
+		}
+		else
+		{
+			zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+			{
+				for (int i = start; i < end; i++) sampleFieldValue(samplePositions[i], type, fieldValues[i]);
+			}, 4096);
+		}
+	}
+
+	//---- zScalar specilization for sampleGradient
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::sampleGradient(zPoint &samplePos, zVector &gradient)
+	{
+		if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2) throw std::invalid_argument(" error: gradient needs at least 2 field values in X and Y.");
+
+		float fX, fY;
+		bool out = getSampleCoordinates(samplePos, fX, fY);
+
+		sampleLinear(&samplePos, 1, nullptr, &gradient);
+
+		return out;
+	}
+
+	//---- zScalar specilization for sampleGradients
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleGradients(zPointArray &samplePositions, zVectorArray &gradients)
+	{
+		gradients.resize(samplePositions.size());
+		if (samplePositions.size() == 0) return;
+
+		if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2) throw std::invalid_argument(" error: gradient needs at least 2 field values in X and Y.");
+
+		zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+		{
+			sampleLinear(&samplePositions[start], end - start, nullptr, &gradients[start]);
+		}, 4096);
+	}
+
 	template<typename T>
 	ZSPACE_INLINE bool zFnMeshField<T>::getValuesPerVertexBoolean()
 	{
@@ -1190,43 +1314,11 @@ namespace zSpace
 	//----  2D IDW FIELD METHODS
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = meshValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW_Nearest(fieldValues, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), meshValue, influence, power, influenceRadius);
 
 		if (normalise)
 		{
@@ -1236,45 +1328,11 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise )
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
-
 		zFnGraph inFngraph(inGraphObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFngraph.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFngraph.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = graphValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-
-
-		}
+		computeIDW_Nearest(fieldValues, inFngraph.getRawVertexPositions(), inFngraph.numVertices(), graphValue, influence, power, influenceRadius);
 
 		if (normalise)
 		{
@@ -1285,39 +1343,14 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise, double influenceRadius)
 	{
-
-		fieldValues.clear();
 		zFnPointCloud fnPoints(inPointsObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
+		vector<T> values(fnPoints.numVertices(), value);
+		zDoubleArray influences(fnPoints.numVertices(), influence);
 
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, fnPoints.getRawVertexPositions(), fnPoints.numVertices(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -1326,41 +1359,14 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
 		zFnPointCloud fnPoints(inPointsObj);
 
 		if (fnPoints.numVertices() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (fnPoints.numVertices() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, fnPoints.getRawVertexPositions(), fnPoints.numVertices(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -1369,39 +1375,12 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise, double influenceRadius)
 	{
+		vector<T> values(inPositions.size(), value);
+		zDoubleArray influences(inPositions.size(), influence);
 
-		fieldValues.clear();
-
-
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inPositions.data(), inPositions.size(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -1410,38 +1389,12 @@ namespace zSpace
 	}
 	
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, zDoubleArray& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, zDoubleArray& influences, double power, bool normalise, double influenceRadius)
 	{
 		if (inPositions.size() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inPositions.size() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)	d /= wSum;			
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inPositions.data(), inPositions.size(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -1462,28 +1415,19 @@ namespace zSpace
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
 
+		distVals.assign(fnMesh.numVertices(), 100000000);
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			distVals.push_back(100000000);
-		}
+		zKdTree tree;
+		tree.build(inPositions);
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 		{
-			for (int j = 0; j < inPositions.size(); j++)
+			for (int i = start; i < end; i++)
 			{
-
-
-				double dist = meshPositions[i].squareDistanceTo(inPositions[j]);
-
-
-
-				if (dist < distVals[i])
-				{
-					distVals[i] = dist;
-				}
+				float dist;
+				if (tree.getNearest(meshPositions[i], dist) != -1 && dist < distVals[i]) distVals[i] = dist;
 			}
-		}
+		});
 
 		dMin = coreUtils.zMin(distVals);
 		dMax = coreUtils.zMax(distVals);
@@ -1507,32 +1451,7 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zPointArray &inPositions, float offset, bool normalise)
 	{
-		scalars.clear();;
-
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, inPositions.data(), inPositions.size(), offset);
 
 		if (normalise)
 		{
@@ -1554,27 +1473,20 @@ namespace zSpace
 		double dMax = 0;;
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			distVals.push_back(10000);
-		}
+		distVals.assign(fnMesh.numVertices(), 10000);
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zKdTree tree;
+		tree.build(fnPoints.getRawVertexPositions(), fnPoints.numVertices());
+
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 		{
-			for (int j = 0; j < fnPoints.numVertices(); j++)
+			for (int i = start; i < end; i++)
 			{
-
-
-				double dist = meshPositions[i].squareDistanceTo(inPositions[j]);
-
-				if (dist < distVals[j])
-				{
-					distVals[j] = dist;
-				}
+				float dist;
+				if (tree.getNearest(meshPositions[i], dist) != -1 && dist < distVals[i]) distVals[i] = dist;
 			}
-		}
+		});
 
 		for (int i = 0; i < distVals.size(); i++)
 		{
@@ -1600,35 +1512,9 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, float offset,  bool normalise)
 	{
-		scalars.clear();;
-
 		zFnPointCloud fnPoints(inPointsObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, fnPoints.getRawVertexPositions(), fnPoints.numVertices(), offset);
 
 		if (normalise)
 		{
@@ -1641,36 +1527,9 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjMesh &inMeshObj, float offset,  bool normalise)
 	{
-		scalars.clear();
-
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), offset);
 
 		if (normalise)
 		{
@@ -1683,36 +1542,9 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjGraph &inGraphObj, float offset, bool normalise)
 	{
-		scalars.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-
-		// update values from meta balls
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnGraph.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), offset);
 
 		if (normalise)
 		{
@@ -1728,37 +1560,37 @@ namespace zSpace
 		zFnMesh inFnMesh(inMeshObj);
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
 
-		// update values from edge distance
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zIntArray edgeVertices;
+		edgeVertices.reserve(inFnMesh.numEdges() * 2);
+
+		for (zItMeshEdge e(inMeshObj); !e.end(); e++)
 		{
-			double d = 0.0;
-			double tempDist = 10000;
+			edgeVertices.push_back(e.getHalfEdge(0).getVertex().getId());
+			edgeVertices.push_back(e.getHalfEdge(0).getStartVertex().getId());
+		}
 
-			for (zItMeshEdge e(inMeshObj); !e.end(); e++)
-			{
+		zBVH bvh;
+		bvh.buildEdges(inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), edgeVertices);
 
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
+		scalars.assign(fnMesh.numVertices(), 0.0);
 
+		// update values from edge distance
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				double dist;
 				zVector closestPt;
 
-				float r = coreUtils.minDist_Edge_Point(meshPositions[i], inPositions[e0], inPositions[e1], closestPt);
+				if (bvh.getNearest(meshPositions[i], dist, closestPt) == -1) continue;
 
+				float r = dist;
 				r = r - offset;
 
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
+				if (r < 10000) scalars[i] = r;
 			}
-
-			scalars.push_back(d);
-
-		}
+		});
 
 		if (normalise)
 		{
@@ -1776,38 +1608,38 @@ namespace zSpace
 		zFnGraph inFnGraph(inGraphObj);
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-				
-		// update values from edge distance
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
 
-			for (zItGraphEdge e(inGraphObj); !e.end(); e++)
-			{
+		zIntArray edgeVertices;
+		edgeVertices.reserve(inFnGraph.numEdges() * 2);
 
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
+		for (zItGraphEdge e(inGraphObj); !e.end(); e++)
+		{
+			if (e.getLength() < EPS) continue;
 
-				if (e.getLength() < EPS) continue;
+			edgeVertices.push_back(e.getHalfEdge(0).getVertex().getId());
+			edgeVertices.push_back(e.getHalfEdge(0).getStartVertex().getId());
+		}
 
+		zBVH bvh;
+		bvh.buildEdges(inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), edgeVertices);
+
+		scalars.assign(fnMesh.numVertices(), 0.0);
+				
+		// update values from edge distance
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				double r;
 				zVector closestPt;
 
-				double r = coreUtils.minDist_Edge_Point(meshPositions[i], inPositions[e0], inPositions[e1], closestPt);
+				if (bvh.getNearest(meshPositions[i], r, closestPt) == -1) continue;
 
 				r = r - offset;
 
-				if (r < tempDist)
-				{
-					d = r;					
-					tempDist = r;
-				}
+				if (r < 10000) scalars[i] = r;
 			}
-
-			scalars.push_back(d);
-
-		}
+		});
 
 		if (normalise)
 		{
@@ -5569,10 +5401,10 @@ namespace zSpace
 		zVector* meshPositions = fnMesh.getRawVertexPositions();
 		zVector* inPositions = inFnGraph.getRawVertexPositions();
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 		{
-			scalars[i] = getScalar_Polygon(inGraphObj, meshPositions[i]) ;
-		}
+			for (int i = start; i < end; i++) scalars[i] = getScalar_Polygon(inGraphObj, meshPositions[i]);
+		});
 
 		if (normalise)
 		{
@@ -5591,11 +5423,14 @@ namespace zSpace
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 		{
-			if (annularVal == 0) scalars[i] = getScalar_Circle(cen, meshPositions[i], r);
-			else scalars[i] = abs(getScalar_Circle(cen, meshPositions[i], r) - annularVal);
-		}
+			for (int i = start; i < end; i++)
+			{
+				if (annularVal == 0) scalars[i] = getScalar_Circle(cen, meshPositions[i], r);
+				else scalars[i] = abs(getScalar_Circle(cen, meshPositions[i], r) - annularVal);
+			}
+		});
 
 		if (normalise) normliseValues(scalars);
 	}
@@ -5627,11 +5462,14 @@ namespace zSpace
 
 		zVector *meshPositions = fnMesh.getRawVertexPositions();
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 		{
-			if (annularVal == 0) scalars[i] = getScalar_Line(meshPositions[i], v0, v1);
-			else scalars[i] = abs(getScalar_Line(meshPositions[i], v0, v1) - annularVal);
-		}
+			for (int i = start; i < end; i++)
+			{
+				if (annularVal == 0) scalars[i] = getScalar_Line(meshPositions[i], v0, v1);
+				else scalars[i] = abs(getScalar_Line(meshPositions[i], v0, v1) - annularVal);
+			}
+		});
 
 		if (normalise) normliseValues(scalars);
 	}
@@ -5850,73 +5688,34 @@ namespace zSpace
 		zDomainFloat inNeg(d.min, 0.0);
 		zDomainFloat inPos(0.0, d.max);
 
-		for (int i = 0; i < fieldValues.size(); i++)
-		{
-			if(fieldValues[i] < 0) fieldValues[i] = coreUtils.ofMap(fieldValues[i], inNeg, outNeg);
-			else fieldValues[i] = coreUtils.ofMap(fieldValues[i], inPos, outPos);
-		}*/
-	}
-
-	template<>
-	ZSPACE_INLINE void zFnMeshField<zVector>::normliseValues(vector<zVector> &fieldValues)
-	{
-		for (int i = 0; i < fieldValues.size(); i++) fieldValues[i].normalize();
-	}
-
-	//---- zScalar specilization for smoothField
-
-	template<>
-	ZSPACE_INLINE void zFnMeshField<zScalar>::smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp, zDiffusionType type)
-	{
-		for (int k = 0; k < numSmooth; k++)
-		{
-			zScalarArray tempValues;
-
-			for( zItMeshScalarField s(*fieldObj); !s.end(); s++)			
-			{
-				float lapA = 0;
-
-				vector<zItMeshScalarField> ringNeigbours;
-				s.getNeighbour_Ring( 1, ringNeigbours);
-
-				for (int j = 0; j < ringNeigbours.size(); j++)
-				{
-					int id = ringNeigbours[j].getId();
-					zScalar val = scalars[id]/*ringNeigbours[j].getValue()*/;
-					
-					if (type == zLaplacian)
-					{
-						if (id != s.getId()) lapA += (val * 1);
-						else lapA += (val * -8);
-					}
-					else if (type == zAverage)
-					{
-						lapA += (val * 1);
-					}
-				}
-
-
-
-				if (type == zLaplacian)
-				{
-					float val1 = scalars[s.getId()]/*s.getValue()*/;
-					
-					float newA = val1 + (lapA * diffuseDamp);
-					tempValues.push_back(newA);
-				}
-				else if (type == zAverage)
-				{
-					if (lapA != 0) lapA /= (ringNeigbours.size());
-
-					tempValues.push_back(lapA);
-				}
+		for (int i = 0; i < fieldValues.size(); i++)
+		{
+			if(fieldValues[i] < 0) fieldValues[i] = coreUtils.ofMap(fieldValues[i], inNeg, outNeg);
+			else fieldValues[i] = coreUtils.ofMap(fieldValues[i], inPos, outPos);
+		}*/
+	}
 
-			}
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::normliseValues(vector<zVector> &fieldValues)
+	{
+		for (int i = 0; i < fieldValues.size(); i++) fieldValues[i].normalize();
+	}
+
+	//---- zScalar specilization for smoothField
 
-			//setFieldValues(tempValues);
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp, zDiffusionType type, int numRings)
+	{
+		if (scalars.size() != numFieldValues()) throw std::invalid_argument(" error: scalars size not equal to number of field values.");
+		if (numSmooth <= 0 || scalars.size() == 0) return;
 
-			scalars = tempValues;
+		// ping-pong between the input and the scratch buffer
+		diffusionBuffer.resize(scalars.size());
 
+		for (int k = 0; k < numSmooth; k++)
+		{
+			computeDiffusion(&scalars[0], &diffusionBuffer[0], numRings, diffuseDamp, type);
+			scalars.swap(diffusionBuffer);
 		}
 
 		//updateColors();
@@ -6019,11 +5818,12 @@ namespace zSpace
 	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_union(zScalarArray& scalars0, zScalarArray& scalars1, zScalarArray& scalarsResult, bool normalise)
 	{
 		vector<float> out;
+		out.assign(scalars0.size(), 0.0);
 
-		for (int i = 0; i < scalars0.size(); i++)
+		zThreadPool::getGlobal().parallel_for(0, scalars0.size(), [&](int start, int end)
 		{
-			out.push_back(coreUtils.zMin(scalars0[i], scalars1[i]));
-		}
+			for (int i = start; i < end; i++) out[i] = coreUtils.zMin(scalars0[i], scalars1[i]);
+		});
 
 		if (normalise) normliseValues(out);
 
@@ -6034,11 +5834,12 @@ namespace zSpace
 	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_subtract(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise)
 	{
 		vector<float> out;
+		out.assign(fieldValues_A.size(), 0.0);
 
-		for (int i = 0; i < fieldValues_A.size(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fieldValues_A.size(), [&](int start, int end)
 		{
-			out.push_back(coreUtils.zMax(fieldValues_A[i], -1 * fieldValues_B[i]));
-		}
+			for (int i = start; i < end; i++) out[i] = coreUtils.zMax(fieldValues_A[i], -1 * fieldValues_B[i]);
+		});
 
 		if (normalise) normliseValues(out);
 
@@ -6049,11 +5850,12 @@ namespace zSpace
 	ZSPACE_INLINE void zFnMeshField<zScalar>::boolean_intersect(zScalarArray& fieldValues_A, zScalarArray& fieldValues_B, zScalarArray& fieldValues_Result, bool normalise)
 	{
 		vector<float> out;
+		out.assign(fieldValues_A.size(), 0.0);
 
-		for (int i = 0; i < fieldValues_A.size(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fieldValues_A.size(), [&](int start, int end)
 		{
-			out.push_back(coreUtils.zMax(fieldValues_A[i], fieldValues_B[i]));
-		}
+			for (int i = start; i < end; i++) out[i] = coreUtils.zMax(fieldValues_A[i], fieldValues_B[i]);
+		});
 
 		if (normalise) normliseValues(out);
 
@@ -6149,25 +5951,33 @@ namespace zSpace
 				if (fnMesh.numPolygons() == scalars.size())
 				{
 					contourVertexValues.clear();
+					contourVertexValues.assign(fnMesh.numVertices(), 0.0);
 
 					fnMesh.computeVertexColorfromFaceColor();
 
-					for (zItMeshVertex v(*fieldObj); !v.end(); v++)
+					zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 					{
-						vector<int> cFaces;
-						v.getConnectedFaces(cFaces);
+						zIntArray cFaces;
 
-						double val;
-
-						for (int j = 0; j < cFaces.size(); j++)
+						for (int i = start; i < end; i++)
 						{
-							val += scalars[cFaces[j]];
-						}
+							cFaces.clear();
 
-						val /= cFaces.size();
+							zItMeshVertex v(*fieldObj, i);
+							v.getConnectedFaces(cFaces);
 
-						contourVertexValues.push_back(val);
-					}
+							double val = 0;
+
+							for (int j = 0; j < cFaces.size(); j++)
+							{
+								val += scalars[cFaces[j]];
+							}
+
+							val /= cFaces.size();
+
+							contourVertexValues[i] = val;
+						}
+					});
 
 					computeDomain(contourVertexValues, contourValueDomain);
 
@@ -6197,76 +6007,87 @@ namespace zSpace
 				zColor* cols = fnMesh.getRawVertexColors();
 				if (fnMesh.numPolygons() == scalars.size()) cols = fnMesh.getRawFaceColors();
 
-				for (int i = 0; i < scalars.size(); i++)
+				zThreadPool::getGlobal().parallel_for(0, scalars.size(), [&](int start, int end)
 				{
-					// SLIME
-					if (scalars[i] < contourValueDomain.min) cols[i] = fieldColorDomain.min;
-					else if (scalars[i] > contourValueDomain.max) cols[i] = fieldColorDomain.max;
-					else
+					for (int i = start; i < end; i++)
 					{
-						cols[i] = coreUtils.blendColor(scalars[i], contourValueDomain, fieldColorDomain, zHSV);
-					}					
+						// SLIME
+						if (scalars[i] < contourValueDomain.min) cols[i] = fieldColorDomain.min;
+						else if (scalars[i] > contourValueDomain.max) cols[i] = fieldColorDomain.max;
+						else
+						{
+							cols[i] = coreUtils.blendColor(scalars[i], contourValueDomain, fieldColorDomain, zHSV);
+						}					
 
 
-					// SDFs
-					//if (scalars[i] < -0.01)
-					//{
-					//	//temp = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
+						// SDFs
+						//if (scalars[i] < -0.01)
+						//{
+						//	//temp = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
 
-					//	cols[i] = zColor(0, 0.550, 0.950, 1);
-					//}
-					//else if (scalars[i] > 0.01)
-					//{
+						//	cols[i] = zColor(0, 0.550, 0.950, 1);
+						//}
+						//else if (scalars[i] > 0.01)
+						//{
 
-					//	cols[i] = zColor(0.25, 0.25, 0.25, 1) /*dCol.max*/;
-					//}
-					//else cols[i] = zColor(0.950, 0, 0.55, 1);;
+						//	cols[i] = zColor(0.25, 0.25, 0.25, 1) /*dCol.max*/;
+						//}
+						//else cols[i] = zColor(0.950, 0, 0.55, 1);;
 
-					//OTHER
-					//if (scalars[i] < -0.005)
-					//{
-					//	zDomainColor dCol(zColor(324, 0.0, 1), zColor(324, 0.0, 0.4));
-					//	zDomainFloat dVal(contourValueDomain.min, -0.005);
+						//OTHER
+						//if (scalars[i] < -0.005)
+						//{
+						//	zDomainColor dCol(zColor(324, 0.0, 1), zColor(324, 0.0, 0.4));
+						//	zDomainFloat dVal(contourValueDomain.min, -0.005);
 
-					//	//cols[i] = zColor(1, 0, 0, 1);
+						//	//cols[i] = zColor(1, 0, 0, 1);
 
-					//	cols[i] = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
-					//}
-					//else if (scalars[i] > 0.005)
-					//{
+						//	cols[i] = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
+						//}
+						//else if (scalars[i] > 0.005)
+						//{
 
-					//	zDomainColor dCol(zColor(150, 0.0, 0.4), zColor(150, 0, 1));
-					//	zDomainFloat dVal(0.005, contourValueDomain.max);
+						//	zDomainColor dCol(zColor(150, 0.0, 0.4), zColor(150, 0, 1));
+						//	zDomainFloat dVal(0.005, contourValueDomain.max);
 
-					//	//cols[i] = zColor(0, 1, 0, 1);
+						//	//cols[i] = zColor(0, 1, 0, 1);
 
-					//	cols[i] = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
-					//}
-					//else cols[i] = zColor(324, 1, 1);
-				}
+						//	cols[i] = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
+						//}
+						//else cols[i] = zColor(324, 1, 1);
+					}
+				});
 
 				if (fnMesh.numPolygons() == scalars.size())
 				{
 					contourVertexValues.clear();
+					contourVertexValues.assign(fnMesh.numVertices(), 0.0);
 
 					fnMesh.computeVertexColorfromFaceColor();
 
-					for (zItMeshVertex v(*fieldObj); !v.end(); v++)
+					zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
 					{
-						vector<int> cFaces;
-						v.getConnectedFaces(cFaces);
-
-						double val;
+						zIntArray cFaces;
 
-						for (int j = 0; j < cFaces.size(); j++)
+						for (int i = start; i < end; i++)
 						{
-							val += scalars[cFaces[j]];
-						}
+							cFaces.clear();
 
-						val /= cFaces.size();
+							zItMeshVertex v(*fieldObj, i);
+							v.getConnectedFaces(cFaces);
 
-						contourVertexValues.push_back(val);
-					}
+							double val = 0;
+
+							for (int j = 0; j < cFaces.size(); j++)
+							{
+								val += scalars[cFaces[j]];
+							}
+
+							val /= cFaces.size();
+
+							contourVertexValues[i] = val;
+						}
+					});
 
 					computeDomain(contourVertexValues, contourValueDomain);
 
@@ -6418,17 +6239,17 @@ namespace zSpace
 		vector<zVector>positions;
 		vector<int>polyConnects;
 		vector<int>polyCounts;
-
-		unordered_map <string, int> positionVertex;
+		zColorArray colors;
 
 		float threshold = inThreshold; /*coreUtils.ofMap(inThreshold, 0.0f, 1.0f, contourValueDomain.min, contourValueDomain.max)*/;
 
-
-		for (zItMeshFace f(*fieldObj); !f.end(); f++)
+		vector<zIsoContourBuffer> buffers;
+		zIsoContourBuffer::compute(*fieldObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 		{
-			//printf("\n %i ", f.getId());
-			getIsolinePoly(f, positions, polyConnects, polyCounts, positionVertex, threshold, invertMesh);
-		}
+			getIsolinePoly(f, contour, threshold, invertMesh);
+		});
+
+		zIsoContourBuffer::merge(buffers, positions, polyConnects, polyCounts, colors);
 
 
 		tempFn.create(positions, polyCounts, polyConnects);;
@@ -6454,8 +6275,7 @@ namespace zSpace
 		vector<zVector>positions;
 		vector<int>polyConnects;
 		vector<int>polyCounts;
-
-		unordered_map <string, int> positionVertex;
+		zColorArray colors;
 
 		float thresholdLow = coreUtils.ofMap(inThresholdLow, 0.0f, 1.0f, contourValueDomain.min, contourValueDomain.max);
 		float thresholdHigh = coreUtils.ofMap(inThresholdHigh, 0.0f, 1.0f, contourValueDomain.min, contourValueDomain.max);
@@ -6481,10 +6301,16 @@ namespace zSpace
 
 		if (!invertMesh)
 		{
-			for (zItMeshFace f(*fieldObj); !f.end(); f++)
+			float bandLow = (thresholdLow < thresholdHigh) ? thresholdLow : thresholdHigh;
+			float bandHigh = (thresholdLow < thresholdHigh) ? thresholdHigh : thresholdLow;
+
+			vector<zIsoContourBuffer> buffers;
+			zIsoContourBuffer::compute(*fieldObj, buffers, [&](zItMeshFace &f, zIsoContourBuffer &contour)
 			{
-				getIsobandPoly(f, positions, polyConnects, polyCounts, positionVertex, (thresholdLow < thresholdHigh) ? thresholdLow : thresholdHigh, (thresholdLow < thresholdHigh) ? thresholdHigh : thresholdLow);
-			}
+				getIsobandPoly(f, contour, bandLow, bandHigh);
+			}, &contourVertexValues, bandLow, bandHigh);
+
+			zIsoContourBuffer::merge(buffers, positions, polyConnects, polyCounts, colors);
 
 			tempFn.create(positions, polyCounts, polyConnects);;
 
@@ -6608,6 +6434,43 @@ namespace zSpace
 		updateColors();
 	}
 
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::toBIN(string outfilename)
+	{
+		// minBB, maxBB, n_X, n_Y, neighbour rings, values per vertex, triangulated mesh
+		zDoubleArray grid = { fieldObj->field.minBB.x, fieldObj->field.minBB.y, fieldObj->field.minBB.z,
+			fieldObj->field.maxBB.x, fieldObj->field.maxBB.y, fieldObj->field.maxBB.z,
+			(double)fieldObj->field.n_X, (double)fieldObj->field.n_Y, (double)numNeighbourRings,
+			(setValuesperVertex) ? 1.0 : 0.0, (triMesh) ? 1.0 : 0.0 };
+
+		zUtilsBinaryWriter binFile;
+
+		binFile.addBlock(zBinFieldGrid, grid);
+		binFile.addBlock(zBinFieldValues, fieldObj->field.fieldValues);
+
+		binFile.write(outfilename, zMeshFieldFn);
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::fromBIN(string infilename)
+	{
+		zUtilsBinaryReader binFile;
+		if (!binFile.open(infilename)) return;
+
+		if (binFile.getObjectType() != zMeshFieldFn) throw std::invalid_argument(" error: " + infilename + " does not contain a mesh field.");
+
+		zDoubleArray grid;
+		binFile.getBlock(zBinFieldGrid, grid);
+		if (grid.size() != 11) throw std::invalid_argument(" error: invalid field grid in " + infilename);
+
+		vector<T> values;
+		binFile.getBlock(zBinFieldValues, values);
+
+		create(zPoint(grid[0], grid[1], grid[2]), zPoint(grid[3], grid[4], grid[5]), (int)grid[6], (int)grid[7], (int)grid[8], grid[9] != 0.0, grid[10] != 0.0);
+
+		setFieldValues(values);
+	}
+
 	template<typename T>
 	ZSPACE_INLINE void zFnMeshField<T>::createFieldMesh()
 	{
@@ -6694,6 +6557,245 @@ namespace zSpace
 		printf("\n fieldmesh: v %i e %i f %i", fnMesh.numVertices(), fnMesh.numEdges(), fnMesh.numPolygons());
 	}
 
+	//---- PROTECTED DISTANCE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeIDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, vector<T> &values, zDoubleArray &influences, double power, double influenceRadius)
+	{
+		fieldValues.assign(fnMesh.numVertices(), T());
+
+		zVector *meshPositions = fnMesh.getRawVertexPositions();
+
+		zKdTree tree;
+		if (influenceRadius > 0) tree.build(inPositions, numInPositions);
+
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
+		{
+			zIntArray inRadius;
+
+			for (int i = start; i < end; i++)
+			{
+				T d = T();
+				double wSum = 0.0;
+
+				int n = numInPositions;
+				if (influenceRadius > 0)
+				{
+					tree.getWithinRadius(meshPositions[i], influenceRadius, inRadius);
+					n = inRadius.size();
+				}
+
+				for (int k = 0; k < n; k++)
+				{
+					int j = (influenceRadius > 0) ? inRadius[k] : k;
+
+					double r = meshPositions[i].distanceTo(inPositions[j]);
+
+					double w = pow(r, power);
+					wSum += w;
+
+					double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;
+
+					d += (values[j] * val);
+				}
+
+				if (wSum > 0) d /= wSum;
+				else d = T();
+
+				fieldValues[i] = d;
+			}
+		});
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeIDW_Nearest(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T value, double influence, double power, double influenceRadius)
+	{
+		fieldValues.assign(fnMesh.numVertices(), T());
+
+		zVector *meshPositions = fnMesh.getRawVertexPositions();
+
+		// bounding boxes of blocks of consecutive input positions, as the weights depend on the order of the positions
+		int blockSize = 64;
+		vector<zKdNode> blocks;
+
+		for (int start = 0; start < numInPositions; start += blockSize)
+		{
+			zKdNode block;
+			block.start = start;
+			block.end = std::min(numInPositions, start + blockSize);
+			block.left = block.right = -1;
+			block.bbMin = block.bbMax = inPositions[start];
+
+			for (int j = start + 1; j < block.end; j++)
+			{
+				block.bbMin.x = std::min(block.bbMin.x, inPositions[j].x); block.bbMax.x = std::max(block.bbMax.x, inPositions[j].x);
+				block.bbMin.y = std::min(block.bbMin.y, inPositions[j].y); block.bbMax.y = std::max(block.bbMax.y, inPositions[j].y);
+				block.bbMin.z = std::min(block.bbMin.z, inPositions[j].z); block.bbMax.z = std::max(block.bbMax.z, inPositions[j].z);
+			}
+
+			blocks.push_back(block);
+		}
+
+		double maxDist = (influenceRadius > 0) ? influenceRadius : 10000;
+
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				T d = T();
+				double wSum = 0.0;
+				double tempDist = 10000;
+
+				for (auto &block : blocks)
+				{
+					// a block farther than the closest position so far can't contain a closer position
+					double boxDist = sqrt(block.squareDistanceTo(meshPositions[i]));
+					if (boxDist > tempDist || boxDist > maxDist) continue;
+
+					for (int j = block.start; j < block.end; j++)
+					{
+						double r = meshPositions[i].distanceTo(inPositions[j]);
+
+						if (r < tempDist && !(influenceRadius > 0 && r > influenceRadius))
+						{
+							double w = pow(r, power);
+							wSum += w;
+							double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;
+
+							d = value * val;
+
+							tempDist = r;
+						}
+					}
+				}
+
+				if (wSum > 0) d /= wSum;
+				else d = T();
+
+				fieldValues[i] = d;
+			}
+		});
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeVertexDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, float offset)
+	{
+		scalars.assign(fnMesh.numVertices(), 0.0);
+
+		zVector *meshPositions = fnMesh.getRawVertexPositions();
+
+		zKdTree tree;
+		tree.build(inPositions, numInPositions);
+
+		zThreadPool::getGlobal().parallel_for(0, fnMesh.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				float distSq;
+				int j = tree.getNearest(meshPositions[i], distSq);
+				if (j == -1) continue;
+
+				double r = meshPositions[i].distanceTo(inPositions[j]);
+				r = r - offset;
+
+				if (r < 10000) scalars[i] = r;
+			}
+		});
+	}
+
+	//---- PROTECTED DIFFUSION METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeDiffusion(float *inValues, float *outValues, int numRings, double diffuseDamp, zDiffusionType type, double scale, double centreWeight)
+	{
+		if (type != zLaplacian && type != zAverage) throw std::invalid_argument(" error: invalid zDiffusionType type");
+
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int R = (numRings < 1) ? 1 : numRings;
+
+		// laplacian centre weight balancing the (2R + 1)^2 - 1 neighbours, -8 for a single ring
+		if (centreWeight == 0) centreWeight = -1.0 * ((2 * R + 1) * (2 * R + 1) - 1);
+
+		// columns where the stencil isn't clipped in y
+		int interiorStart = std::min(R, n_Y);
+		int interiorEnd = std::max(interiorStart, n_Y - R);
+
+		zThreadPool::getGlobal().parallel_for(0, n_X, [&](int start, int end)
+		{
+			vector<double> rowSums(n_Y, 0.0);
+
+			for (int x = start; x < end; x++)
+			{
+				int startX = std::max(0, x - R);
+				int endX = std::min(n_X - 1, x + R);
+
+				float *centre = inValues + x * n_Y;
+				float *out = outValues + x * n_Y;
+
+				// boundary cells, with the stencil clipped in y
+				for (int y = 0; y < n_Y; y++)
+				{
+					if (y == interiorStart) y = interiorEnd;
+					if (y >= n_Y) break;
+
+					int startY = std::max(0, y - R);
+					int endY = std::min(n_Y - 1, y + R);
+
+					double lapA = 0;
+
+					for (int i = startX; i <= endX; i++)
+					{
+						for (int j = startY; j <= endY; j++)
+						{
+							float val = inValues[i * n_Y + j];
+
+							if (type == zLaplacian && i == x && j == y) lapA += (val * centreWeight);
+							else lapA += (val * 1);
+						}
+					}
+
+					if (type == zLaplacian) out[y] = scale * (centre[y] + (lapA * diffuseDamp));
+					else
+					{
+						if (lapA != 0) lapA /= ((endX - startX + 1) * (endY - startY + 1));
+						out[y] = scale * lapA;
+					}
+				}
+
+				// interior cells, accumulating one stencil entry at a time over the row
+				for (int y = interiorStart; y < interiorEnd; y++) rowSums[y] = 0;
+
+				for (int i = startX; i <= endX; i++)
+				{
+					for (int j = -R; j <= R; j++)
+					{
+						double weight = (type == zLaplacian && i == x && j == 0) ? centreWeight : 1;
+						float *in = inValues + i * n_Y + j;
+
+						for (int y = interiorStart; y < interiorEnd; y++) rowSums[y] += in[y] * weight;
+					}
+				}
+
+				if (type == zLaplacian)
+				{
+					for (int y = interiorStart; y < interiorEnd; y++) out[y] = scale * (centre[y] + (rowSums[y] * diffuseDamp));
+				}
+				else
+				{
+					double stencilSize = (endX - startX + 1) * (2 * R + 1);
+
+					for (int y = interiorStart; y < interiorEnd; y++)
+					{
+						double lapA = rowSums[y];
+						if (lapA != 0) lapA /= stencilSize;
+						out[y] = scale * lapA;
+					}
+				}
+			}
+		});
+	}
+
 	//---- PROTECTED SCALAR METHODS
 
 	
@@ -7064,7 +7166,7 @@ namespace zSpace
 	}
 
 	template<>
-	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsolinePoly(zItMeshFace& f , zPointArray &positions, zIntArray &polyConnects, zIntArray &polyCounts, unordered_map <string, int> &positionVertex, float &threshold, bool invertMesh)
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsolinePoly(zItMeshFace& f , zIsoContourBuffer &contour, float &threshold, bool invertMesh)
 	{
 		vector<zItMeshVertex> fVerts;
 		f.getVertices(fVerts);
@@ -7601,24 +7703,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions.size(); i++)
 			{
 				zVector p0 = newPositions[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 6, v0);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
+				int v0 = contour.addVertex(f, p0, 6);
 
-					/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;*/
-					coreUtils.addToPositionMap(positionVertex, p0, v0, 6);
-				}
-
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions.size());
+			contour.counts.push_back(newPositions.size());
 		}
 
 
@@ -7641,7 +7731,7 @@ namespace zSpace
 
 				if (newPositions2[i].distanceTo(newPositions2[next]) < distanceTolerance)
 				{
-					newPositions2.erase(newPositions.begin() + i);
+					newPositions2.erase(newPositions2.begin() + i);
 				}
 
 			}
@@ -7654,24 +7744,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions2.size(); i++)
 			{
 				zVector p0 = newPositions2[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 6, v0);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
-
-					/*string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;*/
-					coreUtils.addToPositionMap(positionVertex, p0, v0, 6);
-				}
+				int v0 = contour.addVertex(f, p0, 6);
 
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions2.size());
+			contour.counts.push_back(newPositions2.size());
 		}
 
 
@@ -7679,7 +7757,7 @@ namespace zSpace
 	}
 
 	template<>
-	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsobandPoly(zItMeshFace& f, zPointArray &positions, zIntArray &polyConnects, zIntArray &polyCounts, unordered_map <string, int> &positionVertex, float &thresholdLow, float &thresholdHigh)
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getIsobandPoly(zItMeshFace& f, zIsoContourBuffer &contour, float &thresholdLow, float &thresholdHigh)
 	{
 		vector<zItMeshVertex> fVerts;
 		f.getVertices(fVerts);
@@ -8461,23 +8539,12 @@ namespace zSpace
 			for (int i = 0; i < newPositions.size(); i++)
 			{
 				zVector p0 = newPositions[i];
-				int v0;
-
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
-
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
-
-					string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;
-				}
+				int v0 = contour.addVertex(f, p0, 3);
 
-				polyConnects.push_back(v0);
+				contour.connects.push_back(v0);
 			}
 
-			polyCounts.push_back(newPositions.size());
+			contour.counts.push_back(newPositions.size());
 		}
 
 
@@ -8495,7 +8562,7 @@ namespace zSpace
 
 				if (newPositions2[i].distanceTo(newPositions2[next]) < distanceTolerance)
 				{
-					newPositions2.erase(newPositions.begin() + i);
+					newPositions2.erase(newPositions2.begin() + i);
 
 
 				}
@@ -8510,25 +8577,155 @@ namespace zSpace
 			for (int i = 0; i < newPositions2.size(); i++)
 			{
 				zVector p0 = newPositions2[i];
-				int v0;
+				int v0 = contour.addVertex(f, p0, 3);
 
-				bool vExists = coreUtils.vertexExists(positionVertex, p0, 3, v0);
+				contour.connects.push_back(v0);
+			}
 
-				if (!vExists)
-				{
-					v0 = positions.size();
-					positions.push_back(p0);
+			contour.counts.push_back(newPositions2.size());
+		}
 
-					string hashKey = (to_string(p0.x) + "," + to_string(p0.y) + "," + to_string(p0.z));
-					positionVertex[hashKey] = v0;
-				}
+	}
+
+	//---- PROTECTED SAMPLE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::getSampleCoordinates(zPoint &samplePos, float &fX, float &fY)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+
+		fX = (samplePos.x - fieldObj->field.minBB.x) * (float)(1.0 / fieldObj->field.unit_X);
+		fY = (samplePos.y - fieldObj->field.minBB.y) * (float)(1.0 / fieldObj->field.unit_Y);
+
+		bool out = (fX >= 0 && fX <= n_X - 1 && fY >= 0 && fY <= n_Y - 1);
+
+		// negated comparisons also clamp NaN
+		if (!(fX >= 0)) fX = 0;
+		if (!(fX <= n_X - 1)) fX = n_X - 1;
+
+		if (!(fY >= 0)) fY = 0;
+		if (!(fY <= n_Y - 1)) fY = n_Y - 1;
+
+		return out;
+	}
+
+	//---- zScalar specilization for sampleLinear
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		zScalar *values = fieldObj->field.fieldValues.data();
+
+		float invUnit_X = (float)(1.0 / fieldObj->field.unit_X);
+		float invUnit_Y = (float)(1.0 / fieldObj->field.unit_Y);
+
+		int i = 0;
+
+#ifdef ZSPACE_SSE2
+		__m128 zero = _mm_setzero_ps();
+		__m128 minX = _mm_set1_ps(fieldObj->field.minBB.x);
+		__m128 minY = _mm_set1_ps(fieldObj->field.minBB.y);
+		__m128 invUnitX = _mm_set1_ps(invUnit_X);
+		__m128 invUnitY = _mm_set1_ps(invUnit_Y);
+		__m128 maxX = _mm_set1_ps((float)(n_X - 1));
+		__m128 maxY = _mm_set1_ps((float)(n_Y - 1));
+		__m128 maxCellX = _mm_set1_ps((float)(n_X - 2));
+		__m128 maxCellY = _mm_set1_ps((float)(n_Y - 2));
+
+		alignas(16) int iX[4], iY[4];
+		alignas(16) float outX[4], outY[4];
 
-				polyConnects.push_back(v0);
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			zPoint *p = samplePositions + i;
+
+			// grid coordinates, clamped to the field. _mm_max_ps returns its second operand for NaN.
+			__m128 fX = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(p[3].x, p[2].x, p[1].x, p[0].x), minX), invUnitX);
+			__m128 fY = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(p[3].y, p[2].y, p[1].y, p[0].y), minY), invUnitY);
+
+			fX = _mm_min_ps(_mm_max_ps(fX, zero), maxX);
+			fY = _mm_min_ps(_mm_max_ps(fY, zero), maxY);
+
+			__m128 cX = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fX)), maxCellX);
+			__m128 cY = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fY)), maxCellY);
+
+			__m128 tX = _mm_sub_ps(fX, cX);
+			__m128 tY = _mm_sub_ps(fY, cY);
+
+			_mm_store_si128((__m128i*)iX, _mm_cvttps_epi32(cX));
+			_mm_store_si128((__m128i*)iY, _mm_cvttps_epi32(cY));
+
+			int id[4];
+			for (int k = 0; k < 4; k++) id[k] = iX[k] * n_Y + iY[k];
+
+			__m128 v00 = _mm_set_ps(values[id[3]], values[id[2]], values[id[1]], values[id[0]]);
+			__m128 v10 = _mm_set_ps(values[id[3] + n_Y], values[id[2] + n_Y], values[id[1] + n_Y], values[id[0] + n_Y]);
+			__m128 v01 = _mm_set_ps(values[id[3] + 1], values[id[2] + 1], values[id[1] + 1], values[id[0] + 1]);
+			__m128 v11 = _mm_set_ps(values[id[3] + n_Y + 1], values[id[2] + n_Y + 1], values[id[1] + n_Y + 1], values[id[0] + n_Y + 1]);
+
+			__m128 dX0 = _mm_sub_ps(v10, v00);
+			__m128 dX1 = _mm_sub_ps(v11, v01);
+
+			if (fieldValues)
+			{
+				__m128 v0 = _mm_add_ps(v00, _mm_mul_ps(dX0, tX));
+				__m128 v1 = _mm_add_ps(v01, _mm_mul_ps(dX1, tX));
+
+				_mm_storeu_ps(fieldValues + i, _mm_add_ps(v0, _mm_mul_ps(_mm_sub_ps(v1, v0), tY)));
 			}
 
-			polyCounts.push_back(newPositions2.size());
+			if (gradients)
+			{
+				__m128 dY0 = _mm_sub_ps(v01, v00);
+				__m128 dY1 = _mm_sub_ps(v11, v10);
+
+				_mm_store_ps(outX, _mm_mul_ps(_mm_add_ps(dX0, _mm_mul_ps(_mm_sub_ps(dX1, dX0), tY)), invUnitX));
+				_mm_store_ps(outY, _mm_mul_ps(_mm_add_ps(dY0, _mm_mul_ps(_mm_sub_ps(dY1, dY0), tX)), invUnitY));
+
+				for (int k = 0; k < 4; k++) gradients[i + k] = zVector(outX[k], outY[k], 0);
+			}
 		}
+#endif
+
+		for (; i < numSamples; i++)
+		{
+			float fX, fY;
+			getSampleCoordinates(samplePositions[i], fX, fY);
+
+			int cX = std::min((int)fX, n_X - 2);
+			int cY = std::min((int)fY, n_Y - 2);
+
+			float tX = fX - cX;
+			float tY = fY - cY;
+
+			int id = cX * n_Y + cY;
+
+			float v00 = values[id];
+			float v10 = values[id + n_Y];
+			float v01 = values[id + 1];
+			float v11 = values[id + n_Y + 1];
+
+			float dX0 = v10 - v00;
+			float dX1 = v11 - v01;
 
+			if (fieldValues)
+			{
+				float v0 = v00 + dX0 * tX;
+				float v1 = v01 + dX1 * tX;
+
+				fieldValues[i] = v0 + (v1 - v0) * tY;
+			}
+
+			if (gradients)
+			{
+				float dY0 = v01 - v00;
+				float dY1 = v11 - v10;
+
+				gradients[i] = zVector((dX0 + (dX1 - dX0) * tY) * invUnit_X, (dY0 + (dY1 - dY0) * tX) * invUnit_Y, 0);
+			}
+		}
 	}
 
 
@@ -45,11 +45,13 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointCloud::from(string path, zFileTpye type, bool staticGeom)
 	{
 		if (type == zCSV) fromCSV(path);
+		else if (type == zBIN) fromBIN(path);
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::to(string path, zFileTpye type)
 	{
 		if (type == zCSV) toCSV(path);
+		else if (type == zBIN) toBIN(path);
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::getBounds(zPoint &minBB, zPoint &maxBB)
@@ -277,51 +279,59 @@ namespace zSpace
 	{
 		pointsObj->pCloud.vertexPositions.clear();
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		zUtilsTextReader csvFile;
+		if (!csvFile.read(infilename)) return;
 
-		if (myfile.fail())
-		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return;
+		// count the positions of each line block
+		int numBlocks = csvFile.numLineBlocks();
+		zIntArray blockPositions(numBlocks + 1, 0);
 
-		}
-
-		while (!myfile.eof())
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
 		{
-			string str;
-			getline(myfile, str);
-
-			vector<string> perlineData = pointsObj->pCloud.coreUtils.splitString(str, " ");
+			vector<zUtilsTextToken> perlineData;
 
-			if (perlineData.size() > 0)
+			for (int b = start; b < end; b++)
 			{
-				// vertex
-				if (perlineData[0] == "v")
-				{
-					if (perlineData.size() == 4)
-					{
-						zVector pos;
-						pos.x = atof(perlineData[1].c_str());
-						pos.y = atof(perlineData[2].c_str());
-						pos.z = atof(perlineData[3].c_str());
+				int lineStart, lineEnd;
+				csvFile.getLineBlock(b, lineStart, lineEnd);
 
-						pointsObj->pCloud.vertexPositions.push_back(pos);
-					}
-					//printf("\n working vertex");
+				for (int l = lineStart; l < lineEnd; l++)
+				{
+					if (csvFile.getTokens(l, " ", perlineData) == 4 && csvFile.equals(perlineData[0], "v")) blockPositions[b + 1]++;
 				}
-
-
 			}
-		}
+		}, 1);
 
-		myfile.close();
+		for (int b = 0; b < numBlocks; b++) blockPositions[b + 1] += blockPositions[b];
 
+		pointsObj->pCloud.vertexPositions.assign(blockPositions[numBlocks], zVector());
 
+		// parse each line block into the preallocated positions
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
+		{
+			vector<zUtilsTextToken> perlineData;
 
-		printf("\n inPositions: %i ", pointsObj->pCloud.vertexPositions.size());
+			for (int b = start; b < end; b++)
+			{
+				int lineStart, lineEnd;
+				csvFile.getLineBlock(b, lineStart, lineEnd);
+
+				int v = blockPositions[b];
 
+				for (int l = lineStart; l < lineEnd; l++)
+				{
+					if (csvFile.getTokens(l, " ", perlineData) == 4 && csvFile.equals(perlineData[0], "v"))
+					{
+						zVector &pos = pointsObj->pCloud.vertexPositions[v++];
+						pos.x = csvFile.toDouble(perlineData[1]);
+						pos.y = csvFile.toDouble(perlineData[2]);
+						pos.z = csvFile.toDouble(perlineData[3]);
+					}
+				}
+			}
+		}, 1);
 
+		printf("\n inPositions: %i ", pointsObj->pCloud.vertexPositions.size());
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::toCSV(string outfilename)
@@ -351,4 +361,42 @@ namespace zSpace
 		cout << endl << " TXT exported. File:   " << outfilename.c_str() << endl;
 	}
 
-}
\ No newline at end of file
+	ZSPACE_INLINE void zFnPointCloud::fromBIN(string infilename)
+	{
+		zUtilsBinaryReader binFile;
+		if (!binFile.open(infilename)) return;
+
+		if (binFile.getObjectType() != zPointsFn) throw std::invalid_argument(" error: " + infilename + " does not contain a point cloud.");
+
+		pointsObj->pCloud.clear();
+
+		binFile.getBlock(zBinVertexPositions, pointsObj->pCloud.vertexPositions);
+		int numV = pointsObj->pCloud.vertexPositions.size();
+
+		if (!binFile.getBlock(zBinVertexColors, pointsObj->pCloud.vertexColors) || pointsObj->pCloud.vertexColors.size() != numV) pointsObj->pCloud.vertexColors.assign(numV, zColor(1, 0, 0, 1));
+		if (!binFile.getBlock(zBinVertexWeights, pointsObj->pCloud.vertexWeights) || pointsObj->pCloud.vertexWeights.size() != numV) pointsObj->pCloud.vertexWeights.assign(numV, 2.0);
+
+		pointsObj->pCloud.vertices.assign(numV, zVertex());
+		for (int i = 0; i < numV; i++)
+		{
+			pointsObj->pCloud.vertices[i].setId(i);
+			pointsObj->pCloud.addToPositionMap(pointsObj->pCloud.vertexPositions[i], i);
+		}
+
+		pointsObj->pCloud.setNumVertices(numV);
+
+		printf("\n inPositions: %i ", numV);
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::toBIN(string outfilename)
+	{
+		zUtilsBinaryWriter binFile;
+
+		binFile.addBlock(zBinVertexPositions, pointsObj->pCloud.vertexPositions);
+		binFile.addBlock(zBinVertexColors, pointsObj->pCloud.vertexColors);
+		binFile.addBlock(zBinVertexWeights, pointsObj->pCloud.vertexWeights);
+
+		binFile.write(outfilename, zPointsFn);
+	}
+
+}
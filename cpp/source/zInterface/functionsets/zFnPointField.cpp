@@ -13,6 +13,10 @@
 
 #include<headers/zInterface/functionsets/zFnPointField.h>
 
+#ifdef ZSPACE_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace zSpace
 {
 
@@ -81,6 +85,9 @@ namespace zSpace
 		ringNeighbours.clear();
 		adjacentNeighbours.clear();
 
+		ringNeighbours.assign(numFieldValues(), vector<int>());
+		adjacentNeighbours.assign(numFieldValues(), vector<int>());
+
 		int i = 0;
 		for (zItPointScalarField s(*fieldObj); !s.end(); s++, i++)
 		{
@@ -106,6 +113,9 @@ namespace zSpace
 		ringNeighbours.clear();
 		adjacentNeighbours.clear();
 
+		ringNeighbours.assign(numFieldValues(), vector<int>());
+		adjacentNeighbours.assign(numFieldValues(), vector<int>());
+
 		int i = 0;
 		for (zItPointVectorField s(*fieldObj); !s.end(); s++, i++)
 		{
@@ -131,6 +141,9 @@ namespace zSpace
 		ringNeighbours.clear();
 		adjacentNeighbours.clear();
 
+		ringNeighbours.assign(numFieldValues(), vector<int>());
+		adjacentNeighbours.assign(numFieldValues(), vector<int>());
+
 		int i = 0;
 		for (zItPointScalarField s(*fieldObj); !s.end(); s++, i++)
 		{
@@ -156,6 +169,9 @@ namespace zSpace
 		ringNeighbours.clear();
 		adjacentNeighbours.clear();
 
+		ringNeighbours.assign(numFieldValues(), vector<int>());
+		adjacentNeighbours.assign(numFieldValues(), vector<int>());
+
 		int i = 0;
 		for (zItPointVectorField s(*fieldObj); !s.end(); s++, i++)
 		{
@@ -237,6 +253,7 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE bool zFnPointField<zScalar>::getFieldValue(zPoint &samplePos, zFieldValueType type, zScalar& fieldValue)
 	{
+		if (type == zFieldNearest || type == zFieldLinear) return sampleFieldValue(samplePos, type, fieldValue);
 
 		bool out = false;
 
@@ -324,6 +341,7 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE bool zFnPointField<zVector>::getFieldValue(zVector &samplePos, zFieldValueType type, zVector& fieldValue)
 	{
+		if (type == zFieldNearest || type == zFieldLinear) return sampleFieldValue(samplePos, type, fieldValue);
 
 		bool out = false;
 
@@ -470,6 +488,125 @@ namespace zSpace
 		return out;
 	}
 
+	//---- SAMPLE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::sampleFieldValue(zPoint &samplePos, zFieldValueType type, T &fieldValue)
+	{
+		float fX, fY, fZ;
+		bool out = getSampleCoordinates(samplePos, fX, fY, fZ);
+
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+		T *values = fieldObj->field.fieldValues.data();
+
+		if (type == zFieldIndex)
+		{
+			fieldValue = values[std::min((int)fX, n_X - 1) * (n_Y * n_Z) + std::min((int)fY, n_Y - 1) * n_Z + std::min((int)fZ, n_Z - 1)];
+		}
+
+		else if (type == zFieldNearest)
+		{
+			fieldValue = values[(int)(fX + 0.5f) * (n_Y * n_Z) + (int)(fY + 0.5f) * n_Z + (int)(fZ + 0.5f)];
+		}
+
+		else if (type == zFieldLinear)
+		{
+			if (n_X < 2 || n_Y < 2 || n_Z < 2) throw std::invalid_argument(" error: zFieldLinear needs at least 2 field values in X, Y and Z.");
+
+			int iX = std::min((int)fX, n_X - 2);
+			int iY = std::min((int)fY, n_Y - 2);
+			int iZ = std::min((int)fZ, n_Z - 2);
+
+			float tX = fX - iX;
+			float tY = fY - iY;
+			float tZ = fZ - iZ;
+
+			int sX = n_Y * n_Z;
+			int id = iX * sX + iY * n_Z + iZ;
+
+			T a00 = values[id] + (values[id + sX] - values[id]) * tX;
+			T a10 = values[id + n_Z] + (values[id + sX + n_Z] - values[id + n_Z]) * tX;
+			T a01 = values[id + 1] + (values[id + sX + 1] - values[id + 1]) * tX;
+			T a11 = values[id + n_Z + 1] + (values[id + sX + n_Z + 1] - values[id + n_Z + 1]) * tX;
+
+			T b0 = a00 + (a10 - a00) * tY;
+			T b1 = a01 + (a11 - a01) * tY;
+
+			fieldValue = b0 + (b1 - b0) * tZ;
+		}
+
+		else throw std::invalid_argument(" error: invalid zFieldValueType.");
+
+		return out;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, vector<T> &fieldValues)
+	{
+		fieldValues.resize(samplePositions.size());
+
+		zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++) sampleFieldValue(samplePositions[i], type, fieldValues[i]);
+		}, 4096);
+	}
+
+	//---- zScalar specilization for sampleFieldValues
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleFieldValues(zPointArray &samplePositions, zFieldValueType type, zScalarArray &fieldValues)
+	{
+		fieldValues.resize(samplePositions.size());
+		if (samplePositions.size() == 0) return;
+
+		if (type == zFieldLinear)
+		{
+			if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2 || fieldObj->field.n_Z < 2) throw std::invalid_argument(" error: zFieldLinear needs at least 2 field values in X, Y and Z.");
+
+			zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+			{
+				sampleLinear(&samplePositions[start], end - start, &fieldValues[start], nullptr);
+			}, 4096);
+		}
+		else
+		{
+			zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+			{
+				for (int i = start; i < end; i++) sampleFieldValue(samplePositions[i], type, fieldValues[i]);
+			}, 4096);
+		}
+	}
+
+	//---- zScalar specilization for sampleGradient
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zScalar>::sampleGradient(zPoint &samplePos, zVector &gradient)
+	{
+		if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2 || fieldObj->field.n_Z < 2) throw std::invalid_argument(" error: gradient needs at least 2 field values in X, Y and Z.");
+
+		float fX, fY, fZ;
+		bool out = getSampleCoordinates(samplePos, fX, fY, fZ);
+
+		sampleLinear(&samplePos, 1, nullptr, &gradient);
+
+		return out;
+	}
+
+	//---- zScalar specilization for sampleGradients
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleGradients(zPointArray &samplePositions, zVectorArray &gradients)
+	{
+		gradients.resize(samplePositions.size());
+		if (samplePositions.size() == 0) return;
+
+		if (fieldObj->field.n_X < 2 || fieldObj->field.n_Y < 2 || fieldObj->field.n_Z < 2) throw std::invalid_argument(" error: gradient needs at least 2 field values in X, Y and Z.");
+
+		zThreadPool::getGlobal().parallel_for(0, samplePositions.size(), [&](int start, int end)
+		{
+			sampleLinear(&samplePositions[start], end - start, nullptr, &gradients[start]);
+		}, 4096);
+	}
+
 	//---- SET METHODS
 
 	template<typename T>
@@ -522,42 +659,11 @@ namespace zSpace
 	//----  3D IDW FIELD METHODS
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = meshValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0)  d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW_Nearest(fieldValues, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), meshValue, influence, power, influenceRadius);
 
 		if (normalise)
 		{
@@ -567,44 +673,11 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnGraph.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = graphValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-
-
-		}
+		computeIDW_Nearest(fieldValues, inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), graphValue, influence, power, influenceRadius);
 
 		if (normalise)
 		{
@@ -615,39 +688,14 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise, double influenceRadius)
 	{
-
-		fieldValues.clear();
 		zFnPointCloud inFnPoints(inPointsObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnPoints.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
+		vector<T> values(inFnPoints.numVertices(), value);
+		zDoubleArray influences(inFnPoints.numVertices(), influence);
 
-			if (wSum > 0)  d /= wSum;
-			d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inFnPoints.getRawVertexPositions(), inFnPoints.numVertices(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -656,78 +704,26 @@ namespace zSpace
 	}
 
 	template <typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise )
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise, double influenceRadius)
 	{
-		fieldValues.clear();
 		zFnPointCloud inFnPoints(inPointsObj);
 
 
 		if (inFnPoints.numVertices() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inFnPoints.numVertices() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnPoints.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)  d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inFnPoints.getRawVertexPositions(), inFnPoints.numVertices(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise, double influenceRadius)
 	{
+		vector<T> values(inPositions.size(), value);
+		zDoubleArray influences(inPositions.size(), influence);
 
-		fieldValues.clear();
-
-		zVector *positions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inPositions.data(), inPositions.size(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -736,37 +732,12 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power, bool normalise, double influenceRadius)
 	{
 		if (inPositions.size() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inPositions.size() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)	d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeIDW(fieldValues, inPositions.data(), inPositions.size(), values, influences, power, influenceRadius);
 
 		if (normalise)	normliseValues(fieldValues);
 
@@ -784,31 +755,24 @@ namespace zSpace
 		zFnPointCloud inFnPoints(inPointsObj);
 
 		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnPoints.getRawVertexPositions();
 
 		vector<double> distVals;
 		double dMin = 100000;
 		double dMax = 0;;
 
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			distVals.push_back(10000);
-		}
+		distVals.assign(fnPoints.numVertices(), 10000);
 
-		for (int j = 0; j < fnPoints.numVertices(); j++)
-		{
+		zKdTree tree;
+		tree.build(inFnPoints.getRawVertexPositions(), inFnPoints.numVertices());
 
-			for (int i = 0; i < inFnPoints.numVertices(); i++)
+		zThreadPool::getGlobal().parallel_for(0, fnPoints.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
 			{
-
-				double dist = positions[i].squareDistanceTo(inPositions[j]);
-
-				if (dist < distVals[j])
-				{
-					distVals[j] = dist;
-				}
+				float dist;
+				if (tree.getNearest(positions[i], dist) != -1 && dist < distVals[i]) distVals[i] = dist;
 			}
-		}
+		});
 
 		for (int i = 0; i < distVals.size(); i++)
 		{
@@ -834,32 +798,9 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjMesh &inMeshObj, double a, double b, bool normalise)
 	{
-		scalars.clear();
-
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = positions[i].squareDistanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), a, b);
 
 		if (normalise)
 		{
@@ -872,35 +813,9 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjGraph &inGraphObj, double a, double b, bool normalise)
 	{
-		scalars.clear();
-
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-
-		// update values from meta balls
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnGraph.numVertices(); j++)
-			{
-				double r = positions[i].squareDistanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					d = F_of_r(r, a, b);
-					//printf("\n F_of_r:  %1.4f ", F_of_r(r, a, b));
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		computeVertexDistance(scalars, inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), a, b);
 
 		if (normalise)
 		{
@@ -913,42 +828,19 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjMesh &inMeshObj, double a, double b, bool normalise)
 	{
-		scalars.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
+		zIntArray edgeVertices;
+		edgeVertices.reserve(inFnMesh.numEdges() * 2);
 
-		// update values from edge distance
-		for (int i = 0; i < fnPoints.numVertices(); i++)
+		for (zItMeshEdge e(inMeshObj); !e.end(); e++)
 		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (zItMeshEdge e(inMeshObj); !e.end(); e++)
-			{
-
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
-
-				zVector closestPt;
-
-				double r = coreUtils.minDist_Edge_Point(positions[i], inPositions[e0], inPositions[e1], closestPt);
-
-
-				if (r < tempDist)
-				{
-
-					d = F_of_r(r, a, b);
-
-					tempDist = r;
-				}
-			}
-
-			scalars.push_back(d);
-
+			edgeVertices.push_back(e.getHalfEdge(0).getVertex().getId());
+			edgeVertices.push_back(e.getHalfEdge(0).getStartVertex().getId());
 		}
 
+		computeEdgeDistance(scalars, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), edgeVertices, a, b);
+
 		if (normalise)
 		{
 			normliseValues(scalars);
@@ -960,42 +852,19 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnPointField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjGraph &inGraphObj, double a, double b, bool normalise )
 	{
-		scalars.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *positions = fnPoints.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
+		zIntArray edgeVertices;
+		edgeVertices.reserve(inFnGraph.numEdges() * 2);
 
-		// update values from edge distance
-		for (int i = 0; i < fnPoints.numVertices(); i++)
+		for (zItGraphEdge e(inGraphObj); !e.end(); e++)
 		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (zItGraphEdge e(inGraphObj); !e.end(); e++)
-			{
-
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
-
-				zVector closestPt;
-
-				double r = coreUtils.minDist_Edge_Point(positions[i], inPositions[e0], inPositions[e1], closestPt);
-
-
-				if (r < tempDist)
-				{
-
-					d = F_of_r(r, a, b);
-
-					tempDist = r;
-				}
-			}
-
-			scalars.push_back(d);
-
+			edgeVertices.push_back(e.getHalfEdge(0).getVertex().getId());
+			edgeVertices.push_back(e.getHalfEdge(0).getStartVertex().getId());
 		}
 
+		computeEdgeDistance(scalars, inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), edgeVertices, a, b);
+
 		if (normalise)
 		{
 			normliseValues(scalars);
@@ -1340,6 +1209,175 @@ namespace zSpace
 
 	}
 
+	//---- PROTECTED DISTANCE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeIDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, vector<T> &values, zDoubleArray &influences, double power, double influenceRadius)
+	{
+		fieldValues.assign(fnPoints.numVertices(), T());
+
+		zVector *positions = fnPoints.getRawVertexPositions();
+
+		zKdTree tree;
+		if (influenceRadius > 0) tree.build(inPositions, numInPositions);
+
+		zThreadPool::getGlobal().parallel_for(0, fnPoints.numVertices(), [&](int start, int end)
+		{
+			zIntArray inRadius;
+
+			for (int i = start; i < end; i++)
+			{
+				T d = T();
+				double wSum = 0.0;
+
+				int n = numInPositions;
+				if (influenceRadius > 0)
+				{
+					tree.getWithinRadius(positions[i], influenceRadius, inRadius);
+					n = inRadius.size();
+				}
+
+				for (int k = 0; k < n; k++)
+				{
+					int j = (influenceRadius > 0) ? inRadius[k] : k;
+
+					double r = positions[i].distanceTo(inPositions[j]);
+
+					double w = pow(r, power);
+					wSum += w;
+
+					double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;
+
+					d += (values[j] * val);
+				}
+
+				if (wSum > 0) d /= wSum;
+				else d = T();
+
+				fieldValues[i] = d;
+			}
+		});
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeIDW_Nearest(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T value, double influence, double power, double influenceRadius)
+	{
+		fieldValues.assign(fnPoints.numVertices(), T());
+
+		zVector *positions = fnPoints.getRawVertexPositions();
+
+		// bounding boxes of blocks of consecutive input positions, as the weights depend on the order of the positions
+		int blockSize = 64;
+		vector<zKdNode> blocks;
+
+		for (int start = 0; start < numInPositions; start += blockSize)
+		{
+			zKdNode block;
+			block.start = start;
+			block.end = std::min(numInPositions, start + blockSize);
+			block.left = block.right = -1;
+			block.bbMin = block.bbMax = inPositions[start];
+
+			for (int j = start + 1; j < block.end; j++)
+			{
+				block.bbMin.x = std::min(block.bbMin.x, inPositions[j].x); block.bbMax.x = std::max(block.bbMax.x, inPositions[j].x);
+				block.bbMin.y = std::min(block.bbMin.y, inPositions[j].y); block.bbMax.y = std::max(block.bbMax.y, inPositions[j].y);
+				block.bbMin.z = std::min(block.bbMin.z, inPositions[j].z); block.bbMax.z = std::max(block.bbMax.z, inPositions[j].z);
+			}
+
+			blocks.push_back(block);
+		}
+
+		double maxDist = (influenceRadius > 0) ? influenceRadius : 10000;
+
+		zThreadPool::getGlobal().parallel_for(0, fnPoints.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				T d = T();
+				double wSum = 0.0;
+				double tempDist = 10000;
+
+				for (auto &block : blocks)
+				{
+					// a block farther than the closest position so far can't contain a closer position
+					double boxDist = sqrt(block.squareDistanceTo(positions[i]));
+					if (boxDist > tempDist || boxDist > maxDist) continue;
+
+					for (int j = block.start; j < block.end; j++)
+					{
+						double r = positions[i].distanceTo(inPositions[j]);
+
+						if (r < tempDist && !(influenceRadius > 0 && r > influenceRadius))
+						{
+							double w = pow(r, power);
+							wSum += w;
+							double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;
+
+							d = value * val;
+
+							tempDist = r;
+						}
+					}
+				}
+
+				if (wSum > 0) d /= wSum;
+				else d = T();
+
+				fieldValues[i] = d;
+			}
+		});
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeVertexDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, double a, double b)
+	{
+		scalars.assign(fnPoints.numVertices(), 0.0);
+
+		zVector *positions = fnPoints.getRawVertexPositions();
+
+		zKdTree tree;
+		tree.build(inPositions, numInPositions);
+
+		zThreadPool::getGlobal().parallel_for(0, fnPoints.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				float distSq;
+				if (tree.getNearest(positions[i], distSq) == -1) continue;
+
+				double r = distSq;
+
+				if (r < 10000) scalars[i] = F_of_r(r, a, b);
+			}
+		});
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeEdgeDistance(zScalarArray &scalars, zPoint *inPositions, int numInPositions, zIntArray &edgeVertices, double a, double b)
+	{
+		scalars.assign(fnPoints.numVertices(), 0.0);
+
+		zVector *positions = fnPoints.getRawVertexPositions();
+
+		zBVH bvh;
+		bvh.buildEdges(inPositions, numInPositions, edgeVertices);
+
+		// update values from edge distance
+		zThreadPool::getGlobal().parallel_for(0, fnPoints.numVertices(), [&](int start, int end)
+		{
+			for (int i = start; i < end; i++)
+			{
+				double r;
+				zVector closestPt;
+
+				if (bvh.getNearest(positions[i], r, closestPt) == -1) continue;
+
+				if (r < 10000) scalars[i] = F_of_r(r, a, b);
+			}
+		});
+	}
+
 	//----  PROTECTED METHODS
 
 	template<typename T>
@@ -1382,6 +1420,195 @@ namespace zSpace
 
 	}
 
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::getSampleCoordinates(zPoint &samplePos, float &fX, float &fY, float &fZ)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+
+		fX = (samplePos.x - fieldObj->field.minBB.x) * (float)(1.0 / fieldObj->field.unit_X);
+		fY = (samplePos.y - fieldObj->field.minBB.y) * (float)(1.0 / fieldObj->field.unit_Y);
+		fZ = (samplePos.z - fieldObj->field.minBB.z) * (float)(1.0 / fieldObj->field.unit_Z);
+
+		bool out = (fX >= 0 && fX <= n_X - 1 && fY >= 0 && fY <= n_Y - 1 && fZ >= 0 && fZ <= n_Z - 1);
+
+		// negated comparisons also clamp NaN
+		if (!(fX >= 0)) fX = 0;
+		if (!(fX <= n_X - 1)) fX = n_X - 1;
+
+		if (!(fY >= 0)) fY = 0;
+		if (!(fY <= n_Y - 1)) fY = n_Y - 1;
+
+		if (!(fZ >= 0)) fZ = 0;
+		if (!(fZ <= n_Z - 1)) fZ = n_Z - 1;
+
+		return out;
+	}
+
+	//---- zScalar specilization for sampleLinear
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::sampleLinear(zPoint *samplePositions, int numSamples, zScalar *fieldValues, zVector *gradients)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+		int sX = n_Y * n_Z;
+		zScalar *values = fieldObj->field.fieldValues.data();
+
+		float invUnit_X = (float)(1.0 / fieldObj->field.unit_X);
+		float invUnit_Y = (float)(1.0 / fieldObj->field.unit_Y);
+		float invUnit_Z = (float)(1.0 / fieldObj->field.unit_Z);
+
+		int i = 0;
+
+#ifdef ZSPACE_SSE2
+		__m128 zero = _mm_setzero_ps();
+		__m128 minX = _mm_set1_ps(fieldObj->field.minBB.x);
+		__m128 minY = _mm_set1_ps(fieldObj->field.minBB.y);
+		__m128 minZ = _mm_set1_ps(fieldObj->field.minBB.z);
+		__m128 invUnitX = _mm_set1_ps(invUnit_X);
+		__m128 invUnitY = _mm_set1_ps(invUnit_Y);
+		__m128 invUnitZ = _mm_set1_ps(invUnit_Z);
+		__m128 maxX = _mm_set1_ps((float)(n_X - 1));
+		__m128 maxY = _mm_set1_ps((float)(n_Y - 1));
+		__m128 maxZ = _mm_set1_ps((float)(n_Z - 1));
+		__m128 maxCellX = _mm_set1_ps((float)(n_X - 2));
+		__m128 maxCellY = _mm_set1_ps((float)(n_Y - 2));
+		__m128 maxCellZ = _mm_set1_ps((float)(n_Z - 2));
+
+		alignas(16) int iX[4], iY[4], iZ[4];
+		alignas(16) float outX[4], outY[4], outZ[4];
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			zPoint *p = samplePositions + i;
+
+			// grid coordinates, clamped to the field. _mm_max_ps returns its second operand for NaN.
+			__m128 fX = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(p[3].x, p[2].x, p[1].x, p[0].x), minX), invUnitX);
+			__m128 fY = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(p[3].y, p[2].y, p[1].y, p[0].y), minY), invUnitY);
+			__m128 fZ = _mm_mul_ps(_mm_sub_ps(_mm_set_ps(p[3].z, p[2].z, p[1].z, p[0].z), minZ), invUnitZ);
+
+			fX = _mm_min_ps(_mm_max_ps(fX, zero), maxX);
+			fY = _mm_min_ps(_mm_max_ps(fY, zero), maxY);
+			fZ = _mm_min_ps(_mm_max_ps(fZ, zero), maxZ);
+
+			__m128 cX = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fX)), maxCellX);
+			__m128 cY = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fY)), maxCellY);
+			__m128 cZ = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(fZ)), maxCellZ);
+
+			__m128 tX = _mm_sub_ps(fX, cX);
+			__m128 tY = _mm_sub_ps(fY, cY);
+			__m128 tZ = _mm_sub_ps(fZ, cZ);
+
+			_mm_store_si128((__m128i*)iX, _mm_cvttps_epi32(cX));
+			_mm_store_si128((__m128i*)iY, _mm_cvttps_epi32(cY));
+			_mm_store_si128((__m128i*)iZ, _mm_cvttps_epi32(cZ));
+
+			int id[4];
+			for (int k = 0; k < 4; k++) id[k] = iX[k] * sX + iY[k] * n_Z + iZ[k];
+
+			// corner values, named by their x, y, z offsets
+			__m128 v000 = _mm_set_ps(values[id[3]], values[id[2]], values[id[1]], values[id[0]]);
+			__m128 v100 = _mm_set_ps(values[id[3] + sX], values[id[2] + sX], values[id[1] + sX], values[id[0] + sX]);
+			__m128 v010 = _mm_set_ps(values[id[3] + n_Z], values[id[2] + n_Z], values[id[1] + n_Z], values[id[0] + n_Z]);
+			__m128 v110 = _mm_set_ps(values[id[3] + sX + n_Z], values[id[2] + sX + n_Z], values[id[1] + sX + n_Z], values[id[0] + sX + n_Z]);
+			__m128 v001 = _mm_set_ps(values[id[3] + 1], values[id[2] + 1], values[id[1] + 1], values[id[0] + 1]);
+			__m128 v101 = _mm_set_ps(values[id[3] + sX + 1], values[id[2] + sX + 1], values[id[1] + sX + 1], values[id[0] + sX + 1]);
+			__m128 v011 = _mm_set_ps(values[id[3] + n_Z + 1], values[id[2] + n_Z + 1], values[id[1] + n_Z + 1], values[id[0] + n_Z + 1]);
+			__m128 v111 = _mm_set_ps(values[id[3] + sX + n_Z + 1], values[id[2] + sX + n_Z + 1], values[id[1] + sX + n_Z + 1], values[id[0] + sX + n_Z + 1]);
+
+			__m128 d00 = _mm_sub_ps(v100, v000);
+			__m128 d10 = _mm_sub_ps(v110, v010);
+			__m128 d01 = _mm_sub_ps(v101, v001);
+			__m128 d11 = _mm_sub_ps(v111, v011);
+
+			__m128 a00 = _mm_add_ps(v000, _mm_mul_ps(d00, tX));
+			__m128 a10 = _mm_add_ps(v010, _mm_mul_ps(d10, tX));
+			__m128 a01 = _mm_add_ps(v001, _mm_mul_ps(d01, tX));
+			__m128 a11 = _mm_add_ps(v011, _mm_mul_ps(d11, tX));
+
+			__m128 b0 = _mm_add_ps(a00, _mm_mul_ps(_mm_sub_ps(a10, a00), tY));
+			__m128 b1 = _mm_add_ps(a01, _mm_mul_ps(_mm_sub_ps(a11, a01), tY));
+
+			if (fieldValues)
+			{
+				_mm_storeu_ps(fieldValues + i, _mm_add_ps(b0, _mm_mul_ps(_mm_sub_ps(b1, b0), tZ)));
+			}
+
+			if (gradients)
+			{
+				__m128 e0 = _mm_add_ps(d00, _mm_mul_ps(_mm_sub_ps(d10, d00), tY));
+				__m128 e1 = _mm_add_ps(d01, _mm_mul_ps(_mm_sub_ps(d11, d01), tY));
+
+				__m128 g0 = _mm_sub_ps(a10, a00);
+				__m128 g1 = _mm_sub_ps(a11, a01);
+
+				_mm_store_ps(outX, _mm_mul_ps(_mm_add_ps(e0, _mm_mul_ps(_mm_sub_ps(e1, e0), tZ)), invUnitX));
+				_mm_store_ps(outY, _mm_mul_ps(_mm_add_ps(g0, _mm_mul_ps(_mm_sub_ps(g1, g0), tZ)), invUnitY));
+				_mm_store_ps(outZ, _mm_mul_ps(_mm_sub_ps(b1, b0), invUnitZ));
+
+				for (int k = 0; k < 4; k++) gradients[i + k] = zVector(outX[k], outY[k], outZ[k]);
+			}
+		}
+#endif
+
+		for (; i < numSamples; i++)
+		{
+			float fX, fY, fZ;
+			getSampleCoordinates(samplePositions[i], fX, fY, fZ);
+
+			int cX = std::min((int)fX, n_X - 2);
+			int cY = std::min((int)fY, n_Y - 2);
+			int cZ = std::min((int)fZ, n_Z - 2);
+
+			float tX = fX - cX;
+			float tY = fY - cY;
+			float tZ = fZ - cZ;
+
+			int id = cX * sX + cY * n_Z + cZ;
+
+			// corner values, named by their x, y, z offsets
+			float v000 = values[id];
+			float v100 = values[id + sX];
+			float v010 = values[id + n_Z];
+			float v110 = values[id + sX + n_Z];
+			float v001 = values[id + 1];
+			float v101 = values[id + sX + 1];
+			float v011 = values[id + n_Z + 1];
+			float v111 = values[id + sX + n_Z + 1];
+
+			float d00 = v100 - v000;
+			float d10 = v110 - v010;
+			float d01 = v101 - v001;
+			float d11 = v111 - v011;
+
+			float a00 = v000 + d00 * tX;
+			float a10 = v010 + d10 * tX;
+			float a01 = v001 + d01 * tX;
+			float a11 = v011 + d11 * tX;
+
+			float b0 = a00 + (a10 - a00) * tY;
+			float b1 = a01 + (a11 - a01) * tY;
+
+			if (fieldValues)
+			{
+				fieldValues[i] = b0 + (b1 - b0) * tZ;
+			}
+
+			if (gradients)
+			{
+				float e0 = d00 + (d10 - d00) * tY;
+				float e1 = d01 + (d11 - d01) * tY;
+
+				float g0 = a10 - a00;
+				float g1 = a11 - a01;
+
+				gradients[i] = zVector((e0 + (e1 - e0) * tZ) * invUnit_X, (g0 + (g1 - g0) * tZ) * invUnit_Y, (b1 - b0) * invUnit_Z);
+			}
+		}
+	}
+
 
 #if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
 	// explicit instantiation
@@ -1326,6 +1326,7 @@ namespace zSpace
 		double edgeLengthSquare = 0;
 		float gaussianCurv = 0;
 		float gaussianAngle = 0;
+		float multFactor = 0.125;
 
 		zCurvature curv;
 		curv.k1 = 0;
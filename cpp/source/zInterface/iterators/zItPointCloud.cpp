@@ -11,7 +11,7 @@
 //
 
 
-#include<headers/zInterface/iterators/zItPointCLoud.h>
+#include<headers/zInterface/iterators/zItPointCloud.h>
 
 //---- ZIT_POINTCLOUD_VERTEX ------------------------------------------------------------------------------
 
@@ -39,10 +39,10 @@ namespace zSpace
 		showBufQuads = false;
 	}
 
-	ZSPACE_INLINE zModel::zModel(int _buffersize)
+	ZSPACE_INLINE zModel::zModel(int _buffersize, bool _headless)
 	{
 
-		displayUtils.bufferObj = zObjBuffer(_buffersize);
+		displayUtils.bufferObj = zObjBuffer(_buffersize, _headless);
 
 		showBufPointColors = false;
 		showBufPoints = false;
@@ -97,6 +97,17 @@ namespace zSpace
 
 	}
 
+	ZSPACE_INLINE void zModel::draw(zUtilsRaster &raster)
+	{
+		if (showBufTris) raster.drawTrianglesFromBuffer(displayUtils.bufferObj, showBufTrisColors);
+
+		if (showBufQuads) raster.drawQuadsFromBuffer(displayUtils.bufferObj, showBufQuadsColors);
+
+		if (showBufLines) raster.drawLinesFromBuffer(displayUtils.bufferObj, showBufLinesColors);
+
+		if (showBufPoints) raster.drawPointsFromBuffer(displayUtils.bufferObj, showBufPointColors);
+	}
+
 	//---- SET METHODS
 
 	ZSPACE_INLINE void zModel::setShowBufPoints(bool _showBufPoints, bool showColors)
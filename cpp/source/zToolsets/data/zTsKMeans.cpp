@@ -23,6 +23,9 @@ namespace zSpace
 	{
 		numClusters = 2;
 		numIterations = 100;
+
+		initType = zKMeansPlusPlus;
+		randomEngine.seed((unsigned int)time(NULL));
 	}
 
 	ZSPACE_INLINE zTsKMeans::zTsKMeans(MatrixXf &_dataPoints)
@@ -32,6 +35,9 @@ namespace zSpace
 
 		numClusters = 2;
 		numIterations = 100;
+
+		initType = zKMeansPlusPlus;
+		randomEngine.seed((unsigned int)time(NULL));
 	}
 
 	ZSPACE_INLINE zTsKMeans::zTsKMeans(MatrixXf &_dataPoints, int &_numClusters, int &_numIterations)
@@ -40,6 +46,9 @@ namespace zSpace
 
 		numClusters = _numClusters;
 		numIterations = _numIterations;
+
+		initType = zKMeansPlusPlus;
+		randomEngine.seed((unsigned int)time(NULL));
 	}
 
 	//---- DESTRUCTOR
@@ -58,6 +67,16 @@ namespace zSpace
 		numIterations = _numIterations;
 	}
 
+	ZSPACE_INLINE void zTsKMeans::setInitType(zKMeansInitType _initType)
+	{
+		initType = _initType;
+	}
+
+	ZSPACE_INLINE void zTsKMeans::setSeed(unsigned int seed)
+	{
+		randomEngine.seed(seed);
+	}
+
 	//---- CLUSTERING METHODS
 
 	ZSPACE_INLINE int zTsKMeans::getKMeansClusters(int &actualNumClusters)
@@ -65,157 +84,232 @@ namespace zSpace
 		int numRows = dataPoints.rows();
 		int numCols = dataPoints.cols();
 
-		// get min max value of the datapoints
-		int minIndex;
-		
-		float minVal = dataPoints.minCoeff();
+		if (numRows == 0) throw std::invalid_argument(" error: no data points to cluster.");
 
-		int maxIndex;
-		float maxVal = dataPoints.maxCoeff();
+		// data points as columns
+		MatrixXf points = dataPoints.transpose();
 
 		// Initialise means
-		MatrixXf tempMeans = intialiseMeans(minVal, maxVal);
+		MatrixXf tempMeans;
 
-		// Initialise container to store cluster index per data point
-		vector<int> clusterIDS;
-		for (int i = 0; i < numRows; i++)
+		if (initType == zKMeansPlusPlus) tempMeans = intialiseMeans_PlusPlus(points);
+		else
 		{
-			clusterIDS.push_back(0);
+			float minVal = dataPoints.minCoeff();
+			float maxVal = dataPoints.maxCoeff();
+
+			tempMeans = intialiseMeans(minVal, maxVal).transpose();
 		}
 
+		// Initial assignment and hamerly bounds
+		zIntArray ids;
+		VectorXf upper, lower;
+		assignClusters(points, tempMeans, ids, upper, lower);
 
-		// Initialise container to store item indicies per cluster
-		vector<vector<int>> tempClusters;
-		for (int i = 0; i < numClusters; i++)
-		{
-			vector<int> temp;
-			tempClusters.push_back(temp);
-		}
+		int numChunks = min(numRows, zThreadPool::getGlobal().numThreads() * 4);
+
+		vector<MatrixXd> chunkSums(numChunks);
+		vector<VectorXi> chunkCounts(numChunks);
+		zIntArray chunkChanges(numChunks, 0);
 
+		VectorXf halfMinDist(numClusters);
+		VectorXf shift(numClusters);
 
 		// compute means
 
 		int numIters = 0;
-		bool exit = false;
+		int numChanges = numRows;
+
 		for (int i = 0; i < numIterations; i++)
 		{
 			numIters = i;
 
-			exit = true;
+			// update means
+			zThreadPool::getGlobal().parallel_for(0, numChunks, [&](int start, int end)
+			{
+				for (int c = start; c < end; c++)
+				{
+					chunkSums[c] = MatrixXd::Zero(numCols, numClusters);
+					chunkCounts[c] = VectorXi::Zero(numClusters);
+
+					for (int j = (int)((long long)c * numRows / numChunks); j < (int)((long long)(c + 1) * numRows / numChunks); j++)
+					{
+						chunkSums[c].col(ids[j]) += points.col(j).cast<double>();
+						chunkCounts[c][ids[j]]++;
+					}
+				}
+			}, 1);
 
-			for (int j = 0; j < numRows; j++)
+			for (int c = 1; c < numChunks; c++)
 			{
-				MatrixXf data = dataPoints.row(j);
+				chunkSums[0] += chunkSums[c];
+				chunkCounts[0] += chunkCounts[c];
+			}
 
-				int clusterID = getClusterIndex(data, tempMeans);
+			for (int j = 0; j < numClusters; j++)
+			{
+				shift[j] = 0;
 
+				// mean of an empty cluster is unchanged
+				if (chunkCounts[0][j] == 0) continue;
 
-				// check if data point changed cluster
-				if (clusterID != clusterIDS[j]) exit = false;
+				VectorXf mean = (chunkSums[0].col(j) / chunkCounts[0][j]).cast<float>();
 
-				clusterIDS[j] = clusterID;
+				shift[j] = (mean - tempMeans.col(j)).norm();
+				tempMeans.col(j) = mean;
+			}
 
+			if (numChanges == 0 || i == numIterations - 1) break;
 
+			// update bounds
+			int maxShiftId;
+			float maxShift = shift.maxCoeff(&maxShiftId);
 
-				// update clusters
-				tempClusters[clusterID].push_back(j);
+			float secondMaxShift = 0;
+			for (int j = 0; j < numClusters; j++) if (j != maxShiftId) secondMaxShift = max(secondMaxShift, shift[j]);
 
+			for (int j = 0; j < numClusters; j++)
+			{
+				halfMinDist[j] = std::numeric_limits<float>::max();
 
+				for (int l = 0; l < numClusters; l++)
+				{
+					if (l != j) halfMinDist[j] = min(halfMinDist[j], 0.5f * (tempMeans.col(j) - tempMeans.col(l)).norm());
+				}
 			}
 
-			// update mean			
-			for (int j = 0; j < numClusters; j++)
+			// reassign data points whose bounds overlap
+			zThreadPool::getGlobal().parallel_for(0, numChunks, [&](int start, int end)
 			{
-				MatrixXf  mean = tempMeans.row(j);
+				VectorXf dists(numClusters);
 
-				for (int l = 0; l < tempClusters[j].size(); l++)
+				for (int c = start; c < end; c++)
 				{
-					int dataId = tempClusters[j][l];
-					MatrixXf data = dataPoints.row(dataId);
+					chunkChanges[c] = 0;
 
-					updateMean(data, mean, l + 1);
-				}		
+					for (int j = (int)((long long)c * numRows / numChunks); j < (int)((long long)(c + 1) * numRows / numChunks); j++)
+					{
+						int clusterID = ids[j];
 
-				tempMeans.row(j) = mean;
-			}
+						upper[j] += shift[clusterID];
+						lower[j] -= (clusterID == maxShiftId) ? secondMaxShift : maxShift;
 
+						float bound = max(halfMinDist[clusterID], lower[j]);
+						if (upper[j] <= bound) continue;
 
+						upper[j] = (points.col(j) - tempMeans.col(clusterID)).norm();
+						if (upper[j] <= bound) continue;
 
-			if (exit) break;
-			else
-			{
-				// clear clusters
-				for (int j = 0; j < numClusters; j++)
-				{
-					tempClusters[j].clear();
-				}
-			}
+						dists = (tempMeans.colwise() - points.col(j)).colwise().squaredNorm().transpose();
+
+						int nearest = 0;
+						float d0 = std::numeric_limits<float>::max();
+						float d1 = std::numeric_limits<float>::max();
+
+						for (int l = 0; l < numClusters; l++)
+						{
+							if (dists[l] < d0) { d1 = d0; d0 = dists[l]; nearest = l; }
+							else if (dists[l] < d1) d1 = dists[l];
+						}
+
+						// check if data point changed cluster
+						if (nearest != clusterID) chunkChanges[c]++;
 
+						ids[j] = nearest;
+						upper[j] = sqrt(d0);
+						lower[j] = sqrt(d1);
+					}
+				}
+			}, 1);
 
+			numChanges = 0;
+			for (int c = 0; c < numChunks; c++) numChanges += chunkChanges[c];
 		}
 
+		setClusters(ids, tempMeans, actualNumClusters);
 
-		// remove cluster with zero elements
-		actualNumClusters = numClusters;
-		clusters.clear();
+		return numIters;
 
-		for (int i = 0; i < numClusters; i++)
-		{
-			if (tempClusters[i].size() != 0)
-			{
-				clusters.push_back(tempClusters[i]);
-			}
-			else actualNumClusters--;
+	}
 
-		}
+	ZSPACE_INLINE int zTsKMeans::getKMeansClusters_MiniBatch(int &actualNumClusters, int batchSize)
+	{
+		int numRows = dataPoints.rows();
 
-		means = MatrixXf(actualNumClusters, tempMeans.cols());
-		int id = 0;
-		for (int i = 0; i < tempMeans.rows(); i++)
+		if (numRows == 0) throw std::invalid_argument(" error: no data points to cluster.");
+		if (batchSize < numClusters) throw std::invalid_argument(" error: batchSize is smaller than the number of clusters.");
+
+		// reinitialise the means from the first batch
+		means.resize(0, 0);
+
+		std::uniform_int_distribution<int> randomRow(0, numRows - 1);
+		MatrixXf batch(batchSize, dataPoints.cols());
+
+		int numIters = 0;
+		for (int i = 0; i < numIterations; i++)
 		{
-			if (tempClusters[i].size() != 0)
-			{
-				for (int j = 0; j < tempMeans.cols(); j++)
-				{
-					means(id, j) = tempMeans(i, j);
-				}
+			numIters = i;
 
-				id++;
-			}
+			for (int j = 0; j < batchSize; j++) batch.row(j) = dataPoints.row(randomRow(randomEngine));
+
+			updateMeans_MiniBatch(batch);
 		}
 
-		return numIters;
+		// assign all data points
+		MatrixXf points = dataPoints.transpose();
+		MatrixXf tempMeans = means.transpose();
 
-	}
+		zIntArray ids;
+		VectorXf upper, lower;
+		assignClusters(points, tempMeans, ids, upper, lower);
 
-	//---- PROTECTED METHODS
+		setClusters(ids, tempMeans, actualNumClusters);
 
-	ZSPACE_INLINE MatrixXf zTsKMeans::intialiseMeans(float &minVal, float &maxVal)
+		return numIters;
+	}
+
+	ZSPACE_INLINE void zTsKMeans::updateMeans_MiniBatch(MatrixXf &batch)
 	{
-		MatrixXf out(numClusters, dataPoints.cols());
+		MatrixXf points = batch.transpose();
+		MatrixXf tempMeans;
 
-		// to generate different random number every time the program runs
-		srand(time(NULL));
+		if (means.rows() != numClusters || means.cols() != batch.cols())
+		{
+			if (batch.rows() < numClusters) throw std::invalid_argument(" error: batch is smaller than the number of clusters.");
 
-		vector<double> randNumbers;
+			tempMeans = intialiseMeans_PlusPlus(points);
+			meanCounts = VectorXi::Zero(numClusters);
+		}
+		else tempMeans = means.transpose();
+
+		zIntArray ids;
+		VectorXf upper, lower;
+		assignClusters(points, tempMeans, ids, upper, lower);
 
-		for (int i = 0; i < out.rows() * out.cols(); i++)
+		// per mean learning rate of 1 / number of data points
+		for (int j = 0; j < points.cols(); j++)
 		{
-			double v = coreUtils.randomNumber_double(minVal, maxVal);
+			int clusterID = ids[j];
 
-			randNumbers.push_back(v);
+			meanCounts[clusterID]++;
+			tempMeans.col(clusterID) += (points.col(j) - tempMeans.col(clusterID)) / (float)meanCounts[clusterID];
 		}
 
-		int id = 0;
+		means = tempMeans.transpose();
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE MatrixXf zTsKMeans::intialiseMeans(float &minVal, float &maxVal)
+	{
+		MatrixXf out(numClusters, dataPoints.cols());
+
+		// drawn from the seeded engine, so setSeed makes the initialisation reproducible
+		std::uniform_real_distribution<float> randomValue(minVal, maxVal);
 
 		for (int i = 0; i < out.rows(); i++)
 		{
-
-			for (int j = 0; j < out.cols(); j++)
-			{
-				out(i, j) = randNumbers[id];
-				id++;
-			}
+			for (int j = 0; j < out.cols(); j++) out(i, j) = randomValue(randomEngine);
 		}
 
 		return out;
@@ -223,31 +317,168 @@ namespace zSpace
 
 	ZSPACE_INLINE int zTsKMeans::getClusterIndex(MatrixXf &data, MatrixXf &means)
 	{
-		double minDist = 10000000;
 		int out = -1;
+		if (means.rows() == 0) return out;
+
+		(means.rowwise() - data.row(0)).rowwise().squaredNorm().minCoeff(&out);
+
+		return out;
+	}
 
-		for (int i = 0; i < means.rows(); i++)
+	ZSPACE_INLINE MatrixXf zTsKMeans::intialiseMeans_PlusPlus(MatrixXf &points)
+	{
+		int numPoints = points.cols();
+
+		MatrixXf out(points.rows(), numClusters);
+
+		int numChunks = min(numPoints, zThreadPool::getGlobal().numThreads() * 4);
+
+		VectorXd minDists = VectorXd::Constant(numPoints, std::numeric_limits<double>::max());
+		VectorXd chunkSums(numChunks);
+
+		std::uniform_int_distribution<int> randomPoint(0, numPoints - 1);
+		std::uniform_real_distribution<double> randomValue(0.0, 1.0);
+
+		// first mean is a random data point
+		out.col(0) = points.col(randomPoint(randomEngine));
+
+		for (int i = 1; i < numClusters; i++)
 		{
-			MatrixXf mean = means.row(i);
+			// squared distance to the nearest chosen mean
+			zThreadPool::getGlobal().parallel_for(0, numChunks, [&](int start, int end)
+			{
+				for (int c = start; c < end; c++)
+				{
+					chunkSums[c] = 0;
 
-			double dist = coreUtils.getEuclideanDistance(data, mean);
+					for (int j = (int)((long long)c * numPoints / numChunks); j < (int)((long long)(c + 1) * numPoints / numChunks); j++)
+					{
+						minDists[j] = min(minDists[j], (double)(points.col(j) - out.col(i - 1)).squaredNorm());
+						chunkSums[c] += minDists[j];
+					}
+				}
+			}, 1);
+
+			double total = chunkSums.sum();
+
+			// all data points coincide with a mean
+			if (total <= 0)
+			{
+				out.col(i) = points.col(randomPoint(randomEngine));
+				continue;
+			}
+
+			// next mean with probability proportional to the squared distance
+			double target = randomValue(randomEngine) * total;
 
-			if (dist < minDist)
+			int c = 0;
+			while (c < numChunks - 1 && target >= chunkSums[c])
 			{
-				minDist = dist;
-				out = i;
+				target -= chunkSums[c];
+				c++;
 			}
+
+			int chunkEnd = (int)((long long)(c + 1) * numPoints / numChunks);
+			int id = chunkEnd - 1;
+
+			for (int j = (int)((long long)c * numPoints / numChunks); j < chunkEnd; j++)
+			{
+				if (target < minDists[j] ) { id = j; break; }
+				target -= minDists[j];
+			}
+
+			out.col(i) = points.col(id);
 		}
 
 		return out;
 	}
 
-	ZSPACE_INLINE void zTsKMeans::updateMean(MatrixXf &data, MatrixXf &mean, int clusterSize)
+	ZSPACE_INLINE void zTsKMeans::assignClusters(MatrixXf &points, MatrixXf &centers, zIntArray &ids, VectorXf &upper, VectorXf &lower)
 	{
-		for (int i = 0; i < mean.cols(); i++)
+		int numPoints = points.cols();
+		int numCenters = centers.cols();
+		int blockSize = 256;
+		int numBlocks = (numPoints + blockSize - 1) / blockSize;
+
+		ids.assign(numPoints, 0);
+		upper.resize(numPoints);
+		lower.resize(numPoints);
+
+		// offset by the centroid of the means to limit cancellation in |x|^2 - 2 x.c + |c|^2
+		VectorXf offset = centers.rowwise().mean();
+		MatrixXf offsetCenters = centers.colwise() - offset;
+		VectorXf centerNorms = offsetCenters.colwise().squaredNorm().transpose();
+
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
 		{
-			mean(0, i) = (mean(0, i) * (clusterSize - 1) + data(0, i)) / clusterSize;
+			MatrixXf block;
+			MatrixXf dists;
+
+			for (int b = start; b < end; b++)
+			{
+				int blockStart = b * blockSize;
+				int blockCount = min(blockSize, numPoints - blockStart);
+
+				block = points.middleCols(blockStart, blockCount).colwise() - offset;
+
+				dists.noalias() = -2.0f * offsetCenters.transpose() * block;
+				dists.colwise() += centerNorms;
+
+				for (int j = 0; j < blockCount; j++)
+				{
+					float pointNorm = block.col(j).squaredNorm();
+
+					int nearest = 0;
+					float d0 = std::numeric_limits<float>::max();
+					float d1 = std::numeric_limits<float>::max();
+
+					for (int l = 0; l < numCenters; l++)
+					{
+						float d = dists(l, j);
+						if (d < d0) { d1 = d0; d0 = d; nearest = l; }
+						else if (d < d1) d1 = d;
+					}
+
+					ids[blockStart + j] = nearest;
+					upper[blockStart + j] = sqrt(max(d0 + pointNorm, 0.0f));
+					lower[blockStart + j] = (numCenters > 1) ? sqrt(max(d1 + pointNorm, 0.0f)) : std::numeric_limits<float>::max();
+				}
+			}
+		}, 1);
+	}
+
+	ZSPACE_INLINE void zTsKMeans::setClusters(zIntArray &ids, MatrixXf &centers, int &actualNumClusters)
+	{
+		int numCenters = centers.cols();
+
+		vector<vector<int>> tempClusters(numCenters);
+		for (int j = 0; j < ids.size(); j++) tempClusters[ids[j]].push_back(j);
+
+		// remove cluster with zero elements
+		actualNumClusters = 0;
+		clusters.clear();
+
+		zIntArray clusterMap(numCenters, -1);
+
+		for (int i = 0; i < numCenters; i++)
+		{
+			if (tempClusters[i].size() != 0)
+			{
+				clusterMap[i] = actualNumClusters;
+				actualNumClusters++;
+
+				clusters.push_back(tempClusters[i]);
+			}
 		}
+
+		means = MatrixXf(actualNumClusters, centers.rows());
+		for (int i = 0; i < numCenters; i++)
+		{
+			if (clusterMap[i] != -1) means.row(clusterMap[i]) = centers.col(i).transpose();
+		}
+
+		clusterIDs.resize(ids.size());
+		for (int j = 0; j < ids.size(); j++) clusterIDs[j] = clusterMap[ids[j]];
 	}
 
 }
\ No newline at end of file
@@ -107,97 +107,152 @@ namespace zSpace
 		fnField.create(minBB - offset, maxBB + offset, _n_X, _n_Y);
 	}
 
-	ZSPACE_INLINE void zTsOSM::createStreets(zColor streetCol)
+	ZSPACE_INLINE void zTsOSM::createSpatialIndex()
 	{
-		vector<zVector>(positions);
-		vector<int>(edgeConnects);
+		vector<string> sqlStm = { "BEGIN TRANSACTION; " };
+
+		// way bounds from their nodes
+		if (zDB->tableExists("ways_nodes") && zDB->tableExists("nodes") && zDB->tableExists("ways_tags"))
+		{
+			sqlStm.push_back("CREATE INDEX IF NOT EXISTS ways_nodes_way_id ON ways_nodes(way_id); ");
+			sqlStm.push_back("CREATE INDEX IF NOT EXISTS ways_tags_id ON ways_tags(id); ");
 
-		unordered_map <string, int> node_streetVertices;
-		map <int, string> streetVertices_Node;
+			sqlStm.push_back("CREATE VIRTUAL TABLE IF NOT EXISTS ways_rtree USING rtree(id, minLat, maxLat, minLon, maxLon); ");
+			sqlStm.push_back("DELETE FROM ways_rtree; ");
+			sqlStm.push_back("INSERT INTO ways_rtree SELECT ways_nodes.way_id, MIN(nodes.lat), MAX(nodes.lat), MIN(nodes.lon), MAX(nodes.lon) FROM ways_nodes INNER JOIN nodes ON nodes.id = ways_nodes.node_id GROUP BY ways_nodes.way_id; ");
+		}
 
+		// building shape bounds, the text shape ids are mapped to the integer ids the R*Tree needs
+		if (zDB->tableExists("building_nodes"))
+		{
+			sqlStm.push_back("CREATE INDEX IF NOT EXISTS building_nodes_shapeId ON building_nodes(shapeId); ");
 
-		vector<string> outStm_nodes;
-		vector<string> sqlStm_nodes = { " SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (SELECT id FROM ways_tags WHERE ways_tags.k = \"highway\")) ;" };
-		bool stat = zDB->sqlCommand(sqlStm_nodes, zSelect, false, outStm_nodes, false);
+			sqlStm.push_back("CREATE TABLE IF NOT EXISTS building_shapes(id INTEGER PRIMARY KEY, shapeId TEXT UNIQUE); ");
+			sqlStm.push_back("DELETE FROM building_shapes; ");
+			sqlStm.push_back("INSERT INTO building_shapes(shapeId) SELECT DISTINCT shapeId FROM building_nodes; ");
 
+			sqlStm.push_back("CREATE VIRTUAL TABLE IF NOT EXISTS building_shapes_rtree USING rtree(id, minLat, maxLat, minLon, maxLon); ");
+			sqlStm.push_back("DELETE FROM building_shapes_rtree; ");
+			sqlStm.push_back("INSERT INTO building_shapes_rtree SELECT building_shapes.id, MIN(building_nodes.lat), MAX(building_nodes.lat), MIN(building_nodes.lon), MAX(building_nodes.lon) FROM building_nodes INNER JOIN building_shapes ON building_shapes.shapeId = building_nodes.shapeId GROUP BY building_shapes.id; ");
 
-		printf("\n outStm_nodes: %i", outStm_nodes.size());
+			if (zDB->tableExists("building_outlines")) sqlStm.push_back("CREATE INDEX IF NOT EXISTS building_outlines_shapeId ON building_outlines(shapeId); ");
+		}
 
-		for (int i = 0; i < outStm_nodes.size(); i += 3)
+		// tube station points
+		if (zDB->tableExists("stations_tube_london"))
 		{
+			sqlStm.push_back("CREATE VIRTUAL TABLE IF NOT EXISTS stations_tube_london_rtree USING rtree(id, minLat, maxLat, minLon, maxLon); ");
+			sqlStm.push_back("DELETE FROM stations_tube_london_rtree; ");
+			sqlStm.push_back("INSERT INTO stations_tube_london_rtree SELECT rowid, lat, lat, lon, lon FROM stations_tube_london; ");
+		}
 
+		sqlStm.push_back("COMMIT TRANSACTION; ");
 
-			string hashKey = outStm_nodes[i];;
-			node_streetVertices[hashKey] = positions.size();
+		vector<string> outStm;
+		bool stat = zDB->sqlCommand(sqlStm, zCreate, false, outStm);
 
-			streetVertices_Node[positions.size()] = hashKey;
+		if (!stat)
+		{
+			zDB->rollbackTransaction();
+			throw std::invalid_argument(" error: spatial index creation failed.");
+		}
 
-			double lat = atof(outStm_nodes[i + 1].c_str());
-			double lon = atof(outStm_nodes[i + 2].c_str());
+		// the cached statements were prepared against the old schema
+		zDB->clearStatementCache();
 
-			zVector pos = computePositionFromCoordinates(lat, lon);
+		printf("\n spatial index created.");
+	}
 
-			positions.push_back(pos);
+	ZSPACE_INLINE void zTsOSM::createStreets(zColor streetCol)
+	{
+		vector<zVector>(positions);
+		vector<int>(edgeConnects);
 
+		unordered_map <long long, int> node_streetVertices;
 
-		}
+		OSMwaysID_zWayId.clear();
+		streetEdges_Way.clear();
 
-		vector<string> outStm_ways;
-		vector<string> sqlStm_ways = { " SELECT * FROM ways_nodes WHERE way_id IN (SELECT id FROM ways_tags WHERE ways_tags.k = \"highway\");" };
-		stat = zDB->sqlCommand(sqlStm_ways, zSelect, false, outStm_ways, false);
+		bool inBounds = zDB->tableExists("ways_rtree");
+		string wayIds = getWayIdsQuery("ways_tags.k = \"highway\"", inBounds);
 
-		printf("\n outStm_ways: %i", outStm_ways.size());
+		// stream the nodes, reading the columns as numbers
+		zDatabaseCursor nodes = zDB->query(" SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (" + wayIds + ")) ;");
+		if (inBounds) bindBounds(nodes);
 
-		way = new zWays[outStm_ways.size()];
-		n_zWays = 0;
-
-		for (int i = 0; i < outStm_ways.size() - 3; i += 3)
+		while (nodes.step())
 		{
-			if (i != 0) i -= 3;
+			node_streetVertices[nodes.getInt64(0)] = positions.size();
 
-			string wayId = outStm_ways[i];
+			double lat = nodes.getDouble(1);
+			double lon = nodes.getDouble(2);
 
-			way[n_zWays].id = n_zWays;
-			way[n_zWays].OS_wayId = wayId;
+			zVector pos = computePositionFromCoordinates(lat, lon);
 
-			way[n_zWays].streetType = getStreetType(wayId);
+			positions.push_back(pos);
+		}
 
-			// map
-			OSMwaysID_zWayId[wayId] = n_zWays;
+		printf("\n nodes: %i", positions.size());
+
+		// stream the ways, the nodes of a way are in consecutive rows
+		vector<zWays> streetWays;
+
+		zDatabaseCursor ways = zDB->query(" SELECT * FROM ways_nodes WHERE way_id IN (" + wayIds + ") ORDER BY rowid;");
+		if (inBounds) bindBounds(ways);
+
+		string wayId;
+		int prevVertex = -1;
+		int numRows = 0;
+
+		while (ways.step())
+		{
+			std::string_view rowWayId = ways.getText(0);
 
-			while (outStm_ways[i] == wayId && i < outStm_ways.size() - 3)
+			if (streetWays.size() == 0 || rowWayId != wayId)
 			{
-				string hashKey = outStm_ways[i + 1];
-				std::unordered_map<string, int>::const_iterator got = node_streetVertices.find(hashKey);
+				wayId = string(rowWayId);
+				prevVertex = -1;
 
-				if (got != node_streetVertices.end())
-				{
-					if (outStm_ways[i + 3] == wayId)
-					{
-						string hashKey1 = outStm_ways[i + 3 + 1].c_str();
-						std::unordered_map<string, int>::const_iterator got1 = node_streetVertices.find(hashKey1);
+				zWays temp;
+				temp.id = streetWays.size();
+				temp.OS_wayId = wayId;
+				temp.streetType = getStreetType(wayId);
 
-						if (got1 != node_streetVertices.end())
-						{
-							way[n_zWays].streetGraph_edgeId.push_back(edgeConnects.size());
-							streetEdges_Way[edgeConnects.size()] = wayId;
-							edgeConnects.push_back(got->second);
+				// map
+				OSMwaysID_zWayId[wayId] = temp.id;
 
-							way[n_zWays].streetGraph_edgeId.push_back(edgeConnects.size());
-							streetEdges_Way[edgeConnects.size()] = wayId;
-							edgeConnects.push_back(got1->second);
+				streetWays.push_back(temp);
+			}
 
-						}
+			int vertex = -1;
 
-					}
-				}
+			std::unordered_map<long long, int>::const_iterator got = node_streetVertices.find(ways.getInt64(1));
+			if (got != node_streetVertices.end()) vertex = got->second;
+
+			if (prevVertex != -1 && vertex != -1)
+			{
+				zWays &temp = streetWays.back();
+
+				temp.streetGraph_edgeId.push_back(edgeConnects.size());
+				streetEdges_Way[edgeConnects.size()] = wayId;
+				edgeConnects.push_back(prevVertex);
 
-				i += 3;
+				temp.streetGraph_edgeId.push_back(edgeConnects.size());
+				streetEdges_Way[edgeConnects.size()] = wayId;
+				edgeConnects.push_back(vertex);
 			}
 
-			n_zWays++;
+			prevVertex = vertex;
+			numRows++;
 		}
 
+		printf("\n ways_nodes: %i", numRows);
+
+		n_zWays = streetWays.size();
+		way = new zWays[n_zWays];
+
+		for (int i = 0; i < n_zWays; i++) way[i] = std::move(streetWays[i]);
+
 		fnStreet.create(positions, edgeConnects);
 		fnStreet.setEdgeColor(streetCol, false);
 
@@ -208,94 +263,91 @@ namespace zSpace
 		vector<zVector>(positions);
 		vector<int>(edgeConnects);
 
-		unordered_map <string, int> node_buildingVertices;
-		map <int, string> buildingVertices_Node;
+		unordered_map <long long, int> node_buildingVertices;
 
+		OSMwaysID_zBuildingsId.clear();
+		buildingEdges_Building.clear();
 
-		vector<string> outStm_nodes;
-		vector<string> sqlStm_nodes = { " SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (SELECT id FROM ways_tags WHERE ways_tags.k = \"building\")) ;" };
-		bool stat = zDB->sqlCommand(sqlStm_nodes, zSelect, false, outStm_nodes, false);
+		bool inBounds = zDB->tableExists("ways_rtree");
+		string wayIds = getWayIdsQuery("ways_tags.k = \"building\"", inBounds);
 
-		printf("\n outStm_nodes: %i", outStm_nodes.size());
+		// stream the nodes, reading the columns as numbers
+		zDatabaseCursor nodes = zDB->query(" SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (" + wayIds + ")) ;");
+		if (inBounds) bindBounds(nodes);
 
-		for (int i = 0; i < outStm_nodes.size(); i += 3)
+		while (nodes.step())
 		{
+			node_buildingVertices[nodes.getInt64(0)] = positions.size();
 
-
-			string hashKey = outStm_nodes[i];;
-			node_buildingVertices[hashKey] = positions.size();
-
-			buildingVertices_Node[positions.size()] = hashKey;
-
-			double lat = atof(outStm_nodes[i + 1].c_str());
-			double lon = atof(outStm_nodes[i + 2].c_str());
+			double lat = nodes.getDouble(1);
+			double lon = nodes.getDouble(2);
 
 			zVector pos = computePositionFromCoordinates(lat, lon);
 
 			positions.push_back(pos);
-
-
 		}
 
-		vector<string> outStm_ways;
-		vector<string> sqlStm_ways = { " SELECT * FROM ways_nodes WHERE way_id IN (SELECT id FROM ways_tags WHERE ways_tags.k = \"building\");" };
-		stat = zDB->sqlCommand(sqlStm_ways, zSelect, false, outStm_ways, false);
-
-		printf("\n outStm_ways: %i", outStm_ways.size());
-
-		buildings = new zBuildings[outStm_ways.size()];
-		n_zBuildings = 0;
+		printf("\n nodes: %i", positions.size());
 
-		for (int i = 0; i < outStm_ways.size() - 3; i += 3)
-		{
-			if (i != 0) i -= 3;
-
-			string wayId = outStm_ways[i];
+		// stream the ways, the nodes of a way are in consecutive rows
+		vector<zBuildings> graphBuildings;
 
-			buildings[n_zBuildings].id = n_zBuildings;
-			buildings[n_zBuildings].OS_wayId = wayId;
+		zDatabaseCursor ways = zDB->query(" SELECT * FROM ways_nodes WHERE way_id IN (" + wayIds + ") ORDER BY rowid;");
+		if (inBounds) bindBounds(ways);
 
-			buildings[n_zBuildings].buildingType = getBuildingType(wayId);
+		string wayId;
+		int prevVertex = -1;
+		int numRows = 0;
 
-			// map
-			OSMwaysID_zBuildingsId[wayId] = n_zBuildings;
+		while (ways.step())
+		{
+			std::string_view rowWayId = ways.getText(0);
 
-			while (outStm_ways[i] == wayId && i < outStm_ways.size() - 3)
+			if (graphBuildings.size() == 0 || rowWayId != wayId)
 			{
-				string hashKey = outStm_ways[i + 1];
-				std::unordered_map<string, int>::const_iterator got = node_buildingVertices.find(hashKey);
+				wayId = string(rowWayId);
+				prevVertex = -1;
 
-				if (got != node_buildingVertices.end())
-				{
-					if (outStm_ways[i + 3] == wayId)
-					{
+				zBuildings temp;
+				temp.id = graphBuildings.size();
+				temp.OS_wayId = wayId;
+				temp.buildingType = getBuildingType(wayId);
 
+				// map
+				OSMwaysID_zBuildingsId[wayId] = temp.id;
 
-						string hashKey1 = outStm_ways[i + 3 + 1].c_str();
-						std::unordered_map<string, int>::const_iterator got1 = node_buildingVertices.find(hashKey1);
+				graphBuildings.push_back(temp);
+			}
 
+			int vertex = -1;
 
-						if (got1 != node_buildingVertices.end())
-						{
-							buildings[n_zBuildings].buildingGraph_edgeId.push_back(edgeConnects.size());
-							buildingEdges_Building[edgeConnects.size()] = wayId;
-							edgeConnects.push_back(got->second);
+			std::unordered_map<long long, int>::const_iterator got = node_buildingVertices.find(ways.getInt64(1));
+			if (got != node_buildingVertices.end()) vertex = got->second;
 
-							buildings[n_zBuildings].buildingGraph_edgeId.push_back(edgeConnects.size());
-							buildingEdges_Building[edgeConnects.size()] = wayId;
-							edgeConnects.push_back(got1->second);
+			if (prevVertex != -1 && vertex != -1)
+			{
+				zBuildings &temp = graphBuildings.back();
 
-						}
+				temp.buildingGraph_edgeId.push_back(edgeConnects.size());
+				buildingEdges_Building[edgeConnects.size()] = wayId;
+				edgeConnects.push_back(prevVertex);
 
-					}
-				}
-
-				i += 3;
+				temp.buildingGraph_edgeId.push_back(edgeConnects.size());
+				buildingEdges_Building[edgeConnects.size()] = wayId;
+				edgeConnects.push_back(vertex);
 			}
 
-			n_zBuildings++;
+			prevVertex = vertex;
+			numRows++;
 		}
 
+		printf("\n ways_nodes: %i", numRows);
+
+		n_zBuildings = graphBuildings.size();
+		buildings = new zBuildings[n_zBuildings];
+
+		for (int i = 0; i < n_zBuildings; i++) buildings[i] = std::move(graphBuildings[i]);
+
 		printf(" \n num Buildings %i ", n_zBuildings);
 
 		fnGraphBuilding.create(positions, edgeConnects);
@@ -453,69 +505,80 @@ namespace zSpace
 		vector<int>(polyConnects);
 		vector<int>(polyCounts);
 
+		OSMwaysID_zBuildingsId.clear();
 
-		unordered_map <string, int> node_buildingVertices;
-		map <int, string> buildingVertices_Node;
-
-
-		vector<string> outStm_nodes;
-		vector<string> sqlStm_nodes = { " SELECT * FROM building_nodes WHERE shapeId IN (SELECT DISTINCT shapeId FROM building_nodes WHERE lat >=" + to_string(lat_lon[0])
-			+ " AND lat <= " + to_string(lat_lon[2]) + " AND lon >=" + to_string(lat_lon[1]) + " AND lon <=" + to_string(lat_lon[3]) + ")  ORDER BY rowid;" };
-		bool stat = zDB->sqlCommand(sqlStm_nodes, zSelect, false, outStm_nodes, false);
-
-		printf("\n outStm_nodes: %i", outStm_nodes.size());
-
-		buildings = new zBuildings[outStm_nodes.size()];
-		n_zBuildings = 0;
-
+		// shapes with a node in the bounds, found through the shape bounds if the spatial index exists
+		string shapeIds = "SELECT DISTINCT shapeId FROM building_nodes WHERE lat >= ?1 AND lat <= ?3 AND lon >= ?2 AND lon <= ?4";
 
-
-		for (int i = 0; i < outStm_nodes.size() - 3; i += 3)
+		if (zDB->tableExists("building_shapes_rtree"))
 		{
-			string hashKey = outStm_nodes[i];;
-			int pCounts = 0;
+			shapeIds = "SELECT building_shapes.shapeId FROM building_shapes_rtree CROSS JOIN building_shapes ON building_shapes.id = building_shapes_rtree.id";
+			shapeIds += " WHERE building_shapes_rtree.maxLat >= ?1 AND building_shapes_rtree.minLat <= ?3 AND building_shapes_rtree.maxLon >= ?2 AND building_shapes_rtree.minLon <= ?4";
+			shapeIds += " AND EXISTS (SELECT 1 FROM building_nodes WHERE building_nodes.shapeId = building_shapes.shapeId AND lat >= ?1 AND lat <= ?3 AND lon >= ?2 AND lon <= ?4)";
+		}
 
+		// stream the building nodes, the nodes of a shape are in consecutive rows
+		vector<zBuildings> meshBuildings;
 
+		string shapeId;
+		zPointArray shapePositions;
+		int numRows = 0;
 
-			vector<int> tempConnects;
+		auto addShape = [&]()
+		{
+			vector<string> parts = coreUtils.splitString(shapeId, ".");
 
-			while (outStm_nodes[i] == hashKey)
+			if (shapePositions.size() >= 3 && parts.size() == 1)
 			{
-				tempConnects.push_back(positions.size());
+				polyCounts.push_back(shapePositions.size());
 
-				double lat = atof(outStm_nodes[i + 1].c_str());
-				double lon = atof(outStm_nodes[i + 2].c_str());
+				for (auto &pos : shapePositions)
+				{
+					polyConnects.push_back(positions.size());
+					positions.push_back(pos);
+				}
 
-				zVector pos = computePositionFromCoordinates(lat, lon);
+				zBuildings temp;
+				temp.id = meshBuildings.size();
+				temp.OS_wayId = shapeId;
 
-				positions.push_back(pos);
-				pCounts++;
+				// map
+				OSMwaysID_zBuildingsId[shapeId] = temp.id;
 
-				i += 3;
+				meshBuildings.push_back(temp);
 			}
 
-			vector<string> parts = coreUtils.splitString(hashKey, ".");
+			shapePositions.clear();
+		};
 
+		zDatabaseCursor nodes = zDB->query(" SELECT * FROM building_nodes WHERE shapeId IN (" + shapeIds + ")  ORDER BY rowid;");
+		bindBounds(nodes);
 
-			if (pCounts >= 3 && parts.size() == 1)
-			{
-				polyCounts.push_back(pCounts);
+		while (nodes.step())
+		{
+			std::string_view rowShapeId = nodes.getText(0);
 
-				for (auto id : tempConnects) polyConnects.push_back(id);
+			if (numRows == 0 || rowShapeId != shapeId)
+			{
+				if (numRows > 0) addShape();
+				shapeId = string(rowShapeId);
+			}
 
-				buildings[n_zBuildings].id = n_zBuildings;
-				buildings[n_zBuildings].OS_wayId = hashKey;
+			double lat = nodes.getDouble(1);
+			double lon = nodes.getDouble(2);
 
-				// map
-				OSMwaysID_zBuildingsId[hashKey] = n_zBuildings;
+			shapePositions.push_back(computePositionFromCoordinates(lat, lon));
+			numRows++;
+		}
 
-				n_zBuildings++;
-			}
+		if (numRows > 0) addShape();
 
-			i -= 3;
-		}
+		printf("\n building_nodes: %i", numRows);
 
+		n_zBuildings = meshBuildings.size();
+		buildings = new zBuildings[n_zBuildings];
 
+		for (int i = 0; i < n_zBuildings; i++) buildings[i] = std::move(meshBuildings[i]);
 
 		fnBuilding.create(positions, polyCounts, polyConnects);
 		fnBuilding.setFaceColor(buildingCol, false);
@@ -523,26 +586,16 @@ namespace zSpace
 		zVector *pos = fnBuilding.getRawVertexPositions();
 
 		// get Building Heights
-		vector<string> outStm_heights;
-		vector<string> sqlStm_heights = { " SELECT shapeId, buildingHeight FROM building_outlines WHERE shapeId IN (SELECT DISTINCT shapeId FROM building_nodes WHERE lat >=" + to_string(lat_lon[0])
-			+ " AND lat <= " + to_string(lat_lon[2]) + " AND lon >=" + to_string(lat_lon[1]) + " AND lon <=" + to_string(lat_lon[3]) + ")  ORDER BY rowid;" };
-		stat = zDB->sqlCommand(sqlStm_heights, zSelect, false, outStm_heights, false);
-
-		printf("\n outStm_heights: %i", outStm_heights.size());
-
+		zDatabaseCursor heights = zDB->query(" SELECT shapeId, buildingHeight FROM building_outlines WHERE shapeId IN (" + shapeIds + ")  ORDER BY rowid;");
+		bindBounds(heights);
 
-
-		for (int i = 0; i < outStm_heights.size(); i += 2)
+		while (heights.step())
 		{
-			string shapeId = outStm_heights[i];
-
-			std::unordered_map<string, int>::const_iterator got = OSMwaysID_zBuildingsId.find(shapeId);
+			std::unordered_map<string, int>::const_iterator got = OSMwaysID_zBuildingsId.find(string(heights.getText(0)));
 
-			if (got != node_buildingVertices.end())
+			if (got != OSMwaysID_zBuildingsId.end())
 			{
-				buildings[got->second].height = atof(outStm_heights[i + 1].c_str());
-
-				//printf("\n %i %1.2f ", got->second, atof(outStm_heights[i + 1].c_str()));
+				buildings[got->second].height = heights.getDouble(1);
 
 				zItMeshFace f(*buildingObj, got->second);
 
@@ -551,14 +604,8 @@ namespace zSpace
 
 				for (auto vID : fVerts) pos[vID].z = buildings[got->second].height *0.001 * scaleFactor;
 			}
-
 		}
 
-
-
-
-
-
 	}
 
 	ZSPACE_INLINE void zTsOSM::getPostcodesPrices()
@@ -622,31 +669,32 @@ namespace zSpace
 
 	ZSPACE_INLINE void zTsOSM::getTubeStations()
 	{
-		vector<string> outStm_tubenodes;
-
-		vector<string> sqlStm_tubenodes = { "SELECT * FROM stations_tube_london WHERE lat >= " + to_string(lat_lon[0])
-					+ " AND lat <= " + to_string(lat_lon[2]) + " AND lon >=" + to_string(lat_lon[1]) + " AND lon <=" + to_string(lat_lon[3]) + ";" };
-
-
-		//vector<string> sqlStm_tubenodes = { "SELECT * FROM stations_tube_london;" };
+		string sql = "SELECT * FROM stations_tube_london WHERE lat >= ?1 AND lat <= ?3 AND lon >= ?2 AND lon <= ?4;";
 
-		bool stat = zDB->sqlCommand(sqlStm_tubenodes, zSelect, false, outStm_tubenodes, false);
+		if (zDB->tableExists("stations_tube_london_rtree"))
+		{
+			sql = "SELECT stations_tube_london.* FROM stations_tube_london_rtree CROSS JOIN stations_tube_london ON stations_tube_london.rowid = stations_tube_london_rtree.id";
+			sql += " WHERE stations_tube_london_rtree.maxLat >= ?1 AND stations_tube_london_rtree.minLat <= ?3 AND stations_tube_london_rtree.maxLon >= ?2 AND stations_tube_london_rtree.minLon <= ?4";
+			sql += " AND lat >= ?1 AND lat <= ?3 AND lon >= ?2 AND lon <= ?4 ORDER BY stations_tube_london.rowid;";
+		}
 
-		printf("\n outStm_tubenodes: %i", outStm_tubenodes.size());
+		zDatabaseCursor tubenodes = zDB->query(sql);
+		bindBounds(tubenodes);
 
 		tubeStations.clear();
 
-		for (int i = 0; i < outStm_tubenodes.size(); i += 5)
+		while (tubenodes.step())
 		{
-
-			double lat = atof(outStm_tubenodes[i + 1].c_str());
-			double lon = atof(outStm_tubenodes[i + 2].c_str());
+			double lat = tubenodes.getDouble(1);
+			double lon = tubenodes.getDouble(2);
 
 			zVector pos = computePositionFromCoordinates(lat, lon);
 
 			tubeStations.push_back(pos);
 		}
 
+		printf("\n tubenodes: %i", tubeStations.size());
+
 
 	}
 
@@ -675,30 +723,26 @@ namespace zSpace
 
 	ZSPACE_INLINE void zTsOSM::getParks()
 	{
-		vector<string> outStm_parknodes;
-
-		vector<string> sqlStm_parknodes = { "SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (SELECT id FROM ways_tags WHERE ways_tags.k = \"leisure\" AND ways_tags.v = \"park\")) ;" };
+		bool inBounds = zDB->tableExists("ways_rtree");
+		string wayIds = getWayIdsQuery("ways_tags.k = \"leisure\" AND ways_tags.v = \"park\"", inBounds);
 
-
-		//vector<string> sqlStm_tubenodes = { "SELECT * FROM stations_tube_london;" };
-
-		bool stat = zDB->sqlCommand(sqlStm_parknodes, zSelect, false, outStm_parknodes, false);
-
-		printf("\n outStm_parknodes: %i", outStm_parknodes.size());
+		zDatabaseCursor parknodes = zDB->query("SELECT * FROM nodes WHERE id IN (SELECT node_id FROM ways_nodes WHERE way_id IN (" + wayIds + ")) ;");
+		if (inBounds) bindBounds(parknodes);
 
 		parks.clear();
 
-		for (int i = 0; i < outStm_parknodes.size(); i += 3)
+		while (parknodes.step())
 		{
-
-			double lat = atof(outStm_parknodes[i + 1].c_str());
-			double lon = atof(outStm_parknodes[i + 2].c_str());
+			double lat = parknodes.getDouble(1);
+			double lon = parknodes.getDouble(2);
 
 			zVector pos = computePositionFromCoordinates(lat, lon);
 
 			parks.push_back(pos);
 		}
 
+		printf("\n parknodes: %i", parks.size());
+
 
 	}
 
@@ -727,33 +771,38 @@ namespace zSpace
 
 	//---- GET METHODS
 
-	ZSPACE_INLINE zDataStreet zTsOSM::getStreetType(string wayId)
+	ZSPACE_INLINE bool zTsOSM::hasSpatialIndex()
 	{
-		vector<string> outStm;
-		vector<string> sqlStm = { "SELECT v FROM ways_tags WHERE ways_tags.id = " + wayId + ";" };
-		bool stat = zDB->sqlCommand(sqlStm, zSelect, false, outStm, false);
-
+		return (zDB->tableExists("ways_rtree") || zDB->tableExists("building_shapes_rtree"));
+	}
 
+	ZSPACE_INLINE zDataStreet zTsOSM::getStreetType(string wayId)
+	{
+		// cached statement, the way id is bound as a number like the literal it replaces
+		zDatabaseCursor cursor = zDB->query("SELECT v FROM ways_tags WHERE ways_tags.id = ?;");
+		cursor.bindInt64(1, stoll(wayId));
 
 		zDataStreet out = zUndefinedStreet;
 
-		if (outStm.size() > 0)
+		if (cursor.step())
 		{
-			if (outStm[0] == "trunk" || outStm[0] == "trunk_link") out = zTrunkStreet;
+			std::string_view v = cursor.getText(0);
+
+			if (v == "trunk" || v == "trunk_link") out = zTrunkStreet;
 
-			if (outStm[0] == "primary" || outStm[0] == "primary_link") out = zPrimaryStreet;
+			if (v == "primary" || v == "primary_link") out = zPrimaryStreet;
 
-			if (outStm[0] == "secondary" || outStm[0] == "secondary_link") out = zSecondaryStreet;
+			if (v == "secondary" || v == "secondary_link") out = zSecondaryStreet;
 
-			if (outStm[0] == "tertiary" || outStm[0] == "tertiary_link") out = zTertiaryStreet;
+			if (v == "tertiary" || v == "tertiary_link") out = zTertiaryStreet;
 
-			if (outStm[0] == "residential" || outStm[0] == "living_street") out = zResidentialStreet;
+			if (v == "residential" || v == "living_street") out = zResidentialStreet;
 
-			if (outStm[0] == "pedestrian" || outStm[0] == "footway") out = zPrimaryStreet;
+			if (v == "pedestrian" || v == "footway") out = zPrimaryStreet;
 
-			if (outStm[0] == "cycleway") out = zCycleStreet;
+			if (v == "cycleway") out = zCycleStreet;
 
-			if (outStm[0] == "service") out = zServiceStreet;
+			if (v == "service") out = zServiceStreet;
 
 		}
 
@@ -820,26 +869,26 @@ namespace zSpace
 
 	ZSPACE_INLINE zDataBuilding zTsOSM::getBuildingType(string wayId)
 	{
-		vector<string> outStm;
-		vector<string> sqlStm = { "SELECT v FROM ways_tags WHERE ways_tags.id = " + wayId + ";" };
-		bool stat = zDB->sqlCommand(sqlStm, zSelect, false, outStm, false);
-
-
+		// cached statement, the way id is bound as a number like the literal it replaces
+		zDatabaseCursor cursor = zDB->query("SELECT v FROM ways_tags WHERE ways_tags.id = ?;");
+		cursor.bindInt64(1, stoll(wayId));
 
 		zDataBuilding out = zUndefinedBuilding;
 
-		if (outStm.size() > 0)
+		if (cursor.step())
 		{
-			if (outStm[0] == "office" || outStm[0] == "commercial" || outStm[0] == "hotel" || outStm[0] == "theatre" || outStm[0] == "retail") out = zCommercialBuilding;
-			if (outStm[0] == "Commercial" || outStm[0] == "Arts_&_Office_Complex" || outStm[0] == "shop" || outStm[0] == "offices") out = zCommercialBuilding;
+			std::string_view v = cursor.getText(0);
+
+			if (v == "office" || v == "commercial" || v == "hotel" || v == "theatre" || v == "retail") out = zCommercialBuilding;
+			if (v == "Commercial" || v == "Arts_&_Office_Complex" || v == "shop" || v == "offices") out = zCommercialBuilding;
 
-			if (outStm[0] == "apartments" || outStm[0] == "flats" || outStm[0] == "residential" || outStm[0] == "council_flats") out = zResidentialBuilding;
-			if (outStm[0] == "house" || outStm[0] == "hall_of_residence" || outStm[0] == "Student hostel") out = zResidentialBuilding;
+			if (v == "apartments" || v == "flats" || v == "residential" || v == "council_flats") out = zResidentialBuilding;
+			if (v == "house" || v == "hall_of_residence" || v == "Student hostel") out = zResidentialBuilding;
 
-			if (outStm[0] == "gallery" || outStm[0] == "hospital" || outStm[0] == "church" || outStm[0] == "place_of_worship" || outStm[0] == "museum" || outStm[0] == "cathedral") out = zPublicBuilding;
-			if (outStm[0] == "railway_station" || outStm[0] == "Community_Building" || outStm[0] == "train_station" || outStm[0] == "station" || outStm[0] == "civic") out = zPublicBuilding;
+			if (v == "gallery" || v == "hospital" || v == "church" || v == "place_of_worship" || v == "museum" || v == "cathedral") out = zPublicBuilding;
+			if (v == "railway_station" || v == "Community_Building" || v == "train_station" || v == "station" || v == "civic") out = zPublicBuilding;
 
-			if (outStm[0] == "school" || outStm[0] == "university" || outStm[0] == "college" || outStm[0] == "Nursery,_School") out = zUniversityBuilding;
+			if (v == "school" || v == "university" || v == "college" || v == "Nursery,_School") out = zUniversityBuilding;
 
 		}
 
@@ -1384,4 +1433,86 @@ namespace zSpace
 
 	}
 
-}
\ No newline at end of file
+	//---- PRIVATE METHODS
+
+	ZSPACE_INLINE void zTsOSM::bindBounds(zDatabaseCursor &cursor)
+	{
+		cursor.bindDouble(1, lat_lon[0]);
+		cursor.bindDouble(2, lat_lon[1]);
+		cursor.bindDouble(3, lat_lon[2]);
+		cursor.bindDouble(4, lat_lon[3]);
+	}
+
+	ZSPACE_INLINE string zTsOSM::getWayIdsQuery(string tagCondition, bool inBounds)
+	{
+		if (!inBounds) return "SELECT id FROM ways_tags WHERE " + tagCondition;
+
+		string out = "SELECT ways_rtree.id FROM ways_rtree WHERE ways_rtree.maxLat >= ?1 AND ways_rtree.minLat <= ?3 AND ways_rtree.maxLon >= ?2 AND ways_rtree.minLon <= ?4";
+		out += " AND EXISTS (SELECT 1 FROM ways_tags WHERE ways_tags.id = ways_rtree.id AND " + tagCondition + ")";
+
+		return out;
+	}
+
+	ZSPACE_INLINE bool zTsOSM::readCoordinatesCSV(string infilename, zUtilsTextReader &csvFile, zDoubleArray &lats, zDoubleArray &lons, vector<zUtilsTextToken> &dataTokens)
+	{
+		lats.clear();
+		lons.clear();
+		dataTokens.clear();
+
+		if (!csvFile.read(infilename)) return false;
+
+		// count the records of each line block
+		int numBlocks = csvFile.numLineBlocks();
+		zIntArray blockRecords(numBlocks + 1, 0);
+
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
+		{
+			vector<zUtilsTextToken> perlineData;
+
+			for (int b = start; b < end; b++)
+			{
+				int lineStart, lineEnd;
+				csvFile.getLineBlock(b, lineStart, lineEnd);
+
+				for (int l = lineStart; l < lineEnd; l++)
+				{
+					if (csvFile.getTokens(l, ",", perlineData) == 3 && !csvFile.equals(perlineData[0], " ")) blockRecords[b + 1]++;
+				}
+			}
+		}, 1);
+
+		for (int b = 0; b < numBlocks; b++) blockRecords[b + 1] += blockRecords[b];
+
+		lats.assign(blockRecords[numBlocks], 0.0);
+		lons.assign(blockRecords[numBlocks], 0.0);
+		dataTokens.assign(blockRecords[numBlocks], zUtilsTextToken());
+
+		// parse each line block into the preallocated records
+		zThreadPool::getGlobal().parallel_for(0, numBlocks, [&](int start, int end)
+		{
+			vector<zUtilsTextToken> perlineData;
+
+			for (int b = start; b < end; b++)
+			{
+				int lineStart, lineEnd;
+				csvFile.getLineBlock(b, lineStart, lineEnd);
+
+				int r = blockRecords[b];
+
+				for (int l = lineStart; l < lineEnd; l++)
+				{
+					if (csvFile.getTokens(l, ",", perlineData) == 3 && !csvFile.equals(perlineData[0], " "))
+					{
+						lats[r] = csvFile.toDouble(perlineData[0]);
+						lons[r] = csvFile.toDouble(perlineData[1]);
+						dataTokens[r] = perlineData[2];
+						r++;
+					}
+				}
+			}
+		}, 1);
+
+		return true;
+	}
+
+}
@@ -11,7 +11,7 @@
 //
 
 
-#include<headers/zToolsets/digiFab/zTsRobot.h>
+#include<headers/zToolsets/digifab/zTsRobot.h>
 
 //---- ZLINK ------------------------------------------------------------------------------
 
@@ -40,25 +40,30 @@ namespace zSpace
 
 	ZSPACE_INLINE void zLink::updateTransform()
 	{
-		T(0, 0) = cos(linkDH.theta);
-		T(0, 1) = -sin(linkDH.theta) * cos(linkDH.alpha);
-		T(0, 2) = sin(linkDH.theta) * sin(linkDH.alpha);
-		T(0, 3) = linkDH.a * cos(linkDH.theta);
-
-		T(1, 0) = sin(linkDH.theta);
-		T(1, 1) = cos(linkDH.theta) * cos(linkDH.alpha);
-		T(1, 2) = -cos(linkDH.theta)*sin(linkDH.alpha);
-		T(1, 3) = linkDH.a * sin(linkDH.theta);
-
-		T(2, 0) = 0;
-		T(2, 1) = sin(linkDH.alpha);
-		T(2, 2) = cos(linkDH.alpha);
-		T(2, 3) = linkDH.d;
-
-		T(3, 0) = 0;
-		T(3, 1) = 0;
-		T(3, 2) = 0;
-		T(3, 3) = 1;
+		computeTransform(linkDH.theta, T);
+	}
+
+	ZSPACE_INLINE void zLink::computeTransform(double theta, zTransform &outT) const
+	{
+		outT(0, 0) = cos(theta);
+		outT(0, 1) = -sin(theta) * cos(linkDH.alpha);
+		outT(0, 2) = sin(theta) * sin(linkDH.alpha);
+		outT(0, 3) = linkDH.a * cos(theta);
+
+		outT(1, 0) = sin(theta);
+		outT(1, 1) = cos(theta) * cos(linkDH.alpha);
+		outT(1, 2) = -cos(theta)*sin(linkDH.alpha);
+		outT(1, 3) = linkDH.a * sin(theta);
+
+		outT(2, 0) = 0;
+		outT(2, 1) = sin(linkDH.alpha);
+		outT(2, 2) = cos(linkDH.alpha);
+		outT(2, 3) = linkDH.d;
+
+		outT(3, 0) = 0;
+		outT(3, 1) = 0;
+		outT(3, 2) = 0;
+		outT(3, 3) = 1;
 	}
 }
 
@@ -410,6 +415,127 @@ namespace zSpace
 		return out;
 	}
 
+	ZSPACE_INLINE void zTsRobot::inverseKinematicsBatch(vector<zTransform> &targets, vector<zIKSolution> &solutions, double tolerance, int grainSize)
+	{
+		if (Bars.size() < DOF) throw std::invalid_argument(" error: robot links not created.");
+
+		int numTargets = targets.size();
+		solutions.assign(numTargets, zIKSolution());
+
+		// relevant joint lengths
+		double a1 = Bars[1].linkDH.a;
+		double a2 = sqrt(Bars[2].linkDH.a * Bars[2].linkDH.a + Bars[3].linkDH.d * Bars[3].linkDH.d);
+		double dq2 = atan2(Bars[2].linkDH.a, Bars[3].linkDH.d);
+
+		// closed form solution of each target, as in inverseKinematics, checked with the forward chain
+		zThreadPool::getGlobal().parallel_for(0, numTargets, [&](int start, int end)
+		{
+			zTransform linkT[DOF];
+
+			for (int i = start; i < end; i++)
+			{
+				zIKSolution &sol = solutions[i];
+
+				zTransform target = targets[i].transpose();
+				zTransform Target_J6 = target * robot_endEffector_matrix;
+
+				// CALCULATE WRIST CENTER
+				zVector wristC = zVector(Target_J6(0, 3), Target_J6(1, 3), Target_J6(2, 3));
+				wristC -= (zVector(Target_J6(0, 2), Target_J6(1, 2), Target_J6(2, 2)) * Bars[5].linkDH.d * 1);
+
+				// CALCULATE FIRST 3 ANGLES
+				double th0 = atan2(wristC.y, wristC.x);
+
+				double r = sqrt(wristC.x * wristC.x + wristC.y * wristC.y) - Bars[0].linkDH.a;
+				double s = Bars[0].linkDH.d - wristC.z;
+
+				double d = (r * r + s * s - a1 * a1 - a2 * a2) / (2.0 * a1 * a2);
+				double th2 = atan2(sqrt(1.0 - d * d), d);
+
+				double k1 = a1 + a2 * cos(th2);
+				double k2 = a2 * sin(th2);
+				double th1 = atan2(s, r) - atan2(k2, k1);
+
+				sol.rotations[0] = th0 * RAD_TO_DEG;
+				sol.rotations[1] = (th1)* RAD_TO_DEG;
+				sol.rotations[2] = (((th2 + dq2) * RAD_TO_DEG) - 90) * 1;
+
+				// SOLVE LAST 3 ANGLES
+				for (int j = 0; j < 3; j++) Bars[j].computeTransform(sol.rotations[j] * DEG_TO_RAD, linkT[j]);
+
+				zTransform r03 = linkT[0] * linkT[1] * linkT[2];
+
+				zTransform r36 = r03.transpose() * Target_J6;
+				double t = r36(2, 2);
+
+				double th3 = atan2(-r36(1, 2), -r36(0, 2));
+				double th4 = atan2(1.0 * sqrt(1.0 - t * t), t);
+				double th5 = atan2(-r36(2, 1), r36(2, 0));
+
+				sol.rotations[3] = (th3 * RAD_TO_DEG);
+				sol.rotations[4] = (th4 * RAD_TO_DEG);
+				sol.rotations[5] = (th5 * RAD_TO_DEG - 180);
+
+				// FORWARD CHECK
+				for (int j = 3; j < DOF; j++) Bars[j].computeTransform(sol.rotations[j] * DEG_TO_RAD, linkT[j]);
+
+				zTransform T06 = r03 * linkT[3] * linkT[4] * linkT[5];
+				zTransform TCP = T06 * robot_endEffector_matrix;
+
+				sol.robotTCP_position = zVector(TCP(0, 3), TCP(1, 3), TCP(2, 3));
+				sol.target_position = zVector(targets[i](3, 0), targets[i](3, 1), targets[i](3, 2));
+
+				zVector J6(T06(0, 3), T06(1, 3), T06(2, 3));
+				zVector J6_target(Target_J6(0, 3), Target_J6(1, 3), Target_J6(2, 3));
+				sol.distDifference = J6.distanceTo(J6_target);
+
+				sol.reachable = (sol.distDifference <= tolerance);
+				for (int j = 0; j < DOF; j++) if (isnan(sol.rotations[j])) sol.reachable = false;
+
+				sol.jointLimitViolations = 0;
+			}
+
+		}, grainSize);
+
+		// warm start from the previous joint state, in target order
+		double previous[DOF];
+		for (int j = 0; j < DOF; j++) previous[j] = jointRotations[j].rotation;
+
+		auto inLimits = [&](int j, double rotation)
+		{
+			return !((rotation + jointRotations[j].offset) < jointRotations[j].minimum || (rotation + jointRotations[j].offset) > jointRotations[j].maximum);
+		};
+
+		for (auto &sol : solutions)
+		{
+			// no closed form solution, the previous joint state is kept for the next target
+			if (isnan(sol.distDifference)) continue;
+
+			for (int j = 0; j < DOF; j++)
+			{
+				double best = sol.rotations[j];
+				bool bestInLimits = inLimits(j, best);
+
+				for (double turn : { -360.0, 360.0 })
+				{
+					double rotation = sol.rotations[j] + turn;
+					bool rotationInLimits = inLimits(j, rotation);
+
+					if ((rotationInLimits && !bestInLimits) || (rotationInLimits == bestInLimits && abs(rotation - previous[j]) < abs(best - previous[j])))
+					{
+						best = rotation;
+						bestInLimits = rotationInLimits;
+					}
+				}
+
+				sol.rotations[j] = best;
+				if (!bestInLimits) sol.jointLimitViolations |= (1 << j);
+
+				previous[j] = best;
+			}
+		}
+	}
+
 	//----MESH METHODS
 
 	ZSPACE_INLINE void zTsRobot::setJointMeshDihedralEdges()
@@ -498,6 +624,32 @@ namespace zSpace
 		robot_gCode.push_back(inGCode);
 	}
 
+	ZSPACE_INLINE void zTsRobot::gCode_store(zIKSolution &solution, double velocity, zRobotMoveType moveType, zRobotEEControlType endEffectorControl)
+	{
+		zGCode inGCode;
+		inGCode.vel = velocity;
+		inGCode.moveType = moveType;
+		inGCode.endEffectorControl = endEffectorControl;
+
+		inGCode.robotTCP_position = solution.robotTCP_position;
+		inGCode.target_position = solution.target_position;
+
+		inGCode.distDifference = inGCode.robotTCP_position.distanceTo(inGCode.target_position);
+
+		inGCode.targetReached = (solution.reachable && solution.jointLimitViolations == 0);
+		if (inGCode.distDifference > 0.1) inGCode.targetReached = false;
+
+		for (int i = 0; i < DOF; i++)
+		{
+			zJointRotation jointRot = jointRotations[i];
+			jointRot.rotation = solution.rotations[i];
+
+			inGCode.rotations.push_back(jointRot);
+		}
+
+		robot_gCode.push_back(inGCode);
+	}
+
 	ZSPACE_INLINE void zTsRobot::gCode_to(string directoryPath, zRobotType type)
 	{
 		if (type == zRobotABB)
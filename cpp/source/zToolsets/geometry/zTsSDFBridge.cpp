@@ -2138,8 +2138,10 @@ namespace zSpace
 
 	}
 
-	ZSPACE_INLINE void zTsSDFBridge::computeSDF(zPrintBlock& _block, float printWidth, float neopreneOffset, float raftWidth)
+	ZSPACE_INLINE void zTsSDFBridge::computeSDF(zPrintBlock& _block, float printWidth, float neopreneOffset, float raftWidth, std::function<void(int, zObjGraph&)> layerComputed, zSDFTimings *timings, bool printInfo)
 	{
+		std::chrono::steady_clock::time_point sliceStart = std::chrono::steady_clock::now();
+
 		_block.o_contourGraphs.clear();
 		_block.o_contourGraphs.assign(_block.o_sectionGraphs.size(), zObjGraph());
 
@@ -2151,7 +2153,6 @@ namespace zSpace
 
 		printf("\n num frames : %i ", _block.o_sectionGraphs.size());
 
-		int raftId = 0; 
 		int r0 = 0;
 		int r1 = floor(_block.o_sectionGraphs.size() * 0.5) -1;
 		int r2 = floor(_block.o_sectionGraphs.size() * 0.5);
@@ -2161,45 +2162,161 @@ namespace zSpace
 		int end = (_block.right_sideFaces.size() != _block.left_sideFaces.size()) ? _block.o_sectionGraphs.size() : floor(_block.o_sectionGraphs.size() * 0.5);
 		
 		bool exportBMP = true;
+		bool boundaryLayers = (_block.right_sideFaces.size() != _block.left_sideFaces.size());
+
+		// collect the print layers, every section graph is sliced once
+		zIntArray layerGraphs, layerIds, layerRaftIds;
+		zBoolArray layerRightSide;
+
+		zBoolArray graphQueued;
+		graphQueued.assign(_block.o_sectionGraphs.size(), false);
 
-		for (int j = 1; j <2; j++)
+		for (int j = 0; j < end; j++)
 		{
 			int kStart = ((onBoundaryBlock(_block.id)) && _block.right_BoundaryFaces.size() == 0) ? 1 : 0;
 			int kEnd = ((onBoundaryBlock(_block.id)) && _block.left_BoundaryFaces.size() == 0) ? 1 : 2;
 
-
-
 			for (int k = kStart; k < kEnd; k++)
 			{
 				int i = (k == 0) ? j : j + end;
 
 				if (onBoundaryBlock(_block.id)) i = j;
 
-				//if (i == r0 || i == r2) continue;
+				if (i >= _block.o_sectionGraphs.size() || graphQueued[i]) continue;
+				graphQueued[i] = true;
 
-				if (_block.right_sideFaces.size() != _block.left_sideFaces.size())
-				{
+				// raft index of the layer, -1 for print layers
+				int raftId = -1;
+				if (i == r0) raftId = 0;
+				else if (i == r2 && !boundaryLayers) raftId = 1;
+
+				layerGraphs.push_back(i);
+				layerIds.push_back(j);
+				layerRightSide.push_back(k == 0);
+				layerRaftIds.push_back(raftId);
+			}
+		}
+
+		int numLayers = layerGraphs.size();
+		if (numLayers == 0) return;
+
+		// scratch fields for the layers sliced concurrently, allocated once for the block.
+		// The last layer is always sliced on the SDF field, so it holds the same layer whatever the thread order.
+		int lastLayer = numLayers - 1;
+		int numFields = std::min(zThreadPool::getGlobal().numThreads(), lastLayer);
+
+		zFnMeshScalarField fnField(o_field);
+
+		int resX, resY;
+		fnField.getResolution(resX, resY);
+
+		zPoint minBB, maxBB;
+		fnField.getBoundingBox(minBB, maxBB);
 
-					if (i == r0)computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, true, 0);
-					//else if (i == r2 ) computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, true, 1);
-					//else if (i == r1) computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, true, 2);
-					//else if (i == r3) computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, true, 3);
+		vector<zObjMeshScalarField> o_scratchFields(numFields);
 
-					else computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, false, 0);
+		vector<zObjMeshScalarField*> layerFields;
+
+		for (auto& o_scratch : o_scratchFields)
+		{
+			zFnMeshScalarField fnScratch(o_scratch);
+			fnScratch.create(minBB, maxBB, resX, resY, 1, true, false);
+
+			layerFields.push_back(&o_scratch);
+		}
+
+		zIntArray freeFields;
+		for (int l = numFields - 1; l >= 0; l--) freeFields.push_back(l);
+
+		std::mutex fieldLock;
+		std::mutex outputLock;
+
+		vector<zSDFTimings> layerTimings(numLayers);
+
+		zThreadPool::getGlobal().parallel_for(0, numLayers, [&](int layerStart, int layerEnd)
+		{
+			for (int l = layerStart; l < layerEnd; l++)
+			{
+				int fieldId = -1;
+				if (l != lastLayer)
+				{
+					std::lock_guard<std::mutex> guard(fieldLock);
+					fieldId = freeFields.back();
+					freeFields.pop_back();
 				}
-				else
+
+				zObjMeshScalarField *layerField = (l == lastLayer) ? &o_field : layerFields[fieldId];
+
+				int i = layerGraphs[l];
+				bool addRaft = (layerRaftIds[l] != -1);
+				int raftId = (addRaft) ? layerRaftIds[l] : 0;
+
+				// the boundary layers use the default raft width
+				if (boundaryLayers) computeBlockSDF_Boundary(_block, i, printWidth, neopreneOffset, addRaft, raftId, 0.030, layerField, &layerTimings[l]);
+				else computeBlockSDF_Internal(_block, i, layerIds[l], layerRightSide[l], printWidth, neopreneOffset, addRaft, raftId, raftWidth, (addRaft) ? false : exportBMP, layerField, &layerTimings[l]);
+
+				if (l != lastLayer)
 				{
-					if (i == r0 )computeBlockSDF_Internal(_block, i,j, (k == 0), printWidth, neopreneOffset, true, 0, raftWidth, false);
-					else if (i == r2) computeBlockSDF_Internal(_block, i, j, (k == 0), printWidth, neopreneOffset, true, 1, raftWidth, false);
-					//else if (i == r1) computeBlockSDF_Internal(_block, i, printWidth, neopreneOffset, true, 2, raftWidth);
-					//else if (i == r3) computeBlockSDF_Internal(_block, i, printWidth, neopreneOffset, true, 3, raftWidth);
+					std::lock_guard<std::mutex> guard(fieldLock);
+					freeFields.push_back(fieldId);
+				}
 
-					else computeBlockSDF_Internal(_block, i, j, (k == 0), printWidth, neopreneOffset, false, 0, raftWidth, exportBMP);
+				// stream the contour out as soon as the layer is done
+				if (layerComputed)
+				{
+					std::lock_guard<std::mutex> guard(outputLock);
+					layerComputed(i, (addRaft) ? _block.o_raftGraphs[raftId] : _block.o_contourGraphs[i]);
 				}
 			}
-			
+		}, 1);
+
+		zSDFTimings blockTimings;
+		for (auto& lT : layerTimings)
+		{
+			blockTimings.fieldEvaluation += lT.fieldEvaluation;
+			blockTimings.booleans += lT.booleans;
+			blockTimings.contouring += lT.contouring;
+			blockTimings.numLayers += lT.numLayers;
 		}
-				
+
+		blockTimings.total = std::chrono::duration<double>(std::chrono::steady_clock::now() - sliceStart).count();
+
+		if (printInfo) printf("\n block %i SDF : %i layers | fields %1.3fs booleans %1.3fs contours %1.3fs | total %1.3fs ", _block.id, blockTimings.numLayers, blockTimings.fieldEvaluation, blockTimings.booleans, blockTimings.contouring, blockTimings.total);
+
+		if (timings) *timings = blockTimings;
+	}
+
+	ZSPACE_INLINE void zTsSDFBridge::computeSectionTrimPlane(int faceId, zTransform& transform, zPoint& cen, zVector& norm)
+	{
+		zItMeshFace f(o_planeMesh, faceId);
+
+		zPointArray fVertPos;
+		f.getVertexPositions(fVertPos);
+
+		cen = zPoint();
+		for (auto& vPos : fVertPos)
+		{
+			vPos = vPos * transform;
+			cen += vPos;
+		}
+		cen /= fVertPos.size();
+
+		// same normal as zItMeshFace::updateNormal, on the transformed positions
+		norm = zVector();
+
+		if (fVertPos.size() != 3)
+		{
+			for (int j = 0; j < fVertPos.size(); j++)
+			{
+				norm += (fVertPos[j] - cen) ^ (fVertPos[(j + 1) % fVertPos.size()] - cen);
+			}
+		}
+		else norm = (fVertPos[1] - fVertPos[0]) ^ (fVertPos[2] - fVertPos[0]);
+
+		norm.normalize();
+
+		// point inwards
+		norm *= -1;
 	}
 
 	//---- UTILITY METHODS
@@ -2351,7 +2468,7 @@ namespace zSpace
 				fnPlaneParticles[i].updateParticle(true);
 			}
 
-			fnPlaneMesh.computeMeshNormals();
+			fnPlaneMesh.updateMeshNormals();
 		}
 
 
@@ -2504,7 +2621,7 @@ namespace zSpace
 				fnPlaneParticles[i].updateParticle(true);
 			}
 
-			fnPlaneMesh.computeMeshNormals();
+			fnPlaneMesh.updateMeshNormals();
 		}
 
 
@@ -2726,7 +2843,7 @@ namespace zSpace
 				fnPlaneParticles[i].updateParticle(true);
 			}
 
-			fnPlaneMesh.computeMeshNormals();
+			fnPlaneMesh.updateMeshNormals();
 		}
 
 
@@ -7062,11 +7179,22 @@ namespace zSpace
 
 	}
 
-	ZSPACE_INLINE void zTsSDFBridge::computeBlockSDF_Internal(zPrintBlock& _block, int graphId, int printLayerId, bool rightSide, float printWidth, float neopreneOffset, bool addRaft, int raftId, float raftWidth, bool exportBMP)
+	ZSPACE_INLINE void zTsSDFBridge::computeBlockSDF_Internal(zPrintBlock& _block, int graphId, int printLayerId, bool rightSide, float printWidth, float neopreneOffset, bool addRaft, int raftId, float raftWidth, bool exportBMP, zObjMeshScalarField *fieldObj, zSDFTimings *timings)
 	{
 		if (_block.id == -1) return;
 		if (graphId >= _block.o_sectionGraphs.size())return;
 
+		// stage timings of the layer
+		zSDFTimings layerTimings;
+		std::chrono::steady_clock::time_point stageStart = std::chrono::steady_clock::now();
+
+		auto endStage = [&stageStart](double& stageTime)
+		{
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			stageTime += std::chrono::duration<double>(now - stageStart).count();
+			stageStart = now;
+		};
+
 		zFnGraph fnGraph(_block.o_sectionGraphs[graphId]);
 
 		/*float pWidth = (addRaft) ? raftWidth : printWidth;
@@ -7117,38 +7245,17 @@ namespace zSpace
 		zVector endPlaneNorm;
 
 		int startIndex = (boundarySide) ? 1 : 0;
-		for (int i = startIndex; i < 2; i += 1)
-		{
-			zItMeshFace f(o_planeMesh, (i == 0) ? p.first : p.second);
-
-			zTransformationMatrix from;
-			from.setTransform(_block.sectionFrames[graphId], true);
-
-			zTransform transform = from.getLocalMatrix();
-
-			zPointArray fVertPos;
-			f.getVertexPositions(fVertPos);
-
-			zItMeshVertexArray fVerts;
-			f.getVertices(fVerts);
-
-			for (auto& v : fVerts)
-			{
-				zPoint vPos = v.getPosition();
+		zTransformationMatrix from;
+		from.setTransform(_block.sectionFrames[graphId], true);
 
-				zPoint newPos = vPos * transform;
+		zTransform transform = from.getLocalMatrix();
 
-				v.setPosition(newPos);
-			}
-
-			f.updateNormal();
-			fNorm[i] = f.getNormal();
-			fNorm[i].normalize();
-
-			// point inwards
-			fNorm[i] *= -1;
+		for (int i = startIndex; i < 2; i += 1)
+		{
+			int faceId = (i == 0) ? p.first : p.second;
 
-			fCen[i] = f.getCenter();
+			// the plane mesh is shared by all the layers, so it is left untouched
+			computeSectionTrimPlane(faceId, transform, fCen[i], fNorm[i]);
 
 			if (i == 0)
 			{
@@ -7162,25 +7269,8 @@ namespace zSpace
 				endPlaneOrigin = fCen[i];
 			}
 
+			zItMeshFace f(o_planeMesh, faceId);
 			fCol[i] = f.getColor();
-
-			/*if (fCol[i] == yellow)
-			{
-
-				fCen[i] += fNorm[i] * ((pWidth * 0.5) + neopreneOffset);
-			}*/
-			//if (fCol[i] == blue) 	fCen[i] += fNorm[i] * ((pWidth * 0.37));
-
-			// revert to original position
-			int counter = 0;
-			for (auto& v : fVerts)
-			{
-				v.setPosition(fVertPos[counter]);
-				counter++;
-			}
-
-			f.updateNormal();
-
 		}
 
 
@@ -7247,7 +7337,7 @@ namespace zSpace
 		float maxTriagleLength = 0.35;
 
 		// field
-		zFnMeshScalarField fnField(o_field);
+		zFnMeshScalarField fnField((fieldObj) ? *fieldObj : o_field);
 
 		float offset_outer = 0.5 * pWidth;
 		float offset_inner = 1.5 * pWidth;
@@ -7256,6 +7346,8 @@ namespace zSpace
 		zScalarArray polyField;
 		fnField.getScalars_Polygon(polyField, _block.o_sectionGuideGraphs[graphId], false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		// EDGE field outer
 
 		zScalarArray edgeField_outer = polyField;;
@@ -7264,15 +7356,21 @@ namespace zSpace
 		zScalarArray trim_outer; 
 		fnField.getScalars_3dp_topBottomTrim(trim_outer, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE,  0.5 * pWidth,0, false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		zScalarArray booleanField_outer;
 		fnField.boolean_subtract(edgeField_outer, trim_outer, booleanField_outer, false);
 
+		endStage(layerTimings.booleans);
+
 
 		// PATTERN
 
 		zScalarArray patternField;
 		fnField.getScalars_3dp_Pattern(patternField, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, maxTriagleLength, pWidth,  false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		//fnField.smoothField(patternField, 1, 0.0);
 
 		zScalarArray booleanField_outer2;
@@ -7328,9 +7426,13 @@ namespace zSpace
 		zScalarArray edgeField_inner = polyField;
 		for (auto& s : edgeField_inner) s += offset_inner;
 
+		endStage(layerTimings.booleans);
+
 		zScalarArray trim_inner;
 		fnField.getScalars_3dp_topBottomTrim(trim_inner, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, 1.5 * pWidth,0, false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 
 		zScalarArray booleanField_inner;
 		fnField.boolean_subtract(edgeField_inner, trim_inner, booleanField_inner, false);
@@ -7365,12 +7467,18 @@ namespace zSpace
 
 		//INFILL
 
+		endStage(layerTimings.booleans);
+
 		zScalarArray infillField;
 		fnField.getScalars_3dp_Infill(infillField, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, maxTriagleLength, pWidth, false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		zScalarArray booleanField_infill;
 		fnField.boolean_intersect(booleanField_inner, infillField, booleanField_infill, false);
 
+		endStage(layerTimings.booleans);
+
 		//TRIANGLE TRIM,
 		zScalarArray triangleTrim;
 		//fnField.getScalars_3dp_InfillTrim(triangleTrim, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, maxTriagleLength,  pWidth * 0.5, false);
@@ -7380,6 +7488,8 @@ namespace zSpace
 		zFnGraph fnTrimGraph(_block.o_trimGraphs[graphId]);
 		fnTrimGraph.setTransform(t, true, true);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		
 		//// BOOLEAN FIELDS
 
@@ -7392,6 +7502,8 @@ namespace zSpace
 				
 		fnField.smoothField(booleanField_trim, 1, 0.0);
 
+		endStage(layerTimings.booleans);
+
 		fnField.setFieldValues(booleanField_trim);
 
 		if (exportBMP)
@@ -7453,6 +7565,16 @@ namespace zSpace
 
 		}
 
+		endStage(layerTimings.contouring);
+
+		if (timings)
+		{
+			timings->fieldEvaluation += layerTimings.fieldEvaluation;
+			timings->booleans += layerTimings.booleans;
+			timings->contouring += layerTimings.contouring;
+			timings->numLayers++;
+		}
+
 		//fnField.fnMesh.to("C:/Users/vishu.b/Desktop/VeniceIO_0104/sdf/field_deck_5_" + to_string(graphId) + ".json", zJSON);
 		
 		//fnGraphGuide.to("C:/Users/vishu.b/Desktop/VeniceIO_0104/sdf/guide_deck" + to_string(graphId) + ".json", zJSON);
@@ -7525,11 +7647,22 @@ namespace zSpace
 
 	}
 
-	ZSPACE_INLINE void zTsSDFBridge::computeBlockSDF_Boundary(zPrintBlock& _block, int graphId, float printWidth, float neopreneOffset, bool addRaft , int raftId, float raftWidth)
+	ZSPACE_INLINE void zTsSDFBridge::computeBlockSDF_Boundary(zPrintBlock& _block, int graphId, float printWidth, float neopreneOffset, bool addRaft , int raftId, float raftWidth, zObjMeshScalarField *fieldObj, zSDFTimings *timings)
 	{
 		if (_block.id == -1) return;
 		if (graphId >= _block.o_sectionGraphs.size())return;
 
+		// stage timings of the layer
+		zSDFTimings layerTimings;
+		std::chrono::steady_clock::time_point stageStart = std::chrono::steady_clock::now();
+
+		auto endStage = [&stageStart](double& stageTime)
+		{
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			stageTime += std::chrono::duration<double>(now - stageStart).count();
+			stageStart = now;
+		};
+
 		zFnGraph fnGraph(_block.o_sectionGraphs[graphId]);
 
 		float pWidth = (addRaft) ? printWidth : printWidth;
@@ -7576,40 +7709,17 @@ namespace zSpace
 		zVector endPlaneNorm;
 
 		int endIndex = (boundarySide) ? 1:0;
-		for (int i = 0; i < endIndex; i += 1)
-		{
-			zItMeshFace f(o_planeMesh, (i == 0) ? p.first : p.second);
-
-			zTransformationMatrix from;
-			from.setTransform(_block.sectionFrames[graphId], true);
-
-			zTransform transform = from.getLocalMatrix();
-
-			zPointArray fVertPos;
-			f.getVertexPositions(fVertPos);
-
-			zItMeshVertexArray fVerts;
-			f.getVertices(fVerts);
+		zTransformationMatrix from;
+		from.setTransform(_block.sectionFrames[graphId], true);
 
-			for (auto& v : fVerts)
-			{
-				zPoint vPos = v.getPosition();
-
-				zPoint newPos = vPos * transform;
-
-				v.setPosition(newPos);
-			}
+		zTransform transform = from.getLocalMatrix();
 
-			f.updateNormal();
-			fNorm[i] = f.getNormal();
-			fNorm[i].normalize();
-
-			// point inwards
-			fNorm[i] *= -1;
-
-			fCen[i] = f.getCenter();
+		for (int i = 0; i < endIndex; i += 1)
+		{
+			int faceId = (i == 0) ? p.first : p.second;
 
-			fCol[i] = f.getColor();
+			// the plane mesh is shared by all the layers, so it is left untouched
+			computeSectionTrimPlane(faceId, transform, fCen[i], fNorm[i]);
 
 			if (i == 0)
 			{
@@ -7623,19 +7733,8 @@ namespace zSpace
 				endPlaneOrigin = fCen[i];
 			}
 
-			//if (fCol[i] == yellow) 	fCen[i] += fNorm[i] * ((printWidth * 0.5) + neopreneOffset);
-			//if (fCol[i] == blue) 	fCen[i] += fNorm[i] * ((printWidth * 0.37));
-
-			// revert to original position
-			int counter = 0;
-			for (auto& v : fVerts)
-			{
-				v.setPosition(fVertPos[counter]);
-				counter++;
-			}
-
-			f.updateNormal();
-
+			zItMeshFace f(o_planeMesh, faceId);
+			fCol[i] = f.getColor();
 		}
 
 
@@ -7701,7 +7800,7 @@ namespace zSpace
 
 
 		// field
-		zFnMeshScalarField fnField(o_field);
+		zFnMeshScalarField fnField((fieldObj) ? *fieldObj : o_field);
 
 		float offset_outer = 0.5 * pWidth;
 		float offset_inner = 1.5 * pWidth;
@@ -7710,6 +7809,8 @@ namespace zSpace
 		zScalarArray polyField;
 		fnField.getScalars_Polygon(polyField, _block.o_sectionGuideGraphs[graphId], false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		// EDGE field outer
 
 		zScalarArray edgeField_outer = polyField;;
@@ -7814,18 +7915,26 @@ namespace zSpace
 		//zPoint cen = (topHE[topHE.size() - 1].getVertex().getPosition() + bottomHE[bottomHE.size() - 1].getVertex().getPosition()) * 0.5;
 		//fnField.getScalars_Circle(circleTrim, cen, 0.06, 0.0, false);
 
+		endStage(layerTimings.booleans);
+
 		zScalarArray infillField;
 		fnField.getScalars_3dp_InfillBoundary(infillField, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, 0.24, (addRaft) ? 0.010 : printWidth * 0.50, false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		zScalarArray booleanField_infill;
 		fnField.boolean_intersect(booleanField_inner, infillField, booleanField_infill, false);
 
+		endStage(layerTimings.booleans);
+
 		zScalarArray trim_infill;
 		fnField.getScalars_3dp_InfillInteriorTrimBoundary(trim_infill, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, 0.24, (addRaft) ? 0.010 : printWidth * 0.50,(graphId %2 == 0), false, _block.o_trimGraphs[graphId]);
 
 		zFnGraph fnTrimGraph(_block.o_trimGraphs[graphId]);
 		fnTrimGraph.setTransform(t, true, true);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		zScalarArray booleanField_infill2;
 		fnField.boolean_subtract(booleanField_inner, booleanField_infill, booleanField_infill2, false);
 
@@ -7838,9 +7947,13 @@ namespace zSpace
 		fnField.smoothField(booleanField_infill3, 1, 0.0);
 
 		////TRIANGLE TRIM,
+		endStage(layerTimings.booleans);
+
 		zScalarArray triangleTrim;
 		fnField.getScalars_3dp_InfillTrimBoundary(triangleTrim, _block.o_sectionGuideGraphs[graphId], topHE, bottomHE, topLength, bottomLength, numInfillTriangles, 0.24, (addRaft) ? 0.010 : printWidth * 0.50, (graphId % 2 == 0), false);
 
+		endStage(layerTimings.fieldEvaluation);
+
 		
 
 
@@ -7852,6 +7965,8 @@ namespace zSpace
 		fnField.boolean_subtract(booleanField_outer, booleanField_infill3, booleanField_combined, false);
 
 		fnField.boolean_subtract(booleanField_combined, triangleTrim, booleanField_trim, false);
+		endStage(layerTimings.booleans);
+
 		fnField.setFieldValues(booleanField_trim);
 
 		
@@ -7888,6 +8003,16 @@ namespace zSpace
 
 		
 
+		endStage(layerTimings.contouring);
+
+		if (timings)
+		{
+			timings->fieldEvaluation += layerTimings.fieldEvaluation;
+			timings->booleans += layerTimings.booleans;
+			timings->contouring += layerTimings.contouring;
+			timings->numLayers++;
+		}
+
 		fnField.fnMesh.to("C:/Users/vishu.b/Desktop/VeniceIO_0104/sdf/field_balustrade_5_" + to_string(graphId) + ".json", zJSON);
 
 		fnGraphGuide.to("C:/Users/vishu.b/Desktop/VeniceIO_0104/sdf/guide_balustrade" + to_string(graphId) + ".json", zJSON);
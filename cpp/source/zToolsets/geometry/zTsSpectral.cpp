@@ -16,6 +16,56 @@
 namespace zSpace
 {
 
+	//---- zSpectralShiftSolve
+
+	ZSPACE_INLINE zSpectralShiftSolve::zSpectralShiftSolve()
+	{
+		shift = 0.0;
+	}
+
+	ZSPACE_INLINE void zSpectralShiftSolve::setMatrix(zSparseMatrix &_matrix)
+	{
+		if (_matrix.rows() != _matrix.cols()) throw std::invalid_argument(" error: shift-solve matrix must be square.");
+
+		matrix = _matrix;
+		solver.reset();
+	}
+
+	ZSPACE_INLINE int zSpectralShiftSolve::rows() const
+	{
+		return matrix.rows();
+	}
+
+	ZSPACE_INLINE int zSpectralShiftSolve::cols() const
+	{
+		return matrix.cols();
+	}
+
+	ZSPACE_INLINE void zSpectralShiftSolve::set_shift(double sigma)
+	{
+		if (solver && sigma == shift) return;
+
+		zSparseMatrix identity(matrix.rows(), matrix.cols());
+		identity.setIdentity();
+
+		// new factorisation, as copies may share the current one
+		std::shared_ptr<SimplicialLDLT<zSparseMatrix>> temp = std::make_shared<SimplicialLDLT<zSparseMatrix>>();
+		temp->compute(matrix - sigma * identity);
+
+		if (temp->info() != Success) throw std::invalid_argument(" error: factorisation failed with the given shift.");
+
+		solver = temp;
+		shift = sigma;
+	}
+
+	ZSPACE_INLINE void zSpectralShiftSolve::perform_op(const double *x_in, double *y_out) const
+	{
+		Map<const VectorXd> x(x_in, matrix.rows());
+		Map<VectorXd> y(y_out, matrix.rows());
+
+		y.noalias() = solver->solve(x);
+	}
+
 	//---- CONSTRUCTOR
 
 	ZSPACE_INLINE zTsSpectral::zTsSpectral() {}
@@ -47,58 +97,28 @@ namespace zSpace
 	{
 		int n_v = fnMesh.numVertices();
 
-		if (meshLaplacian.cols() != n_v)
-		{
-			std::clock_t start;
-			start = std::clock();
-
-			meshLaplacian = fnMesh.getTopologicalLaplacian();
-
-			printf("\n meshLaplacian: r %i  c %i ", meshLaplacian.rows(), meshLaplacian.cols());
-
-			double t_duration = (std::clock() - start) / (double)CLOCKS_PER_SEC;
-			std::cout << "\n mesh Laplacian compute: " << t_duration << " seconds";
-		}
+		if (meshLaplacian.cols() != n_v || eigenOperator.cols() != n_v) computeEigenOperator();
 
 		if (computeEigenVectors)
 		{
-			std::clock_t start;
-			start = std::clock();
-
-			//using spectra
-			SparseSymShiftSolve<double> op(meshLaplacian);
-			SymEigsShiftSolver< double, LARGEST_MAGN, SparseSymShiftSolve<double> > eigs(&op, n_Eigens, n_Eigens + 1, 0.0);
-
-			// Initialize and compute
-			eigs.init();
-			int nconv = eigs.compute();
-
-			double t_duration2 = (std::clock() - start) / (double)CLOCKS_PER_SEC;
-			std::cout << "\n Eigen solve : " << t_duration2 << " seconds";
-
-			// Retrieve results
-			if (eigs.info() == SUCCESSFUL)
-			{
-				eigenVectors = eigs.eigenvectors(nconv);
-				eigenValues = eigs.eigenvalues();
-			}
-			else
+			if (!computeEigenPairs(n_Eigens))
 			{
 				cout << "\n Eigen convergence unsuccessful ";
 				return -1.0;
 			}
 
-			printf("\n Eigen num converge %i : eigenVectors r %i  c %i ", nconv, eigenVectors.rows(), eigenVectors.cols());
-
 			computeEigenVectors = !computeEigenVectors;
 		}
 
 
-		if (eigenVectors.rows() != n_v) return -1.0;
+		if (eigenVectors.rows() != n_v || eigenVectors.cols() < n_Eigens) return -1.0;
 
 		int val = (int)frequency;
 		if (val >= n_Eigens) val = (int)frequency % n_Eigens;
 
+		// eigen pairs are in decreasing order, so skip the extra pairs of a larger request
+		val += eigenVectors.cols() - n_Eigens;
+
 		// compute derivatives
 		zDomainFloat inDomain;
 		computeMinMax_Eigen(val, inDomain);
@@ -125,6 +145,108 @@ namespace zSpace
 		return eigenValues[val];
 	}
 
+	ZSPACE_INLINE void zTsSpectral::computeEigenOperator()
+	{
+		int n_v = fnMesh.numVertices();
+
+		std::clock_t start;
+		start = std::clock();
+
+		meshLaplacian = fnMesh.getTopologicalLaplacian();
+
+		printf("\n meshLaplacian: r %i  c %i ", meshLaplacian.rows(), meshLaplacian.cols());
+
+		double t_duration = (std::clock() - start) / (double)CLOCKS_PER_SEC;
+		std::cout << "\n mesh Laplacian compute: " << t_duration << " seconds";
+
+		start = std::clock();
+
+		if (useMassMatrix)
+		{
+			// L x = lambda M x , solved as M^-1/2 L M^-1/2 y = lambda y with x = M^-1/2 y
+			zFloatArray vertexAreas;
+			fnMesh.updateVertexAreas(vertexAreas);
+
+			vertexArea.assign(vertexAreas.begin(), vertexAreas.end());
+
+			massInvSqrt = VectorXd(n_v);
+			for (int i = 0; i < n_v; i++) massInvSqrt[i] = (vertexArea[i] > 0) ? 1.0 / sqrt(vertexArea[i]) : 0.0;
+
+			eigenOperator = massInvSqrt.asDiagonal() * meshLaplacian * massInvSqrt.asDiagonal();
+		}
+		else
+		{
+			massInvSqrt.resize(0);
+			eigenOperator = meshLaplacian;
+		}
+
+		// the laplacian is singular, so shift just below its zero eigen value
+		double meanDiagonal = (n_v > 0) ? eigenOperator.diagonal().cwiseAbs().mean() : 0.0;
+		eigenShift = -0.00000001 * ((meanDiagonal > 0) ? meanDiagonal : 1.0);
+
+		shiftSolve.setMatrix(eigenOperator);
+		if (n_v > 0) shiftSolve.set_shift(eigenShift);
+
+		n_Solved = 0;
+
+		double t_duration2 = (std::clock() - start) / (double)CLOCKS_PER_SEC;
+		std::cout << "\n Eigen operator factorisation : " << t_duration2 << " seconds";
+	}
+
+	ZSPACE_INLINE bool zTsSpectral::computeEigenPairs(int numEigen)
+	{
+		int n_v = fnMesh.numVertices();
+
+		if (meshLaplacian.cols() != n_v || eigenOperator.cols() != n_v) computeEigenOperator();
+
+		if (numEigen >= n_v) numEigen = n_v - 1;
+		if (numEigen < 1) return false;
+
+		// eigen pairs of the current operator are cached
+		if (numEigen <= n_Solved) return true;
+
+		std::clock_t start;
+		start = std::clock();
+
+		//using spectra
+		int ncv = min(n_v, max(2 * numEigen + 1, numEigen + 20));
+		SymEigsShiftSolver< double, LARGEST_MAGN, zSpectralShiftSolve > eigs(&shiftSolve, numEigen, ncv, eigenShift);
+
+		// warm start from the previous eigen vectors
+		if (eigenVectors.rows() == n_v && eigenVectors.cols() > 0)
+		{
+			VectorXd startVector = eigenVectors.rowwise().sum();
+
+			if (massInvSqrt.size() == n_v)
+			{
+				for (int i = 0; i < n_v; i++) startVector[i] = (massInvSqrt[i] > 0) ? startVector[i] / massInvSqrt[i] : 0.0;
+			}
+
+			if (startVector.norm() > 0) eigs.init(startVector.data());
+			else eigs.init();
+		}
+		else eigs.init();
+
+		int nconv = eigs.compute();
+
+		double t_duration2 = (std::clock() - start) / (double)CLOCKS_PER_SEC;
+		std::cout << "\n Eigen solve : " << t_duration2 << " seconds";
+
+		// Retrieve results
+		if (eigs.info() != SUCCESSFUL) return false;
+
+		eigenVectors = eigs.eigenvectors(nconv);
+		eigenValues = eigs.eigenvalues();
+
+		if (massInvSqrt.size() == n_v) eigenVectors = massInvSqrt.asDiagonal() * eigenVectors;
+
+		n_Solved = nconv;
+
+		printf("\n Eigen num converge %i : eigenVectors r %i  c %i ", nconv, eigenVectors.rows(), eigenVectors.cols());
+
+		return true;
+	}
+
 	ZSPACE_INLINE void zTsSpectral::computeVertexType()
 	{
 		int n_v = fnMesh.numVertices();
@@ -214,6 +336,17 @@ namespace zSpace
 		if (_numEigen >= fnMesh.numVertices()) n_Eigens = fnMesh.numVertices() - 1;
 	}
 
+	ZSPACE_INLINE void zTsSpectral::setUseMassMatrix(bool _useMassMatrix)
+	{
+		if (useMassMatrix == _useMassMatrix) return;
+
+		useMassMatrix = _useMassMatrix;
+
+		// recompute the eigen operator on the next solve
+		eigenOperator.resize(0, 0);
+		n_Solved = 0;
+	}
+
 	ZSPACE_INLINE void zTsSpectral::setColorDomain(zDomainColor &colDomain, zColorType colType)
 	{
 		colorDomain = colDomain;
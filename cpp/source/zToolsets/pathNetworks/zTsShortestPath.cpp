@@ -18,7 +18,10 @@ namespace zSpace
 	//---- CONSTRUCTOR
 
 	template<typename T, typename U>
-	ZSPACE_INLINE zTsShortestPath<T,U>::zTsShortestPath() {}
+	ZSPACE_INLINE zTsShortestPath<T,U>::zTsShortestPath() 
+	{
+		numThreads = 0;
+	}
 
 	//---- graph specilization for zTsShortestPath constructor
 	template<>
@@ -26,6 +29,8 @@ namespace zSpace
 	{
 		heObj = &_graph;
 		fnHE = zFnGraph(_graph);
+
+		numThreads = 0;
 	}
 
 	//---- mesh specilization for zTsShortestPath constructor
@@ -34,6 +39,8 @@ namespace zSpace
 	{
 		heObj = &_mesh;
 		fnHE = zFnMesh(_mesh);
+
+		numThreads = 0;
 	}
 
 	//---- DESTRUCTOR
@@ -41,130 +48,109 @@ namespace zSpace
 	template<typename T, typename U>
 	ZSPACE_INLINE zTsShortestPath<T, U>::~zTsShortestPath() {}
 
-	//--- WALK METHODS 
+	//--- ADJACENCY METHODS 
 
-	//---- graph specilization for shortestDistance
+	//---- graph specilization for computeAdjacency
 	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjGraph, zFnGraph>::shortestDistance(int index, vector<float> &dist, vector<int> &parent)
+	ZSPACE_INLINE void zTsShortestPath<zObjGraph, zFnGraph>::computeAdjacency()
 	{
-		if (index > fnHE.numVertices()) throw std::invalid_argument("index out of bounds.");
-
-		float maxDIST = 100000;
-
-		dist.clear();
-		parent.clear();
+		adjacencyOffsets.clear();
+		adjacencyVertices.clear();
+		adjacencyWeights.clear();
 
-		vector<bool> sptSet;
+		adjacencyOffsets.assign(fnHE.numVertices() + 1, 0);
+		adjacencyVertices.reserve(fnHE.numHalfEdges());
+		adjacencyWeights.reserve(fnHE.numHalfEdges());
 
-		// Initialize all distances as INFINITE and stpSet[] as false 
-		for (int i = 0; i < fnHE.numVertices(); i++)
-		{
-			dist.push_back(maxDIST);
-			sptSet.push_back(false);
-
-			parent.push_back(-2);
-		}
+		zIntArray cVerts;
 
-		// Distance of source vertex from itself is always 0 
-		dist[index] = 0;
-		parent[index] = -1;
-
-		// Find shortest path for all vertices 
-		for (int i = 0; i < fnHE.numVertices(); i++)
+		for (zItGraphVertex v(*heObj); !v.end(); v++)
 		{
-			// Pick the minimum distance vertex from the set of vertices not 
-			// yet processed. u is always equal to src in the first iteration. 
-			zItGraphVertex u(*heObj, minDistance(dist, sptSet));
+			adjacencyOffsets[v.getId() + 1] = adjacencyVertices.size();
 
-			// Mark the picked vertex as processed 
-			sptSet[u.getId()] = true;
+			// isolated vertex
+			if (v.getRawIter()->getHalfEdge() == NULL) continue;
 
-			// Update dist value of the adjacent vertices of the picked vertex. 
+			zVector vPos = v.getPosition();
 
-			vector<zItGraphVertex> cVerts;
-			u.getConnectedVertices(cVerts);
+			cVerts.clear();
+			v.getConnectedVertices(cVerts);
 
-			for (auto &v : cVerts)
+			for (auto &cV : cVerts)
 			{
+				zItGraphVertex c(*heObj, cV);
+				zVector cPos = c.getPosition();
 
-				zVector uPos = u.getPosition();
-
-				zVector vPos = v.getPosition();
-
-				float distUV = uPos.distanceTo(vPos);
-
-
-				if (!sptSet[v.getId()] && dist[u.getId()] != maxDIST && dist[u.getId()] + distUV < dist[v.getId()])
-				{
-					dist[v.getId()] = dist[u.getId()] + distUV;
-					parent[v.getId()] = u.getId();
-				}
+				adjacencyVertices.push_back(cV);
+				adjacencyWeights.push_back(vPos.distanceTo(cPos));
 			}
 
+			adjacencyOffsets[v.getId() + 1] = adjacencyVertices.size();
 		}
 
+		symHalfEdges.clear();
+		symHalfEdges.assign(fnHE.numHalfEdges(), -1);
 
+		for (zItGraphHalfEdge he(*heObj); !he.end(); he++) symHalfEdges[he.getId()] = he.getSym().getId();
 	}
 
-	//---- mesh specilization for shortestDistance
+	//---- mesh specilization for computeAdjacency
 	template<>
-	ZSPACE_INLINE  void  zTsShortestPath<zObjMesh, zFnMesh>::shortestDistance(int index, vector<float> &dist, vector<int> &parent)
+	ZSPACE_INLINE void zTsShortestPath<zObjMesh, zFnMesh>::computeAdjacency()
 	{
-		float maxDIST = 100000;
+		adjacencyOffsets.clear();
+		adjacencyVertices.clear();
+		adjacencyWeights.clear();
 
-		dist.clear();
-		parent.clear();
+		adjacencyOffsets.assign(fnHE.numVertices() + 1, 0);
+		adjacencyVertices.reserve(fnHE.numHalfEdges());
+		adjacencyWeights.reserve(fnHE.numHalfEdges());
 
-		vector<bool> sptSet;
+		zIntArray cVerts;
 
-		// Initialize all distances as INFINITE and stpSet[] as false 
-		for (int i = 0; i < fnHE.numVertices(); i++)
+		for (zItMeshVertex v(*heObj); !v.end(); v++)
 		{
-			dist.push_back(maxDIST);
-			sptSet.push_back(false);
+			adjacencyOffsets[v.getId() + 1] = adjacencyVertices.size();
 
-			parent.push_back(-2);
-		}
+			// isolated vertex
+			if (v.getRawIter()->getHalfEdge() == NULL) continue;
 
-		// Distance of source vertex from itself is always 0 
-		dist[index] = 0;
-		parent[index] = -1;
+			zVector vPos = v.getPosition();
 
-		// Find shortest path for all vertices 
-		for (int i = 0; i < fnHE.numVertices(); i++)
-		{
-			// Pick the minimum distance vertex from the set of vertices not 
-			// yet processed. u is always equal to src in the first iteration. 
-			zItMeshVertex u(*heObj, minDistance(dist, sptSet));
-
-			// Mark the picked vertex as processed 
-			sptSet[u.getId()] = true;
+			cVerts.clear();
+			v.getConnectedVertices(cVerts);
 
-			// Update dist value of the adjacent vertices of the picked vertex. 
-
-			vector<zItMeshVertex> cVerts;
-			u.getConnectedVertices(cVerts);
-
-			for (auto &v : cVerts)
+			for (auto &cV : cVerts)
 			{
+				zItMeshVertex c(*heObj, cV);
+				zVector cPos = c.getPosition();
 
-				zVector uPos = u.getPosition();
+				adjacencyVertices.push_back(cV);
+				adjacencyWeights.push_back(vPos.distanceTo(cPos));
+			}
 
-				zVector vPos = v.getPosition();
+			adjacencyOffsets[v.getId() + 1] = adjacencyVertices.size();
+		}
 
-				float distUV = uPos.distanceTo(vPos);
+		symHalfEdges.clear();
+		symHalfEdges.assign(fnHE.numHalfEdges(), -1);
 
+		for (zItMeshHalfEdge he(*heObj); !he.end(); he++) symHalfEdges[he.getId()] = he.getSym().getId();
+	}
 
-				if (!sptSet[v.getId()] && dist[u.getId()] != maxDIST && dist[u.getId()] + distUV < dist[v.getId()])
-				{
-					dist[v.getId()] = dist[u.getId()] + distUV;
-					parent[v.getId()] = u.getId();
-				}
-			}
+	//--- WALK METHODS 
 
-		}
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestDistance(int index, vector<float> &dist, vector<int> &parent)
+	{
+		if (index < 0 || index >= fnHE.numVertices()) throw std::invalid_argument("index out of bounds.");
 
+		computeAdjacency();
 
+		zIntArray sourceVertices = { index };
+		zIntArray order;
+
+		dijkstra(sourceVertices, dist, parent, order);
 	}
 
 	//---- graph specilization for shortestPath
@@ -526,198 +512,58 @@ namespace zSpace
 
 	}
 
-	//---- graph specilization for shortestPathWalks
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjGraph, zFnGraph>::shortestPathWalks(vector<int> &edgeVisited)
-	{
-		edgeVisited.clear();
-
-		// initialise edge visits to 0
-		for (int i = 0; i < fnHE.numHalfEdges(); i++)
-		{
-			edgeVisited.push_back(0);
-		}
-
-
-		for (int i = 0; i < fnHE.numVertices(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(i, dists, parent);
-
-			printf("\n total: %i source: %i ", fnHE.numVertices(), i);
-
-			// compute shortes path from all vertices to current vertex 
-			for (int j = i + 1; j < fnHE.numVertices(); j++)
-			{
-				shortestPath_DistanceParent(i, j, dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
-	}
-
-	//---- mesh specilization for shortestPathWalks
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjMesh, zFnMesh>::shortestPathWalks(vector<int> &edgeVisited)
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestPathWalks(vector<int> &edgeVisited)
 	{
 		edgeVisited.clear();
 
 		// initialise edge visits to 0
-		for (int i = 0; i < fnHE.numHalfEdges(); i++)
-		{
-			edgeVisited.push_back(0);
-		}
-
-
-		for (int i = 0; i < fnHE.numVertices(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
+		edgeVisited.assign(fnHE.numHalfEdges(), 0);
 
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(i, dists, parent);
+		zIntArray vertices;
+		for (int i = 0; i < fnHE.numVertices(); i++) vertices.push_back(i);
 
-			printf("\n total: %i source: %i ", fnHE.numVertices(), i);
+		computeAdjacency();
 
-			// compute shortes path from all vertices to current vertex 
-			for (int j = i + 1; j < fnHE.numVertices(); j++)
-			{
-				shortestPath_DistanceParent(i, j, dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
+		// compute shortes path from all vertices to all other vertices 
+		edgeVisits(vertices, vertices, true, edgeVisited);
 	}
 
-	//---- graph specilization for shortestPathWalks_SourceToAll 
-	template<>
-	ZSPACE_INLINE  void  zTsShortestPath<zObjGraph, zFnGraph>::shortestPathWalks_SourceToAll(vector<int> &sourceVertices, vector<int> &edgeVisited)
-	{
-
-		// initialise edge visits to 0
-		if (edgeVisited.size() == 0 || edgeVisited.size() < fnHE.numHalfEdges())
-		{
-			edgeVisited.clear();
-			for (int i = 0; i < fnHE.numHalfEdges(); i++)
-			{
-				edgeVisited.push_back(0);
-			}
-		}
-
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
-
-			// compute shortes path from all vertices to current vertex 
-			for (int j = 0; j < fnHE.numVertices(); j++)
-			{
-				shortestPath_DistanceParent(sourceVertices[i], j, dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
-	}
-
-	//---- mesh specilization for shortestPathWalks_SourceToAll 
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjMesh, zFnMesh>::shortestPathWalks_SourceToAll(vector<int> &sourceVertices, vector<int> &edgeVisited)
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestPathWalks_SourceToAll(vector<int> &sourceVertices, vector<int> &edgeVisited)
 	{
 		// initialise edge visits to 0
 		if (edgeVisited.size() == 0 || edgeVisited.size() < fnHE.numHalfEdges())
 		{
 			edgeVisited.clear();
-			for (int i = 0; i < fnHE.numHalfEdges(); i++)
-			{
-				edgeVisited.push_back(0);
-			}
+			edgeVisited.assign(fnHE.numHalfEdges(), 0);
 		}
 
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
+		zIntArray vertices;
+		for (int i = 0; i < fnHE.numVertices(); i++) vertices.push_back(i);
 
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
+		computeAdjacency();
 
-			// compute shortes path from all vertices to current vertex 
-			for (int j = 0; j < fnHE.numVertices(); j++)
-			{
-				shortestPath_DistanceParent(sourceVertices[i], j, dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
+		// compute shortes path from all vertices to current vertex 
+		edgeVisits(sourceVertices, vertices, false, edgeVisited);
 	}
 
-	//---- graph specilization for shortestPathWalks_SourceToOtherSource 
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjGraph, zFnGraph>::shortestPathWalks_SourceToOtherSource(vector<int> &sourceVertices, vector<int> &edgeVisited)
-	{
-		edgeVisited.clear();
-
-		vector<bool> computeDone;
-
-		// initialise edge visits to 0
-		for (int i = 0; i < fnHE.numHalfEdges(); i++)
-		{
-			edgeVisited.push_back(0);
-		}
-
-
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
-
-			printf("\n total: %i source: %i ", fnHE.numVertices(), sourceVertices[i]);
-
-			// compute shortes path from all vertices to current vertex 
-			for (int j = i + 1; j < sourceVertices.size(); j++)
-			{
-				shortestPath_DistanceParent(sourceVertices[i], sourceVertices[j], dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
-	}
-
-	//---- mesh specilization for shortestPathWalks_SourceToOtherSource 
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjMesh, zFnMesh>::shortestPathWalks_SourceToOtherSource(vector<int> &sourceVertices, vector<int> &edgeVisited)
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestPathWalks_SourceToOtherSource(vector<int> &sourceVertices, vector<int> &edgeVisited)
 	{
 		edgeVisited.clear();
 
-		vector<bool> computeDone;
-
 		// initialise edge visits to 0
-		for (int i = 0; i < fnHE.numHalfEdges(); i++)
-		{
-			edgeVisited.push_back(0);
-		}
-
+		edgeVisited.assign(fnHE.numHalfEdges(), 0);
 
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
-
-			printf("\n total: %i source: %i ", fnHE.numVertices(), sourceVertices[i]);
+		computeAdjacency();
 
-			// compute shortes path from all vertices to current vertex 
-			for (int j = i + 1; j < sourceVertices.size(); j++)
-			{
-				shortestPath_DistanceParent(sourceVertices[i], sourceVertices[j], dists, parent, zEdgeVisited, edgeVisited);
-			}
-		}
+		// compute shortes path from all sources to the other sources 
+		edgeVisits(sourceVertices, sourceVertices, true, edgeVisited);
 	}
 
-	//---- graph specilization for walking distance sources
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjGraph, zFnGraph>::walk_DistanceFromSources(vector<int>& sourceVertices, vector<double>& vertexDistances)
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::walk_DistanceFromSources(vector<int>& sourceVertices, vector<double>& vertexDistances)
 	{
 		float maxDIST = 100000;
 
@@ -726,47 +572,18 @@ namespace zSpace
 			vertexDistances.push_back(maxDIST);
 		}
 
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
-
-			for (int j = 0; j < dists.size(); j++)
-			{
-				if (dists[j] < vertexDistances[j]) vertexDistances[j] = dists[j];
-			}
-		}
+		if (sourceVertices.size() == 0) return;
 
-	}
+		vector<float> dists;
+		vector<int> parent;
 
-	//---- mesh specilization for walking distance sources
-	template<>
-	ZSPACE_INLINE  void zTsShortestPath<zObjMesh, zFnMesh>::walk_DistanceFromSources(vector<int>& sourceVertices, vector<double>& vertexDistances)
-	{
-		float maxDIST = 100000;
+		// get Dijkstra shortest distance spanning tree from all sources at once
+		shortestDistance(sourceVertices, dists, parent);
 
-		for (int i = 0; i < fnHE.numVertices(); i++)
+		for (int j = 0; j < dists.size(); j++)
 		{
-			vertexDistances.push_back(maxDIST);
+			if (dists[j] < vertexDistances[j]) vertexDistances[j] = dists[j];
 		}
-
-		for (int i = 0; i < sourceVertices.size(); i++)
-		{
-			vector<float> dists;
-			vector<int> parent;
-
-			// get Dijkstra shortest distance spanning tree
-			shortestDistance(sourceVertices[i], dists, parent);
-
-			for (int j = 0; j < dists.size(); j++)
-			{
-				if (dists[j] < vertexDistances[j]) vertexDistances[j] = dists[j];
-			}
-		}
-
 	}
 
 	//---- graph specilization for walking distance sources
@@ -930,6 +747,54 @@ namespace zSpace
 		}
 	}
 
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestDistance(zIntArray &sourceVertices, vector<float> &dist, vector<int> &parent)
+	{
+		computeAdjacency();
+
+		zIntArray order;
+		dijkstra(sourceVertices, dist, parent, order);
+	}
+
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::shortestDistance_AllSources(zIntArray &sourceVertices, vector<zFloatArray> &dists)
+	{
+		computeAdjacency();
+
+		dists.clear();
+		dists.assign(sourceVertices.size(), zFloatArray());
+
+		int nThreads = getNumThreads(sourceVertices.size());
+
+		auto walk = [&](int threadId)
+		{
+			vector<int> parent;
+			zIntArray order;
+			zIntArray source(1);
+
+			for (int i = threadId; i < sourceVertices.size(); i += nThreads)
+			{
+				source[0] = sourceVertices[i];
+				dijkstra(source, dists[i], parent, order);
+			}
+		};
+
+		vector<std::thread> threads;
+		for (int t = 1; t < nThreads; t++) threads.push_back(std::thread(walk, t));
+
+		walk(0);
+
+		for (auto &t : threads) t.join();
+	}
+
+	//--- SET METHODS 
+
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::setNumThreads(int _numThreads)
+	{
+		numThreads = _numThreads;
+	}
+
 	//--- SPANNING TREE METHODS 
 
 	template<typename T, typename U>	
@@ -952,6 +817,194 @@ namespace zSpace
 		return min_index;
 	}
 
+	//--- PROTECTED WALK METHODS 
+
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::dijkstra(zIntArray &sourceVertices, vector<float> &dist, vector<int> &parent, zIntArray &order)
+	{
+		float maxDIST = 100000;
+
+		int numV = adjacencyOffsets.size() - 1;
+
+		// Initialize all distances as INFINITE 
+		dist.clear();
+		dist.assign(numV, maxDIST);
+
+		parent.clear();
+		parent.assign(numV, -2);
+
+		order.clear();
+
+		// indexed binary heap - heapId is -1 if not yet in the heap, -2 once in the shortest path tree
+		zIntArray heap;
+		zIntArray heapId(numV, -1);
+
+		auto lessThan = [&](int a, int b)
+		{
+			return (dist[a] < dist[b]) || (dist[a] == dist[b] && a > b);
+		};
+
+		auto siftUp = [&](int i)
+		{
+			int v = heap[i];
+			while (i > 0)
+			{
+				int p = (i - 1) / 2;
+				if (!lessThan(v, heap[p])) break;
+
+				heap[i] = heap[p];
+				heapId[heap[i]] = i;
+				i = p;
+			}
+			heap[i] = v;
+			heapId[v] = i;
+		};
+
+		auto siftDown = [&](int i)
+		{
+			int v = heap[i];
+			int n = heap.size();
+			while (true)
+			{
+				int c = 2 * i + 1;
+				if (c >= n) break;
+				if (c + 1 < n && lessThan(heap[c + 1], heap[c])) c++;
+				if (!lessThan(heap[c], v)) break;
+
+				heap[i] = heap[c];
+				heapId[heap[i]] = i;
+				i = c;
+			}
+			heap[i] = v;
+			heapId[v] = i;
+		};
+
+		// Distance of source vertex from itself is always 0 
+		for (auto &s : sourceVertices)
+		{
+			if (s < 0 || s >= numV) throw std::invalid_argument("index out of bounds.");
+			if (heapId[s] != -1) continue;
+
+			dist[s] = 0;
+			parent[s] = -1;
+
+			heap.push_back(s);
+			siftUp(heap.size() - 1);
+		}
+
+		while (heap.size() > 0)
+		{
+			// Pick the minimum distance vertex from the set of vertices not yet processed. 
+			int u = heap[0];
+			heap[0] = heap.back();
+			heap.pop_back();
+			if (heap.size() > 0) siftDown(0);
+
+			// Mark the picked vertex as processed 
+			heapId[u] = -2;
+			order.push_back(u);
+
+			// Update dist value of the adjacent vertices of the picked vertex. 
+			for (int k = adjacencyOffsets[u]; k < adjacencyOffsets[u + 1]; k++)
+			{
+				int v = adjacencyVertices[k];
+				if (heapId[v] == -2) continue;
+
+				float distUV = dist[u] + adjacencyWeights[k];
+
+				if (distUV < dist[v])
+				{
+					dist[v] = distUV;
+					parent[v] = u;
+
+					if (heapId[v] == -1)
+					{
+						heap.push_back(v);
+						siftUp(heap.size() - 1);
+					}
+					else siftUp(heapId[v]);
+				}
+			}
+		}
+	}
+
+	template<typename T, typename U>
+	ZSPACE_INLINE void zTsShortestPath<T, U>::edgeVisits(zIntArray &sourceVertices, zIntArray &targetVertices, bool targetsAfterSource, vector<int> &edgeVisited)
+	{
+		int numV = adjacencyOffsets.size() - 1;
+
+		int nThreads = getNumThreads(sourceVertices.size());
+
+		// per thread edge visits, summed after the walks to keep the result independent of the thread count
+		vector<zIntArray> threadVisited(nThreads, zIntArray(edgeVisited.size(), 0));
+
+		auto walk = [&](int threadId)
+		{
+			vector<float> dists;
+			vector<int> parent;
+			zIntArray order;
+			zIntArray source(1);
+			zIntArray numPaths(numV);
+
+			zIntArray &visited = threadVisited[threadId];
+
+			for (int i = threadId; i < sourceVertices.size(); i += nThreads)
+			{
+				// get Dijkstra shortest distance spanning tree
+				source[0] = sourceVertices[i];
+				dijkstra(source, dists, parent, order);
+
+				// number of paths ending at each vertex
+				std::fill(numPaths.begin(), numPaths.end(), 0);
+
+				int start = (targetsAfterSource) ? i + 1 : 0;
+				for (int j = start; j < targetVertices.size(); j++) numPaths[targetVertices[j]]++;
+
+				// leaves to root, each tree edge is walked by all the paths ending in the subtree below it
+				for (int k = order.size() - 1; k >= 0; k--)
+				{
+					int id = order[k];
+					int nextId = parent[id];
+
+					if (nextId < 0 || numPaths[id] == 0) continue;
+
+					int eId;
+					bool chkEdge = fnHE.halfEdgeExists(id, nextId, eId);
+
+					if (chkEdge)
+					{
+						visited[eId] += numPaths[id];
+						visited[symHalfEdges[eId]] += numPaths[id];
+					}
+
+					numPaths[nextId] += numPaths[id];
+				}
+			}
+		};
+
+		vector<std::thread> threads;
+		for (int t = 1; t < nThreads; t++) threads.push_back(std::thread(walk, t));
+
+		walk(0);
+
+		for (auto &t : threads) t.join();
+
+		for (int t = 0; t < nThreads; t++)
+		{
+			for (int i = 0; i < edgeVisited.size(); i++) edgeVisited[i] += threadVisited[t][i];
+		}
+	}
+
+	template<typename T, typename U>
+	ZSPACE_INLINE int zTsShortestPath<T, U>::getNumThreads(int numTasks)
+	{
+		int out = (numThreads > 0) ? numThreads : (int)std::thread::hardware_concurrency();
+		if (out > numTasks) out = numTasks;
+		if (out < 1) out = 1;
+
+		return out;
+	}
+
 
 
 #if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
@@ -238,44 +238,14 @@ namespace zSpace
 
 	ZSPACE_INLINE void zSlimeEnvironment::diffuseEnvironment(double decayT, double diffuseDamp, zDiffusionType diffType)
 	{
-		vector<double> temp_chemA;
+		if (chemA.size() != numFieldValues()) throw std::invalid_argument(" error: chemA size not equal to number of field values.");
+		if (chemA.size() == 0) return;
 
-		for (int i = 0; i < numFieldValues(); i++)
-		{
-			double lapA = 0;
-
-			for (int j = 0; j < ringNeighbours[i].size(); j++)
-			{
-				int id = ringNeighbours[i][j];
-
-
-				if (diffType == zLaplacian)
-				{
-					if (id != i) lapA += (chemA[id] * 1);
-					else lapA += (chemA[id] * -8);
-				}
-				else if (diffType == zAverage)
-				{
-					lapA += (chemA[id] * 1);
-				}
-			}
+		diffusionBuffer.resize(chemA.size());
 
-			if (diffType == zLaplacian)
-			{
-				double newA = chemA[i] + (lapA * diffuseDamp);
-				temp_chemA.push_back(newA);
-			}
-			else if (diffType == zAverage)
-			{
-				if (lapA != 0) lapA /= (ringNeighbours[i].size());
-				temp_chemA.push_back(lapA);
-			}
-		}
-
-		for (int i = 0; i < numFieldValues(); i++)
-		{
-			chemA[i] = (1 - decayT) *temp_chemA[i];
-		}
+		// the slime environment keeps its -8 laplacian centre weight for any number of rings
+		computeDiffusion(&chemA[0], &diffusionBuffer[0], numNeighbourRings, diffuseDamp, diffType, (1 - decayT), -8.0);
+		chemA.swap(diffusionBuffer);
 	}
 
 	//---- UTILITY METHODS
@@ -0,0 +1,350 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+
+#include<headers/zToolsets/statics/zTsFDMSolver.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zTsFDMSolver::zTsFDMSolver()
+	{
+		numVertices = 0;
+		numFree = 0;
+
+		analysedLLT = false;
+		analysedLDLT = false;
+		positiveDensities = true;
+		factorised = false;
+
+		relativeResidual = 0;
+		iterations = 0;
+		analyses = 0;
+
+		tolerance = 1e-8;
+		maxIterations = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zTsFDMSolver::~zTsFDMSolver() {}
+
+	//---- COMPUTE METHODS
+
+	ZSPACE_INLINE bool zTsFDMSolver::compute(zSparseMatrix &C, zBoolArray &fixedVertices, VectorXd &_q)
+	{
+		if (_q.rows() != C.rows()) throw std::invalid_argument(" error: number of force densities not equal to the number of rows of the edge node matrix.");
+		if (fixedVertices.size() != C.cols()) throw std::invalid_argument(" error: number of fixed vertex booleans not equal to the number of columns of the edge node matrix.");
+
+		if (!samePattern(C, fixedVertices)) analysePattern(C, fixedVertices);
+
+		q = _q;
+
+		positiveDensities = true;
+		for (int i = 0; i < q.rows(); i++)
+		{
+			if (q[i] <= 0) positiveDensities = false;
+		}
+
+		// numeric assembly into the cached pattern
+		double *values = Dn.valuePtr();
+		for (int i = 0; i < Dn.nonZeros(); i++) values[i] = 0;
+
+		for (int e = 0; e < q.rows(); e++)
+		{
+			for (int k = entryOffsets[e]; k < entryOffsets[e + 1]; k++) values[entryIds[k]] += entryCoefficients[k] * q[e];
+		}
+
+		if (numFree == 0)
+		{
+			factorised = true;
+			return true;
+		}
+
+		if (positiveDensities)
+		{
+			if (!analysedLLT)
+			{
+				solverLLT.analyzePattern(Dn);
+				analysedLLT = true;
+			}
+
+			solverLLT.factorize(Dn);
+			factorised = (solverLLT.info() == Eigen::Success);
+
+			return factorised;
+		}
+		else
+		{
+			if (!analysedLDLT)
+			{
+				solverLDLT.analyzePattern(Dn);
+				analysedLDLT = true;
+			}
+
+			solverLDLT.factorize(Dn);
+			factorised = (solverLDLT.info() == Eigen::Success);
+
+			// a failed LDL^T factorisation is solved with MINRES
+			return true;
+		}
+	}
+
+	ZSPACE_INLINE bool zTsFDMSolver::solve(MatrixXd &P, MatrixXd &X, MatrixXd &Xn)
+	{
+		if (P.rows() != numVertices || X.rows() != numVertices) throw std::invalid_argument(" error: number of rows not equal to the number of vertices of the edge node matrix.");
+		if (P.cols() != X.cols()) throw std::invalid_argument(" error: number of columns of the load and position matrix are not equal.");
+
+		iterations = 0;
+		relativeResidual = 0;
+
+		// B = Pn - Cn^T * Q * Cf * Xf, computed per edge
+		MatrixXd B(numFree, P.cols());
+
+		for (int v = 0; v < numVertices; v++)
+		{
+			if (freeIds[v] != -1) B.row(freeIds[v]) = P.row(v);
+		}
+
+		RowVectorXd fixedSum(P.cols());
+		for (int e = 0; e < q.rows(); e++)
+		{
+			fixedSum.setZero();
+			bool hasFixed = false;
+
+			for (int k = edgeOffsets[e]; k < edgeOffsets[e + 1]; k++)
+			{
+				int v = edgeVertices[k];
+				if (freeIds[v] != -1) continue;
+
+				fixedSum += edgeCoefficients[k] * X.row(v);
+				hasFixed = true;
+			}
+
+			if (!hasFixed) continue;
+
+			for (int k = edgeOffsets[e]; k < edgeOffsets[e + 1]; k++)
+			{
+				int v = edgeVertices[k];
+				if (freeIds[v] == -1) continue;
+
+				B.row(freeIds[v]) -= (edgeCoefficients[k] * q[e]) * fixedSum;
+			}
+		}
+
+		Xn = MatrixXd::Zero(numFree, P.cols());
+		if (numFree == 0) return true;
+
+		double bNorm = B.norm();
+		auto getResidual = [&]()
+		{
+			double r = (Dn * Xn - B).norm();
+			return (bNorm > 0) ? r / bNorm : r;
+		};
+
+		if (positiveDensities)
+		{
+			if (!factorised) return false;
+
+			Xn = solverLLT.solve(B);
+			relativeResidual = getResidual();
+
+			return (solverLLT.info() == Eigen::Success);
+		}
+
+		if (factorised)
+		{
+			Xn = solverLDLT.solve(B);
+			relativeResidual = getResidual();
+
+			if (solverLDLT.info() == Eigen::Success && relativeResidual <= tolerance) return true;
+		}
+
+		// MINRES only needs the matrix to be symmetric, and starts from the LDL^T solution if it is finite
+		if (!factorised || !Xn.allFinite()) Xn.setZero();
+
+		MINRES<zSparseMatrix, Lower | Upper, IdentityPreconditioner> solverMINRES;
+		solverMINRES.setTolerance(tolerance);
+		if (maxIterations > 0) solverMINRES.setMaxIterations(maxIterations);
+		solverMINRES.compute(Dn);
+
+		for (int c = 0; c < B.cols(); c++)
+		{
+			VectorXd guess = Xn.col(c);
+			Xn.col(c) = solverMINRES.solveWithGuess(B.col(c), guess);
+
+			iterations = std::max(iterations, (int)solverMINRES.iterations());
+		}
+
+		relativeResidual = getResidual();
+
+		return relativeResidual <= tolerance;
+	}
+
+	ZSPACE_INLINE void zTsFDMSolver::clear()
+	{
+		numVertices = 0;
+		numFree = 0;
+
+		patternOuter.clear();
+		patternInner.clear();
+		patternValues.clear();
+		patternFixed.clear();
+
+		freeIds.clear();
+		edgeOffsets.clear();
+		edgeVertices.clear();
+		edgeCoefficients.clear();
+		entryOffsets.clear();
+		entryIds.clear();
+		entryCoefficients.clear();
+
+		Dn = zSparseMatrix();
+		q = VectorXd();
+
+		analysedLLT = false;
+		analysedLDLT = false;
+		factorised = false;
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE bool zTsFDMSolver::isPositive()
+	{
+		return positiveDensities;
+	}
+
+	ZSPACE_INLINE double zTsFDMSolver::getRelativeResidual()
+	{
+		return relativeResidual;
+	}
+
+	ZSPACE_INLINE int zTsFDMSolver::numIterations()
+	{
+		return iterations;
+	}
+
+	ZSPACE_INLINE int zTsFDMSolver::numAnalyses()
+	{
+		return analyses;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zTsFDMSolver::samePattern(zSparseMatrix &C, zBoolArray &fixedVertices)
+	{
+		C.makeCompressed();
+
+		if (C.cols() != numVertices || C.rows() + 1 != edgeOffsets.size()) return false;
+		if (C.nonZeros() != patternInner.size() || fixedVertices != patternFixed) return false;
+
+		if (!std::equal(patternOuter.begin(), patternOuter.end(), C.outerIndexPtr())) return false;
+		if (!std::equal(patternInner.begin(), patternInner.end(), C.innerIndexPtr())) return false;
+		if (!std::equal(patternValues.begin(), patternValues.end(), C.valuePtr())) return false;
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zTsFDMSolver::analysePattern(zSparseMatrix &C, zBoolArray &fixedVertices)
+	{
+		C.makeCompressed();
+
+		numVertices = C.cols();
+		int numEdges = C.rows();
+
+		patternOuter.assign(C.outerIndexPtr(), C.outerIndexPtr() + C.outerSize() + 1);
+		patternInner.assign(C.innerIndexPtr(), C.innerIndexPtr() + C.nonZeros());
+		patternValues.assign(C.valuePtr(), C.valuePtr() + C.nonZeros());
+		patternFixed = fixedVertices;
+
+		numFree = 0;
+		freeIds.assign(numVertices, -1);
+		for (int v = 0; v < numVertices; v++)
+		{
+			if (!fixedVertices[v]) freeIds[v] = numFree++;
+		}
+
+		// transpose the column major edge node matrix to vertex lists per edge
+		edgeOffsets.assign(numEdges + 1, 0);
+		for (int i = 0; i < C.nonZeros(); i++) edgeOffsets[patternInner[i] + 1]++;
+		for (int e = 0; e < numEdges; e++) edgeOffsets[e + 1] += edgeOffsets[e];
+
+		edgeVertices.assign(C.nonZeros(), -1);
+		edgeCoefficients.assign(C.nonZeros(), 0);
+
+		zIntArray fill(edgeOffsets.begin(), edgeOffsets.end() - 1);
+		for (int v = 0; v < numVertices; v++)
+		{
+			for (zSparseMatrix::InnerIterator it(C, v); it; ++it)
+			{
+				int k = fill[it.row()]++;
+				edgeVertices[k] = v;
+				edgeCoefficients[k] = it.value();
+			}
+		}
+
+		// pattern of Dn = Cn^T * Q * Cn
+		vector<zTriplet> coefs;
+		for (int e = 0; e < numEdges; e++)
+		{
+			for (int a = edgeOffsets[e]; a < edgeOffsets[e + 1]; a++)
+			{
+				for (int b = edgeOffsets[e]; b < edgeOffsets[e + 1]; b++)
+				{
+					int fa = freeIds[edgeVertices[a]];
+					int fb = freeIds[edgeVertices[b]];
+
+					if (fa != -1 && fb != -1) coefs.push_back(zTriplet(fa, fb, 1.0));
+				}
+			}
+		}
+
+		Dn = zSparseMatrix(numFree, numFree);
+		Dn.setFromTriplets(coefs.begin(), coefs.end());
+		Dn.makeCompressed();
+
+		// index of each edge contribution in the value array of Dn
+		entryOffsets.assign(1, 0);
+		entryIds.clear();
+		entryCoefficients.clear();
+
+		for (int e = 0; e < numEdges; e++)
+		{
+			for (int a = edgeOffsets[e]; a < edgeOffsets[e + 1]; a++)
+			{
+				for (int b = edgeOffsets[e]; b < edgeOffsets[e + 1]; b++)
+				{
+					int fa = freeIds[edgeVertices[a]];
+					int fb = freeIds[edgeVertices[b]];
+
+					if (fa == -1 || fb == -1) continue;
+
+					int *start = Dn.innerIndexPtr() + Dn.outerIndexPtr()[fb];
+					int *end = Dn.innerIndexPtr() + Dn.outerIndexPtr()[fb + 1];
+
+					entryIds.push_back(std::lower_bound(start, end, fa) - Dn.innerIndexPtr());
+					entryCoefficients.push_back(edgeCoefficients[a] * edgeCoefficients[b]);
+				}
+			}
+
+			entryOffsets.push_back(entryIds.size());
+		}
+
+		analysedLLT = false;
+		analysedLDLT = false;
+		factorised = false;
+
+		analyses++;
+	}
+
+}
@@ -2060,12 +2060,22 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zTsPolytopal::get_EquilibriumMatrix(zDiagramType type, MatrixXd &out)
 	{
-		double factor = pow(10, 3);
+		zSparseMatrix A;
+		if (!get_EquilibriumMatrix(type, A)) return false;
 
-		// Get Normal diagonal matricies
-		VectorXd nx(primal_n_f_i);
-		VectorXd ny(primal_n_f_i);
-		VectorXd nz(primal_n_f_i);
+		out = MatrixXd(A);
+
+		printf("\n A : %i  %i ", out.rows(), out.cols());
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zTsPolytopal::get_EquilibriumMatrix(zDiagramType type, zSparseMatrix &out)
+	{
+		// Get face normals
+		VectorXd nx = VectorXd::Zero(primal_n_f_i);
+		VectorXd ny = VectorXd::Zero(primal_n_f_i);
+		VectorXd nz = VectorXd::Zero(primal_n_f_i);
 
 		for (int j = 0; j < primalFaceNormals.size(); j++)
 		{
@@ -2078,52 +2088,89 @@ namespace zSpace
 			nx[id] = n.x;
 			ny[id] = n.y;
 			nz[id] = n.z;
+		}
+
+		// primal _ edgefaceMatrix
+		zSparseMatrix C_ef;
+		getPrimal_EdgeFaceMatrix(zForceDiagram, C_ef);
 
+		// compute A = [C_ef * Nx ; C_ef * Ny ; C_ef * Nz]
+		vector<zTriplet> coefs;
+		coefs.reserve(3 * C_ef.nonZeros());
 
+		for (int k = 0; k < C_ef.outerSize(); ++k)
+		{
+			for (zSparseMatrix::InnerIterator it(C_ef, k); it; ++it)
+			{
+				int e = it.row();
+				int f = it.col();
+
+				if (nx[f] != 0) coefs.push_back(zTriplet(e, f, it.value() * nx[f]));
+				if (ny[f] != 0) coefs.push_back(zTriplet(primal_n_e_i + e, f, it.value() * ny[f]));
+				if (nz[f] != 0) coefs.push_back(zTriplet(2 * primal_n_e_i + e, f, it.value() * nz[f]));
+			}
 		}
 
-		zDiagonalMatrix Nx = nx.asDiagonal();
-		zDiagonalMatrix Ny = ny.asDiagonal();
-		zDiagonalMatrix Nz = nz.asDiagonal();
+		out = zSparseMatrix(3 * primal_n_e_i, primal_n_f_i);
+		out.setFromTriplets(coefs.begin(), coefs.end());
+		out.makeCompressed();
+
+		return true;
+	}
+
+	ZSPACE_INLINE int zTsPolytopal::get_EquilibriumNullSpace(zSparseMatrix &A, double threshold, MatrixXd &nullSpace)
+	{
+		// A P = Q R , with rank r from the pivoting of the QR
+		SparseQR<zSparseMatrix, COLAMDOrdering<int>> qr;
+		qr.setPivotThreshold(threshold);
+		qr.compute(A);
 
+		if (qr.info() != Success) throw std::invalid_argument(" error: sparse QR factorisation of the equilibrium matrix failed.");
 
-		// primal _ edgefaceMatrix
-		zSparseMatrix C_ef;
-		getPrimal_EdgeFaceMatrix(zForceDiagram, C_ef);
+		int rank = qr.rank();
+		int k = A.cols() - rank;
 
-		//cout << "\n C_ef " <<  endl  << C_ef << endl;
+		nullSpace = MatrixXd::Zero(A.cols(), k);
+		if (k == 0) return rank;
 
-		// compute A
+		// null space = P [ -R11^-1 R12 ; I ]
+		zSparseMatrix R = qr.matrixR();
+		zSparseMatrix R11 = R.topLeftCorner(rank, rank);
+		MatrixXd R12 = MatrixXd(R.topRightCorner(rank, k));
 
-		out = MatrixXd(3 * primal_n_e_i, primal_n_f_i);
+		MatrixXd N(A.cols(), k);
+		N.topRows(rank) = -1 * R11.triangularView<Upper>().solve(R12);
+		N.bottomRows(k).setIdentity();
 
+		// orthonormalise
+		HouseholderQR<MatrixXd> hqr(qr.colsPermutation() * N);
+		nullSpace = hqr.householderQ() * MatrixXd::Identity(A.cols(), k);
 
+		return rank;
+	}
 
-		for (int i = 0; i < 3; i++)
-		{
-			MatrixXd temp(primal_n_e_i, primal_n_f_i);
+	ZSPACE_INLINE void zTsPolytopal::getDual_ForceDensities_Sparse(VectorXd &q, double tolerance)
+	{
+		zSparseMatrix A;
+		get_EquilibriumMatrix(zForceDiagram, A);
 
-			if (i == 0) temp = C_ef * Nx;
-			if (i == 1) temp = C_ef * Ny;
-			if (i == 2) temp = C_ef * Nz;
+		// minimum norm projection of the unit force densities to the null space, q = Xi - A^T y with A A^T y = A Xi.
+		// y is the least squares solution of A^T y = Xi, so neither A A^T nor a null space basis is formed.
+		zSparseMatrix At = A.transpose();
 
-			for (int j = 0; j < primal_n_e_i; j++)
-			{
-				for (int k = 0; k < primal_n_f_i; k++)
-				{
-					out(i*primal_n_e_i + j, k) = temp(j, k);
+		LeastSquaresConjugateGradient<zSparseMatrix> lscg;
+		lscg.setTolerance(tolerance);
+		lscg.compute(At);
 
-					//out(i*primal_n_e_i + j, k) = round(out(i*primal_n_e_i + j, k) *factor) / factor;
+		VectorXd Xi = VectorXd::Ones(A.cols());
+		VectorXd y = lscg.solve(Xi);
 
-					//if (out(i*primal_n_e_i + j, k) >0 &&  out(i*primal_n_e_i + j, k) < 0.000001) out(i*primal_n_e_i + j, k) = 0;
-					//if (out(i*primal_n_e_i + j, k) < 0 && out(i*primal_n_e_i + j, k) > -0.000001) out(i*primal_n_e_i + j, k) = 0;
-				}
-			}
-		}
+		cout << "\n Iterations : " << lscg.iterations() << " , error : " << lscg.error() << endl;
+		if (lscg.info() != Success) cout << "\n least squares solve did not converge to the input tolerance." << endl;
 
-		printf("\n A : %i  %i ", out.rows(), out.cols());
+		q = Xi - At * y;
 
-		return true;
+		cout << "\n AQ norm: " << endl << (A * q).norm() << endl;
 	}
 
 	ZSPACE_INLINE void zTsPolytopal::getDual_ForceDensities_LPA(VectorXd &q)
@@ -616,8 +616,6 @@ namespace zSpace
 		//printf("\n Force Densities: \n");
 		//cout << endl << q;
 
-		zDiagonalMatrix Q = q.asDiagonal();
-
 		// LOAD VECTOR
 		VectorXd p(fnResult.numVertices());
 
@@ -644,52 +642,20 @@ namespace zSpace
 
 		}
 
-		zSparseMatrix Cn = subMatrix(C, freeVertices);
-		zSparseMatrix Cf = subMatrix(C, fixedVertices);
-		MatrixXd Xf = subMatrix(X, fixedVertices);
-		MatrixXd Pn = subMatrix(P, freeVertices);
-
-		//cout << "Cn: \n" << Cn << endl;
-		//cout << "Cf: \n" << Cf << endl;
-
-		zSparseMatrix Cn_transpose;
-		Cn_transpose = Cn.transpose();
-
-		//CHOLESKY DECOMPOSITION
-
-		zSparseMatrix Dn = Cn_transpose * Q * Cn;
-		zSparseMatrix Df = Cn_transpose * Q * Cf;
-
-		MatrixXd  B = Pn - Df * Xf;
-
-		// solve
+		// solve, reusing the symbolic factorisation of the previous call if the pattern is the same
 		MatrixXd Xn;
 
-		if (positiveDensities)
-		{
-			SimplicialLLT< zSparseMatrix > solver; // sparse cholesky solver
-			solver.compute(Dn); // compute cholesky factors
-
-			if (solver.info() != Eigen::Success)
-				return false;
+		if (!fdmSolver.compute(C, fixedVerticesBoolean, q))
+			return false;
 
+		if (!fdmSolver.solve(P, X, Xn) && fdmSolver.isPositive())
+			return false;
 
-			Xn = solver.solve(B); // solve AX = B ;
-			if (solver.info() != Eigen::Success)
-				return false;
-
-			//cout << endl << Xn;
-		}
-		else
+		if (!fdmSolver.isPositive())
 		{
-			MatrixXd denseDn;
-			denseDn = MatrixXd(Dn);
-			Xn = denseDn.ldlt().solve(B);
-
 			// convergence error check.
-			double relative_error = (denseDn*Xn - B).norm() / B.norm(); // norm() is L2 norm
+			double relative_error = fdmSolver.getRelativeResidual();
 			cout << endl << relative_error << " FDM - negative" << endl;
-
 		}
 
 
@@ -784,8 +750,6 @@ namespace zSpace
 		//printf("\n Force Densities: \n");
 		//cout << endl << q << endl;
 
-		zDiagonalMatrix Q = q.asDiagonal();
-
 		// LOAD VECTOR
 		VectorXd p(fnResult.numVertices());
 
@@ -812,54 +776,20 @@ namespace zSpace
 
 		}
 
-		zSparseMatrix Cn = subMatrix(C, freeVertices);
-		zSparseMatrix Cf = subMatrix(C, fixedVertices);
-		MatrixXd Xf = subMatrix(X, fixedVertices);
-		MatrixXd Pn = subMatrix(P, freeVertices);
-
-		//cout << "Pn: \n" << Pn << endl;
-
-		//cout << "Cn: \n" << Cn << endl;
-		//cout << "Cf: \n" << Cf << endl;
-
-		zSparseMatrix Cn_transpose;
-		Cn_transpose = Cn.transpose();
-
-		//CHOLESKY DECOMPOSITION
-
-		zSparseMatrix Dn = Cn_transpose * Q * Cn;
-		zSparseMatrix Df = Cn_transpose * Q * Cf;
-
-		MatrixXd  B = Pn - Df * Xf;
-
-		// solve
+		// solve, reusing the symbolic factorisation of the previous call if the pattern is the same
 		MatrixXd Xn;
 
-		if (positiveDensities)
-		{
-			SimplicialLLT< zSparseMatrix > solver; // sparse cholesky solver
-			solver.compute(Dn); // compute cholesky factors
-
-			if (solver.info() != Eigen::Success)
-				return false;
-
+		if (!fdmSolver.compute(C, fixedVerticesBoolean, q))
+			return false;
 
-			Xn = solver.solve(B); // solve AX = B ;
-			if (solver.info() != Eigen::Success)
-				return false;
+		if (!fdmSolver.solve(P, X, Xn) && fdmSolver.isPositive())
+			return false;
 
-			//cout << endl << Xn;
-		}
-		else
+		if (!fdmSolver.isPositive())
 		{
-			MatrixXd denseDn;
-			denseDn = MatrixXd(Dn);
-			Xn = denseDn.ldlt().solve(B);
-
 			// convergence error check.
-			double relative_error = (denseDn*Xn - B).norm() / B.norm(); // norm() is L2 norm
+			double relative_error = fdmSolver.getRelativeResidual();
 			cout << endl << relative_error << " FDM - negative" << endl;
-
 		}
 
 
@@ -1256,10 +1186,6 @@ namespace zSpace
 		// POSITION MATRIX
 		
 
-		// FORCE DENSITY VECTOR
-		
-		zDiagonalMatrix Q = q.asDiagonal();
-
 		// LOAD VECTOR
 		VectorXd p(fnResult.numVertices());
 
@@ -1274,38 +1200,16 @@ namespace zSpace
 		P.col(2) = p.col(0);
 		
 
-		// SUB MATRICES
-		
-		zSparseMatrix Cn = subMatrix(C, freeVertices);
-		zSparseMatrix Cf = subMatrix(C, fixedVertices);
-		MatrixXd Xf = subMatrix(X, fixedVertices);		
-
-		MatrixXd Pn_mat = subMatrix(P, freeVertices);
-
-		zSparseMatrix Cn_transpose;
-		Cn_transpose = Cn.transpose();
-
-		//CHOLESKY DECOMPOSITION
-
-		zSparseMatrix Dn = Cn_transpose * Q * Cn;
-		zSparseMatrix Df = Cn_transpose * Q * Cf;
-
-		MatrixXd  B = Pn_mat - Df * Xf;
-
-		// solve
+		// SOLVE
 		MatrixXd Xn;
 
-
-		MatrixXd denseDn;
-		denseDn = MatrixXd(Dn);
-		Xn = denseDn.ldlt().solve(B);
+		if (!fdmSolver.compute(C, fixedVerticesBoolean, q)) return;
+		fdmSolver.solve(P, X, Xn);
 
 		// convergence error check.
-		double relative_error = (denseDn*Xn - B).norm() / B.norm(); // norm() is L2 norm
+		double relative_error = fdmSolver.getRelativeResidual();
 		cout << endl << relative_error << " FDM - negative" << endl;
 
-	
-
 		// POSITIONS OF NON FIXED VERTICES
 		for (int i = 0; i < freeVertices.size(); i++)
 		{
@@ -2079,8 +1983,6 @@ namespace zSpace
 		//printf("\n Force Densities: \n");
 		//cout << endl << q;
 
-		zDiagonalMatrix Q = q.asDiagonal();
-
 		// LOAD VECTOR
 		VectorXd p(fnResult.numVertices());
 
@@ -2106,52 +2008,20 @@ namespace zSpace
 
 		}
 
-		zSparseMatrix Cn = subMatrix(C, freeVertices);
-		zSparseMatrix Cf = subMatrix(C, fixedVertices);
-		MatrixXd Xf = subMatrix(Xz, fixedVertices);
-		MatrixXd Pn = subMatrix(P, freeVertices);
-
-		//cout << "Cn: \n" << Cn << endl;
-		//cout << "Cf: \n" << Cf << endl;
-
-		zSparseMatrix Cn_transpose;
-		Cn_transpose = Cn.transpose();
-
-		//CHOLESKY DECOMPOSITION
-
-		zSparseMatrix Dn = Cn_transpose * Q * Cn;
-		zSparseMatrix Df = Cn_transpose * Q * Cf;
-
-		MatrixXd  B = Pn - Df * Xf;
-
-		// solve
+		// solve, reusing the symbolic factorisation of the previous call if the pattern is the same
 		MatrixXd Xn;
 
-		if (positiveDensities)
-		{
-			SimplicialLLT< zSparseMatrix > solver; // sparse cholesky solver
-			solver.compute(Dn); // compute cholesky factors
-
-			if (solver.info() != Eigen::Success)
-				return false;
-
+		if (!fdmSolver.compute(C, fixedVerticesBoolean, q))
+			return false;
 
-			Xn = solver.solve(B); // solve AX = B ;
-			if (solver.info() != Eigen::Success)
-				return false;
+		if (!fdmSolver.solve(P, Xz, Xn) && fdmSolver.isPositive())
+			return false;
 
-			//cout << endl << Xn;
-		}
-		else
+		if (!fdmSolver.isPositive())
 		{
-			MatrixXd denseDn;
-			denseDn = MatrixXd(Dn);
-			Xn = denseDn.ldlt().solve(B);
-
 			// convergence error check.
-			double relative_error = (denseDn*Xn - B).norm() / B.norm(); // norm() is L2 norm
+			double relative_error = fdmSolver.getRelativeResidual();
 			cout << endl << relative_error << " FDM - negative" << endl;
-
 		}
 
 
@@ -2242,8 +2112,6 @@ namespace zSpace
 		//printf("\n Force Densities: \n");
 		//cout << endl << q;
 
-		zDiagonalMatrix Q = q.asDiagonal();
-
 		// LOAD VECTOR
 		VectorXd p(fnResult.numVertices());
 
@@ -2269,52 +2137,20 @@ namespace zSpace
 
 		}
 
-		zSparseMatrix Cn = subMatrix(C, freeVertices);
-		zSparseMatrix Cf = subMatrix(C, fixedVertices);
-		MatrixXd Xf = subMatrix(Xz, fixedVertices);
-		MatrixXd Pn = subMatrix(P, freeVertices);
-
-		//cout << "Cn: \n" << Cn << endl;
-		//cout << "Cf: \n" << Cf << endl;
-
-		zSparseMatrix Cn_transpose;
-		Cn_transpose = Cn.transpose();
-
-		//CHOLESKY DECOMPOSITION
-
-		zSparseMatrix Dn = Cn_transpose * Q * Cn;
-		zSparseMatrix Df = Cn_transpose * Q * Cf;
-
-		MatrixXd  B = Pn - Df * Xf;
-
-		// solve
+		// solve, reusing the symbolic factorisation of the previous call if the pattern is the same
 		MatrixXd Xn;
 
-		if (positiveDensities)
-		{
-			SimplicialLLT< zSparseMatrix > solver; // sparse cholesky solver
-			solver.compute(Dn); // compute cholesky factors
-
-			if (solver.info() != Eigen::Success)
-				return false;
+		if (!fdmSolver.compute(C, fixedVerticesBoolean, q))
+			return false;
 
+		if (!fdmSolver.solve(P, Xz, Xn) && fdmSolver.isPositive())
+			return false;
 
-			Xn = solver.solve(B); // solve AX = B ;
-			if (solver.info() != Eigen::Success)
-				return false;
-
-			//cout << endl << Xn;
-		}
-		else
+		if (!fdmSolver.isPositive())
 		{
-			MatrixXd denseDn;
-			denseDn = MatrixXd(Dn);
-			Xn = denseDn.ldlt().solve(B);
-
 			// convergence error check.
-			double relative_error = (denseDn*Xn - B).norm() / B.norm(); // norm() is L2 norm
+			double relative_error = fdmSolver.getRelativeResidual();
 			cout << endl << relative_error << " FDM - negative" << endl;
-
 		}
 
 
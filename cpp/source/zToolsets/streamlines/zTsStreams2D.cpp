@@ -148,265 +148,291 @@ namespace zSpace
 
 	//----  2D STREAM LINES METHODS
 
-	ZSPACE_INLINE void zTsStreams2D::createStreams(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, bool seedStreamsOnly)
+	ZSPACE_INLINE void zTsStreams2D::createStreams(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, bool seedStreamsOnly, int maxStreams)
 	{
 		streams.clear();
-		streams.assign(5000, zStreamLine());
+		streams.assign(maxStreams, zStreamLine());
 
 		int streamCounter = 0;
 
-		// make first stream line
-		if (streamCounter == 0)
+		if (start_seedPoints.size() == 0)
 		{
-			bool noStartSeedPoints = false;
+			zVector minBB, maxBB;
+			fnField.getBoundingBox(minBB, maxBB);
 
-			if (start_seedPoints.size() == 0)
-			{
-				noStartSeedPoints = true;
-
-				zVector minBB, maxBB;
-				fnField.getBoundingBox(minBB, maxBB);
-
-				zVector seedPoint = zVector(coreUtils.randomNumber_double(minBB.x, maxBB.x), coreUtils.randomNumber_double(minBB.y, maxBB.y), 0);
-
-				start_seedPoints.push_back(seedPoint);
-			}
+			zVector seedPoint = zVector(coreUtils.randomNumber_double(minBB.x, maxBB.x), coreUtils.randomNumber_double(minBB.y, maxBB.y), 0);
 
-			for (int i = 0; i < start_seedPoints.size(); i++)
-			{
-				
-				bool chk = createStreamGraph(streams[streamCounter].graphObj, start_seedPoints[i]);
+			start_seedPoints.push_back(seedPoint);
+		}
 
-				if (chk)
-				{
-					//streams.push_back(temp);
+		createStreamGrid();
 
-					streams[streamCounter].isValid = true;
-					streamCounter++;				
+		growStreams(streams, streamCounter, start_seedPoints, seedStreamsOnly, nullptr, 0.0, 0.0);
 
-				}
-			}
+		printf("\n %i streamLines created. ", streamCounter);
+	}
 
+	//----  2D STREAM LINES METHODS WITH INFLUENCE SCALAR FIELD
 
+	ZSPACE_INLINE void zTsStreams2D::createStreams_Influence(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, bool seedStreamsOnly, int maxStreams)
+	{
+		streams.clear();
+		streams.assign(maxStreams, zStreamLine());
 
+		int streamCounter = 0;
 
-		}
+		if (start_seedPoints.size() == 0)
+		{
+			zVector minBB, maxBB;
+			fnField.getBoundingBox(minBB, maxBB);
 
+			zVector seedPoint = zVector(coreUtils.randomNumber_double(minBB.x, maxBB.x), coreUtils.randomNumber_double(minBB.y, maxBB.y), 0);
 
-		if (seedStreamsOnly)
-		{
-			printf("\n %i streamLines created. ", streamCounter);
-			return;
+			start_seedPoints.push_back(seedPoint);
 		}
 
-		// compute other stream lines.
-
-		int currentStreamGraphId = 0;
-		int currentStreamGraphVertexId = 0;
+		createStreamGrid();
 
-		bool finished = false;
+		growStreams(streams, streamCounter, start_seedPoints, seedStreamsOnly, &fnInfluenceField, min_Power, max_Power);
 
-		while (!finished)
+		// alternate colors between parent and child streams
+		vector<bool> alternateGraph;
+		for (int i = 0; i < streamCounter; i++)
 		{
-			vector<zVector> seedPoints;
-
-			
-			zFnGraph fnGraph(streams[currentStreamGraphId].graphObj);
-
-			if (streams[currentStreamGraphId].isValid)
-			{
-				getSeedPoints(streams[currentStreamGraphId], currentStreamGraphVertexId, seedPoints);
-
-
-				for (int i = 0; i < seedPoints.size(); i++)
-				{
-
-					int id = streamCounter;
-					//streams.push_back(zStreamLine());
-
-					bool chk = createStreamGraph(streams[id].graphObj, seedPoints[i]);
-
-					if (chk)
-					{
-						streams[currentStreamGraphId].child.push_back(id);
-						streams[id].setParent(currentStreamGraphId);
-
-						streams[id].isValid = true;
-						streamCounter++;
-					}
-				}
-			}
-
-			
+			alternateGraph.push_back((streams[i].parent >= 0) ? !alternateGraph[streams[i].parent] : false);
 
-			currentStreamGraphVertexId++;
-
-			if (currentStreamGraphVertexId >= fnGraph.numVertices()) currentStreamGraphId++, currentStreamGraphVertexId = 0;
-
-			if (currentStreamGraphId >= streams.size()) finished = true;
+			zFnGraph fnGraph(streams[i].graphObj);
+			zColor col = (alternateGraph[i]) ? zColor(1, 0, 0, 1) : zColor(0, 0, 1, 1);
 
-			if (streamCounter >= streams.size()) finished = true;
+			fnGraph.setEdgeColor(col, true);
 		}
 
 		printf("\n %i streamLines created. ", streamCounter);
-
 	}
 
-	//----  2D STREAM LINES METHODS WITH INFLUENCE SCALAR FIELD
+	//---- PROTECTED METHODS
 
-	ZSPACE_INLINE void zTsStreams2D::createStreams_Influence(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, bool seedStreamsOnly)
+	ZSPACE_INLINE void zTsStreams2D::growStreams(vector<zStreamLine>& streams, int &streamCounter, vector<zVector> &start_seedPoints, bool seedStreamsOnly, zFnMeshField<zScalar> *fnInfluenceField, double min_Power, double max_Power)
 	{
-		streams.clear();
-		streams.assign(100, zStreamLine());
+		zThreadPool &pool = zThreadPool::getGlobal();
 
-		vector<vector<int>> childgraphs;
-		vector<int> parentGraph;
-		bool alternate = false;
+		// a single thread integrates every stream in the commit, without speculation.
+		int roundSize = (pool.numThreads() > 1) ? 4 * pool.numThreads() : 0;
+		int roundWindow = 256 * roundSize;
+		int seedsPerStream = 2;
 
-		int streamCounter = 0; 
+		// speculative stream of a seed, integrated against the stream grid of the snapshot
+		struct zStreamCandidate
+		{
+			zVector seed;
+			zPointArray positions;
+			zIntArray edgeConnects;
+			bool valid;
+			int snapshot;
+		};
 
-		// make first stream line
-		if (streamCounter == 0)
+		map<zIntPair, vector<zStreamCandidate>> candidates;
+
+		auto getCandidate = [&](zIntPair &source, zVector &seed) -> zStreamCandidate*
 		{
-			bool noStartSeedPoints = false;
+			auto it = candidates.find(source);
+			if (it == candidates.end()) return nullptr;
 
-			if (start_seedPoints.size() == 0)
+			for (auto &candidate : it->second)
 			{
-				noStartSeedPoints = true;
+				if (!(candidate.seed == seed)) continue;
+
+				// invalid streams stay invalid, valid streams need to be clear of the streams committed after the snapshot.
+				if (!candidate.valid || checkStreamClearance(candidate.positions, candidate.snapshot)) return &candidate;
+				return nullptr;
+			}
 
-				zVector minBB, maxBB;
-				fnField.getBoundingBox(minBB, maxBB);
+			return nullptr;
+		};
 
-				zVector seedPoint = zVector(coreUtils.randomNumber_double(minBB.x, maxBB.x), coreUtils.randomNumber_double(minBB.y, maxBB.y), 0);
+		// seed sources in the serial order - start seeds first, then the vertices of the created streams
+		zIntPair cursor(-1, 0);
+
+		while (streamCounter < streams.size() && checkSeedSource(streams, streamCounter, start_seedPoints, seedStreamsOnly, cursor))
+		{
+			// scan the next sources for seeds that are apart from the other speculative seeds, a few per stream.
+			zIntPairArray newSources;
+			zPointArray newSeeds;
 
-				start_seedPoints.push_back(seedPoint);
+			for (auto &it : candidates)
+			{
+				for (auto &candidate : it.second) seedGrid.addPosition(candidate.seed, -1);
 			}
 
-			for (int i = 0; i < start_seedPoints.size(); i++)
+			zIntPair source = cursor;
+			int streamSeeds = 0;
+
+			for (int i = 0; i < roundWindow && newSeeds.size() < roundSize; i++)
 			{
-				//streams.push_back(zStreamLine());
+				if (!checkSeedSource(streams, streamCounter, start_seedPoints, seedStreamsOnly, source)) break;
+				if (source.second == 0) streamSeeds = 0;
 
-				bool chk = createStreamGraph_Influence(streams[streamCounter].graphObj, start_seedPoints[i], fnInfluenceField, min_Power, max_Power);
+				zPointArray seeds;
+				getSourceSeedPoints(streams, start_seedPoints, source, fnInfluenceField, min_Power, max_Power, seeds);
 
-				if (chk)
+				for (auto &seed : seeds)
 				{
-					//streams.push_back(temp);
+					if (getCandidate(source, seed)) continue;
+					if (!seedGrid.checkClearance(seed, *dSep)) continue;
 
-					streams[streamCounter].isValid = true;
-					streamCounter++;
-
-					alternate = !alternate;
+					newSources.push_back(source);
+					newSeeds.push_back(seed);
+					seedGrid.addPosition(seed, -1);
 
+					streamSeeds++;
 				}
-			}
-
 
+				// start seeds are all used, stream vertices move on to the next stream
+				if (source.first != -1 && streamSeeds >= seedsPerStream) source = zIntPair(source.first + 1, 0);
+				else source.second++;
+			}
 
+			seedGrid.clear();
 
-		}
+			// integrate the new seeds in parallel against the current stream grid
+			int numNewSeeds = newSeeds.size();
+			vector<zStreamCandidate> newCandidates(numNewSeeds);
 
-		vector<bool> alternateGraph;
-		for (int i = 0; i < streamCounter; i++) alternateGraph.push_back(false);
+			pool.parallel_for(0, numNewSeeds, [&](int start, int end)
+			{
+				for (int i = start; i < end; i++)
+				{
+					zStreamCandidate &candidate = newCandidates[i];
 
-		if (seedStreamsOnly)
-		{
-			printf("\n %i streamLines created. ", streamCounter);
+					candidate.seed = newSeeds[i];
+					candidate.snapshot = streamCounter;
+					candidate.valid = (fnInfluenceField) ? integrateStream_Influence(newSeeds[i], *fnInfluenceField, min_Power, max_Power, candidate.positions, candidate.edgeConnects) : integrateStream(newSeeds[i], candidate.positions, candidate.edgeConnects);
+				}
+			}, 1);
 
-			for (int i = 0; i < streamCounter; i++)
+			for (int i = 0; i < numNewSeeds; i++)
 			{
-				zFnGraph fnGraph(streams[i].graphObj);
+				vector<zStreamCandidate> &sourceCandidates = candidates[newSources[i]];
 
-				zColor col = (alternateGraph[i]) ? zColor(1, 0, 0, 1) : zColor(0, 0, 1, 1);
-				fnGraph.setEdgeColor(col, true);
+				// replaces a candidate of the same seed which is not clear anymore
+				for (int j = 0; j < sourceCandidates.size(); j++)
+				{
+					if (sourceCandidates[j].seed == newSeeds[i]) sourceCandidates.erase(sourceCandidates.begin() + j), j--;
+				}
 
+				sourceCandidates.push_back(move(newCandidates[i]));
 			}
 
-			return;
-		}
-
-		// compute other stream lines.
-
-		int currentStreamGraphId = 0;
-		int currentStreamGraphVertexId = 0;
-
-		bool finished = false;
-
-
-		int numGraphs = streams.size();
-		int startGraph = 0;
-
+			// commit in the serial order. Seeds without a clear speculative stream are only integrated here for the first source, else the round ends.
+			bool firstSource = true;
 
+			while (streamCounter < streams.size() && checkSeedSource(streams, streamCounter, start_seedPoints, seedStreamsOnly, cursor))
+			{
+				zPointArray seeds;
+				getSourceSeedPoints(streams, start_seedPoints, cursor, fnInfluenceField, min_Power, max_Power, seeds);
 
+				bool speculated = true;
 
+				for (auto &seed : seeds)
+				{
+					if (!getCandidate(cursor, seed)) speculated = false;
+				}
 
-		while (!finished)
-		{
-			vector<zVector> seedPoints;
-			zFnGraph fnCurrentGraph(streams[currentStreamGraphId].graphObj);
-			
-			if (streams[currentStreamGraphId].isValid)
-			{				
-				
-				getSeedPoints_Influence(fnInfluenceField, streams[currentStreamGraphId], currentStreamGraphVertexId, min_Power, max_Power, seedPoints);
+				if (!speculated && !firstSource) break;
 
-				for (int i = 0; i < seedPoints.size(); i++)
+				for (int j = 0; j < seeds.size(); j++)
 				{
+					if (streamCounter >= streams.size()) break;
 
-					int id = streamCounter;
-					//streams.push_back(zStreamLine());
+					// checked again before each commit, as the stream of an earlier seed of the source may block it
+					zStreamCandidate *match = getCandidate(cursor, seeds[j]);
 
-					
-					bool chk = createStreamGraph_Influence(streams[id].graphObj, seedPoints[i], fnInfluenceField, min_Power, max_Power);
+					zPointArray positions;
+					zIntArray edgeConnects;
+					bool valid;
 
-					if (chk)
+					if (match)
 					{
-						streams[currentStreamGraphId].child.push_back(id);
-						streams[id].setParent(currentStreamGraphId);
+						valid = match->valid;
+						positions.swap(match->positions);
+						edgeConnects.swap(match->edgeConnects);
+					}
+					else valid = (fnInfluenceField) ? integrateStream_Influence(seeds[j], *fnInfluenceField, min_Power, max_Power, positions, edgeConnects) : integrateStream(seeds[j], positions, edgeConnects);
 
-						streams[id].isValid = true;
-						streamCounter++;
+					if (valid) commitStream(streams, streamCounter, cursor.first, positions, edgeConnects);
+				}
 
-						alternateGraph.push_back(!alternateGraph[currentStreamGraphId]);
+				candidates.erase(cursor);
 
-						alternate = !alternate;
-					}
-				}
+				cursor.second++;
+				firstSource = (roundSize == 0);
 			}
-			
-
-			currentStreamGraphVertexId++;
+		}
+	}
 
-			if (currentStreamGraphVertexId >= fnCurrentGraph.numVertices()) currentStreamGraphId++, currentStreamGraphVertexId = 0;
+	ZSPACE_INLINE bool zTsStreams2D::checkSeedSource(vector<zStreamLine>& streams, int streamCounter, vector<zVector> &start_seedPoints, bool seedStreamsOnly, zIntPair &source)
+	{
+		if (source.first == -1)
+		{
+			if (source.second < start_seedPoints.size()) return true;
+			if (seedStreamsOnly) return false;
 
-			if (currentStreamGraphId >= streams.size()) finished = true;
+			source = zIntPair(0, 0);
+		}
 
+		while (source.first < streamCounter)
+		{
+			zFnGraph fnGraph(streams[source.first].graphObj);
+			if (source.second < fnGraph.numVertices()) return true;
 
+			source.first++;
+			source.second = 0;
 		}
 
-		for (int i = 0; i < streamCounter; i++)
-		{
+		return false;
+	}
 
-			zFnGraph fnGraph(streams[i].graphObj);
-			zColor col = (alternateGraph[i]) ? zColor(1, 0, 0, 1) : zColor(0, 0, 1, 1);
+	ZSPACE_INLINE void zTsStreams2D::getSourceSeedPoints(vector<zStreamLine>& streams, vector<zVector> &start_seedPoints, zIntPair &source, zFnMeshField<zScalar> *fnInfluenceField, double min_Power, double max_Power, vector<zVector> &seedPoints)
+	{
+		if (source.first == -1) seedPoints.push_back(start_seedPoints[source.second]);
+		else if (fnInfluenceField) getSeedPoints_Influence(*fnInfluenceField, streams[source.first], source.second, min_Power, max_Power, seedPoints);
+		else getSeedPoints(streams[source.first], source.second, seedPoints);
+	}
 
-			fnGraph.setEdgeColor(col, true);
+	ZSPACE_INLINE void zTsStreams2D::commitStream(vector<zStreamLine>& streams, int &streamCounter, int parentId, vector<zVector> &positions, vector<int> &edgeConnects)
+	{
+		int id = streamCounter;
 
-		}
+		zFnGraph tempFn(streams[id].graphObj);
+		tempFn.create(positions, edgeConnects);
 
+		if (parentId != -1)
+		{
+			streams[parentId].child.push_back(id);
+			streams[id].setParent(parentId);
+		}
 
-		printf("\n %i streamLines created. ", streamCounter);
+		streams[id].isValid = true;
 
+		for (int i = 0; i < positions.size(); i++)
+		{
+			streamGrid.addPosition(positions[i], id);
+			addToFieldStreamPositions(positions[i]);
+		}
 
+		streamCounter++;
 	}
 
-	//---- PROTECTED METHODS
-
-	ZSPACE_INLINE bool zTsStreams2D::createStreamGraph(zObjGraph &streamGraphObj, zVector &seedPoint)
+	ZSPACE_INLINE bool zTsStreams2D::integrateStream(zVector &seedPoint, vector<zVector> &positions, vector<int> &edgeConnects)
 	{
+		positions.clear();
+		edgeConnects.clear();
 
-		vector<zVector> positions;
-		vector<int> edgeConnects;
+		// stream positions rounded to 3 decimals, to stop at repeated positions.
+		set<tuple<long long, long long, long long>> positionKeys;
+		auto positionKey = [](zVector &p) { return make_tuple(llround(p.x * 1000.0), llround(p.y * 1000.0), llround(p.z * 1000.0)); };
 
+		double streamLength = 0.0;
 
 		// move forward
 		if (streamType == zForward || streamType == zForwardBackward)
@@ -420,13 +446,8 @@ namespace zSpace
 
 			zFnParticle seedForward(p);
 
-			//zFnParticle seedForward;
-			//seedForward.create(startForward);
-
 			double currentLength = 0.0;
 
-			//printf("\n working!");
-
 			while (!exit)
 			{
 				bool firstVertex = (startForward == seedPoint) ? true : false;
@@ -435,20 +456,16 @@ namespace zSpace
 
 				if (firstVertex)
 				{
-
 					positions.push_back(curPos);
+					positionKeys.insert(positionKey(curPos));
 				}
 
 				// get field focrce
 				zVector fieldForce;
-				bool checkBounds = fnField.getFieldValue(curPos, zFieldNeighbourWeighted, fieldForce);
-
-
+				bool checkBounds = fnField.getFieldValue(curPos, zFieldLinear, fieldForce);
 
 				if (!checkBounds)
 				{
-					//printf("\n bounds working!");
-
 					exit = true;
 					continue;
 				}
@@ -456,8 +473,6 @@ namespace zSpace
 				// local minima or maxima point
 				if (fieldForce.length() == 0)
 				{
-					//printf("\n force working!");
-
 					exit = true;
 					continue;
 				}
@@ -481,53 +496,26 @@ namespace zSpace
 
 				if (!checkBounds)
 				{
-					//printf("\n bounds 2 working!");
-
-					//printf("\n %1.2f %1.2f %1.2f ", newPos.x, newPos.y, newPos.z);
-
 					exit = true;
 					continue;
-
-
-
 				}
 
-				int index = -1;
-				bool checkRepeat = coreUtils.checkRepeatElement(newPos, positions, index);
-				if (checkRepeat)
+				if (positionKeys.count(positionKey(newPos)) > 0)
 				{
-					//printf("\n repeat working!");
-
 					exit = true;
 					continue;
-
-
-
 				}
 
-
 				bool validStreamPoint = checkValidStreamPosition(newPos, *dTest);
 
-				if (!validStreamPoint)
-				{
-					exit = true;
-
-					//printf("\n validity working!");
-				}
+				if (!validStreamPoint) exit = true;
 
 				// check length
-				if (currentLength + curPos.distanceTo(newPos) > *maxLength)
-				{
-					exit = true;
-
-					//printf("\n length working!");
-				}
+				if (currentLength + curPos.distanceTo(newPos) > *maxLength) exit = true;
 
 				// add new stream point
 				if (!exit)
 				{
-
-
 					if (positions.size() > 0)
 					{
 						edgeConnects.push_back(positions.size());
@@ -535,17 +523,14 @@ namespace zSpace
 					}
 
 					positions.push_back(newPos);
+					positionKeys.insert(positionKey(newPos));
 
 					currentLength += curPos.distanceTo(newPos);
-
 				}
-
-
-
-
 			}
-		}
 
+			streamLength += currentLength;
+		}
 
 		if (streamType == zBackward || streamType == zForwardBackward)
 		{
@@ -559,36 +544,31 @@ namespace zSpace
 
 			zFnParticle seedBackward(p);
 
-			//zFnParticle seedBackward;
-			//seedBackward.create(startBackward);
-
-
 			double currentLength = 0.0;
 
 			while (!exit)
 			{
 				bool firstVertex = (startBackward == seedPoint) ? true : false;
 
-
 				zVector curPos = seedBackward.getPosition();
 
-
 				// insert first point if the stream is inly for backward direction.
 				if (firstVertex && streamType == zBackward)
 				{
 					positions.push_back(curPos);
+					positionKeys.insert(positionKey(curPos));
 				}
 
 				// get field focrce
 				zVector fieldForce;
-
-				bool checkBounds = fnField.getFieldValue(curPos, zFieldNeighbourWeighted, fieldForce);
+				bool checkBounds = fnField.getFieldValue(curPos, zFieldLinear, fieldForce);
 
 				if (!checkBounds)
 				{
 					exit = true;
 					continue;
 				}
+
 				// local minima or maxima point
 				if (fieldForce.length() == 0)
 				{
@@ -623,9 +603,7 @@ namespace zSpace
 					continue;
 				}
 
-				int index = -1;
-				bool checkRepeat = coreUtils.checkRepeatElement(newPos, positions, index);
-				if (checkRepeat)
+				if (positionKeys.count(positionKey(newPos)) > 0)
 				{
 					exit = true;
 					continue;
@@ -633,7 +611,6 @@ namespace zSpace
 
 				bool validStreamPoint = checkValidStreamPosition(newPos, *dTest);
 
-
 				if (!validStreamPoint) exit = true;
 
 				// check length
@@ -642,58 +619,27 @@ namespace zSpace
 				// add new stream point
 				if (!exit)
 				{
-
-
 					if (positions.size() > 0)
 					{
 						(firstVertex) ? edgeConnects.push_back(0) : edgeConnects.push_back(positions.size() - 1);
 						edgeConnects.push_back(positions.size());
-
 					}
 
 					positions.push_back(newPos);
+					positionKeys.insert(positionKey(newPos));
 
 					currentLength += curPos.distanceTo(newPos);
 				}
-
-			}
-		}
-
-
-		/*printf("\n v: %i e:%i ", positions.size(), edgeConnects.size());*/
-
-		// create stream graph
-		bool out = false;
-
-		if (edgeConnects.size() > 0)
-		{
-
-			zFnGraph tempFn(streamGraphObj);
-			tempFn.create(positions, edgeConnects);
-
-			vector<double> lengths;
-			double length = tempFn.getEdgeLengths(lengths);
-
-			if (length > *minLength)
-			{
-				for (int i = 0; i < positions.size(); i++)
-				{
-					addToFieldStreamPositions(positions[i]);
-
-				}
-
-				out = true;
 			}
 
+			streamLength += currentLength;
 		}
 
-
-
-		return out;
-
+		return (edgeConnects.size() > 0 && streamLength > *minLength);
 	}
 
 	ZSPACE_INLINE void zTsStreams2D::getSeedPoints(zStreamLine& currentStream, int vertexId, vector<zVector> &seedPoints)
+
 	{
 		zFnGraph tempFn(currentStream.graphObj);
 		if (tempFn.numEdges() == 0) return;
@@ -749,12 +695,16 @@ namespace zSpace
 
 	}
 
-	ZSPACE_INLINE bool zTsStreams2D::createStreamGraph_Influence(zObjGraph &streamGraphObj, zVector &seedPoint, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power)
+	ZSPACE_INLINE bool zTsStreams2D::integrateStream_Influence(zVector &seedPoint, zFnMeshField<zScalar>& fnInfluenceField, double min_Power, double max_Power, vector<zVector> &positions, vector<int> &edgeConnects)
 	{
+		positions.clear();
+		edgeConnects.clear();
 
-		vector<zVector> positions;
-		vector<int> edgeConnects;
+		// stream positions rounded to 3 decimals, to stop at repeated positions.
+		set<tuple<long long, long long, long long>> positionKeys;
+		auto positionKey = [](zVector &p) { return make_tuple(llround(p.x * 1000.0), llround(p.y * 1000.0), llround(p.z * 1000.0)); };
 
+		double streamLength = 0.0;
 
 		// move forward
 		if (streamType == zForward || streamType == zForwardBackward)
@@ -767,8 +717,6 @@ namespace zSpace
 			p.particle = zParticle(startForward);
 
 			zFnParticle seedForward (p);
-			//seedForward.create(startForward);
-
 
 			double currentLength = 0;
 
@@ -780,19 +728,16 @@ namespace zSpace
 
 				if (firstVertex)
 				{
-
 					positions.push_back(curPos);
+					positionKeys.insert(positionKey(curPos));
 				}
 
 				// get field focrce
 				zVector fieldForce;
-				bool checkBounds = fnField.getFieldValue(curPos, zFieldNeighbourWeighted, fieldForce);
-
-
+				bool checkBounds = fnField.getFieldValue(curPos, zFieldLinear, fieldForce);
 
 				if (!checkBounds)
 				{
-
 					exit = true;
 					continue;
 				}
@@ -800,22 +745,18 @@ namespace zSpace
 				// local minima or maxima point
 				if (fieldForce.length() == 0)
 				{
-
 					exit = true;
 					continue;
 				}
 
-
 				// get dSep
 				float influenceFieldValue;
-				fnInfluenceField.getFieldValue(curPos, zFieldNeighbourWeighted, influenceFieldValue);
+				fnInfluenceField.getFieldValue(curPos, zFieldLinear, influenceFieldValue);
 				double power = coreUtils.ofMap(influenceFieldValue, -1.0f, 1.0f, (float) min_Power,(float) max_Power);
 
 				double distSep = *dSep / pow(2, power);
 
-
 				// update particle force
-
 				zVector axis(0, 0, 1);
 
 				double rotateAngle = *angle;
@@ -836,72 +777,41 @@ namespace zSpace
 
 				if (!checkBounds)
 				{
-
 					exit = true;
 					continue;
-
-
 				}
 
-				if (exit) cout << "\n e t";
-				else cout << "\n e f";
-
-				int index = -1;
-				bool checkRepeat = coreUtils.checkRepeatElement(newPos, positions, index);
-
-				if (checkRepeat)
+				if (positionKeys.count(positionKey(newPos)) > 0)
 				{
-
 					exit = true;
 					continue;
-
-
 				}
 
-				if (exit) cout << "\n e t";
-				else cout << "\n e f";
-
 				bool validStreamPoint = checkValidStreamPosition(newPos, *dTest);
 
-				if (!validStreamPoint)
-				{
-
-					exit = true;
-				}
-
-				if (exit) cout << "\n e t";
-				else cout << "\n e f";
+				if (!validStreamPoint) exit = true;
 				
 				// check length
 				if (currentLength + curPos.distanceTo(newPos) > *maxLength *0.5)  exit = true;
 
-				if (exit) cout << "\n e t";
-				else cout << "\n e f";
-
 				// add new stream point
 				if (!exit)
 				{
-
-
 					if (positions.size() > 0)
 					{
 						edgeConnects.push_back(positions.size());
 						edgeConnects.push_back(positions.size() - 1);
-
-
 					}
 
 					positions.push_back(newPos);
+					positionKeys.insert(positionKey(newPos));
 
 					currentLength += curPos.distanceTo(newPos);
 				}
-
-
-
-
 			}
-		}
 
+			streamLength += currentLength;
+		}
 
 		if (streamType == zBackward || streamType == zForwardBackward)
 		{
@@ -914,7 +824,6 @@ namespace zSpace
 			p.particle = zParticle(startBackward);
 
 			zFnParticle seedBackward(p);
-			//seedBackward.create(startBackward);
 
 			double currentLength = 0.0;
 
@@ -922,26 +831,25 @@ namespace zSpace
 			{
 				bool firstVertex = (startBackward == seedPoint) ? true : false;
 
-
 				zVector curPos = seedBackward.getPosition();
 
-
 				// insert first point if the stream is inly for backward direction.
 				if (firstVertex && streamType == zBackward)
 				{
 					positions.push_back(curPos);
+					positionKeys.insert(positionKey(curPos));
 				}
 
 				// get field focrce
 				zVector fieldForce;
-
-				bool checkBounds = fnField.getFieldValue(curPos, zFieldNeighbourWeighted, fieldForce);
+				bool checkBounds = fnField.getFieldValue(curPos, zFieldLinear, fieldForce);
 
 				if (!checkBounds)
 				{
 					exit = true;
 					continue;
 				}
+
 				// local minima or maxima point
 				if (fieldForce.length() == 0)
 				{
@@ -951,13 +859,12 @@ namespace zSpace
 
 				// get dSep
 				float influenceFieldValue;
-				fnInfluenceField.getFieldValue(curPos, zFieldNeighbourWeighted, influenceFieldValue);
+				fnInfluenceField.getFieldValue(curPos, zFieldLinear, influenceFieldValue);
 				double power = coreUtils.ofMap(influenceFieldValue, -1.0f, 1.0f, (float) min_Power, (float) max_Power);
 
 				double distSep = *dSep / pow(2, power);
 
 				// update particle force
-
 				zVector axis(0, 0, 1);
 				fieldForce *= -1;
 
@@ -985,9 +892,7 @@ namespace zSpace
 					continue;
 				}
 
-				int index = -1;
-				bool checkRepeat = coreUtils.checkRepeatElement(newPos, positions, index);
-				if (checkRepeat)
+				if (positionKeys.count(positionKey(newPos)) > 0)
 				{
 					exit = true;
 					continue;
@@ -995,7 +900,6 @@ namespace zSpace
 
 				bool validStreamPoint = checkValidStreamPosition(newPos, *dTest);
 
-
 				if (!validStreamPoint) exit = true;
 
 				// check length
@@ -1004,58 +908,23 @@ namespace zSpace
 				// add new stream point
 				if (!exit)
 				{
-
-
 					if (positions.size() > 0)
 					{
 						(firstVertex) ? edgeConnects.push_back(0) : edgeConnects.push_back(positions.size() - 1);
 						edgeConnects.push_back(positions.size());
-
 					}
 
 					positions.push_back(newPos);
+					positionKeys.insert(positionKey(newPos));
 
 					currentLength += curPos.distanceTo(newPos);
 				}
-
-			}
-		}
-
-
-		printf("\n v: %i e:%i ", positions.size(), edgeConnects.size());
-
-		// create stream graph
-		bool out = false;
-		if (edgeConnects.size() > 0)
-		{
-
-
-			zFnGraph tempFn(streamGraphObj);
-			tempFn.create(positions, edgeConnects);
-
-			vector<double> lengths;
-			double length = tempFn.getEdgeLengths(lengths);
-
-			if (length > *minLength)
-			{
-				for (int i = 0; i < positions.size(); i++)
-				{
-					int curFieldIndex;
-					bool checkBounds = fnField.checkPositionBounds(positions[i], curFieldIndex);
-
-					if (checkBounds) fieldIndex_streamPositions[curFieldIndex].push_back(positions[i]);
-
-				}
-
-				out = true;
 			}
 
+			streamLength += currentLength;
 		}
 
-
-
-		return out;
-
+		return (edgeConnects.size() > 0 && streamLength > *minLength);
 	}
 
 	ZSPACE_INLINE void zTsStreams2D::getSeedPoints_Influence(zFnMeshField<zScalar>& fnInfluenceField, zStreamLine& currentStream, int vertexId, double min_Power, double max_Power, vector<zVector> &seedPoints)
@@ -1129,121 +998,150 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zTsStreams2D::checkValidStreamPosition(zVector &inPoint, double &dTest)
 	{
+		return streamGrid.checkClearance(inPoint, dTest);
+	}
 
+	ZSPACE_INLINE bool zTsStreams2D::checkValidSeedPosition(zVector &inPoint, double &dSep)
+	{
 		int newFieldIndex;
-		bool check = fnField.checkPositionBounds(inPoint, newFieldIndex);
+		bool checkBounds = fnField.checkPositionBounds(inPoint, newFieldIndex);
 
-		bool validStreamPoint = true;
+		if (!checkBounds) return false;
 
-		for (int j = 0; j < fieldIndex_streamPositions[newFieldIndex].size(); j++)
+		return streamGrid.checkClearance(inPoint, dSep);
+	}
+
+	ZSPACE_INLINE bool zTsStreams2D::checkStreamClearance(vector<zVector> &positions, int minStreamId)
+	{
+		// the seed is checked separately against the seperation distance.
+		for (int i = 1; i < positions.size(); i++)
 		{
-			zVector streamPoint = fieldIndex_streamPositions[newFieldIndex][j];
+			if (!streamGrid.checkClearance(positions[i], *dTest, minStreamId)) return false;
+		}
+
+		return true;
+	}
 
+	ZSPACE_INLINE void zTsStreams2D::createStreamGrid()
+	{
+		zVector minBB, maxBB;
+		fnField.getBoundingBox(minBB, maxBB);
 
-			double dist = streamPoint.distanceTo(inPoint);
+		double cellSize = std::max(*dSep, *dTest);
 
-			if (dist < dTest)
-			{
-				validStreamPoint = false;
-				break;
-			}
-		}
+		streamGrid.create(minBB, maxBB, cellSize);
+		seedGrid.create(minBB, maxBB, cellSize);
 
-		// check in neighbour if validStreamPoint is true
-		if (validStreamPoint)
+		// stream positions of earlier calls
+		for (auto &cellPositions : fieldIndex_streamPositions)
 		{
-			vector<int> ringNeighbours;
+			for (auto &pos : cellPositions) streamGrid.addPosition(pos, -1);
+		}
+	}
 
-			zItMeshVectorField s(*fnField.fieldObj, newFieldIndex);
+	ZSPACE_INLINE void zTsStreams2D::addToFieldStreamPositions(zVector &inPoint)
+	{
 
-			s.getNeighbour_Ring( 1, ringNeighbours);
+		int curFieldIndex;
+		bool checkBounds = fnField.checkPositionBounds(inPoint, curFieldIndex);
 
-			for (int i = 0; i < ringNeighbours.size(); i++)
-			{
-				if (ringNeighbours[i] == newFieldIndex) continue;
+		if (checkBounds) fieldIndex_streamPositions[curFieldIndex].push_back(inPoint);
+	}
+}
 
-				for (int j = 0; j < fieldIndex_streamPositions[ringNeighbours[i]].size(); j++)
-				{
-					zVector streamPoint = fieldIndex_streamPositions[ringNeighbours[i]][j];
+//---- zStreamGrid ------------------------------------------------------------------------------
 
-					double dist = streamPoint.distanceTo(inPoint);
+namespace zSpace
+{
 
-					if (dist < dTest)
-					{
-						validStreamPoint = false;
+	//---- CONSTRUCTOR
 
+	ZSPACE_INLINE zStreamGrid::zStreamGrid()
+	{
+		cellSize = 1.0;
+		n_X = 0;
+		n_Y = 0;
+	}
 
-						break;
-					}
-				}
+	//---- METHODS
 
-			}
-		}
+	ZSPACE_INLINE void zStreamGrid::create(zVector &_minBB, zVector &_maxBB, double _cellSize)
+	{
+		if (!(_cellSize > 0)) throw std::invalid_argument(" error: cell size needs to be greater than 0.");
+
+		minBB = _minBB;
+		cellSize = _cellSize;
 
-		return validStreamPoint;
+		n_X = std::max((int)floor((_maxBB.x - _minBB.x) / cellSize) + 1, 1);
+		n_Y = std::max((int)floor((_maxBB.y - _minBB.y) / cellSize) + 1, 1);
+
+		cells.clear();
+		cells.assign(n_X * n_Y, zIntArray());
+
+		occupiedCells.clear();
+		positions.clear();
+		streamIds.clear();
 	}
 
-	ZSPACE_INLINE bool zTsStreams2D::checkValidSeedPosition(zVector &inPoint, double &dSep)
+	ZSPACE_INLINE void zStreamGrid::clear()
 	{
+		for (int cellId : occupiedCells) cells[cellId].clear();
 
+		occupiedCells.clear();
+		positions.clear();
+		streamIds.clear();
+	}
 
-		int newFieldIndex;
-		bool checkBounds = fnField.checkPositionBounds(inPoint, newFieldIndex);
+	ZSPACE_INLINE void zStreamGrid::addPosition(zVector &inPoint, int streamId)
+	{
+		int cellId = getCellIndex(inPoint.x, inPoint.y);
 
-		if (!checkBounds) return false;
+		if (cells[cellId].size() == 0) occupiedCells.push_back(cellId);
+		cells[cellId].push_back(positions.size());
 
-		bool validSeedPoint = true;
+		positions.push_back(inPoint);
+		streamIds.push_back(streamId);
+	}
 
-		for (int j = 0; j < fieldIndex_streamPositions[newFieldIndex].size(); j++)
-		{
-			zVector streamPoint = fieldIndex_streamPositions[newFieldIndex][j];
+	ZSPACE_INLINE bool zStreamGrid::checkClearance(zVector &inPoint, double distance, int minStreamId)
+	{
+		if (cells.size() == 0) return true;
 
-			double dist = streamPoint.distanceTo(inPoint);
+		int minCell = getCellIndex(inPoint.x - distance, inPoint.y - distance);
+		int maxCell = getCellIndex(inPoint.x + distance, inPoint.y + distance);
 
-			if (dist < dSep)
-			{
-				validSeedPoint = false;
-				break;
-			}
-		}
+		double distanceSq = distance * distance;
 
-		// check in neighbour if validStreamPoint is true
-		if (validSeedPoint)
+		for (int idX = minCell / n_Y; idX <= maxCell / n_Y; idX++)
 		{
-			vector<int> ringNeighbours;
-
-			zItMeshVectorField s(*fnField.fieldObj, newFieldIndex);
-			s.getNeighbour_Ring( 1, ringNeighbours);
-
-			for (int i = 0; i < ringNeighbours.size(); i++)
+			for (int idY = minCell % n_Y; idY <= maxCell % n_Y; idY++)
 			{
-				if (ringNeighbours[i] == newFieldIndex) continue;
-
-				for (int j = 0; j < fieldIndex_streamPositions[ringNeighbours[i]].size(); j++)
+				for (int id : cells[idX * n_Y + idY])
 				{
-					zVector streamPoint = fieldIndex_streamPositions[ringNeighbours[i]][j];
+					if (streamIds[id] < minStreamId) continue;
 
-					double dist = streamPoint.distanceTo(inPoint);
+					double dX = positions[id].x - inPoint.x;
+					double dY = positions[id].y - inPoint.y;
+					double dZ = positions[id].z - inPoint.z;
 
-					if (dist < dSep)
-					{
-						validSeedPoint = false;
-						break;
-					}
+					if (dX * dX + dY * dY + dZ * dZ < distanceSq) return false;
 				}
-
 			}
 		}
 
-		return validSeedPoint;
+		return true;
 	}
 
-	ZSPACE_INLINE void zTsStreams2D::addToFieldStreamPositions(zVector &inPoint)
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE int zStreamGrid::getCellIndex(double x, double y)
 	{
+		double fX = (x - minBB.x) / cellSize;
+		double fY = (y - minBB.y) / cellSize;
 
-		int curFieldIndex;
-		bool checkBounds = fnField.checkPositionBounds(inPoint, curFieldIndex);
+		int idX = (fX > 0) ? (int)std::min(fX, (double)(n_X - 1)) : 0;
+		int idY = (fY > 0) ? (int)std::min(fY, (double)(n_Y - 1)) : 0;
 
-		if (checkBounds) fieldIndex_streamPositions[curFieldIndex].push_back(inPoint);
+		return idX * n_Y + idY;
 	}
-}
\ No newline at end of file
+}